@@ -453,6 +453,15 @@ bool trackingSyncInProgress() {
 void setDeltaTrackingRate() {
   double f1=0.0, f2=0.0;
 
+  // the encoder rate trim only holds while sidereal tracking carries on at the same rate and the encoders keep sending it,
+  // setTrackingRate() drops it too
+  static byte lastTrimTrackingState=TrackingNone;
+  static long lastTrimSiderealInterval=0;
+  if (trackingState != TrackingSidereal || trackingState != lastTrimTrackingState || siderealInterval != lastTrimSiderealInterval ||
+      (long)(millis()-trackingRateTrimTime) > TRACKING_RATE_TRIM_TIMEOUT) trackingRateTrimAxis1=0.0;
+  lastTrimTrackingState=trackingState;
+  lastTrimSiderealInterval=siderealInterval;
+
   if (trackingSyncInProgress()) {
     trackingSyncSeconds--;
     
@@ -485,7 +494,7 @@ void setDeltaTrackingRate() {
 #endif
   cli();
   // trackingTimerRateAxis1/2 are x the sidereal rate
-  if (trackingState == TrackingSidereal) trackingTimerRateAxis1=(_deltaAxis1/15.0)+f1; else trackingTimerRateAxis1=0.0;
+  if (trackingState == TrackingSidereal) trackingTimerRateAxis1=(_deltaAxis1/15.0)+trackingRateTrimAxis1+f1; else trackingTimerRateAxis1=0.0;
   if (trackingState == TrackingSidereal) trackingTimerRateAxis2=(_deltaAxis2/15.0)+f2; else trackingTimerRateAxis2=0.0;
   sei();
   fstepAxis1.fixed=doubleToFixed( ((axis1Settings.stepsPerMeasure/240.0)*(_deltaAxis1/15.0))/100.0 );
@@ -495,6 +504,7 @@ void setDeltaTrackingRate() {
 double _currentRate=1.0;
 void setTrackingRate(double r) {
   _currentRate=r;
+  trackingRateTrimAxis1=0.0;
 #if MOUNT_TYPE != ALTAZM
   _deltaAxis1=r*15.0;
   _deltaAxis2=0.0;
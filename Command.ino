@@ -898,6 +898,7 @@ void processCommands() {
               case '1': getEnc(&f,&f1); doubleToDms(reply,&f1,true,true,precision); boolReply=false; break; // Get formatted absolute Axis2 angle 
               case '2': getEnc(&f,&f1); dtostrf(f,0,6,reply); boolReply=false; break;                       // Get absolute Axis1 angle in degrees
               case '3': getEnc(&f,&f1); dtostrf(f1,0,6,reply); boolReply=false; break;                      // Get absolute Axis2 angle in degrees
+              case '4': dtostrf(trackingRateTrimAxis1,1,8,reply); boolReply=false; break;                   // Get Axis1 tracking rate trim
               case '9': cli(); dtostrf(trackingTimerRateAxis1,1,8,reply); sei(); boolReply=false; break;    // Get current tracking rate
               default:  commandError=CE_CMD_UNKNOWN;
             }
@@ -1229,6 +1230,78 @@ void processCommands() {
         if (Lib.firstFreeRec()) Lib.writeVars(name,i,origTargetRA,origTargetDec); else commandError=CE_LIBRARY_FULL;
       } else 
 
+// :Lr#       Get catalog record in hex format, with advance to next record
+//            Returns: x0x1..x15cc# (the sixteen record bytes followed by their one byte checksum, all in hex)
+//                     ,# when there are no more records in this catalog
+      if (command[1] == 'r' && parameter[0] == 0) {
+        libRec_t work;
+        if (Lib.readRawRec(&work)) {
+          char x[3]="  ";
+          b=0;
+          for (int l=0; l < rec_size; l++) { sprintf(x,"%02X",work.libRecBytes[l]); strcat(reply,x); b+=work.libRecBytes[l]; }
+          sprintf(x,"%02X",b); strcat(reply,x);
+        } else strcpy(reply,",");
+        boolReply=false;
+      } else 
+
+// :Lw[x]#    Write catalog record in hex format (as returned by :Lr#) to next available empty record
+//            Returns: 0 on failure (bad checksum or memory full, for example)
+//                     1 on success
+      if (command[1] == 'w') {
+        if (strlen(parameter) == rec_size*2+2) {
+          libRec_t work;
+          byte cks=0;
+          for (int l=0; l <= rec_size; l++) {
+            char x[3]={parameter[l*2],parameter[l*2+1],0};
+            b=strtol(x,&conv_end,16); if (conv_end != &x[2]) { commandError=CE_PARAM_FORM; break; }
+            if (l < rec_size) { work.libRecBytes[l]=b; cks+=b; } else if (b != cks) commandError=CE_PARAM_FORM;
+          }
+          if (commandError == CE_NONE && !Lib.writeRawRec(work)) commandError=CE_LIBRARY_FULL;
+        } else commandError=CE_PARAM_FORM;
+      } else 
+
+// :Lq[n]#    Find the n (1 to 8) objects in the current catalog nearest to the telescope position
+// :Lq[n],HH:MM:SS,sDD*MM:SS#
+//            Find the n (1 to 8) objects in the current catalog nearest to the given RA and Dec
+//            Returns: n# (number of objects found, get them in order of distance with :LQ#)
+      if (command[1] == 'q') {
+        char *parameter2=strchr(parameter,',');
+        char *parameter3=NULL;
+        if (parameter2) { parameter2[0]=0; parameter2++; parameter3=strchr(parameter2,','); }
+        if (atoi2(parameter,&i)) {
+          if (i >= 1 && i <= LIB_NEAREST_MAX) {
+            if (parameter2) {
+              if (parameter3) {
+                parameter3[0]=0; parameter3++;
+                if (!hmsToDouble(&f,parameter2) || !dmsToDouble(&f1,parameter3,true)) commandError=CE_PARAM_FORM; else f*=15.0;
+              } else commandError=CE_PARAM_FORM;
+            } else {
+              getEqu(&f,&f1,false);
+#if TELESCOPE_COORDINATES == TOPOCENTRIC
+              observedPlaceToTopocentric(&f,&f1);
+#endif
+            }
+            if (commandError == CE_NONE) sprintf(reply,"%d",Lib.findNearest(f,f1,i));
+          } else commandError=CE_PARAM_RANGE;
+        } else commandError=CE_PARAM_FORM;
+        boolReply=false;
+      } else 
+
+// :LQ#       Move to the next object found by :Lq# and set it as the current target object
+//            Returns: s# (string containing the object's name, type, and distance in degrees)
+//                     ,# when there are no more objects
+      if (command[1] == 'Q' && parameter[0] == 0) {
+        float d;
+        if (Lib.nextNearest(&d)) {
+          Lib.readVars(reply,&i,&origTargetRA,&origTargetDec);
+          char ws[12];
+          strcat(reply,",");
+          strcat(reply,objectStr[i]);
+          dtostrf(d,0,3,ws); strcat(reply,","); strcat(reply,ws);
+        } else strcpy(reply,",");
+        boolReply=false;
+      } else 
+
 // :LN#       Find next deep sky target object subject to the current constraints.
 //            Returns: Nothing
       if (command[1] == 'N' && parameter[0] == 0) { 
@@ -1847,6 +1920,10 @@ void processCommands() {
             case '3': // re-enable setting OnStep to Encoders after a Sync 
               syncToEncodersOnly=false;
               break;
+            case '4': // set Axis1 tracking rate trim, x the sidereal rate (+/-0.01 max) added with the next rate update, lapses after 10s
+              f=strtod(&parameter[3],&conv_end);
+              if (&parameter[3] != conv_end && fabs(f) <= 0.01) { trackingRateTrimAxis1=f; trackingRateTrimTime=millis(); } else commandError=CE_PARAM_RANGE;
+              break;
             default: commandError=CE_CMD_UNKNOWN;
           }
         } else
@@ -209,6 +209,10 @@
 #define AXIS5_LIMIT_MIN                 0 //      0, n. Where n=0..500 (millimeters.) Minimum allowed position.               Adjust
 #define AXIS5_LIMIT_MAX                50 //     50, n. Where n=0..500 (millimeters.) Maximum allowed position.               Adjust
 
+// OBJECT LIBRARY ------------------------------------------------------------------------------------------------------------------
+#define LIBRARY_COMPACT               OFF //    OFF, ON Variable length records hold about 60% more objects. Clear the        Option
+                                          //         library (:L!#) when switching, the record formats differ.
+
 // AUXILIARY FEATURE CONTROL ------------------------------ see https://onstep.groups.io/g/main/wiki/6-ConfigurationMaster#AUXILIARY
 // For additional infrequently used _PURPOSE options see Constants.h "various auxillary features"
 #define FEATURE_LIST_DS               OFF //    OFF, temporarily set ON to list ds18b20 and ds2413 device serial numbers.     Adjust
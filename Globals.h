@@ -118,6 +118,9 @@ unsigned long axis2StepsGoto            = 1;
 #define DefaultTrackingRate               1
 volatile double trackingTimerRateAxis1  = DefaultTrackingRate;
 volatile double trackingTimerRateAxis2  = DefaultTrackingRate;
+double trackingRateTrimAxis1            = 0.0;                 // Axis1 rate trim (x sidereal) from encoder closed loop tracking
+unsigned long trackingRateTrimTime      = 0;                   // millis() of the last trim, it lapses if the encoders stop sending
+#define TRACKING_RATE_TRIM_TIMEOUT        10000                // in ms, five encoder polls
 volatile double timerRateRatio = AXIS1_STEPS_PER_DEGREE/AXIS2_STEPS_PER_DEGREE;
 volatile bool useTimerRateRatio;
 long stepsPerWormRotationAxis1;
@@ -36,6 +36,10 @@
   #define FEATURE8_DEFAULT_VALUE OFF
 #endif
 
+#ifndef LIBRARY_COMPACT
+  #define LIBRARY_COMPACT OFF
+#endif
+
 #ifndef PIER_SIDE_PREFERRED_DEFAULT
   #define PIER_SIDE_PREFERRED_DEFAULT BEST
 #endif
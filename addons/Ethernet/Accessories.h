@@ -2,6 +2,16 @@
 // Misc functions to help with commands, etc.
 #pragma once
 
+// the encoder task shares the serial link to OnStep with the web server, whoever has it finishes first
+#ifdef ENC_TASK
+  SemaphoreHandle_t serialMutex=NULL;
+  void serialLock() { if (serialMutex) xSemaphoreTakeRecursive(serialMutex,portMAX_DELAY); }
+  void serialUnlock() { if (serialMutex) xSemaphoreGiveRecursive(serialMutex); }
+#else
+  #define serialLock()
+  #define serialUnlock()
+#endif
+
 // integer numeric conversion with error checking
 boolean atoi2(char *a, int *i) {
   char *conv_end;
@@ -14,7 +24,9 @@ boolean atoi2(char *a, int *i) {
 
 char serialRecvFlush() {
   char c=0;
+  serialLock();
   while (Ser.available()>0) c=Ser.read();
+  serialUnlock();
   return c;
 }
 
@@ -34,7 +46,7 @@ void clearSerialChannel() {
 }
 
 // smart LX200 aware command and response over serial
-boolean processCommand(const char cmd[], char response[], long timeOutMs) {
+boolean processCommandSerial(const char cmd[], char response[], long timeOutMs) {
   Ser.setTimeout(timeOutMs);
   
   // clear the read/write buffers
@@ -76,7 +88,7 @@ boolean processCommand(const char cmd[], char response[], long timeOutMs) {
     } else
     if (cmd[1]=='L') {
       if (strchr("BNCDL!",cmd[2])) noResponse=true;
-      if (strchr("o$W",cmd[2])) { shortResponse=true; if (timeOutMs < 1000) timeOutMs = 1000; }
+      if (strchr("o$Ww",cmd[2])) { shortResponse=true; if (timeOutMs < 1000) timeOutMs = 1000; }
     } else
     if (cmd[1]=='B') {
       if (strchr("+-",cmd[2])) noResponse=true;
@@ -134,6 +146,79 @@ boolean processCommand(const char cmd[], char response[], long timeOutMs) {
   }
 }
 
+// responses to get commands are cached so that any number of web pages and cmd channel clients cause at most one
+// serial command per time to live, sending anything that might change OnStep's state clears the cache
+#define RESPONSE_CACHE_SIZE 24
+
+typedef struct {
+  char cmd[16];
+  char response[40];
+  unsigned long time;
+} CachedResponse;
+
+CachedResponse responseCache[RESPONSE_CACHE_SIZE];
+
+void clearResponseCache() {
+  for (int i=0; i<RESPONSE_CACHE_SIZE; i++) responseCache[i].cmd[0]=0;
+}
+
+// reading the align model's star count or a star's pier side moves OnStep's star index
+bool movesAlignStar(const char cmd[]) {
+  return (cmd[1]=='G') && (cmd[2]=='X') && (cmd[3]=='0') && ((cmd[4]=='9') || (cmd[4]=='E'));
+}
+
+// commands that only read OnStep's state (gets, PEC readout, distance bars, PEC status, and debug echo) leave the cache alone
+bool isReadOnlyCommand(const char cmd[]) {
+  if ((cmd[0]!=':') && (cmd[0]!=';')) return true;
+  if (movesAlignStar(cmd)) return false;
+  if (strchr("GVD",cmd[1])) return true;
+  if ((cmd[1]=='E') && (cmd[2]=='C')) return true;
+  if ((cmd[1]=='$') && (cmd[2]=='Q') && (cmd[3]=='Z') && (cmd[4]=='?')) return true;
+  return false;
+}
+
+// time to live in ms for a command's response, 0 if it can't be cached
+unsigned long responseTTL(const char cmd[]) {
+  if ((cmd[0]!=':') || (cmd[1]!='G') || (strlen(cmd)>15)) return 0;
+  if ((cmd[2]=='X') && (cmd[3]=='0') && (cmd[4]>='9')) return 0;  // align model stars, these follow the star index
+  if (strchr("VtgGho",cmd[2])) return 5000;                       // version, site, and limits
+  if ((cmd[2]=='X') && (cmd[3]=='E')) return 5000;                // settings
+  return 250;                                                     // position, status, etc.
+}
+
+boolean processCommandCached(const char cmd[], char response[], long timeOutMs) {
+  unsigned long ttl=responseTTL(cmd);
+  if (ttl == 0) {
+    if (!isReadOnlyCommand(cmd)) clearResponseCache();
+    return processCommandSerial(cmd,response,timeOutMs);
+  }
+
+  // in the cache and still fresh?
+  int slot=0;
+  for (int i=0; i<RESPONSE_CACHE_SIZE; i++) {
+    if (strcmp(responseCache[i].cmd,cmd) == 0) {
+      if (millis()-responseCache[i].time < ttl) { strcpy(response,responseCache[i].response); return true; }
+      slot=i; break;
+    }
+    // otherwise replace an empty or the oldest entry
+    if ((responseCache[slot].cmd[0]!=0) && ((responseCache[i].cmd[0]==0) || ((long)(responseCache[i].time-responseCache[slot].time) < 0))) slot=i;
+  }
+
+  if (!processCommandSerial(cmd,response,timeOutMs)) { responseCache[slot].cmd[0]=0; return false; }
+  strcpy(responseCache[slot].cmd,cmd);
+  strncpy(responseCache[slot].response,response,39); responseCache[slot].response[39]=0;
+  responseCache[slot].time=millis();
+  return true;
+}
+
+// the cache goes with the serial link so both are held for the whole command
+boolean processCommand(const char cmd[], char response[], long timeOutMs) {
+  serialLock();
+  boolean success=processCommandCached(cmd,response,timeOutMs);
+  serialUnlock();
+  return success;
+}
+
 bool command(const char command[], char response[]) {
   bool success = processCommand(command,response,webTimeout);
   int l=strlen(response)-1; if (l >= 0 && response[l] == '#') response[l]=0;
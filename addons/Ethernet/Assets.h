@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------
+// Static web assets, gzip compressed
+// Generated by assets/make_assets.py from the files in assets/, edit those and run it rather than changing this file
+#pragma once
+
+typedef struct {
+  const char *uri;
+  const char *contentType;
+  const uint8_t *data;
+  unsigned int len;
+  const char *etag;
+} WebAsset;
+
+// main.css, 701 bytes compressed from 2215
+#define ASSET_MAIN_CSS_VER "0d95870e"
+const uint8_t asset_main_css[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x56,0x4d,0x8f,0x9b,0x30,
+  0x10,0xbd,0xef,0xaf,0xb0,0xb4,0x5a,0xed,0x25,0x44,0x06,0x42,0x92,0x92,0x53,0x7b,
+  0xe8,0xb1,0x87,0xaa,0xf7,0xca,0x60,0x27,0x58,0x31,0x36,0x02,0x27,0xd9,0x6d,0xb5,
+  0xff,0xbd,0x33,0x06,0x13,0x92,0x75,0xa2,0x55,0x5b,0x23,0x91,0x78,0x66,0x98,0x79,
+  0x7e,0xf3,0x01,0xf3,0x52,0x09,0xd6,0x92,0xdf,0xc4,0xfd,0xe6,0xa4,0x30,0xb6,0xda,
+  0x90,0xb7,0x87,0x39,0x03,0x59,0xc1,0xca,0xfd,0xae,0x35,0x07,0xcd,0xa3,0xd2,0x28,
+  0x03,0xea,0xc7,0xd8,0x2d,0x67,0x61,0xc1,0xa2,0x61,0x9c,0x4b,0xbd,0xcb,0x49,0x4c,
+  0x9b,0x97,0xfe,0x96,0xf8,0x7f,0x1b,0x72,0x92,0xdc,0x56,0x39,0x59,0x52,0xb7,0x2b,
+  0x4c,0xcb,0x05,0xf8,0xc8,0x40,0xdf,0x19,0x25,0x39,0x79,0xcc,0xb2,0xde,0x5b,0xcd,
+  0xda,0x9d,0xd4,0x39,0x49,0x50,0xe7,0x6e,0x74,0xf8,0xb3,0x21,0x3e,0xf2,0x27,0xb7,
+  0x36,0xf7,0x40,0xd5,0x52,0x47,0x43,0xcc,0x94,0x8a,0x1a,0x51,0x4a,0xdd,0x1c,0x10,
+  0xa8,0x15,0x2f,0x36,0x62,0x4a,0xee,0x74,0x5e,0x0a,0x6d,0x45,0xbb,0x39,0x63,0x4f,
+  0x30,0x8c,0x87,0x90,0xe2,0x66,0x6b,0xb4,0x8d,0x4e,0x42,0xee,0x2a,0x8b,0x94,0x28,
+  0xee,0xcf,0x92,0xa1,0xd7,0x00,0x82,0x2f,0x34,0x81,0x0b,0x48,0x29,0xae,0x49,0xf1,
+  0xe7,0x8e,0x94,0xd8,0xda,0xe0,0xe1,0x07,0x7d,0xdb,0x47,0xbb,0x6d,0x00,0xa9,0xb1,
+  0xa6,0xbe,0xcb,0x9f,0x67,0xed,0x7c,0xbb,0x4e,0xc2,0xbf,0xb1,0xd9,0x09,0x25,0x4a,
+  0xa4,0xb3,0x97,0x2f,0x50,0x1a,0xe0,0xea,0x26,0x41,0x97,0xa4,0xf7,0xc4,0x03,0x69,
+  0x25,0xd6,0xdf,0x95,0x61,0xc0,0xed,0xdb,0x43,0x15,0x5f,0xa6,0x92,0x38,0xd2,0x50,
+  0xc3,0xf2,0xca,0x1c,0x45,0x3b,0x23,0x2c,0x67,0xa5,0x95,0x47,0x11,0x2c,0xdf,0x56,
+  0x38,0x37,0xf3,0xd7,0x49,0xc0,0xaf,0xb0,0xe8,0xad,0x80,0x2c,0x57,0x52,0xef,0xd1,
+  0xeb,0x51,0x76,0xd2,0x0a,0x1e,0xee,0x8a,0x34,0x4d,0x60,0x9d,0xd9,0xfd,0x4c,0x57,
+  0x70,0x8d,0x25,0x1f,0x8f,0x19,0x73,0x00,0x46,0x0e,0xb2,0xb1,0x53,0x7c,0x02,0xb5,
+  0xd1,0x62,0x73,0x71,0x42,0x5f,0xad,0x4e,0xc6,0x45,0x69,0x5a,0x66,0xa5,0x19,0x4d,
+  0xb9,0xec,0x1a,0xc5,0x5e,0x73,0x22,0x35,0x20,0x15,0x51,0xa1,0x4c,0xb9,0x47,0xe4,
+  0xc5,0x01,0xaa,0x45,0xe7,0xa0,0x67,0x85,0xba,0x85,0x7b,0x95,0xa6,0x67,0xd0,0x14,
+  0x59,0xf0,0x0f,0x86,0xed,0xef,0x24,0xc7,0x57,0x31,0xe3,0xf2,0xd0,0xb9,0xa3,0x4d,
+  0xda,0x1a,0x37,0xe3,0xa9,0x17,0x70,0xea,0xf5,0x90,0xf9,0xc2,0xea,0xee,0x27,0x76,
+  0x06,0xc4,0xeb,0xad,0x87,0x3e,0x89,0xe2,0x49,0xeb,0x58,0xd3,0x38,0xf1,0xe8,0x7d,
+  0xda,0x57,0x7d,0x5b,0x04,0xf4,0xde,0x7d,0x2d,0x79,0xd8,0xfb,0x20,0x1a,0x1a,0xef,
+  0x3f,0x44,0x9c,0x3c,0xec,0x9c,0xde,0x7b,0x3a,0x60,0xe0,0x01,0x3b,0xd5,0x19,0xf2,
+  0x2d,0x7c,0x7f,0x1b,0x02,0x7b,0x68,0xab,0x0c,0x03,0x9f,0x78,0x84,0xf3,0x60,0x4e,
+  0x02,0xa3,0x27,0x30,0x1e,0xd6,0x78,0x85,0x8b,0xd4,0x27,0x3c,0xbb,0x48,0x78,0x3c,
+  0xdd,0x22,0xf4,0x61,0xca,0x02,0x98,0x1d,0xce,0xcb,0x50,0x39,0x39,0x51,0x27,0x7f,
+  0x09,0x7c,0x9c,0x3e,0x0d,0x82,0x2d,0xab,0xa5,0x82,0x62,0x7f,0xfe,0x21,0x6b,0xd1,
+  0x91,0x6f,0xe2,0x44,0xbe,0x9b,0x9a,0xe9,0xe7,0x19,0x71,0x92,0x19,0xe9,0x44,0x2b,
+  0xb7,0x93,0xa1,0x87,0x71,0xaa,0xc1,0x73,0x46,0x2f,0x60,0x8d,0x84,0x7c,0x04,0x03,
+  0xcd,0x9e,0x06,0xe3,0xea,0x23,0xd6,0x88,0xd8,0x87,0x4d,0xe6,0x71,0x3f,0x3d,0xe7,
+  0x40,0xa1,0x62,0x4d,0x27,0xa1,0x21,0xc3,0xfd,0x95,0x51,0xba,0xa6,0xeb,0x8b,0x29,
+  0x0d,0x9b,0x43,0xdb,0xe1,0xae,0x31,0xf2,0xea,0xc5,0xb5,0x9a,0xcc,0xf7,0x35,0x86,
+  0xf4,0x99,0x7c,0x3f,0x46,0xfa,0x4c,0x9b,0x83,0xc5,0x29,0xe1,0x0d,0xa6,0x90,0x17,
+  0x03,0x1b,0xfd,0xf4,0x9c,0x91,0x29,0xd8,0x7e,0xb6,0x86,0x21,0x2f,0x97,0xe3,0x07,
+  0x41,0x09,0xee,0xa0,0x10,0xa6,0x6f,0x40,0xf7,0x2d,0xe0,0x9a,0x7d,0x1c,0x54,0x7d,
+  0x68,0x74,0x08,0x45,0x78,0xca,0x49,0x25,0x39,0x17,0x3a,0x58,0x6a,0x29,0x8d,0x93,
+  0x38,0x41,0xdf,0x7f,0x00,0x0e,0x87,0x95,0x0d,0xa7,0x08,0x00,0x00,
+};
+
+// control.js, 344 bytes compressed from 792
+#define ASSET_CONTROL_JS_VER "c7063057"
+const uint8_t asset_control_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x52,0x4d,0x53,0xc2,0x30,
+  0x10,0xbd,0xf3,0x2b,0x72,0x32,0x29,0x2d,0x9d,0xf6,0xe2,0x85,0x61,0x1c,0x1d,0x41,
+  0x9c,0x91,0x71,0x06,0x38,0xe8,0x31,0x43,0xb6,0xb4,0x5a,0x12,0x6c,0x36,0x15,0x64,
+  0xfc,0xef,0x26,0x14,0x68,0x2d,0xa3,0xdc,0xf6,0xe3,0xbd,0xdd,0xb7,0x2f,0x49,0x8c,
+  0x5c,0x60,0xa6,0x24,0xd1,0xec,0x1d,0xb6,0x41,0x19,0x7b,0x64,0xd7,0x21,0xa4,0xe4,
+  0x05,0xd9,0xa4,0x88,0x6b,0x32,0x20,0x12,0x3e,0xc9,0xcb,0xe4,0x69,0x6c,0xb3,0x29,
+  0x7c,0x18,0xd0,0xc8,0xbc,0xbe,0xc5,0xec,0xfb,0xa1,0x5a,0x83,0x64,0xf4,0x61,0x38,
+  0xa7,0x01,0xa1,0x0b,0x25,0xb1,0x50,0xf9,0x6d,0x88,0x1b,0xbc,0xa1,0xbe,0x9d,0xe8,
+  0xd3,0x01,0xf5,0xcb,0xd8,0xa7,0x57,0x1b,0x1b,0xb8,0x51,0xf7,0x1c,0x81,0x79,0xe1,
+  0x12,0x70,0x9e,0xad,0x6c,0x14,0x10,0x2c,0x0c,0x34,0x26,0x6a,0x90,0xc2,0x6d,0xf8,
+  0xee,0x24,0x47,0x71,0x4b,0x66,0x85,0xed,0x34,0xa3,0xa2,0xa0,0x4e,0x63,0xbf,0xd9,
+  0x4b,0xda,0x4d,0x6e,0x50,0x8d,0xb8,0xc6,0xa9,0x91,0xec,0x17,0x54,0x27,0xc7,0x23,
+  0x77,0xa7,0x73,0xcf,0xd0,0x35,0x7c,0x06,0xe8,0xc4,0x56,0x32,0x4f,0xb6,0x88,0xf8,
+  0xe0,0x49,0x75,0x48,0xff,0x50,0x7e,0xe3,0xb2,0x59,0x17,0xb1,0xbb,0x70,0x64,0xf2,
+  0xfc,0x15,0x78,0xe1,0xae,0x8c,0x02,0x12,0x9f,0xd0,0xe2,0x1c,0x5b,0xad,0xe9,0x31,
+  0x3b,0xe8,0x98,0x7e,0x29,0x09,0xcf,0x49,0xa2,0xc1,0x3a,0xde,0xab,0x51,0xcd,0xb2,
+  0xd7,0xbd,0x8e,0xba,0x71,0x14,0x45,0xfb,0xd1,0x42,0x2d,0xcc,0x0a,0x24,0x3a,0xe4,
+  0x30,0x07,0x17,0xde,0x6d,0x1f,0x85,0xb5,0x46,0x50,0x2f,0x2c,0x79,0x6e,0xc0,0x2e,
+  0x16,0xae,0x5d,0xab,0xff,0x9b,0xb4,0x6a,0x93,0x26,0xf6,0x7d,0xd3,0x4b,0xac,0x6d,
+  0x9b,0x55,0xbb,0xf0,0x2f,0x11,0xd3,0x36,0x71,0xac,0x4c,0xa1,0x2f,0xb1,0xce,0x45,
+  0x66,0xd2,0x20,0x5c,0xe4,0xe9,0x36,0x6f,0x06,0xf6,0xfb,0x0a,0x5d,0x7d,0xbd,0x1f,
+  0x57,0x30,0x06,0xc7,0x18,0x03,0x00,0x00,
+};
+
+// the pages link these with ?v=<version> so the browser can cache them until the firmware changes
+#define WEB_ASSET_COUNT 2
+const WebAsset webAssets[WEB_ASSET_COUNT] = {
+  { "/main.css", "text/css", asset_main_css, sizeof(asset_main_css), "\"0d95870e\"" },
+  { "/control.js", "application/javascript", asset_control_js, sizeof(asset_control_js), "\"c7063057\"" },
+};
@@ -48,30 +48,13 @@ void handleAux() {
 
   processAuxGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
   
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  sendHtml(data);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_control1);
-  data += FPSTR(html_main_css_control2);
-  data += FPSTR(html_main_css_control3);
-  data += FPSTR(html_main_css_btns1);
-  sendHtml(data);
-  data += FPSTR(html_main_css_btns2);
-  data += FPSTR(html_main_css_btns3);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -85,7 +68,6 @@ void handleAux() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -93,10 +75,9 @@ void handleAux() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   // ajax scripts
   data += FPSTR(html_auxScript1);
@@ -104,7 +85,6 @@ void handleAux() {
   // active ajax page is: auxAjax();
   data +="<script>var ajaxPage='auxiliary.txt';</script>\n";
   data +=FPSTR(html_ajax_active);
-  sendHtml(data);
 
   // Auxiliary Features --------------------------------------
   int j = 0;
@@ -126,7 +106,6 @@ void handleAux() {
         sprintf_P(temp1,html_auxOffSwitch,i+1,i+1); data += temp1;
         data += F("</div><div style='float: left; width: 4em; height: 2em; line-height: 2em'>");
         data += "</div>\r\n";
-        sendHtml(data);
         j++;
       } else
       if (mountStatus.featurePurpose() == ANALOG_OUTPUT) {
@@ -141,7 +120,6 @@ void handleAux() {
         sprintf(temp1,"<span id='x%dv1'>%d</span>%%",i+1,(int)lround((mountStatus.featureValue1()/255.0)*100.0));
         data += temp1;
         data += "</div>\r\n";
-        sendHtml(data);
         j++;
       } else
       if (mountStatus.featurePurpose() == DEW_HEATER) {
@@ -181,7 +159,6 @@ void handleAux() {
         data += temp1;
         data += "</div>\r\n";
 
-        sendHtml(data);
         j++;
       } else
       if (mountStatus.featurePurpose() == INTERVALOMETER) {
@@ -240,7 +217,6 @@ void handleAux() {
         data += temp1;
         data += "</div>\r\n";
 
-        sendHtml(data);
         j++;
       }
     }
@@ -252,7 +228,6 @@ void handleAux() {
   
   data += "</div></body></html>";
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -24,6 +24,9 @@
 #define DEFAULT_FAST_AJAX_RATE "1"   // fast update is 1 second/update
 #define DEFAULT_AJAX_SHED_TIME "15"  // time before return to normal update rate
 
+#define WEBSOCKET_PORT 81            // status pushed to the Control and Status pages
+#define WEBSOCKET_PORT_STR "81"
+
 // various auxillary features
 #define SWITCH 1
 #define ANALOG_OUTPUT 2
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------------------
+// Kalman filter estimate of the RA rate from encoder tick times
+
+// state is position (arc-seconds,) rate (arc-seconds/second) and the cos/sin amplitudes (arc-seconds) of a periodic
+// error at the worm period, each tick is a measurement of position quantized to one encoder tick
+class EncKalman {
+  public:
+    // tau is the correction time constant in seconds, period the worm period in seconds (0 if unknown)
+    void init(float arcsecPerTick, float tau, float period) {
+      _arcsecPerTick=arcsecPerTick;
+      _r=arcsecPerTick*arcsecPerTick/12.0;
+      _tau4=tau*tau*tau*tau;
+      _period=period;
+      reset(15.041);
+    }
+
+    // start over at the given rate in arc-seconds/second, the periodic error is forgotten too since a slew moves the worm
+    void reset(float rate) {
+      for (int i=0; i<4; i++) { _x[i]=0; for (int j=0; j<4; j++) _P[i][j]=0; }
+      _x[1]=rate;
+      _P[0][0]=_r;
+      _P[1][1]=0.0225;  // (1% of sidereal)^2
+      if (_period > 0) { _P[2][2]=25.0*_r; _P[3][3]=25.0*_r; }
+      _phase=0;
+      _started=false;
+    }
+
+    void update(uint32_t us, uint32_t ticks) {
+      if (!_started) { _lastUs=us; _refTicks=ticks; _started=true; return; }
+      float dt=(float)(us-_lastUs)/1000000.0; _lastUs=us;
+      if (dt <= 0) return;
+
+      // predict, position moves at the rate and the rate wanders with white acceleration q sized so the
+      // filter settles in about tau seconds
+      _x[0]+=_x[1]*dt;
+      for (int j=0; j<4; j++) _P[0][j]+=dt*_P[1][j];
+      for (int i=0; i<4; i++) _P[i][0]+=dt*_P[i][1];
+      float q=_r*dt/_tau4;
+      _P[0][0]+=q*dt*dt*dt/3.0; _P[0][1]+=q*dt*dt/2.0; _P[1][0]+=q*dt*dt/2.0; _P[1][1]+=q*dt;
+      float h[4]={1.0,0.0,0.0,0.0};
+      if (_period > 0) {
+        _phase+=6.2831853*dt/_period; if (_phase > 6.2831853) _phase-=6.2831853;
+        _P[2][2]+=_r*dt/_period; _P[3][3]+=_r*dt/_period;
+        h[2]=cos(_phase); h[3]=sin(_phase);
+      }
+
+      // correct with the measured position
+      float Ph[4];
+      for (int i=0; i<4; i++) { Ph[i]=0; for (int j=0; j<4; j++) Ph[i]+=_P[i][j]*h[j]; }
+      float s=_r, y=(float)(ticks-_refTicks)*_arcsecPerTick;
+      for (int i=0; i<4; i++) { s+=h[i]*Ph[i]; y-=h[i]*_x[i]; }
+      for (int i=0; i<4; i++) _x[i]+=Ph[i]/s*y;
+      for (int i=0; i<4; i++) for (int j=0; j<4; j++) _P[i][j]-=Ph[i]*Ph[j]/s;
+
+      // keep the position small so floats don't lose resolution
+      if (ticks-_refTicks > 1000) { _x[0]-=(float)(ticks-_refTicks)*_arcsecPerTick; _refTicks=ticks; }
+    }
+
+    // rate in arc-seconds/second, with and without the periodic error
+    float rate() {
+      if (_period <= 0) return _x[1];
+      return _x[1]+(6.2831853/_period)*(-_x[2]*sin(_phase)+_x[3]*cos(_phase));
+    }
+    float meanRate() { return _x[1]; }
+
+  private:
+    float _x[4];
+    float _P[4][4];
+    float _r=1.0;
+    float _tau4=1.0;
+    float _period=0;
+    float _phase=0;
+    float _arcsecPerTick=1.0;
+    uint32_t _lastUs=0;
+    uint32_t _refTicks=0;
+    bool _started=false;
+};
@@ -79,6 +79,7 @@
 #include "EEProm.h"
 
 #include "Locale.h"
+#include "Assets.h"
 #include "Globals.h"
 
 #include "CmdServer.h"
@@ -103,9 +104,8 @@ int cmdTimeout=TIMEOUT_CMD;
 #endif
 
 // macros to help with sending webpage data
-#define sendHtmlStart()
-#define sendHtml(x) client->print(x); x=""
-#define sendHtmlDone(x) client->print(x); x=""
+#define sendHtmlStart(x) x.begin(client)
+#define sendHtmlDone(x) x.done()
 
 WebServer server;
 CmdServer cmdSvr;
@@ -118,6 +118,9 @@ void handleNotFound(EthernetClient *client) {
 
 #include "Accessories.h"
 #include "MountStatus.h"
+#include "HtmlWriter.h"
+#include "WebSocket.h"
+WebSocketServer wsSvr;
 
 void setup(void){
   long serial_baud = SERIAL_BAUD;
@@ -240,6 +243,9 @@ Again:
   server.on("/enc.htm", handleEncoders);
   server.on("/encA.txt", encAjaxGet);
   server.on("/enc.txt", encAjax);
+#ifdef ENC_HAS_CAPTURE
+  server.on("/encCap.csv", encCaptureAjax);
+#endif
 #endif
   server.on("/library.htm", handleLibrary);
   server.on("/libraryA.txt", libraryAjaxGet);
@@ -252,6 +258,7 @@ Again:
   server.on("/auxiliary.txt", auxAjax);
   server.on("/pec.htm", handlePec);
   server.on("/pec.txt", pecAjax);
+  for (int i=0; i<WEB_ASSET_COUNT; i++) server.on(webAssets[i].uri,&webAssets[i]);
   server.on("/", handleRoot);
 
   server.onNotFound(handleNotFound);
@@ -259,6 +266,9 @@ Again:
   // Initialize the cmd server, timeout after 500ms
   VLF("WEM: Starting port 9999 cmd svr");
   cmdSvr.init(9999,500);
+
+  VLF("WEM: Starting port 81 websocket svr");
+  wsSvr.init(WEBSOCKET_PORT);
   
   // allow time for the background servers to come up
   delay(2000);
@@ -278,9 +288,17 @@ void loop(void){
   server.handleClient();
   cmdSvr.handleClient();
 #if ENCODERS == ON
+  #ifdef ENC_TASK
+  encoders.applyWrites();
+  #else
   encoders.poll();
+  #endif
 #endif
 
+  // push status changes to the web pages
+  wsSvr.poll();
+  webSocketPush();
+
   // check clients for data, if found get the command, send cmd and pickup the response, then return the response
   static char cmdBuffer[40]="";
   static int cmdBufferPos=0;
@@ -309,6 +327,10 @@ const char* HighSpeedCommsStr(long baud) {
 void idle() {
   server.handleClient();
 #if ENCODERS == ON
+  #ifdef ENC_TASK
+  encoders.applyWrites();
+  #else
   encoders.poll();
+  #endif
 #endif
 }
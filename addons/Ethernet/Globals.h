@@ -45,28 +45,13 @@ const char html_headB[] PROGMEM = "<!DOCTYPE HTML>\r\n"
                                   "<meta charset='utf-8'/>\r\n"
                                   "<meta name=\"viewport\" content=\"width=device-width,initial-scale=1\">\r\n";
 const char html_headerPec[] PROGMEM = "<meta http-equiv=\"refresh\" content=\"5; URL=/pec.htm\">\r\n";
-const char html_headerIdx[] PROGMEM = "<meta http-equiv=\"refresh\" content=\"5; URL=/index.htm\">\r\n";
+// reload every 5 seconds, relaxed to 30 seconds once the WebSocket is keeping the values current
+const char html_headerIdx[] PROGMEM = "<script>var idxReload=setTimeout(function(){location.href='/index.htm';},5000);</script>\r\n";
 const char html_headE[] PROGMEM = "</head>\r\n";
 const char html_bodyB[] PROGMEM = "<body bgcolor='#26262A'>\r\n";
 
-const char html_main_cssB[] PROGMEM = "<STYLE>";
-const char html_main_css1[] PROGMEM = ".clear { clear: both; } .a { background-color: #111111; } .t { padding: 10px 10px 20px 10px; width: 600px; border: 5px solid #551111; margin: 25px 25px 0px 25px;";
-const char html_main_css2[] PROGMEM = "color: #999999; background-color: #111111; min-width: 30em; } input { text-align:center; padding: 2px; margin: 3px; font-weight: bold; width:5em; background-color: #B02020}";
-const char html_main_css3[] PROGMEM = ".b { padding: 10px; border-left: 5px solid #551111; border-right: 5px solid #551111; border-bottom: 5px solid #551111; margin: 0px 25px 25px 25px; width: 600px; color: #999999;";
-const char html_main_css4[] PROGMEM = "background-color: #111111; min-width: 30em; } select { width:4em; font-weight: bold; background-color: #B02020; padding: 2px 2px; } .c { color: #B02020; font-weight: bold; }";
-const char html_main_css5[] PROGMEM = "h1 { text-align: right; } a:hover, a:active { background-color: red; } .y { color: #FFFF00; font-weight: bold; }";
-const char html_main_css6[] PROGMEM = "a:link, a:visited { background-color: #332222; color: #A07070; border:1px solid red; padding: 5px 10px;";
-const char html_main_css7[] PROGMEM = " margin: none; text-align: center; text-decoration: none; display: inline-block; }";
-const char html_main_css8[] PROGMEM = "button:disabled { background-color: #733; color: #000; } button { background-color: #B02020; font-weight: bold; border-radius: 5px; margin: 2px; padding: 4px 8px; }";
-const char html_main_css_btns1[] PROGMEM = ".btns_left { margin-left: -1px; border-top-left-radius: 0px; border-bottom-left-radius: 0px; }";
-const char html_main_css_btns2[] PROGMEM = ".btns_mid { margin-left: -1px; margin-right: -1px; border-top-left-radius: 0px; border-bottom-left-radius: 0px; border-top-right-radius: 0px; border-bottom-right-radius: 0px; }";
-const char html_main_css_btns3[] PROGMEM = ".btns_right { margin-right: -1px; border-top-right-radius: 0px; border-bottom-right-radius: 0px; }";
-const char html_main_css_control1[] PROGMEM = ".b1 { float: left; border: 2px solid #551111; background-color: #181818; text-align: center; margin: 5px; padding: 15px; padding-top: 3px; }";
-const char html_main_css_control2[] PROGMEM = ".gb {  font-weight: bold; font-size: 150%; font-family: 'Times New Roman', Times, serif; width: 60px; height: 50px; padding: 0px; }";
-const char html_main_css_control3[] PROGMEM = ".bb {  font-weight: bold; font-size: 105%; } .bbh {  font-weight: bold; font-size: 100%; height: 2.1em; }";
-const char html_main_css_collapse1[] PROGMEM = ".collapsible { background-color: #500808; color: #999; cursor: pointer; padding: 7px; width: 80%; border: none; text-align: left; outline: none; font-size: 14px; }";
-const char html_main_css_collapse2[] PROGMEM = ".active, .collapsible:hover { background-color: #661111; } .content { padding: 0px 18px; display: none; overflow: hidden; background-color: #301212; }";
-const char html_main_cssE[] PROGMEM = "</STYLE>";
+// the stylesheet is in assets/main.css and served pre-compressed, the version changes with its content so browsers can keep it cached
+const char html_main_css[] PROGMEM = "<link rel='stylesheet' href='/main.css?v=" ASSET_MAIN_CSS_VER "'>\r\n";
 
 const char html_bad_comms_message[] PROGMEM =
   "<br /><bigger><font class=\"y\">" L_DOWN_TITLE "</font></bigger><br /><br />"
@@ -123,8 +108,15 @@ const char html_collapseScript[] PROGMEM =
 
 // Javascript for Ajax
 // be sure to define "var ajaxPage='control.txt';" etc.
+// optionally define "var wsPage='control';" to have changes pushed over the WebSocket, polling resumes if it closes
 const char html_ajax_active[] PROGMEM =
 "<script>\n"
+"var ws=null;\n"
+"if (typeof wsPage!='undefined'&&typeof WebSocket!='undefined') {\n"
+  "ws=new WebSocket('ws://'+location.hostname+':" WEBSOCKET_PORT_STR "/'+wsPage);\n"
+  "ws.onmessage=function(e){applyLines(e.data);};\n"
+  "ws.onopen=function(){if (typeof wsOpen=='function') wsOpen();};\n"
+"}\n"
 "var auto1Tick=-1;\n"
 "var auto2Tick=0;\n"
 "var auto2Rate=" DEFAULT_AJAX_RATE ";\n"
@@ -139,6 +131,7 @@ const char html_ajax_active[] PROGMEM =
   "var i;\n"
   "if (auto2Tick>=0) auto2Tick--;\n"
   "if (auto2Tick==0) auto2Rate=" DEFAULT_AJAX_RATE ";\n"
+  "if (ajaxPage==''||(ws!=null&&ws.readyState==1)) return;\n"
   "if (auto1Tick%auto2Rate==0) {\n"
     "nocache='?nocache='+Math.random()*1000000;\n"
     "var request = new XMLHttpRequest();\n"
@@ -148,21 +141,22 @@ const char html_ajax_active[] PROGMEM =
 "}\n"
 "function pageReady(aPage) {\n"
   "return function() {\n"
-    "if ((this.readyState==4)&&(this.status==200)) {\n"
-      "lines=this.responseText.split('\\n');\n"
-      "for (var i=0; i<lines.length; i++) {\n"
-        "j=lines[i].indexOf('|');m=0;\n"
-        "if (j==-1) {j=lines[i].indexOf('&');m=1;}\n"
-        "v=lines[i].slice(j+1);\n"
-        "k=lines[i].slice(0,j);\n"
-        "if (k!=''&&document.getElementById(k)!=null) {"
-        " if (m==1) document.getElementById(k).value=v; else "
-        " if (v=='disabled') document.getElementById(k).disabled=true; else"
-        " if (v=='enabled') document.getElementById(k).disabled=false; else"
-        " document.getElementById(k).innerHTML=v;"
-        "}\n"
-      "}\n"
-    "}"
+    "if ((this.readyState==4)&&(this.status==200)) applyLines(this.responseText);\n"
   "}"
 "}\n"
+"function applyLines(text) {\n"
+  "lines=text.split('\\n');\n"
+  "for (var i=0; i<lines.length; i++) {\n"
+    "j=lines[i].indexOf('|');m=0;\n"
+    "if (j==-1) {j=lines[i].indexOf('&');m=1;}\n"
+    "v=lines[i].slice(j+1);\n"
+    "k=lines[i].slice(0,j);\n"
+    "if (k!=''&&document.getElementById(k)!=null) {"
+    " if (m==1) document.getElementById(k).value=v; else "
+    " if (v=='disabled') document.getElementById(k).disabled=true; else"
+    " if (v=='enabled') document.getElementById(k).disabled=false; else"
+    " document.getElementById(k).innerHTML=v;"
+    "}\n"
+  "}\n"
+"}\n"
 "</script>\n";
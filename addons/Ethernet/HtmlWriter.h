@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------------
+// Web page output, fragments are copied into a fixed buffer and sent as a chunk each time it fills so pages never sit on the heap
+#pragma once
+
+#ifdef OETHS
+  #define HTML_CHUNK_SIZE 256
+#else
+  #define HTML_CHUNK_SIZE 1024
+#endif
+
+class HtmlWriter {
+  public:
+#ifdef OETHS
+    void begin(EthernetClient *client);
+#else
+    void begin(const char *type="text/html");
+#endif
+    void done();
+
+    HtmlWriter& operator+=(const char *s) { write(s,strlen(s),false); return *this; }
+    HtmlWriter& operator+=(const __FlashStringHelper *s) { write((const char*)s,strlen_P((const char*)s),true); return *this; }
+    HtmlWriter& operator+=(const String &s) { write(s.c_str(),s.length(),false); return *this; }
+    HtmlWriter& operator+=(char c) { write(&c,1,false); return *this; }
+
+  private:
+    void write(const char *s, size_t len, bool progmem);
+    void flush();
+
+#ifdef OETHS
+    EthernetClient *client=NULL;
+#else
+    const char *contentType="text/html";
+#endif
+    size_t bufferLen=0;
+    unsigned long startTime=0;
+    unsigned long bytesSent=0;
+#if DEBUG == VERBOSE && (defined(ESP8266) || defined(ESP32))
+    // free heap when the page started and the lowest seen at each chunk while it was generated
+    unsigned long heapBefore=0;
+    unsigned long heapLow=0;
+#endif
+#if !defined(OETHS) && defined(LEGACY_TRANSMIT_ON)
+    String page;
+#endif
+    // one page is generated at a time so the writers share a buffer, which keeps it off the (small) stack
+    static char buffer[HTML_CHUNK_SIZE+1];
+};
+
+char HtmlWriter::buffer[HTML_CHUNK_SIZE+1];
+
+#ifdef OETHS
+void HtmlWriter::begin(EthernetClient *c) {
+  client=c;
+#else
+void HtmlWriter::begin(const char *type) {
+  contentType=type;
+  #ifndef LEGACY_TRANSMIT_ON
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Cache-Control","no-cache");
+    server.send(200, contentType, String());
+  #endif
+#endif
+  bufferLen=0;
+  bytesSent=0;
+  startTime=millis();
+#if DEBUG == VERBOSE && (defined(ESP8266) || defined(ESP32))
+  heapBefore=ESP.getFreeHeap();
+  heapLow=heapBefore;
+#endif
+}
+
+void HtmlWriter::write(const char *s, size_t len, bool progmem) {
+  while (len>0) {
+    size_t n=HTML_CHUNK_SIZE-bufferLen; if (n>len) n=len;
+    if (progmem) memcpy_P(&buffer[bufferLen],s,n); else memcpy(&buffer[bufferLen],s,n);
+    bufferLen+=n; s+=n; len-=n;
+    if (bufferLen==HTML_CHUNK_SIZE) flush();
+  }
+}
+
+void HtmlWriter::flush() {
+  if (bufferLen==0) return;
+#ifdef OETHS
+  client->write((const uint8_t*)buffer,bufferLen);
+#elif defined(LEGACY_TRANSMIT_ON)
+  // the page goes out in one piece with its length in the header, so it has to be collected first
+  buffer[bufferLen]=0;
+  page += buffer;
+#else
+  server.sendContent(buffer,bufferLen);
+#endif
+  bytesSent+=bufferLen;
+  bufferLen=0;
+#if DEBUG == VERBOSE && (defined(ESP8266) || defined(ESP32))
+  unsigned long heap=ESP.getFreeHeap(); if (heap<heapLow) heapLow=heap;
+#endif
+}
+
+void HtmlWriter::done() {
+  flush();
+#ifndef OETHS
+  #ifdef LEGACY_TRANSMIT_ON
+    server.send(200, contentType, page);
+    page="";
+  #else
+    server.sendContent("");
+  #endif
+#endif
+
+#if DEBUG == VERBOSE
+  char s[120];
+  #if defined(ESP32)
+    // the low-water mark since boot catches anything the server allocated between chunks
+    sprintf(s,"WEM: Page %lu bytes in %lums, heap %lu before, %lu low, %lu low since boot",bytesSent,millis()-startTime,
+      heapBefore,heapLow,(unsigned long)ESP.getMinFreeHeap());
+  #elif defined(ESP8266)
+    sprintf(s,"WEM: Page %lu bytes in %lums, heap %lu before, %lu low, largest block %lu, %u%% fragmented",bytesSent,millis()-startTime,
+      heapBefore,heapLow,(unsigned long)ESP.getMaxFreeBlockSize(),(unsigned)ESP.getHeapFragmentation());
+  #else
+    sprintf(s,"WEM: Page %lu bytes in %lums",bytesSent,millis()-startTime);
+  #endif
+  VLF(s);
+#endif
+}
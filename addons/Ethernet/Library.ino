@@ -7,6 +7,9 @@ bool catalogIndexChanged = false;
 bool downloadCatalogData = false;
 bool uploadCatalogData = false;
 String showMessage = "";
+
+// object types in OnStep Library record order
+const char* const libObjectType[] = {"UNK", "OC", "GC", "PN", "DN", "SG", "EG", "IG", "KNT", "SNR", "GAL", "CN", "STR", "PLA", "CMT", "AST"};
       
 const char html_libScript1[] PROGMEM =
 "<script>\n"
@@ -114,24 +117,14 @@ void handleLibrary() {
   
   processLibraryGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
 
   // send a standard http response header
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  sendHtml(data);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -145,7 +138,6 @@ void handleLibrary() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -153,7 +145,6 @@ void handleLibrary() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // Scripts
   data += FPSTR(html_libScript1);
@@ -164,7 +155,7 @@ void handleLibrary() {
   data +="<script>auto2Rate=2;</script>";
  
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data += FPSTR(html_libCatalogSelect1);
   data += FPSTR(html_libCatalogSelect2);
@@ -176,7 +167,6 @@ void handleLibrary() {
   strcpy(temp,"</div></body></html>");
   data += temp;
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -244,7 +234,19 @@ void libraryAjax() {
         data+=currentCatName;
         data+="\r";
 
+        // bulk download, one raw record per command if OnStep supports it
+        bool bulk=false;
+        String line;
         while (true) {
+          command(":Lr#",temp);
+          if (temp[0] == ',') { bulk=true; success=true; break; }
+          if (!libRecDecode(temp,line)) break;
+          bulk=true;
+          data+=line;
+          data+="\r";
+        }
+
+        while (!bulk) {
           command(":LR#",temp);
           if (temp[0] == ',') { success=true; break; }
           if (temp[0] == 0)  break;
@@ -337,6 +339,7 @@ void processLibraryGet() {
         int lineNum = 0;
         if (v=="DELETE") { v=""; showMessage=L_CAT_DATA_REMOVED "."; }
         commandBlind(":LL#");  // clear this catalog
+        bool bulk=(strcmp(commandString(":Lr#"),",") == 0); // OnStep supports raw record writes?
         while (v.length() > 0) { // any data left?
           lineNum++;
           String line,co,cat,ra,de;
@@ -380,6 +383,12 @@ void processLibraryGet() {
               (de.charAt(3) != '*' && de.charAt(3) != ':') ||
               de.charAt(6) != ':' || de.length() != 9) { showMessage=F(L_CAT_BAD_DEC); showMessage+=String(lineNum); break; }
 
+          if (bulk) {
+            libRecEncode(co,cat,ra,de,temp);
+            if (!commandBool(temp)) { showMessage=F(L_CAT_UPLOAD_LINE_FAIL); showMessage+=String(lineNum); break; }
+            continue;
+          }
+
           if (!commandBool((":Sr"+ra+"#").c_str())) { showMessage=F(L_CAT_UPLOAD_RA_FAIL); showMessage+=String(lineNum); break; }
           if (!commandBool((":Sd"+de+"#").c_str())) { showMessage=F(L_CAT_UPLOAD_DEC_FAIL); showMessage+=String(lineNum); break; }
           if (!commandBool((":LW"+co+","+cat+"#").c_str())) { showMessage=F(L_CAT_UPLOAD_LINE_FAIL); showMessage+=String(lineNum); break; }
@@ -400,3 +409,49 @@ void processLibraryGet() {
     catalogIndexChanged=true;
   }
 }
+
+// encode an object as OnStep's raw 16 byte Library record into a :Lw# command (hex bytes followed by their checksum)
+void libRecEncode(String &name, String &cat, String &ra, String &de, char *cmd) {
+  uint8_t rec[16];
+  memset(rec,0,16);
+  for (unsigned int l=0; l < 11 && l < name.length(); l++) rec[l]=name.charAt(l);
+  for (int l=0; l < 16; l++) if (cat == libObjectType[l]) rec[11]=l;
+
+  // RA=0..360 and Dec=-90..+90 scaled to uint16
+  long r=ra.substring(0,2).toInt()*3600L+ra.substring(3,5).toInt()*60L+ra.substring(6,8).toInt();
+  long d=de.substring(1,3).toInt()*3600L+de.substring(4,6).toInt()*60L+de.substring(7,9).toInt(); if (de.charAt(0) == '-') d=-d;
+  long r16=lround((r/86400.0)*65536.0) & 0xFFFF;
+  long d16=lround(((d+324000L)/648000.0)*65536.0); if (d16 > 65535) d16=65535; if (d16 < 0) d16=0;
+  rec[12]=r16 & 0xFF; rec[13]=r16>>8;
+  rec[14]=d16 & 0xFF; rec[15]=d16>>8;
+
+  uint8_t cks=0;
+  strcpy(cmd,":Lw");
+  for (int l=0; l < 16; l++) { sprintf(&cmd[3+l*2],"%02X",rec[l]); cks+=rec[l]; }
+  sprintf(&cmd[35],"%02X#",cks);
+}
+
+// decode a :Lr# reply into a line of catalog data, returns false if the frame is bad
+bool libRecDecode(const char *hex, String &line) {
+  uint8_t rec[17];
+  uint8_t cks=0;
+  if (strlen(hex) != 34) return false;
+  for (int l=0; l < 17; l++) {
+    char x[3]={hex[l*2],hex[l*2+1],0};
+    char *conv_end;
+    rec[l]=strtol(x,&conv_end,16); if (conv_end != &x[2]) return false;
+    if (l < 16) cks+=rec[l];
+  }
+  if (cks != rec[16]) return false;
+
+  char name[12];
+  for (int l=0; l < 11; l++) name[l]=rec[l]; name[11]=0;
+  long r=lround(((rec[12] | (rec[13]<<8))/65536.0)*86400.0); if (r >= 86400L) r-=86400L;
+  long d=lround(((rec[14] | (rec[15]<<8))/65536.0)*648000.0)-324000L;
+  char sign='+'; if (d < 0) { sign='-'; d=-d; }
+
+  char temp[40];
+  sprintf(temp,"%-11s,%-3s,%02ld:%02ld:%02ld,%c%02ld*%02ld:%02ld",name,libObjectType[rec[11] & 15],r/3600,(r/60)%60,r%60,sign,d/3600,(d/60)%60,d%60);
+  line=temp;
+  return true;
+}
@@ -20,6 +20,15 @@ const char html_pecControls4[] PROGMEM =
 const char html_pecControls5[] PROGMEM =
 "</form></div><br class='clear' /><br />\r\n";
 
+#if ENCODERS == ON
+const char html_pecEncLearn[] PROGMEM =
+"<div class='b1' style='width: 27em'><div style='float: left'>" L_PEC_ENC_LEARN ":</div><br/><div id='epl'>?</div><br />"
+"<form method='get' action='/pec.htm'>"
+"<button name='pe' value='el' type='submit'>" L_START "</button>"
+"<button name='pe' value='es' type='submit'>" L_STOP "</button><br />" L_PEC_ENC_LEARN_MESSAGE "<br />"
+"</form></div><br class='clear' /><br />\r\n";
+#endif
+
 #ifdef OETHS
 void handlePec(EthernetClient *client) {
 #else
@@ -34,27 +43,14 @@ void handlePec() {
 
   processPecGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
 
   // send a standard http response header
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  sendHtml(data);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_control1);
-  data += FPSTR(html_main_css_control2);
-  data += FPSTR(html_main_css_control3);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   if (mountStatus.pecEnabled()) {
     // active ajax page is: pecAjax();
@@ -75,7 +71,6 @@ void handlePec() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecS);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -83,10 +78,9 @@ void handlePec() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data += FPSTR(html_pec1);
 
@@ -98,13 +92,15 @@ void handlePec() {
     data += FPSTR(html_pecControls3);
     data += FPSTR(html_pecControls4);
     data += FPSTR(html_pecControls5);
+#if ENCODERS == ON
+    data += FPSTR(html_pecEncLearn);
+#endif
     data += "</div></body></html>";
   } else {
     data += L_PEC_NO_PEC_MESSAGE;
     data += "</div><br class='clear' /></body></html>";
   }
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -127,6 +123,27 @@ void pecAjax() {
   } else { data += "?"; }
   data += "\n";
 
+#if ENCODERS == ON
+  EncSnapshot e=encoders.snapshot();
+  data += "epl|";
+  switch (e.pecState) {
+    case EP_IDLE:      data += L_PEC_IDLE; break;
+    case EP_LEARNING:  sprintf(temp,L_PEC_ENC_LEARNING " %d/%d",e.pecCycles+1,ENC_PEC_CYCLES); data += temp; break;
+    case EP_UPLOADING: sprintf(temp,L_PEC_ENC_UPLOADING " %d/%d",e.pecUploadIndex,e.pecSize); data += temp; break;
+    case EP_DONE:      data += L_PEC_ENC_DONE ", "; dtostrf(e.pecPeakToPeak,1,1,temp); data += temp; data += "\" p-p"; break;
+    default:           data += L_PEC_ENC_FAILED;
+      switch (e.pecFailure) {
+        case EPF_SETUP:     data += ", " L_PEC_ENC_ERR_SETUP; break;
+        case EPF_RECORDING: data += ", " L_PEC_ENC_ERR_RECORDING; break;
+        case EPF_NO_INDEX:  data += ", " L_PEC_ENC_ERR_NO_INDEX; break;
+        case EPF_TRACKING:  data += ", " L_PEC_ENC_ERR_TRACKING; break;
+        case EPF_TIMEOUT:   data += ", " L_PEC_ENC_ERR_TIMEOUT; break;
+        case EPF_UPLOAD:    data += ", " L_PEC_ENC_ERR_UPLOAD; break;
+      }
+  }
+  data += "\n";
+#endif
+
 #ifdef OETHS
   client->print(data);
 #else
@@ -145,5 +162,9 @@ void processPecGet() {
     if (v == "re") commandBlind(":$QZ/#"); // record
     if (v == "cl") commandBlind(":$QZZ#"); // clear
     if (v == "wr") commandBlind(":$QZ!#"); // write to eeprom
+#if ENCODERS == ON
+    if (v == "el") encoders.request(ER_PEC_LEARN); // learn from the encoders
+    if (v == "es") encoders.request(ER_PEC_STOP);
+#endif
   }
 }
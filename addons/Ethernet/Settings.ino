@@ -86,28 +86,14 @@ void handleSettings() {
 
   processSettingsGet();
   
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
  
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  sendHtml(data);
-  data += FPSTR(html_main_css6);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_btns1);
-  sendHtml(data);
-  data += FPSTR(html_main_css_btns2);
-  data += FPSTR(html_main_css_btns3);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
 
   data += FPSTR(html_bodyB);
-  sendHtml(data);
   
   // active ajax page is: settingsAjax();
   data += "<script>var ajaxPage='settings.txt';</script>\n";
@@ -127,7 +113,6 @@ void handleSettings() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetS);
   data += FPSTR(html_linksCfgN);
@@ -135,10 +120,9 @@ void handleSettings() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
  
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data+="<div style='width: 35em;'>";
 
@@ -148,7 +132,6 @@ void handleSettings() {
   data += FPSTR(html_settingsSlewSpeed1);
   data += FPSTR(html_settingsSlewSpeed2);
 
-  sendHtml(data);
 
   if (mountStatus.mountType()!=MT_ALTAZM) {
     data += FPSTR(html_settingsTrackComp1);
@@ -161,7 +144,6 @@ void handleSettings() {
   
   data += FPSTR(html_settingsPark1);
     
-  sendHtml(data);
 
   data += FPSTR(html_settingsBuzzer1);
   data += FPSTR(html_settingsBuzzer2);
@@ -178,7 +160,6 @@ void handleSettings() {
   data += "<br />";
   data += "</div></div></body></html>";
   
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -254,6 +254,7 @@
 #define L_ENC_STAT_RATE_AXIS1 "轴1速率（恒星）"
 #define L_ENC_STAT_INTPOL_COMP "补偿之间"
 #define L_ENC_STAT_INTPOL_PHASE "初始阶段"
+#define L_ENC_CAPTURE "轴1脉冲捕获"
 
 // ------------------------------ PEC ----------------------------
 
@@ -274,6 +275,18 @@
 #define L_PEC_RECORDING "绘图"
 #define L_PEC_UNK "未知"
 #define L_PEC_EEWRITING "写入EEPROM"
+#define L_PEC_ENC_LEARN "从编码器学习"
+#define L_PEC_ENC_LEARN_MESSAGE "跟踪时用编码器测量两个蜗杆周期的周期误差，然后上传表格并开始播放。转动会停止学习。写入EEPROM以保存结果."
+#define L_PEC_ENC_LEARNING "学习中，周期"
+#define L_PEC_ENC_UPLOADING "上传中"
+#define L_PEC_ENC_DONE "完成"
+#define L_PEC_ENC_FAILED "失败"
+#define L_PEC_ENC_ERR_SETUP "无法读取PEC设置"
+#define L_PEC_ENC_ERR_RECORDING "OnStep正在记录PEC"
+#define L_PEC_ENC_ERR_NO_INDEX "蜗杆索引没有前进 (索引传感器?)"
+#define L_PEC_ENC_ERR_TRACKING "跟踪已停止"
+#define L_PEC_ENC_ERR_TIMEOUT "耗时过长"
+#define L_PEC_ENC_ERR_UPLOAD "上传未确认"
 
 // --------------------------- Settings --------------------------
 
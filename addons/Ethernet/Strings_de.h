@@ -262,6 +262,7 @@
 #define L_ENC_STAT_RATE_AXIS1 "Axis1 Rate (sidereal)"
 #define L_ENC_STAT_INTPOL_COMP "Intpol Comp"
 #define L_ENC_STAT_INTPOL_PHASE "Intpol Phase"
+#define L_ENC_CAPTURE "Axis1 Impulsaufzeichnung"
 
 // ------------------------------ PEC ----------------------------
 
@@ -282,6 +283,18 @@
 #define L_PEC_RECORDING "Zeichne auf"
 #define L_PEC_UNK "Unbekannt"
 #define L_PEC_EEWRITING "schreibe in EEPROM"
+#define L_PEC_ENC_LEARN "Von Encodern lernen"
+#define L_PEC_ENC_LEARN_MESSAGE "Misst w&auml;hrend der Nachf&uuml;hrung den periodischen Fehler mit den Encodern &uuml;ber zwei Schneckenumdrehungen, l&auml;dt dann eine Tabelle hoch und startet die Wiedergabe.  Ein Schwenk bricht ab.  In EEPROM schreiben, um das Ergebnis zu behalten."
+#define L_PEC_ENC_LEARNING "Lerne, Umdrehung"
+#define L_PEC_ENC_UPLOADING "Lade hoch"
+#define L_PEC_ENC_DONE "Fertig"
+#define L_PEC_ENC_FAILED "Fehlgeschlagen"
+#define L_PEC_ENC_ERR_SETUP "PEC-Einstellungen nicht lesbar"
+#define L_PEC_ENC_ERR_RECORDING "OnStep zeichnet PEC auf"
+#define L_PEC_ENC_ERR_NO_INDEX "Schneckenindex bewegt sich nicht (Indexsensor?)"
+#define L_PEC_ENC_ERR_TRACKING "Nachf&uuml;hrung gestoppt"
+#define L_PEC_ENC_ERR_TIMEOUT "dauerte zu lange"
+#define L_PEC_ENC_ERR_UPLOAD "Hochladen nicht best&auml;tigt"
 
 // --------------------------- Settings --------------------------
 
@@ -254,6 +254,7 @@
 #define L_ENC_STAT_RATE_AXIS1 "Axis1 rates (sidereal)"
 #define L_ENC_STAT_INTPOL_COMP "Intpol Comp"
 #define L_ENC_STAT_INTPOL_PHASE "Intpol Phase"
+#define L_ENC_CAPTURE "Axis1 tick capture"
 
 // ------------------------------ PEC ----------------------------
 
@@ -274,6 +275,18 @@
 #define L_PEC_RECORDING "Recording"
 #define L_PEC_UNK "Unknown"
 #define L_PEC_EEWRITING "writing to EEPROM"
+#define L_PEC_ENC_LEARN "Learn from Encoders"
+#define L_PEC_ENC_LEARN_MESSAGE "While tracking, measures the periodic error with the encoders over two worm cycles, then uploads a table and starts playback.  A slew stops it.  Write to EEPROM to keep the result."
+#define L_PEC_ENC_LEARNING "Learning, cycle"
+#define L_PEC_ENC_UPLOADING "Uploading"
+#define L_PEC_ENC_DONE "Done"
+#define L_PEC_ENC_FAILED "Failed"
+#define L_PEC_ENC_ERR_SETUP "can't read the PEC settings"
+#define L_PEC_ENC_ERR_RECORDING "OnStep is recording PEC"
+#define L_PEC_ENC_ERR_NO_INDEX "the worm index isn't advancing (index sense?)"
+#define L_PEC_ENC_ERR_TRACKING "tracking stopped"
+#define L_PEC_ENC_ERR_TIMEOUT "took too long"
+#define L_PEC_ENC_ERR_UPLOAD "upload not confirmed"
 
 // --------------------------- Settings --------------------------
 
@@ -3,40 +3,79 @@
 
 // misc.
 #define WebSocketTimeOut 10000
+#define WEB_HANDLER_COUNT_MAX 32 // 24 are used with encoders and capture on, leave room for SD card files
+#define WEB_ROUTE_BUCKETS 64     // power of two, comfortably more than WEB_HANDLER_COUNT_MAX so probes stay short
+#if (WEB_ROUTE_BUCKETS & (WEB_ROUTE_BUCKETS-1)) || (WEB_ROUTE_BUCKETS < WEB_HANDLER_COUNT_MAX*3/2) || (WEB_HANDLER_COUNT_MAX > 255)
+  #error "WEB_ROUTE_BUCKETS must be a power of two and at least 1.5x WEB_HANDLER_COUNT_MAX, which can't exceed 255"
+#endif
+#define WEB_PARAMETER_COUNT_MAX 20
+#define WEB_REQUEST_SIZE 192     // longest request line (GET /path?args HTTP/1.1) we accept
+#ifdef __AVR__
+  #define WEB_CLIENT_COUNT 1
+#else
+  #define WEB_CLIENT_COUNT 3     // requests read in parallel, the W5500 has sockets to spare
+#endif
 typedef void (* webFunction) (EthernetClient *client);
 
+// one connection, its request line is parsed in place and parameters/values point into it
+typedef struct {
+  EthernetClient client;
+  char request[WEB_REQUEST_SIZE];
+  int requestLen;
+  char headerLine[64];
+  int headerLineLen;
+  bool firstLine;
+  bool lineBlank;
+  char ifNoneMatch[24];
+  char ifModifiedSince[32];
+  unsigned long timeout;
+} WebRequest;
+
 class WebServer {
   public:
     void init();
     void handleClient();
     void setResponseHeader(const char *str);
-    void on(String fn, webFunction handler);
+    void on(const char *fn, webFunction handler);
+    void on(const char *fn, const WebAsset *asset);
 #if SD_CARD == ON
-    void on(String fn);
+    void on(const char *fn);
 #endif
     void onNotFound(webFunction handler);
-    String arg(String id);
+    String arg(const char *id);
 
     bool SDfound=false;
   private:
+    void start(WebRequest *r, EthernetClient &client);
+    bool receive(WebRequest *r);
+    void dispatch(WebRequest *r);
+    int route(const char *fn);
+    void addRoute(const char *fn, webFunction handler, const WebAsset *asset);
 #if SD_CARD == ON
-    void sdPage(String fn, EthernetClient *client);
+    void sdPage(const char *fn, EthernetClient *client);
 #endif
+    void sendAsset(const WebAsset *asset, EthernetClient *client);
+    bool notModified(const char *etag, const char *modified);
+    void sendHeader(int code, const char *contentType, const char *etag, const char *modified, long len, bool gzip, long maxAge, EthernetClient *client);
+    void headerValue(const char *s, char *value, int len);
 
-    String inputBuffer;
     char responseHeader[200]="";
-#if SD_CARD == ON
-    bool modifiedSinceFound=false;
-#endif
+    char lastModified[32]="";
+
+    WebRequest requests[WEB_CLIENT_COUNT];
+    WebRequest *current=NULL;
 
     webFunction notFoundHandler=NULL;
-    webFunction handlers[20];
-    String handlers_fn[20];
+    webFunction handlers[WEB_HANDLER_COUNT_MAX];
+    const WebAsset *assets[WEB_HANDLER_COUNT_MAX];
+    const char *handlers_fn[WEB_HANDLER_COUNT_MAX];
     int handler_count;
-    
-    String parameters[20];
-    String values[20];
+    uint8_t routes[WEB_ROUTE_BUCKETS]; // handler index+1, 0 for an empty bucket
+
+    const char *parameters[WEB_PARAMETER_COUNT_MAX];
+    const char *values[WEB_PARAMETER_COUNT_MAX];
     int parameter_count;
 };
 
 const char http_defaultHeader[] PROGMEM = "HTTP/1.1 200 OK\r\n" "Content-Type: text/html\r\n" "Connection: close\r\n" "\r\n";
+const char http_notFoundHeader[] PROGMEM = "HTTP/1.1 404 Not Found\r\n" "Content-Type: text/plain\r\n" "Connection: close\r\n" "\r\n";
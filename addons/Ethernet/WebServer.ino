@@ -32,125 +32,130 @@ void WebServer::init() {
 #endif
 
   handler_count=0;
+  for (int i=0; i<WEB_ROUTE_BUCKETS; i++) routes[i]=0;
+
+  // the assets only change with the firmware, so its build time is their Last-Modified date
+  const char *months="JanFebMarAprMayJunJulAugSepOctNovDec";
+  const char *days="SunMonTueWedThuFriSat";
+  const int t[]={0,3,2,5,0,3,5,1,4,6,2,4};
+  char mon[4]; strncpy(mon,__DATE__,3); mon[3]=0;
+  int d=atoi(&__DATE__[4]), y=atoi(&__DATE__[7]), m=(strstr(months,mon)-months)/3+1;
+  int yy=y-(m<3); int wd=(yy+yy/4-yy/100+yy/400+t[m-1]+d)%7;
+  sprintf(lastModified,"%.3s, %02d %s %d %s GMT",&days[wd*3],d,mon,y,__TIME__);
 }
 
 void WebServer::handleClient() {
-  // listen for incoming clients
-  EthernetClient _client;
-  _client = _server.available();
-  if (_client) {
+  // new connections take a free slot, the library also hands back connections we already have when more data arrives
+  EthernetClient client=_server.available();
+  if (client) {
+    bool known=false;
+    for (int i=0; i<WEB_CLIENT_COUNT; i++) if (requests[i].client==client) known=true;
+    if (!known) {
+      for (int i=0; i<WEB_CLIENT_COUNT; i++) if (!requests[i].client) { start(&requests[i],client); break; }
+    }
+  }
+
+  // read what's there without waiting, a slow client no longer holds up the rest of the loop
+  for (int i=0; i<WEB_CLIENT_COUNT; i++) {
+    WebRequest *r=&requests[i];
+    if (!r->client) continue;
+    if (receive(r)) {
+      dispatch(r);
+      // give the web browser time to receive the data
+      delay(1);
+    } else if (r->client.connected() && ((long)(millis()-r->timeout) < 0)) continue;
+    // close the connection:
+    r->client.stop();
 #ifdef WEBSERVER_DEBUG_ON
-    Ser.println("new client");
+    Ser.println("client disconnected");
 #endif
-    // an http request ends with a blank line
-    boolean currentLineIsBlank = true;
-    unsigned long to=millis()+WebSocketTimeOut;
-    while ((_client.connected()) && ((long)(millis()-to) < 0)) {
-      if (_client.available()) {
-        char c = _client.read();
+  }
+}
+
+void WebServer::start(WebRequest *r, EthernetClient &client) {
 #ifdef WEBSERVER_DEBUG_ON
-        Ser.write(c);
+  Ser.println("new client");
 #endif
-        if (inputBuffer.length()<128) inputBuffer+=c;
-
-        // if you've gotten to the end of the line (received a newline character) and the line is blank, the http request has ended, send a reply
-        if (c == '\n' && currentLineIsBlank) {
-
-          // grab the URL
-          int url_start=inputBuffer.indexOf("GET ");
-          int url_end=inputBuffer.indexOf("HTTP/");
-          if ((url_start!=-1) && (url_end!=-1)) {
-            String command=inputBuffer.substring(url_start,url_end);
+  r->client=client;
+  r->requestLen=0;
+  r->headerLineLen=0;
+  r->firstLine=true;
+  r->lineBlank=true;
+  r->ifNoneMatch[0]=0;
+  r->ifModifiedSince[0]=0;
+  r->timeout=millis()+WebSocketTimeOut;
+}
 
-#if SD_CARD == ON
-            // watch for cache requests
-            if ((!modifiedSinceFound) && (command.indexOf("If-Modified-Since:")>=0)) modifiedSinceFound=true;
+// returns true once the blank line that ends the http request arrives
+bool WebServer::receive(WebRequest *r) {
+  while (r->client.available()) {
+    char c=r->client.read();
+#ifdef WEBSERVER_DEBUG_ON
+    Ser.write(c);
 #endif
+    if (c == '\n') {
+      if (r->lineBlank && !r->firstLine) return true;
+      if (r->firstLine) r->firstLine=false; else {
+        // watch for cache validators
+        r->headerLine[r->headerLineLen]=0;
+        if (strncasecmp(r->headerLine,"If-None-Match:",14)==0) headerValue(&r->headerLine[14],r->ifNoneMatch,sizeof(r->ifNoneMatch));
+        if (strncasecmp(r->headerLine,"If-Modified-Since:",18)==0) headerValue(&r->headerLine[18],r->ifModifiedSince,sizeof(r->ifModifiedSince));
+      }
+      r->headerLineLen=0;
+      r->lineBlank=true;
+    } else if (c != '\r') {
+      r->lineBlank=false;
+      if (r->firstLine) { if (r->requestLen<WEB_REQUEST_SIZE-1) r->request[r->requestLen++]=c; }
+      else if (r->headerLineLen<(int)sizeof(r->headerLine)-1) r->headerLine[r->headerLineLen++]=c;
+    }
+  }
+  return false;
+}
 
-            // pass to handlers
-            bool handlerFound=false;
-            for (int i=0; i<handler_count; i++) {
-              if (command.indexOf(handlers_fn[i])>=0) {
-                // but first, isolate any get parameters and their values
-                command=command.substring(command.indexOf(handlers_fn[i])+handlers_fn[i].length()); 
-                while (command[0]==' ') command=command.substring(1);
-                while (command[command.length()-1]==' ') command=command.substring(0,command.length()-1);
-
-                if (handlers[i]!=NULL) {
-                  // check to see if there's a ?a=1& or &a=1
-                  parameter_count=0;
-                  while ((command[0]=='?') || (command[0]=='&')) {
-                    command=command.substring(1);
-                    int j =command.indexOf('='); if (j==-1) j=command.length(); if (j==-1) break; // invalid formatting
-                    int j1=command.indexOf('&'); if (j1==-1) j1=command.length()+1;
-                    String thisArg=command.substring(0,j);
-                    String thisVal=command.substring(j+1,j1);
-                    if (thisArg!="") {
-                      parameter_count++;
-                      parameters[parameter_count-1]=thisArg;
-                      values[parameter_count-1]=thisVal;
-                    }
-                    command=command.substring(j1);
-  #ifdef WEBSERVER_DEBUG_ON
-                    Ser.print(thisArg); Ser.print("="); Ser.println(thisVal);
-  #endif
-                  }
-                  _client.print(responseHeader);
-                  (*handlers[i])(&_client); // send page content
-                  handlerFound=true;
-                  break;
-                } else {
-#if SD_CARD == ON
-                  // send a 304 header
-                  if ((modifiedSinceFound) && true ) {
-                    char temp[255]; strcpy_P(temp,http_js304Header); _client.print(temp);
-                    handlerFound=true;
-                    break;
-                  } else {
-                    if (handlers_fn[i].indexOf(".js")>0) {
-                      char temp[255]; strcpy_P(temp,http_jsHeader); _client.print(temp); 
-                    } else client.print(responseHeader);
-                    sdPage(handlers_fn[i],&client);
-                    handlerFound=true;
-                    break;
-                  }
+void WebServer::dispatch(WebRequest *r) {
+  // the request line is "GET /path?a=1&b=2 HTTP/1.1", split it up in place
+  r->request[r->requestLen]=0;
+  if (strncmp(r->request,"GET ",4)!=0) {
+#ifdef WEBSERVER_DEBUG_ON
+    Ser.println("Invalid response");
 #endif
-                }
-              }
-            }
-            // handle not found
-            if (!handlerFound && (notFoundHandler!=NULL)) (*notFoundHandler)(&_client);
+    return;
+  }
+  char *path=&r->request[4];
+  char *s=strchr(path,' '); if (s!=NULL) *s=0;
+  char *query=strchr(path,'?'); if (query!=NULL) *query++=0;
 
-          } else {
+  parameter_count=0;
+  while ((query!=NULL) && (*query!=0) && (parameter_count<WEB_PARAMETER_COUNT_MAX)) {
+    char *next=strchr(query,'&'); if (next!=NULL) *next++=0;
+    char *value=strchr(query,'='); if (value!=NULL) *value++=0; else value=&query[strlen(query)];
+    if (*query!=0) {
+      parameters[parameter_count]=query;
+      values[parameter_count]=value;
+      parameter_count++;
 #ifdef WEBSERVER_DEBUG_ON
-            Ser.println("Invalid response");
+      Ser.print(query); Ser.print("="); Ser.println(value);
 #endif
-          }
-          inputBuffer="";
-          break;
-        }
-        if (c == '\n') {
-          // you're starting a new line
-          currentLineIsBlank = true;
-        } else if (c != '\r') {
-          // you've gotten a character on the current line
-          currentLineIsBlank = false;
-        }
-      }
     }
-    // give the web browser time to receive the data
-    delay(1);
-    // close the connection:
-    _client.stop();
-    // clear the input buffer
-    inputBuffer="";
+    query=next;
+  }
+
+  current=r;
+  int i=route(path);
+  if (i>=0 && handlers[i]!=NULL) {
+    r->client.print(responseHeader);
+    (*handlers[i])(&r->client); // send page content
+  } else if (i>=0 && assets[i]!=NULL) {
+    sendAsset(assets[i],&r->client);
+  } else
 #if SD_CARD == ON
-    modifiedSinceFound=false;
-#endif
-#ifdef WEBSERVER_DEBUG_ON
-    Ser.println("client disconnected");
+  if (i>=0) sdPage(handlers_fn[i],&r->client); else
 #endif
+  if (notFoundHandler!=NULL) {
+    char temp[80]; strcpy_P(temp,http_notFoundHeader); r->client.print(temp);
+    (*notFoundHandler)(&r->client);
   }
+  current=NULL;
 }
 
 void WebServer::setResponseHeader(const char *str) {
@@ -158,31 +163,75 @@ void WebServer::setResponseHeader(const char *str) {
   strcpy_P(responseHeader,str);
 }
 
-void WebServer::on(String fn, webFunction handler) {
-  handler_count++; if (handler_count>20) { handler_count=20; return; }
-  handlers[handler_count-1]=handler;
-  handlers_fn[handler_count-1]=fn;
+// FNV-1a, the routes are looked up by this hash with linear probing
+static uint16_t routeHash(const char *fn) {
+  uint16_t h=0x811c;
+  while (*fn) { h^=(uint8_t)*fn++; h*=0x0193; }
+  return h;
+}
+
+void WebServer::addRoute(const char *fn, webFunction handler, const WebAsset *asset) {
+  if (handler_count>=WEB_HANDLER_COUNT_MAX) { DLF("ERR, WebServer.on(): too many handlers, raise WEB_HANDLER_COUNT_MAX"); return; }
+  handlers[handler_count]=handler;
+  assets[handler_count]=asset;
+  handlers_fn[handler_count]=fn;
+  handler_count++;
+
+  uint16_t b=routeHash(fn)&(WEB_ROUTE_BUCKETS-1);
+  while (routes[b]!=0) b=(b+1)&(WEB_ROUTE_BUCKETS-1);
+  routes[b]=handler_count;
+}
+
+int WebServer::route(const char *fn) {
+  uint16_t b=routeHash(fn)&(WEB_ROUTE_BUCKETS-1);
+  while (routes[b]!=0) {
+    int i=routes[b]-1;
+    if (strcmp(handlers_fn[i],fn)==0) return i;
+    b=(b+1)&(WEB_ROUTE_BUCKETS-1);
+  }
+  return -1;
+}
+
+void WebServer::on(const char *fn, webFunction handler) {
+  addRoute(fn,handler,NULL);
+}
+
+void WebServer::on(const char *fn, const WebAsset *asset) {
+  addRoute(fn,NULL,asset);
 }
 
 void WebServer::onNotFound(webFunction handler) {
   notFoundHandler=handler;
 }
 
-String WebServer::arg(String id) {
+String WebServer::arg(const char *id) {
   for (int i=0; i<parameter_count; i++) {
-    if (id==parameters[i]) return values[i];
+    if (strcmp(id,parameters[i])==0) return values[i];
   }
   return "";
 }
 
 #if SD_CARD == ON
-void WebServer::on(String fn) {
-  handler_count++; if (handler_count>20) { handler_count=20; return; }
-  handlers[handler_count-1]=NULL;
-  handlers_fn[handler_count-1]=fn;
+void WebServer::on(const char *fn) {
+  addRoute(fn,NULL,NULL);
+}
+
+// CRC-32 (IEEE) of the rest of a file, a bit at a time since there's no room for a table
+static uint32_t fileCrc(File &f) {
+  uint8_t temp[64];
+  uint32_t crc=0xFFFFFFFFUL;
+  int n;
+  do {
+    n=f.read(temp,sizeof(temp));
+    for (int i=0; i<n; i++) {
+      crc^=temp[i];
+      for (int b=0; b<8; b++) crc=(crc>>1)^(0xEDB88320UL&(0-(crc&1)));
+    }
+  } while (n>0);
+  return ~crc;
 }
 
-void WebServer::sdPage(String fn, EthernetClient *client) {
+void WebServer::sdPage(const char *fn, EthernetClient *client) {
   char temp[256] = "";
   int n;
 
@@ -190,12 +239,67 @@ void WebServer::sdPage(String fn, EthernetClient *client) {
   if (SDfound) {
     File dataFile=SD.open(fn, FILE_READ);
     if (dataFile) {
+      // the SD library has no file times so there's no Last-Modified, the ETag is a CRC of the contents and the browser
+      // revalidates on every load, a match saves sending the file again
+      char etag[12]; sprintf(etag,"\"%08lx\"",(unsigned long)fileCrc(dataFile));
+      dataFile.seek(0);
+      const char *contentType="text/html";
+      const char *ext=strrchr(fn,'.');
+      if (ext!=NULL && strcmp(ext,".js")==0) contentType="application/javascript"; else if (ext!=NULL && strcmp(ext,".css")==0) contentType="text/css";
+
+      if (notModified(etag,NULL)) { sendHeader(304,contentType,etag,NULL,-1,false,-1,client); dataFile.close(); return; }
+      sendHeader(200,contentType,etag,NULL,-1,false,0,client);
       do {
         n=dataFile.available(); if (n>256) n=256;
         if (n>0) { dataFile.read(temp,n); client->write(temp,n); }
       } while (n>0);
       dataFile.close();
+      return;
     }
   }
+  if (notFoundHandler!=NULL) {
+    char temp[80]; strcpy_P(temp,http_notFoundHeader); client->print(temp);
+    (*notFoundHandler)(client);
+  }
 }
 #endif
+
+void WebServer::sendAsset(const WebAsset *asset, EthernetClient *client) {
+  if (notModified(asset->etag,lastModified)) { sendHeader(304,asset->contentType,asset->etag,lastModified,-1,true,86400,client); return; }
+  sendHeader(200,asset->contentType,asset->etag,lastModified,asset->len,true,86400,client);
+
+  char temp[64];
+  for (unsigned int i=0; i<asset->len; i+=sizeof(temp)) {
+    unsigned int n=asset->len-i; if (n>sizeof(temp)) n=sizeof(temp);
+    memcpy_P(temp,&asset->data[i],n);
+    client->write((uint8_t*)temp,n);
+  }
+}
+
+// If-None-Match wins when both are sent, If-Modified-Since is only trusted if it's the date we handed out (if any)
+bool WebServer::notModified(const char *etag, const char *modified) {
+  if (current==NULL) return false;
+  if (current->ifNoneMatch[0]) return strstr(current->ifNoneMatch,etag)!=NULL;
+  if (current->ifModifiedSince[0] && modified!=NULL) return strcmp(current->ifModifiedSince,modified)==0;
+  return false;
+}
+
+// maxAge of 0 has the browser check back every time
+void WebServer::sendHeader(int code, const char *contentType, const char *etag, const char *modified, long len, bool gzip, long maxAge, EthernetClient *client) {
+  char temp[256];
+  if (code==304) strcpy(temp,"HTTP/1.1 304 Not Modified\r\n"); else {
+    sprintf(temp,"HTTP/1.1 200 OK\r\nContent-Type: %s\r\n",contentType);
+    if (gzip) strcat(temp,"Content-Encoding: gzip\r\n");
+    if (len>=0) sprintf(&temp[strlen(temp)],"Content-Length: %ld\r\n",len);
+  }
+  if (maxAge>0) sprintf(&temp[strlen(temp)],"Cache-Control: max-age=%ld\r\n",maxAge); else strcat(temp,"Cache-Control: no-cache\r\n");
+  sprintf(&temp[strlen(temp)],"ETag: %s\r\n",etag);
+  if (modified!=NULL) sprintf(&temp[strlen(temp)],"Last-Modified: %s\r\n",modified);
+  strcat(temp,"Connection: close\r\n\r\n");
+  client->print(temp);
+}
+
+void WebServer::headerValue(const char *s, char *value, int len) {
+  while (*s==' ') s++;
+  strncpy(value,s,len-1); value[len-1]=0;
+}
@@ -37,6 +37,42 @@ bool CatMgr::isInitialized() {
   return ((_lat<9999) && (_lstT0!=0));
 }
 
+// background tasks, works through the selected catalog a few objects at a time to refresh the visibility cache once a minute
+void CatMgr::poll() {
+  if (!isInitialized()) return;
+  if ((_selected<0) || (getMaxIndex()+1>CatIndexMaxObjects)) return;
+
+  // start a new pass if the catalog or site changed or the last pass is a minute old
+  if ((_visCatalog!=_selected) || (_visPassLat!=_lat)) {
+    _visValidCatalog=-1;
+    _visCatalog=_selected;
+    _visNext=0;
+    _visPassLst=lstDegs();
+    _visPassLat=_lat;
+  } else
+  if (_visNext>getMaxIndex()) {
+    if (fabs(lstDegs()-_visPassLst)<0.25) return;
+    _visNext=0;
+    _visPassLst=lstDegs();
+  }
+
+  long index=catalog[_selected].Index;
+  for (int i=0; (i<32) && (_visNext<=getMaxIndex()); i++, _visNext++) {
+    catalog[_selected].Index=_visNext;
+    double HA=(_visPassLst-ra())/Rad;
+    double Dec=dec()/Rad;
+    double a=asin((sin(Dec)*_sinLat)+(cos(Dec)*_cosLat*cos(HA)))*Rad;
+    _visAlt[_visNext]=floor(a);
+  }
+  catalog[_selected].Index=index;
+
+  // once a pass is done the cache is good until the objects have moved too far to be sure which side of a limit they're on
+  if (_visNext>getMaxIndex()) {
+    _visValidCatalog=_selected;
+    _visValidLst=_visPassLst;
+  }
+}
+
 // Get Local Sidereal Time, converted from hours to degrees
 double CatMgr::lstDegs() {
   return (lstHours()*15.0);
@@ -67,6 +103,58 @@ var_star_comp_t*  _varStarCompCatalog  = NULL;
 dso_t*            _dsoCatalog          = NULL;
 dso_comp_t*       _dsoCompCatalog      = NULL;
 dso_vcomp_t*      _dsoVCompCatalog     = NULL;
+blk_catalog_t*    _blkCatalog          = NULL;
+
+// block compressed catalogs, one block of decoded records is cached
+blk_rec_t         _blkCache[CatBlkRecs];
+long              _blkCacheNum         = -1;
+long              _blkNameBase         = 0;
+long              _blkSubIdBase        = 0;
+
+// read a signed (zigzag coded) varint and advance the pointer past it
+static long blkVarint(const unsigned char* &p) {
+  unsigned long v=0;
+  int shift=0;
+  do {
+    v|=(unsigned long)(*p & 0x7f)<<shift;
+    shift+=7;
+  } while ((*p++ & 0x80) && (shift<32));
+  if (v & 1) return -(long)(v>>1)-1; else return v>>1;
+}
+
+// get a record from the selected block compressed catalog, decoding its block into the cache if needed
+static blk_rec_t* blkRec(long index, long numObjects) {
+  long b=index/CatBlkRecs;
+  if (b!=_blkCacheNum) {
+    const unsigned char *p=&_blkCatalog->Data[_blkCatalog->BlockOffset[b]];
+    unsigned short ra=p[0] | (p[1]<<8);
+    _blkNameBase     =p[2] | (p[3]<<8) | ((long)p[4]<<16);
+    _blkSubIdBase    =p[5] | (p[6]<<8) | ((long)p[7]<<16);
+    p+=8;
+
+    long recs=numObjects-b*CatBlkRecs; if (recs>CatBlkRecs) recs=CatBlkRecs;
+    unsigned char cons=89;
+    unsigned char type=24;
+    long idOffset=0;
+    for (long i=0; i<recs; i++) {
+      unsigned char flags=*p++;
+      if (flags & 4) cons=*p++;
+      if (flags & 8) type=*p++;
+      _blkCache[i].Mag=255; if (flags & 16) _blkCache[i].Mag=*p++;
+      ra+=blkVarint(p);
+      _blkCache[i].RA=ra;
+      _blkCache[i].DE=(signed short)(p[0] | (p[1]<<8)); p+=2;
+      if (flags & 32) idOffset+=blkVarint(p);
+      _blkCache[i].Obj_id=b*CatBlkRecs+i+1+idOffset;
+      _blkCache[i].Has_name =(flags & 1);
+      _blkCache[i].Has_subId=(flags & 2)>>1;
+      _blkCache[i].Cons=cons;
+      _blkCache[i].Obj_type=type;
+    }
+    _blkCacheNum=b;
+  }
+  return &_blkCache[index%CatBlkRecs];
+}
 
 // handle catalog selection (0..n)
 void CatMgr::select(int number) {
@@ -76,6 +164,8 @@ void CatMgr::select(int number) {
   _dsoCatalog          =NULL;
   _dsoCompCatalog      =NULL;
   _dsoVCompCatalog     =NULL;
+  _blkCatalog          =NULL;
+  _blkCacheNum         =-1;
   if ((number<0) || (number>=numCatalogs())) number=-1; // invalid catalog?
   _selected=number;
   if (_selected>=0) {
@@ -87,7 +177,9 @@ void CatMgr::select(int number) {
     if (catalog[_selected].CatalogType==CAT_VAR_STAR_COMP)  _varStarCompCatalog =(var_star_comp_t*)catalog[_selected].Objects; else
     if (catalog[_selected].CatalogType==CAT_DSO)            _dsoCatalog         =(dso_t*)catalog[_selected].Objects; else
     if (catalog[_selected].CatalogType==CAT_DSO_COMP)       _dsoCompCatalog     =(dso_comp_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DSO_VCOMP)      _dsoVCompCatalog    =(dso_vcomp_t*)catalog[_selected].Objects; else _selected=-1;
+    if (catalog[_selected].CatalogType==CAT_DSO_VCOMP)      _dsoVCompCatalog    =(dso_vcomp_t*)catalog[_selected].Objects; else
+    if (catalog[_selected].CatalogType==CAT_GEN_STAR_BLK)   _blkCatalog         =(blk_catalog_t*)catalog[_selected].Objects; else
+    if (catalog[_selected].CatalogType==CAT_DSO_BLK)        _blkCatalog         =(blk_catalog_t*)catalog[_selected].Objects; else _selected=-1;
   }
 }
 
@@ -124,7 +216,8 @@ bool CatMgr::hasPrimaryIdInPrefix() {
 bool CatMgr::isStarCatalog() {
   return (catalogType()==CAT_GEN_STAR) || (catalogType()==CAT_GEN_STAR_VCOMP) || 
          (catalogType()==CAT_DBL_STAR) || (catalogType()==CAT_DBL_STAR_COMP) ||
-         (catalogType()==CAT_VAR_STAR) || (catalogType()==CAT_VAR_STAR_COMP);
+         (catalogType()==CAT_VAR_STAR) || (catalogType()==CAT_VAR_STAR_COMP) ||
+         (catalogType()==CAT_GEN_STAR_BLK);
 }
 
 bool CatMgr::isDblStarCatalog() {
@@ -140,7 +233,11 @@ bool CatMgr::isVarStarCatalog() {
 }
 
 bool CatMgr::isDsoCatalog()  {
-  return (catalogType()==CAT_DSO) || (catalogType()==CAT_DSO_COMP) || (catalogType()==CAT_DSO_VCOMP);
+  return (catalogType()==CAT_DSO) || (catalogType()==CAT_DSO_COMP) || (catalogType()==CAT_DSO_VCOMP) || (catalogType()==CAT_DSO_BLK);
+}
+
+bool CatMgr::isBlkCatalog()  {
+  return (catalogType()==CAT_GEN_STAR_BLK) || (catalogType()==CAT_DSO_BLK);
 }
 
 // Get active catalog title
@@ -278,10 +375,10 @@ bool CatMgr::isFiltered() {
   if (_fm & FM_DBL_MAX_SEP)   { if (isDblStarCatalog() && ((separation()>_fm_dbl_max) || (separation()<0))) return true; }
   if (_fm & FM_DBL_MIN_SEP)   { if (isDblStarCatalog() && ((separation()<_fm_dbl_min) || (separation()<0))) return true; }
   if (_fm & FM_VAR_MAX_PER)   { if (isVarStarCatalog() && ((period()    >_fm_var_max) || (period()    <0))) return true; }
-  if (_fm & FM_ABOVE_HORIZON) { if (alt()<0.0) return true; }
+  if (_fm & FM_ABOVE_HORIZON) { if (isBelowAlt(0.0)) return true; }
   if (_fm & FM_ALIGN_ALL_SKY) {
-    if (magnitude()>3.0) return true; // maximum magnitude 3.0
-    if (alt()<10.0) return true;      // minimum 10 degrees altitude
+    if (magnitude()>3.0) return true;  // maximum magnitude 3.0
+    if (isBelowAlt(10.0)) return true; // minimum 10 degrees altitude
     if (abs(dec())>80.0) return true; // minimum 10 degrees from the pole (for accuracy)
   }
   return false;
@@ -304,25 +401,179 @@ long CatMgr::getMaxIndex() {
 }
 
 bool CatMgr::incIndex() {
-  long i=getMaxIndex()+1;
+  updateCellFilter();
+  updateMagFilter();
+  long i=getMaxIndex()+1; if (_magOrderActive) i=_magCount;
   do {
     i--;
-    catalog[_selected].Index++;
-    if (catalog[_selected].Index>getMaxIndex()) catalog[_selected].Index=0;
-  } while (isFiltered() && (i>0));
+    stepIndex(1);
+  } while ((isCellFiltered() || isFiltered()) && (i>0));
   if (isFiltered()) return false; else return true;
 }
 
 bool CatMgr::decIndex() {
-  long i=getMaxIndex()+1;
+  updateCellFilter();
+  updateMagFilter();
+  long i=getMaxIndex()+1; if (_magOrderActive) i=_magCount;
   do {
     i--;
-    catalog[_selected].Index--;
-    if (catalog[_selected].Index<0) catalog[_selected].Index=getMaxIndex();
-  } while (isFiltered() && (i>0));
+    stepIndex(-1);
+  } while ((isCellFiltered() || isFiltered()) && (i>0));
   if (isFiltered()) return false; else return true;
 }
 
+// move to the next (dir=1) or previous (dir=-1) record, in magnitude order when that's in use
+void CatMgr::stepIndex(int dir) {
+  if (_magOrderActive) {
+    if ((_magPos<0) || (_magPos>=_magCount) || (_magOrder[_magPos]!=catalog[_selected].Index)) {
+      if (dir>0) _magPos=-1; else _magPos=_magCount;
+      for (long i=0; i<_magCount; i++) if (_magOrder[i]==catalog[_selected].Index) { _magPos=i; break; }
+    }
+    _magPos+=dir;
+    if (_magPos>=_magCount) _magPos=0;
+    if (_magPos<0) _magPos=_magCount-1;
+    if (_magCount>0) catalog[_selected].Index=_magOrder[_magPos];
+  } else {
+    catalog[_selected].Index+=dir;
+    if (catalog[_selected].Index>getMaxIndex()) catalog[_selected].Index=0;
+    if (catalog[_selected].Index<0) catalog[_selected].Index=getMaxIndex();
+  }
+}
+
+// spatial index
+
+// assign each object of the selected catalog to its declination zone/RA bucket cell, done once per catalog on first use
+void CatMgr::buildCellIndex() {
+  if (_cellCatalog==_selected) return;
+  _cellCatalog=-1;
+  if ((_selected<0) || (getMaxIndex()+1>CatIndexMaxObjects)) return;
+
+  long index=catalog[_selected].Index;
+  for (long i=0; i<=getMaxIndex(); i++) {
+    catalog[_selected].Index=i;
+    int z=floor((dec()+90.0)/10.0); if (z<0) z=0; if (z>CatZones-1) z=CatZones-1;
+    int b=floor(ra()/30.0); if (b<0) b=0; if (b>CatBuckets-1) b=CatBuckets-1;
+    _cell[i]=z*CatBuckets+b;
+  }
+  catalog[_selected].Index=index;
+  _cellCatalog=_selected;
+  _cellFm=-1;
+}
+
+// mark the cells that can hold objects passing the spatial filters (nearby, above horizon, align), conservative by a degree
+// the mask is only recomputed when the filters or telescope position change or the sky has turned by more than 0.5 degrees
+void CatMgr::updateCellFilter() {
+  _cellFilterActive=false;
+  if (!isInitialized()) return;
+  if (!(_fm & (FM_NEARBY | FM_ABOVE_HORIZON | FM_ALIGN_ALL_SKY))) return;
+  buildCellIndex();
+  if (_cellCatalog<0) return;
+
+  double lst=lstDegs();
+  if ((_cellFm!=_fm) || (fabs(lst-_cellLst)>0.5) || (_cellNearbyDist!=_fm_nearby_dist) || (_cellTeleRA!=_lastTeleRA) || (_cellTeleDec!=_lastTeleDec)) {
+    _cellFm=_fm; _cellLst=lst; _cellNearbyDist=_fm_nearby_dist; _cellTeleRA=_lastTeleRA; _cellTeleDec=_lastTeleDec;
+
+    for (int c=0; c<CatCells; c++) {
+      bool candidate=true;
+      if (_fm & FM_NEARBY) { if (CellMinDist(c,_lastTeleRA,_lastTeleDec)>=_fm_nearby_dist+1.0) candidate=false; }
+      if (candidate && (_fm & (FM_ABOVE_HORIZON | FM_ALIGN_ALL_SKY))) {
+        double zenithDist=CellMinDist(c,lst,_lat);
+        if ((_fm & FM_ABOVE_HORIZON) && (zenithDist>91.0)) candidate=false;
+        if ((_fm & FM_ALIGN_ALL_SKY) && (zenithDist>81.0)) candidate=false;
+      }
+      if ((_fm & FM_ALIGN_ALL_SKY) && ((c/CatBuckets==0) || (c/CatBuckets==CatZones-1))) candidate=false;
+      if (candidate) bitSet(_cellMask[c/8],c%8); else bitClear(_cellMask[c/8],c%8);
+    }
+  }
+  _cellFilterActive=true;
+}
+
+// checks to see if the currently selected object lies in a cell that can't pass the spatial filters (returns true if filtered out)
+bool CatMgr::isCellFiltered() {
+  if (!_cellFilterActive) return false;
+  byte c=_cell[catalog[_selected].Index];
+  return !bitRead(_cellMask[c/8],c%8);
+}
+
+// visibility cache
+
+// the cache holds altitudes from at most two passes, the oldest (_visValidLst) is used to limit how long it's trusted
+bool CatMgr::isVisCacheValid() {
+  if (_visValidCatalog!=_selected) return false;
+  return fabs(lstDegs()-_visValidLst)<=0.75;
+}
+
+// checks to see if the currently selected object is below altitude a (in degrees,) the cached altitude is floor()'d and up
+// to 0.75 degrees (three minutes) old so objects within two degrees of the limit are still checked exactly
+bool CatMgr::isBelowAlt(double a) {
+  if (isVisCacheValid()) {
+    int c=_visAlt[catalog[_selected].Index];
+    if (c>=a+2.0) return false;
+    if (c<=a-2.0) return true;
+  }
+  return alt()<a;
+}
+
+// magnitude index
+
+// sort the record numbers of the selected catalog by magnitude, done once per catalog on first use
+void CatMgr::buildMagIndex() {
+  if (_magCatalog==_selected) return;
+  _magCatalog=-1;
+  if ((_selected<0) || (getMaxIndex()+1>CatIndexMaxObjects)) return;
+
+  long n=getMaxIndex()+1;
+  for (long i=0; i<n; i++) _magOrder[i]=i;
+
+  // shell sort (Knuth gaps,) in place and without a second array of magnitudes
+  long gap=1; while (gap<n/3) gap=gap*3+1;
+  for (; gap>0; gap/=3) {
+    for (long i=gap; i<n; i++) {
+      uint16_t r=_magOrder[i];
+      float m=magnitudeOf(r);
+      long j=i;
+      while ((j>=gap) && (magnitudeOf(_magOrder[j-gap])>m)) { _magOrder[j]=_magOrder[j-gap]; j-=gap; }
+      _magOrder[j]=r;
+    }
+  }
+  _magCatalog=_selected;
+  _magPos=-1;
+}
+
+// when filtering by magnitude browse brightest first and only visit the records up to the magnitude limit
+void CatMgr::updateMagFilter() {
+  _magOrderActive=false;
+  if (!isInitialized()) return;
+  if (!(_fm & (FM_BY_MAG | FM_ALIGN_ALL_SKY))) return;
+  buildMagIndex();
+  if (_magCatalog<0) return;
+
+  long lo=0;
+  long hi=getMaxIndex()+1;
+  while (lo<hi) {
+    long mid=(lo+hi)/2;
+    if (isMagPassed(magnitudeOf(_magOrder[mid]))) lo=mid+1; else hi=mid;
+  }
+  _magCount=lo;
+  _magOrderActive=true;
+}
+
+// checks to see if magnitude m passes the magnitude filters, matches isFiltered()
+bool CatMgr::isMagPassed(float m) {
+  if ((_fm & FM_BY_MAG) && (m>=_fm_mag_limit)) return false;
+  if ((_fm & FM_ALIGN_ALL_SKY) && (m>3.0)) return false;
+  return true;
+}
+
+// magnitude of the given record in the selected catalog
+float CatMgr::magnitudeOf(long index) {
+  long i=catalog[_selected].Index;
+  catalog[_selected].Index=index;
+  float m=magnitude();
+  catalog[_selected].Index=i;
+  return m;
+}
+
 // get catalog contents
 
 // RA, converted from hours to degrees
@@ -341,7 +592,8 @@ double CatMgr::rah() {
   if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
   if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].RA; else
   if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else return 0;
+  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
+  if (isBlkCatalog())                    return blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->RA/2730.6666666666666; else return 0;
 }
 
 // HA in degrees
@@ -377,7 +629,8 @@ double CatMgr::dec() {
   if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
   if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].DE; else
   if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else return 0;
+  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
+  if (isBlkCatalog())                    return blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->DE/364.07777777777777; else return 0;
 }
 
 // Declination as degrees, minutes, seconds
@@ -506,7 +759,8 @@ float CatMgr::magnitude() {
   if (catalogType()==CAT_VAR_STAR_COMP)  { int m=_varStarCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
   if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Mag/100.0; else
   if (catalogType()==CAT_DSO_COMP)       { int m=_dsoCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
-  if (catalogType()==CAT_DSO_VCOMP)      { int m=_dsoVCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else return 99.9;
+  if (catalogType()==CAT_DSO_VCOMP)      { int m=_dsoVCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
+  if (isBlkCatalog())                    { int m=blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else return 99.9;
 }
 
 // Secondary magnitude of an star.  For double stars this is the magnitude of the secondary.  For variables this is the minimum brightness.
@@ -531,7 +785,8 @@ byte CatMgr::constellation() {
   if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].Cons; else
   if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Cons; else
   if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Cons; else return 89;
+  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Cons; else
+  if (isBlkCatalog())                    return blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Cons; else return 89;
 }
 
 // Constellation string
@@ -553,9 +808,11 @@ byte CatMgr::objectType() {
   if (catalogType()==CAT_DBL_STAR_COMP)  return 2; else
   if (catalogType()==CAT_VAR_STAR)       return 2; else
   if (catalogType()==CAT_VAR_STAR_COMP)  return 2; else
+  if (catalogType()==CAT_GEN_STAR_BLK)   return 2; else
   if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Obj_type; else
   if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].Obj_type; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Obj_type; else return -1;
+  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Obj_type; else
+  if (catalogType()==CAT_DSO_BLK)        return blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Obj_type; else return -1;
 }
 
 // Object type string
@@ -569,20 +826,36 @@ const char* CatMgr::objectTypeCodeToStr(int code) {
   if ((code>=0) && (code<=20)) return Txt_Object_Type[code]; else return "";
 }
 
+// Object has a name (Has_name set)
+bool CatMgr::hasName() {
+  if (_selected<0) return false;
+  if (isBlkCatalog()) return blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Has_name;
+  if (catalogType()==CAT_GEN_STAR)       { if (!_genStarCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_GEN_STAR_VCOMP) { if (!_genStarVCompCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_DBL_STAR)       { if (!_dblStarCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_DBL_STAR_COMP)  { if (!_dblStarCompCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_VAR_STAR)       { if (!_varStarCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_VAR_STAR_COMP)  { if (!_varStarCompCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_DSO)            { if (!_dsoCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_DSO_COMP)       { if (!_dsoCompCatalog[catalog[_selected].Index].Has_name) return false; } else
+  if (catalogType()==CAT_DSO_VCOMP)      { if (!_dsoVCompCatalog[catalog[_selected].Index].Has_name) return false; } else return false;
+  return true;
+}
+
 // Object name code (encoded by Has_name.)  Returns -1 if the object doesn't have a name code.
 long CatMgr::objectName() {
   if (_selected<0) return -1;
 
+  // block compressed catalogs count names from the start of the block
+  if (isBlkCatalog()) {
+    if (!blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Has_name) return -1;
+    long result=_blkNameBase-1;
+    for (long i=0; i<=catalog[_selected].Index%CatBlkRecs; i++) { if (_blkCache[i].Has_name) result++; }
+    return result;
+  }
+
   // does it have a name? if not just return
-  if (catalogType()==CAT_GEN_STAR)       { if (!_genStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { if (!_genStarVCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DBL_STAR)       { if (!_dblStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { if (!_dblStarCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_VAR_STAR)       { if (!_varStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { if (!_varStarCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO)            { if (!_dsoCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO_COMP)       { if (!_dsoCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO_VCOMP)      { if (!_dsoVCompCatalog[catalog[_selected].Index].Has_name) return -1; } else return -1;
+  if (!hasName()) return -1;
 
   // find the code
   long result=-1;
@@ -606,7 +879,7 @@ long CatMgr::objectName() {
 const char* CatMgr::objectNameStr() {
   if (_selected<0) return "";
   long elementNum=objectName();
-  if (elementNum>=0) return getElementFromString(catalog[_selected].ObjectNames,elementNum); else return "";
+  if (elementNum>=0) return expandDictionary(getElementFromString(catalog[_selected].ObjectNames,elementNum)); else return "";
 }
 
 // Object Id
@@ -621,7 +894,8 @@ long CatMgr::primaryId() {
   if (catalogType()==CAT_VAR_STAR_COMP)  id=_varStarCompCatalog[catalog[_selected].Index].Obj_id; else
   if (catalogType()==CAT_DSO)            id=_dsoCatalog[catalog[_selected].Index].Obj_id; else
   if (catalogType()==CAT_DSO_COMP)       id=_dsoCompCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_DSO_VCOMP)      id=catalog[_selected].Index+1; else return -1;
+  if (catalogType()==CAT_DSO_VCOMP)      id=catalog[_selected].Index+1; else
+  if (isBlkCatalog())                    id=blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Obj_id; else return -1;
   if (id<1) return -1;
   return id;
 }
@@ -630,6 +904,14 @@ long CatMgr::primaryId() {
 long CatMgr::subId() {
   if (_selected<0) return -1;
 
+  // block compressed catalogs count subIds from the start of the block
+  if (isBlkCatalog()) {
+    if (!blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Has_subId) return -1;
+    long result=_blkSubIdBase-1;
+    for (long i=0; i<=catalog[_selected].Index%CatBlkRecs; i++) { if (_blkCache[i].Has_subId) result++; }
+    return result;
+  }
+
   // does it have a note? if not just return
   if (catalogType()==CAT_GEN_STAR)       { if (!_genStarCatalog[catalog[_selected].Index].Has_subId) return -1; } else
   if (catalogType()==CAT_GEN_STAR_VCOMP) { if (!_genStarVCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else
@@ -663,7 +945,7 @@ long CatMgr::subId() {
 const char* CatMgr::subIdStr() {
   if (_selected<0) return "";
   long elementNum=subId();
-  if (elementNum>=0) return getElementFromString(catalog[_selected].ObjectSubIds,elementNum); else return "";
+  if (elementNum>=0) return expandDictionary(getElementFromString(catalog[_selected].ObjectSubIds,elementNum)); else return "";
 }
 
 // For Bayer designated Stars 0 = Alp, etc. to 23. For Fleemstead designated Stars 25 = '1', etc.
@@ -675,7 +957,8 @@ int CatMgr::bayerFlam() {
   if (catalogType()==CAT_DBL_STAR)       bf=_dblStarCatalog[catalog[_selected].Index].BayerFlam; else
   if (catalogType()==CAT_DBL_STAR_COMP)  bf=_dblStarCompCatalog[catalog[_selected].Index].BayerFlam; else
   if (catalogType()==CAT_VAR_STAR)       bf=_varStarCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  bf=_varStarCompCatalog[catalog[_selected].Index].BayerFlam; else return -1;
+  if (catalogType()==CAT_VAR_STAR_COMP)  bf=_varStarCompCatalog[catalog[_selected].Index].BayerFlam; else
+  if (catalogType()==CAT_GEN_STAR_BLK)   bf=blkRec(catalog[_selected].Index,catalog[_selected].NumObjects)->Obj_type; else return -1;
   if (bf==24) return -1; else return bf;
 }
 
@@ -695,32 +978,291 @@ const char* CatMgr::bayerFlamStr() {
   return "";
 }
 
+// search
+
+// searches all catalogs for a designation like "M3" or "NGC 7000" then for a common name with a word starting with the text
+// like "Veil", names that start with the text are preferred and the first match is selected.  Returns false if nothing matched
+bool CatMgr::search(const char *text) {
+  char name[16];
+  char desig[16];
+  int i=0, k=0;
+  while (text[i]==' ') i++;
+  for (; (text[i]!=0) && (k<15); i++) {
+    name[k++]=toupper(text[i]);
+  }
+  while ((k>0) && (name[k-1]==' ')) k--;
+  name[k]=0;
+  if (k==0) return false;
+
+  // designation, leading letters then a number
+  k=0;
+  for (i=0; name[i]!=0; i++) if (name[i]!=' ') desig[k++]=name[i];
+  desig[k]=0;
+  long id=-1;
+  for (i=0; isalpha(desig[i]); i++) ;
+  if ((i>0) && (desig[i]!=0)) {
+    char *conv_end;
+    id=strtol(&desig[i],&conv_end,10);
+    if ((*conv_end!=0) || (id<1)) id=-1;
+    desig[i]=0;
+    if (strcmp(desig,"NGC")==0) strcpy(desig,"N");
+    if (strcmp(desig,"IC")==0) strcpy(desig,"I");
+  }
+
+  if (!_searchBuilt) buildSearchIndex();
+
+  int lastSelected=_selected;
+  if (id>=0) {
+    for (int c=0; c<numCatalogs(); c++) {
+      select(c);
+      if (_selected<0) continue;
+      if (searchDesignation(desig,id)) return true;
+    }
+  }
+  if (searchName(name)) return true;
+  select(lastSelected);
+  return false;
+}
+
+// looks in the selected catalog for a designation (prefix in upper case w/o spaces and id,) only catalogs with a single prefix
+bool CatMgr::searchDesignation(const char *prefix, long id) {
+  const char *s=catalog[_selected].Prefix;
+  if (strstr(s,";")) return false;
+
+  char p[16];
+  int k=0;
+  for (int i=0; (s[i]!=0) && (k<15); i++) if (s[i]!=' ') p[k++]=toupper(s[i]);
+  p[k]=0;
+  if (strcmp(p,prefix)!=0) return false;
+
+  // catalogs in id order are bisected down to one record, the others are scanned
+  long index=catalog[_selected].Index;
+  long lo=0;
+  long hi=getMaxIndex();
+  if ((_selected<64) && (_searchIdSorted & ((uint64_t)1<<_selected))) {
+    while (lo<hi) {
+      long mid=(lo+hi)/2;
+      catalog[_selected].Index=mid;
+      if (primaryId()<id) lo=mid+1; else hi=mid;
+    }
+  }
+  for (long i=lo; i<=hi; i++) {
+    catalog[_selected].Index=i;
+    if (primaryId()==id) return true;
+  }
+  catalog[_selected].Index=index;
+  return false;
+}
+
+// search index key, the first three characters (upper case) of a word in base 40 with zero past the end
+static uint8_t searchCode(char c) {
+  c=toupper((unsigned char)c);
+  if (c==0) return 0;
+  if ((c>='A') && (c<='Z')) return c-'A'+1;
+  if ((c>='0') && (c<='9')) return c-'0'+27;
+  if (c=='-') return 37;
+  if (c==' ') return 38;
+  return 39;
+}
+
+static uint16_t searchKey(const char *s) {
+  uint16_t key=0;
+  bool end=false;
+  for (int i=0; i<3; i++) {
+    uint8_t c=end?0:searchCode(s[i]);
+    if (c==0) end=true;
+    key=key*40+c;
+  }
+  return key;
+}
+
+// search index reference, bit 31 is set for words that don't start the name so those sort after names starting with the same
+// letters, then catalog (6 bits,) word offset in the expanded name (5 bits) and name element (20 bits)
+#define SearchRef(notStart,cat,offset,element) (((uint32_t)(notStart)<<31) | ((uint32_t)(cat)<<25) | ((uint32_t)(offset)<<20) | (uint32_t)(element))
+#define SearchRefCatalog(ref) (((ref)>>25) & 63)
+#define SearchRefOffset(ref)  (((ref)>>20) & 31)
+#define SearchRefElement(ref) ((ref) & 0xfffff)
+
+// walk the common names of all catalogs once and index every word, then sort by key so a search is a bisection rather than a scan
+void CatMgr::buildSearchIndex() {
+  int lastSelected=_selected;
+  _searchCount=0;
+  _searchIdSorted=0;
+  for (int c=0; (c<numCatalogs()) && (c<64); c++) {
+    select(c);
+    if (_selected<0) continue;
+
+    // note catalogs in id order (repeats allowed, components share an id) so designations can be bisected
+    long index=catalog[c].Index;
+    bool sorted=true;
+    long last=0;
+    for (long r=0; (r<=getMaxIndex()) && sorted; r++) {
+      catalog[c].Index=r;
+      long id=primaryId();
+      if (id<last) sorted=false;
+      last=id;
+    }
+    catalog[c].Index=index;
+    if (sorted) _searchIdSorted|=(uint64_t)1<<c;
+
+    // double and variable star catalogs keep spectral types and the like in their names, those aren't searched
+    if (isDblStarCatalog() || isVarStarCatalog()) continue;
+    const char *data=catalog[c].ObjectNames;
+    if (data==NULL) continue;
+
+    long element=0;
+    long i=0;
+    while ((data[i]!=0) && (element<=0xfffff)) {
+      char raw[40];
+      int k=0;
+      for (; (data[i]!=0) && (data[i]!=';'); i++) if (k<39) raw[k++]=data[i];
+      raw[k]=0;
+      if (data[i]==';') i++;
+
+      const char *e=expandDictionary(raw);
+      for (int j=0; (e[j]!=0) && (j<32); j++) {
+        if ((j>0) && (e[j-1]!=' ')) continue;
+        if ((e[j]==' ') || (_searchCount>=CatSearchMaxWords)) continue;
+        _searchKey[_searchCount]=searchKey(&e[j]);
+        _searchRef[_searchCount]=SearchRef(j>0,c,j,element);
+        _searchCount++;
+      }
+      element++;
+    }
+  }
+
+  // shell sort (Knuth gaps) by key then reference
+  long n=_searchCount;
+  long gap=1; while (gap<n/3) gap=gap*3+1;
+  for (; gap>0; gap/=3) {
+    for (long i=gap; i<n; i++) {
+      uint16_t key=_searchKey[i];
+      uint32_t ref=_searchRef[i];
+      long j=i;
+      while ((j>=gap) && ((_searchKey[j-gap]>key) || ((_searchKey[j-gap]==key) && (_searchRef[j-gap]>ref)))) {
+        _searchKey[j]=_searchKey[j-gap];
+        _searchRef[j]=_searchRef[j-gap];
+        j-=gap;
+      }
+      _searchKey[j]=key;
+      _searchRef[j]=ref;
+    }
+  }
+  _searchBuilt=true;
+  select(lastSelected);
+}
+
+// looks in the search index for a common name (in upper case) with a word starting with name, the lowest reference wins
+bool CatMgr::searchName(const char *name) {
+  int len=strlen(name);
+
+  // the keys of words starting with the first (up to three) letters run from lo to hi
+  uint16_t lo=searchKey(name);
+  uint16_t hi=lo;
+  if (len<3) { uint16_t span=1; for (int i=len; i<3; i++) span*=40; hi=lo+span-1; }
+
+  long a=0;
+  long b=_searchCount;
+  while (a<b) {
+    long mid=(a+b)/2;
+    if (_searchKey[mid]<lo) a=mid+1; else b=mid;
+  }
+
+  // up to three letters any word in the range matches, past that compare the rest of the name
+  long found=-1;
+  for (long i=a; (i<_searchCount) && (_searchKey[i]<=hi); i++) {
+    if (len<=3) {
+      if ((found<0) || (_searchRef[i]<_searchRef[found])) found=i;
+    } else {
+      int c=SearchRefCatalog(_searchRef[i]);
+      select(c);
+      const char *e=expandDictionary(getElementFromString(catalog[c].ObjectNames,SearchRefElement(_searchRef[i])));
+      e+=SearchRefOffset(_searchRef[i]);
+      int m=0;
+      while ((m<len) && (e[m]!=0) && (toupper(e[m])==name[m])) m++;
+      if (m==len) { found=i; break; }
+    }
+  }
+  if (found<0) return false;
+  return selectNamed(SearchRefCatalog(_searchRef[found]),SearchRefElement(_searchRef[found]));
+}
+
+// selects catalog cat and the record with the given name element
+bool CatMgr::selectNamed(int cat, long element) {
+  select(cat);
+  if (_selected<0) return false;
+  long index=catalog[_selected].Index;
+  for (long r=0; r<=getMaxIndex(); r++) {
+    catalog[_selected].Index=r;
+    if (hasName()) { if (element==0) return true; element--; }
+  }
+  catalog[_selected].Index=index;
+  return false;
+}
+
 // support functions
 
 // returns elementNum 'th element from the comma delimited string where the 0th element is the first etc.
 const char* CatMgr::getElementFromString(const char *data, long elementNum) {
   static char result[40] = "";
+  if ((data==NULL) || (elementNum<0)) return "";
 
-  // find the string start index
-  bool found=false;
-  long j=0;
+  // start scanning from the nearest checkpoint
+  long i=0;
   long n=elementNum;
-  long len=strlen(data);
-  for (long i=0; i<len; i++) {
-    if (n==0) { j=i; found=true; break; }
-    if (data[i]==';') { n--; }
+  int t=elementTable(data);
+  if (t>=0) {
+    long c=elementNum/CatElementStride;
+    if (c>_elementCount[t]-1) c=_elementCount[t]-1;
+    i=_elementOffset[t][c];
+    n-=c*CatElementStride;
   }
 
+  // find the string start index
+  for (; (data[i]!=0) && (n>0); i++) { if (data[i]==';') n--; }
+  if (data[i]==0) return "";
+
   // return the string
-  if (found) {
-    long k=0;
-    for (long i=j; i<len; i++) {
-      result[k++]=data[i];
-      if (result[k-1]==';') { result[k-1]=0; break; }
-      if (i==len-1) { result[k]=0; break; }
-    }
-    return result;
-  } else return "";
+  long k=0;
+  for (; (data[i]!=0) && (data[i]!=';') && (k<39); i++) result[k++]=data[i];
+  result[k]=0;
+  return result;
+}
+
+// expands the dictionary words (bytes 128 to 254) in a block compressed catalog's name or subId string
+const char* CatMgr::expandDictionary(const char *s) {
+  if (!isBlkCatalog() || (_blkCatalog->Dictionary==NULL)) return s;
+  static char result[40] = "";
+  char raw[40];
+  strcpy(raw,s);
+
+  int k=0;
+  for (int i=0; (raw[i]!=0) && (k<39); i++) {
+    unsigned char c=raw[i];
+    if ((c>=128) && (c<255)) {
+      const char *w=getElementFromString(_blkCatalog->Dictionary,c-128);
+      for (int j=0; (w[j]!=0) && (k<39); j++) result[k++]=w[j];
+    } else result[k++]=c;
+  }
+  result[k]=0;
+  return result;
+}
+
+// find or build the checkpoint table (offset of every 64th element) for this string, returns the table number or -1
+int CatMgr::elementTable(const char *data) {
+  for (int t=0; t<CatElementTables; t++) if (_elementData[t]==data) return t;
+
+  int t=_elementNext;
+  _elementNext=(_elementNext+1)%CatElementTables;
+  _elementData[t]=data;
+  _elementOffset[t][0]=0;
+  int c=1;
+  long n=0;
+  for (long i=0; (data[i]!=0) && (c<CatElementCheckpoints) && (i<65535); i++) {
+    if (data[i]==';') { n++; if (n%CatElementStride==0) _elementOffset[t][c++]=i+1; }
+  }
+  _elementCount[t]=c;
+  return t;
 }
 
 // angular distance from current Equ coords, in degrees
@@ -729,6 +1271,29 @@ double CatMgr::DistFromEqu(double RA, double Dec) {
   return acos( sin(dec()/Rad)*sin(Dec) + cos(dec()/Rad)*cos(Dec)*cos(ra()/Rad - RA))*Rad;
 }
 
+// smallest angular distance from the given Equ coords to any point in a spatial index cell, in degrees
+double CatMgr::CellMinDist(int cell, double RA, double Dec) {
+  double d1=(cell/CatBuckets)*10.0-90.0;
+  double d2=d1+10.0;
+  double dRA=RA-((cell%CatBuckets)*30.0+15.0);
+  while (dRA>180.0)   dRA-=360.0;
+  while (dRA<=-180.0) dRA+=360.0;
+
+  // within the cell's RA range the closest point is along the meridian
+  if (fabs(dRA)<=15.0) { if (Dec<d1) return d1-Dec; if (Dec>d2) return Dec-d2; return 0; }
+
+  // otherwise it's on the nearer edge meridian, where cos(dist)=A*sin(d)+B*cos(d) peaks at atan2(A,B) or an end point
+  dRA=(fabs(dRA)-15.0)/Rad;
+  double A=sin(Dec/Rad);
+  double B=cos(Dec/Rad)*cos(dRA);
+  double dm=atan2(A,B)*Rad; if (dm<d1) dm=d1; if (dm>d2) dm=d2;
+  double c=A*sin(dm/Rad)+B*cos(dm/Rad);
+  double c1=A*sin(d1/Rad)+B*cos(d1/Rad); if (c1>c) c=c1;
+  double c2=A*sin(d2/Rad)+B*cos(d2/Rad); if (c2>c) c=c2;
+  if (c>1.0) c=1.0; if (c<-1.0) c=-1.0;
+  return acos(c)*Rad;
+}
+
 // convert an HA to RA, in degrees
 double CatMgr::HAToRA(double HA) {
   return (lstDegs()-HA);
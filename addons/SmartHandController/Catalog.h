@@ -13,7 +13,31 @@ const unsigned int FM_DBL_MIN_SEP    = 64;
 const unsigned int FM_DBL_MAX_SEP    = 128;
 const unsigned int FM_VAR_MAX_PER    = 256;
 
-enum CAT_TYPES {CAT_NONE, CAT_GEN_STAR, CAT_GEN_STAR_VCOMP, CAT_DBL_STAR, CAT_DBL_STAR_COMP, CAT_VAR_STAR, CAT_VAR_STAR_COMP, CAT_DSO, CAT_DSO_COMP, CAT_DSO_VCOMP};
+// spatial index, each object is assigned to one of 18 declination zones (10 degrees) x 12 RA buckets (30 degrees)
+const int CatZones   = 18;
+const int CatBuckets = 12;
+const int CatCells   = CatZones*CatBuckets;
+
+// offset index for the ';' delimited name and subId strings, a checkpoint every 64 elements for up to four strings
+const int CatElementStride      = 64;
+const int CatElementCheckpoints = 128;
+const int CatElementTables      = 4;
+
+// largest catalog (number of objects) the spatial/magnitude indexes and visibility cache are built for, larger catalogs are scanned object by object
+#if defined(ESP32) || defined(__IMXRT1052__) || defined(__IMXRT1062__)
+  #define CatIndexMaxObjects 12000
+#else
+  #define CatIndexMaxObjects 2500
+#endif
+
+// common name search index, words (of any catalog) past this many aren't indexed and can't be found by name
+#if defined(ESP32) || defined(__IMXRT1052__) || defined(__IMXRT1062__)
+  #define CatSearchMaxWords 4096
+#else
+  #define CatSearchMaxWords 2048
+#endif
+
+enum CAT_TYPES {CAT_NONE, CAT_GEN_STAR, CAT_GEN_STAR_VCOMP, CAT_DBL_STAR, CAT_DBL_STAR_COMP, CAT_VAR_STAR, CAT_VAR_STAR_COMP, CAT_DSO, CAT_DSO_COMP, CAT_DSO_VCOMP, CAT_GEN_STAR_BLK, CAT_DSO_BLK};
 
 class CatMgr {
   public:
@@ -23,6 +47,9 @@ class CatMgr {
     void        setLastTeleEqu(double RA, double Dec);
     bool        isInitialized();
 
+// background tasks, call often
+    void        poll();
+
 // time
     double      lstDegs();
     double      lstHours();
@@ -56,6 +83,9 @@ class CatMgr {
     bool        incIndex();
     bool        decIndex();
 
+// search all catalogs
+    bool        search(const char *text);
+
 // get catalog contents
     int         epoch();
 
@@ -118,8 +148,70 @@ private:
     int _selected=0;
 
     bool isFiltered();
+    bool isBlkCatalog();
+    bool hasName();
+    bool searchDesignation(const char *prefix, long id);
+    bool searchName(const char *name);
+    bool selectNamed(int cat, long element);
+
+    // search index, the words of the common names sorted by their first three letters, built once on first use
+    uint16_t _searchKey[CatSearchMaxWords];
+    uint32_t _searchRef[CatSearchMaxWords];
+    long     _searchCount=0;
+    bool     _searchBuilt=false;
+    uint64_t _searchIdSorted=0;
+
+    void buildSearchIndex();
+
+    // spatial index
+    byte   _cell[CatIndexMaxObjects];
+    byte   _cellMask[CatCells/8+1];
+    int    _cellCatalog=-1;
+    bool   _cellFilterActive=false;
+    int    _cellFm=FM_NONE;
+    double _cellLst=0;
+    double _cellNearbyDist=0;
+    double _cellTeleRA=0;
+    double _cellTeleDec=0;
+
+    void buildCellIndex();
+    void updateCellFilter();
+    bool isCellFiltered();
+    double CellMinDist(int cell, double RA, double Dec);
+
+    // magnitude index, catalog record numbers sorted brightest first
+    uint16_t _magOrder[CatIndexMaxObjects];
+    int      _magCatalog=-1;
+    bool     _magOrderActive=false;
+    long     _magCount=0;
+    long     _magPos=-1;
+
+    void buildMagIndex();
+    void updateMagFilter();
+    bool isMagPassed(float m);
+    float magnitudeOf(long index);
+    void stepIndex(int dir);
+
+    // visibility cache, coarse altitude (whole degrees) of each object in the selected catalog refreshed once a minute
+    int8_t   _visAlt[CatIndexMaxObjects];
+    int      _visCatalog=-1;
+    long     _visNext=0;
+    double   _visPassLst=0;
+    double   _visPassLat=0;
+    int      _visValidCatalog=-1;
+    double   _visValidLst=0;
+
+    bool isVisCacheValid();
+    bool isBelowAlt(double a);
 
     const char* getElementFromString(const char *data, long elementNum);
+    const char* expandDictionary(const char *s);
+    int         elementTable(const char *data);
+
+    const char* _elementData[CatElementTables];
+    uint16_t    _elementOffset[CatElementTables][CatElementCheckpoints];
+    int         _elementCount[CatElementTables];
+    int         _elementNext=0;
     double DistFromEqu(double RA, double Dec);
     double HAToRA(double ha);
     void EquToHor(double RA, double Dec, double *Alt, double *Azm);
@@ -9,6 +9,9 @@
 // ngc.h          // for the full ngc catalog at the highest accuracy.
 // ngc_vc.h       // for a nearly complete ngc catalog at somewhat reduced accuracy, but much smaller size (50% of above.)
 // ngc_select_c.h // for a selection of the brighter objects from the ngc catalog at somewhat reduced accuracy.
+// Catalogs with the _blk suffix use the block compressed format (see CatalogTypes.h,) they're decoded on demand and have the
+// accuracy of the compact catalogs in well under half the flash of the full ones (the NGC takes 49665 bytes vs 114156.)
+// catalogs/make_blk.py builds them from the full and compact DSO and general star catalogs.
 
 // Note: You can navigate to and open the SmartHandController's catalogs directory in the Arduino IDE to see the available catalogs.
 #if defined(ESP32)
@@ -21,8 +24,8 @@
   #include "catalogs/caldwell.h"        // The Caldwell (supplement) catalog of 109 DSO's
   #include "catalogs/herschel.h"        // Herschel's "400 best of the NGC" catalog
   #include "catalogs/collinder.h"       // The Collinder catalog of 471 open clusters
-  #include "catalogs/ngc.h"             // The New General Catalog of 8154 DSO's
-  #include "catalogs/ic.h"              // The Index Catalog (supplement) of 5400 DSO's
+  #include "catalogs/ngc_blk.h"         // The New General Catalog of 8154 DSO's, block compressed from ngc.h
+  #include "catalogs/ic_blk.h"          // The Index Catalog (supplement) of 5400 DSO's, block compressed from ic.h
 #elif defined(__IMXRT1052__) || defined(__IMXRT1062__) // Teensy4.0
   #include "catalogs/stars.h"           // Catalog of 408 bright stars
   #include "catalogs/stf.h"             // Struve STF catalog, limited to 4313 double stars
@@ -33,8 +36,8 @@
   #include "catalogs/caldwell.h"        // The Caldwell (supplement) catalog of 109 DSO's
   #include "catalogs/herschel.h"        // Herschel's "400 best of the NGC" catalog
   #include "catalogs/collinder.h"       // The Collinder catalog of 471 open clusters
-  #include "catalogs/ngc_vc.h"          // The New General Catalog of 8154 DSO's
-  #include "catalogs/ic_select_c.h"     // The Index Catalog (supplement) of 473 DSO's, limited to Magnitude 16 AND with surface brightness >= 22.5m/arc-sec^2
+  #include "catalogs/ngc_blk.h"         // The New General Catalog of 8154 DSO's, block compressed from ngc.h
+  #include "catalogs/ic_blk.h"          // The Index Catalog (supplement) of 5400 DSO's, block compressed from ic.h
 #else // Teensy3.2
   #include "catalogs/stars_vc.h"        // Catalog of 408 bright stars
   #include "catalogs/stf_select_c.h"    // Struve STF catalog, limited to 595 double stars brighter than Magnitude 8.5
@@ -12,7 +12,7 @@
 typedef struct {
   const char           Title[32];
   const char*          Prefix;
-  const unsigned short NumObjects;
+  const unsigned long  NumObjects;
   const void*          Objects;
   const char*          ObjectNames;
   const char*          ObjectSubIds;
@@ -139,6 +139,41 @@ typedef struct {
 
 #pragma pack()
 
+// Block compressed catalogs (CAT_GEN_STAR_BLK and CAT_DSO_BLK), the records are stored in blocks of CatBlkRecs records
+// that CatMgr decodes on demand into a one block cache. The catalog_t Objects pointer is to a blk_catalog_t.
+// These are built by catalogs/make_blk.py from a compact or full DSO/star catalog, optionally sorted by RA.
+//
+// Block header (8 bytes): RA of the block (uint16,) number of names before this block (24 bits,) number of subIds before
+// this block (24 bits,) all little endian.
+// Record: a flags byte then [Cons] [Obj_type or BayerFlam] [Mag] RA delta (varint) DE (int16) [Obj_id delta (varint)]
+//   flags: 1 = Has_name, 2 = Has_subId, 4 = Cons byte follows (else same as the previous record in the block,)
+//          8 = Obj_type/BayerFlam byte follows (else same as previous,) 16 = Mag byte follows (else unknown,)
+//          32 = Obj_id delta follows (the id is the record number+1 plus an offset that starts at zero in each block,
+//          the delta is added to the offset and it holds for the rest of the block)
+//   RA is the delta from the previous record (or the block RA) in 65536ths of 24 hours, DE/Mag are scaled as in the
+//   compact structs above. Varints are 7 bits per byte, low bits first, with the high bit set on all but the last byte,
+//   and zigzag coded (0, -1, 1, -2, ... are 0, 1, 2, 3, ...) so small steps either way take one byte.
+// Name and subId strings can use dictionary compression, bytes 128 to 254 expand to word 0 to 126 of the Dictionary.
+#define CatBlkRecs 32
+
+typedef struct {
+  const unsigned char* Data;
+  const unsigned long* BlockOffset; // offset of each block in Data
+  const char*          Dictionary;  // ';' delimited words, or NULL
+} blk_catalog_t;
+
+// Decoded record from a block compressed catalog
+typedef struct {
+  unsigned char  Has_name;
+  unsigned char  Has_subId;
+  unsigned char  Cons;
+  unsigned char  Obj_type;          // Obj_type for DSO's, BayerFlam for stars
+  unsigned char  Mag;
+  unsigned short RA;
+  signed   short DE;
+  unsigned long  Obj_id;
+} blk_rec_t;
+
 // Bayer designation, the Greek letter for each star within a constellation
 const char* Txt_Bayer[25] = {
   "Alp","Bet","Gam","Del","Eps","Zet","Eta","The","Iot","Kap","Lam","Mu","Nu","Xi","Omi","Pi","Rho","Sig","Tau","Ups","Phi","Chi","Psi","Ome","?"
@@ -11,6 +11,8 @@
 
 #define TIMEOUT_CMD         1000  // Default=1000 (1 second)
 #define BACKGROUND_CMD_RATE 300   // Default=300, regulates the background command rate
+#define BACKGROUND_CMD_RATE_FAST 150  // Default=150, background command rate while slewing, parking, or guiding
+#define BACKGROUND_CMD_RATE_SLOW 900  // Default=900, background command rate while parked or not tracking
 
 // Helper macros for debugging, with less typing
 // Use VF or VLF for strings (supports embedded spaces)
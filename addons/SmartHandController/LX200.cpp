@@ -34,26 +34,21 @@ void char2DEC(char* txt, int& deg, unsigned int& min, unsigned int& sec)
   sec = (int)strtol(&txt[7], &pEnd, 10);
 }
 
-// smart LX200 aware command and response over serial
-bool processCommand(char* command, char* response, unsigned long timeOutMs) {
-  Ser.setTimeout(timeOutMs);
-
-  // clear the read/write buffers
-  Ser.flush();
-  serialRecvFlush();
-
-  // send the command
-  Ser.print(command);
+enum ResponseType {RT_NONE, RT_SHORT, RT_FULL};
 
+// decides if a command has no response, a short (single character) response, or a full '#' terminated response and adjusts
+// the time out to suit
+ResponseType responseType(const char* command, unsigned long &timeOutMs) {
   boolean noResponse = false;
   boolean shortResponse = false;
+  unsigned long shortTimeOutMs = timeOutMs;
   if ((command[0] == (char)6) && (command[1] == 0)) shortResponse = true;
   if (command[0] == ':') {
     if (command[1] == '%') {
-      Ser.setTimeout(timeOutMs * 4);
+      shortTimeOutMs = timeOutMs * 4;
     }
     if (command[1] == 'A') {
-      if (strchr("W123456789+", command[2])) { shortResponse = true; Ser.setTimeout(1000); }
+      if (strchr("W123456789+", command[2])) { shortResponse = true; shortTimeOutMs = 1000; }
     }
     if ((command[1]=='F') || (command[1]=='f')) {
       if (strchr("+-QZHhFS1234",command[2])) noResponse=true;
@@ -84,7 +79,7 @@ bool processCommand(char* command, char* response, unsigned long timeOutMs) {
     }
     if (command[1] == 'h') {
       if (strchr("F", command[2])) noResponse = true;
-      if (strchr("COPQR", command[2])) { shortResponse = true; Ser.setTimeout(timeOutMs * 2); }
+      if (strchr("COPQR", command[2])) { shortResponse = true; shortTimeOutMs = timeOutMs * 2; }
     }
     if (command[1] == 'T') {
       if (strchr("QR+-SLK", command[2])) noResponse = true;
@@ -100,12 +95,120 @@ bool processCommand(char* command, char* response, unsigned long timeOutMs) {
     }
   }
 
-  if (noResponse) {
+  if (noResponse) return RT_NONE;
+  if (shortResponse) { timeOutMs = shortTimeOutMs; return RT_SHORT; }
+  return RT_FULL;
+}
+
+// non-blocking command queue, up to LX200_PIPELINE_DEPTH commands are sent ahead and their responses are matched up in order
+// as the characters arrive.  On completion the response is copied to the requester's buffer and its result flag set.
+#define LX200_QUEUE_SIZE     6
+#define LX200_PIPELINE_DEPTH 3
+
+typedef struct {
+  char command[20];
+  char *response;
+  bool *result;
+  ResponseType type;
+  unsigned long timeOutMs;
+} lx200Request_t;
+
+lx200Request_t lx200Queue[LX200_QUEUE_SIZE];
+int  lx200QueueHead = 0;     // oldest request, the one whose response is expected next
+int  lx200QueueCount = 0;    // requests in the queue
+int  lx200QueueSent = 0;     // of those, the number already sent
+unsigned long lx200QueueStart = 0;
+char lx200QueueResponse[20];
+int  lx200QueueResponsePos = 0;
+
+// finish the oldest request
+void completeLX200(bool success) {
+  lx200Request_t *r = &lx200Queue[lx200QueueHead];
+  if (success) strcpy(r->response, lx200QueueResponse);
+  if (r->result != NULL) *r->result = success;
+  lx200QueueHead = (lx200QueueHead + 1) % LX200_QUEUE_SIZE;
+  lx200QueueCount--;
+  lx200QueueSent--;
+  lx200QueueResponsePos = 0; lx200QueueResponse[0] = 0;
+  lx200QueueStart = millis();
+}
+
+// add a command to the queue, returns false if the queue is full
+bool queueLX200(const char* command, char* response, bool* result) {
+  // already waiting on this one?
+  for (int i = 0; i < lx200QueueCount; i++) {
+    lx200Request_t *r = &lx200Queue[(lx200QueueHead + i) % LX200_QUEUE_SIZE];
+    if ((r->response == response) && (strcmp(r->command, command) == 0)) return true;
+  }
+  if ((lx200QueueCount >= LX200_QUEUE_SIZE) || (strlen(command) > 19)) return false;
+
+  lx200Request_t *r = &lx200Queue[(lx200QueueHead + lx200QueueCount) % LX200_QUEUE_SIZE];
+  strcpy(r->command, command);
+  r->response = response;
+  r->result = result;
+  r->timeOutMs = TIMEOUT_CMD;
+  r->type = responseType(command, r->timeOutMs);
+  lx200QueueCount++;
+  processQueueLX200();
+  return true;
+}
+
+// send queued commands and handle any response characters that have arrived, call often
+void processQueueLX200() {
+  // responses, any no response requests at the head are done once everything sent before them has completed
+  while ((lx200QueueSent > 0) && (lx200Queue[lx200QueueHead].type == RT_NONE)) completeLX200(true);
+  while ((lx200QueueSent > 0) && (Ser.available() > 0)) {
+    char b = Ser.read();
+    lx200QueueResponse[lx200QueueResponsePos] = b; lx200QueueResponsePos++; if (lx200QueueResponsePos > 19) lx200QueueResponsePos = 19; lx200QueueResponse[lx200QueueResponsePos] = 0;
+    if ((lx200Queue[lx200QueueHead].type == RT_SHORT) || (b == '#')) {
+      completeLX200(true);
+      while ((lx200QueueSent > 0) && (lx200Queue[lx200QueueHead].type == RT_NONE)) completeLX200(true);
+    }
+  }
+
+  // on a time out we can't tell which response any late characters belong to, so give up on everything in flight
+  if ((lx200QueueSent > 0) && (millis() - lx200QueueStart > lx200Queue[lx200QueueHead].timeOutMs)) {
+    while (lx200QueueSent > 0) completeLX200(false);
+    serialRecvFlush();
+  }
+
+  // commands
+  while ((lx200QueueSent < lx200QueueCount) && (lx200QueueSent < LX200_PIPELINE_DEPTH)) {
+    lx200Request_t *r = &lx200Queue[(lx200QueueHead + lx200QueueSent) % LX200_QUEUE_SIZE];
+    if (lx200QueueSent == 0) { serialRecvFlush(); lx200QueueStart = millis(); }
+    Ser.print(r->command);
+    lx200QueueSent++;
+    // nothing comes back, done as soon as it's the oldest
+    if ((r->type == RT_NONE) && (lx200QueueSent == 1)) completeLX200(true);
+  }
+}
+
+// true if nothing is queued or waiting on a response
+bool isQueueIdleLX200() {
+  return lx200QueueCount == 0;
+}
+
+// smart LX200 aware command and response over serial
+bool processCommand(char* command, char* response, unsigned long timeOutMs) {
+  // let any queued commands finish first so their responses don't get mixed up with this one
+  while (!isQueueIdleLX200()) { processQueueLX200(); HdCrtlr.tickButtons(); }
+
+  ResponseType type = responseType(command, timeOutMs);
+  Ser.setTimeout(timeOutMs);
+
+  // clear the read/write buffers
+  Ser.flush();
+  serialRecvFlush();
+
+  // send the command
+  Ser.print(command);
+
+  if (type == RT_NONE) {
     response[0] = 0;
     return true;
   }
   else
-    if (shortResponse) {
+    if (type == RT_SHORT) {
       response[Ser.readBytes(response, 1)] = 0;
       return (response[0] != 0);
     }
@@ -16,6 +16,9 @@ enum LX200RETURN {
 };
 
 bool isOk(LX200RETURN val);
+bool queueLX200(const char* command, char* response, bool* result);
+void processQueueLX200();
+bool isQueueIdleLX200();
 LX200RETURN GetLX200(char* command, char* output);
 LX200RETURN GetLX200(const char* command, char* output); // overloaded to allow const char* strings without compiler warnings, similar follow below
 LX200RETURN GetLX200Trim(char* command, char* output);
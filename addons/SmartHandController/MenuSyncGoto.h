@@ -30,7 +30,8 @@ MENU_RESULT SmartHandController::menuSyncGoto(bool sync)
         if (strlen(thisSubmenu)==0) catalog_index[catalog_index_count++]=i; else catalog_index[catalog_index_count++]=-i;
       }
     }
-    // add the normal filtering, solarsys, etc. items
+    // add the search, normal filtering, solarsys, etc. items
+    strcat(string_list_gotoL1,L_SG_SEARCH "\n");
     strcat(string_list_gotoL1,L_SG_SOLSYS ">" "\n");
     if (sync) strcat(string_list_gotoL1,L_SG_HERE ">"); else strcat(string_list_gotoL1,L_SG_USER ">" "\n" L_SG_FILTERS "\n" L_SG_COORDS "\n" L_SG_HOME);
 
@@ -44,9 +45,12 @@ MENU_RESULT SmartHandController::menuSyncGoto(bool sync)
     } else
     switch (current_selection-catalog_index_count) {
       case 1:
-        if (menuSolarSys(sync)==MR_QUIT) return MR_QUIT;
+        if (menuSearch(sync)==MR_QUIT) return MR_QUIT;
         break;
       case 2:
+        if (menuSolarSys(sync)==MR_QUIT) return MR_QUIT;
+        break;
+      case 3:
         if (sync) {
           bool isYes=true;
           if (display->UserInterfaceInputValueBoolean(&buttonPad, L_SG_HERE "?", &isYes)) if (isYes) { DisplayMessageLX200(SetLX200(":CS#"),false); return MR_QUIT; }
@@ -54,13 +58,13 @@ MENU_RESULT SmartHandController::menuSyncGoto(bool sync)
           if (menuUser(sync)==MR_QUIT) return MR_QUIT;
         }
         break;
-      case 3:
+      case 4:
         menuFilters();
         break;
-      case 4:
+      case 5:
         if (menuRADec(sync)==MR_QUIT) return MR_QUIT;
         break;
-      case 5:
+      case 6:
       {
         boolean GotoHome=false; 
         DisplayMessage(L_SG_HOME1, L_SG_HOME2, 2000);
@@ -141,6 +145,24 @@ MENU_RESULT SmartHandController::menuCatalog(bool sync, int number)
   return MR_CANCEL;
 }
 
+MENU_RESULT SmartHandController::menuSearch(bool sync)
+{
+  static char text[16]="M";
+  cat_mgr.setLat(telInfo.getLat()); cat_mgr.setLstT0(telInfo.getLstT0());
+  if (!cat_mgr.isInitialized()) { DisplayMessage(L_SG_SEARCH, L_SG_NO_INIT "?", 2000); return MR_CANCEL; }
+
+  char title[20]; if (sync) strcpy(title,L_SG_SYNC " "); else strcpy(title,L_SG_GOTO " "); strcat(title,L_SG_SEARCH);
+  if (!display->UserInterfaceCatalogSearch(&buttonPad, title, text)) return MR_CANCEL;
+
+  // browse the catalog from the object found, the filters are set again when a catalog is next selected from the menu
+  cat_mgr.filtersClear();
+  if (sync) strcpy(title,L_SG_SYNC " "); else strcpy(title,L_SG_GOTO " "); strcat(title,cat_mgr.catalogTitle());
+  if (display->UserInterfaceCatalog(&buttonPad, title)) {
+    if (DisplayMessageLX200(SyncGotoCatLX200(sync), false)) return MR_QUIT;
+  }
+  return MR_CANCEL;
+}
+
 MENU_RESULT SmartHandController::menuSolarSys(bool sync)
 {
   static int current_selection = 1;
@@ -385,6 +385,12 @@ void SmartHandController::update()
 #ifndef DISABLE_EEPROM_COMMIT_ON
   nv.poll();
 #endif
+
+  // keep the catalog visibility cache fresh
+  cat_mgr.poll();
+
+  // send queued status requests and collect their responses
+  processQueueLX200();
   
   tickButtons();
   unsigned long top = millis();
@@ -538,7 +544,7 @@ void SmartHandController::update()
   // handle shift button features
   if (buttonPad.shift.isDown()) {
     // a long press brings up the main menu
-    if ((buttonPad.shift.timeDown()>1000) && telInfo.align == Telescope::ALI_OFF) { menuMain(); time_last_action = millis(); } // bring up the menus
+    if ((buttonPad.shift.timeDown()>1000) && telInfo.align == Telescope::ALI_OFF) { menuMain(); mainDisplayValid = false; time_last_action = millis(); } // bring up the menus
   } else {
     // wait long enough that a double press can happen before picking up other press events
     if (buttonPad.shift.timeUp()>250) {
@@ -546,6 +552,7 @@ void SmartHandController::update()
         if (telInfo.align == Telescope::ALI_OFF) {
           // display feature key menu OR...
           menuFeatureKey();
+          mainDisplayValid = false;
         } else {
           // ...if aligning, go back and select a different star
           if ((telInfo.align == Telescope::ALI_RECENTER_1 || telInfo.align == Telescope::ALI_RECENTER_2 || telInfo.align == Telescope::ALI_RECENTER_3 ||
@@ -579,6 +586,19 @@ void SmartHandController::update()
   }
 }
 
+// simple FNV-1a hash used to detect changes in the fields shown on the main display
+static uint32_t fieldHash(uint32_t h, const char *s)
+{
+  while (*s) { h ^= (uint8_t)*s++; h *= 16777619UL; }
+  h *= 16777619UL; // field separator
+  return h;
+}
+static uint32_t fieldHash(uint32_t h, long v)
+{
+  for (int i = 0; i < 4; i++) { h ^= (uint8_t)(v & 0xff); h *= 16777619UL; v >>= 8; }
+  return h;
+}
+
 void SmartHandController::updateMainDisplay( u8g2_uint_t page)
 {
   u8g2_t *u8g2 = display->getU8g2();
@@ -587,7 +607,6 @@ void SmartHandController::updateMainDisplay( u8g2_uint_t page)
 
   // get the status
   telInfo.connected = true;
-  telInfo.updateSeq++;
   telInfo.updateTel();
   if (telInfo.connected == false) return;
 
@@ -621,9 +640,32 @@ void SmartHandController::updateMainDisplay( u8g2_uint_t page)
   if (strlen(lastMessage) != 0) {
     if ((long)(millis()-startTime) > 1000) strcpy(lastMessage,"");
   }
- 
-  // the graphics loop
-  u8g2_FirstPage(u8g2);
+
+  // find out which parts of the display have changed since they were last drawn, the status icons
+  // in the top rows and the page body below them
+  uint32_t statusHash = 2166136261UL;
+  if (telInfo.hasTelStatus) statusHash = fieldHash(statusHash, telInfo.TelStatus);
+  statusHash = fieldHash(statusHash, (long)telInfo.align);
+  statusHash = fieldHash(statusHash, (long)telInfo.aliMode);
+
+  uint32_t bodyHash = fieldHash(2166136261UL, (long)page);
+  bodyHash = fieldHash(bodyHash, lastMessage);
+  if (page == 0 && telInfo.hasInfoRa && telInfo.hasInfoDec) { bodyHash = fieldHash(bodyHash, telInfo.TempRa); bodyHash = fieldHash(bodyHash, telInfo.TempDec); } else
+  if (page == 1 && telInfo.hasInfoAz && telInfo.hasInfoAlt) { bodyHash = fieldHash(bodyHash, telInfo.TempAz); bodyHash = fieldHash(bodyHash, telInfo.TempAlt); } else
+  if (page == 2 && telInfo.hasInfoUTC && telInfo.hasInfoSidereal) { bodyHash = fieldHash(bodyHash, telInfo.TempUniversalTime); bodyHash = fieldHash(bodyHash, telInfo.TempSidereal); } else
+  if (page == 4) { bodyHash = fieldHash(bodyHash, (long)telInfo.align); bodyHash = fieldHash(bodyHash, (long)cat_mgr.bayerFlam()); bodyHash = fieldHash(bodyHash, cat_mgr.constellationStr()); }
+
+  // ambient conditions are read while drawing so that page is always redrawn
+  bool statusChanged = !mainDisplayValid || (statusHash != lastStatusHash);
+  bool bodyChanged = !mainDisplayValid || (bodyHash != lastBodyHash) || (page == 3);
+  if (!statusChanged && !bodyChanged) { lastpageupdate = millis(); return; }
+  lastStatusHash = statusHash;
+  lastBodyHash = bodyHash;
+
+  // with a full frame buffer draw once and send only the tile rows that changed, otherwise it's
+  // the usual page by page loop
+  bool fullBuffer = (u8g2_GetBufferTileHeight(u8g2) * 8 >= u8g2_GetDisplayHeight(u8g2));
+  if (fullBuffer) u8g2_ClearBuffer(u8g2); else u8g2_FirstPage(u8g2);
   do
   {
     u8g2_uint_t x = u8g2_GetDisplayWidth(u8g2);
@@ -816,7 +858,18 @@ void SmartHandController::updateMainDisplay( u8g2_uint_t page)
       u8g2_DrawUTF8(u8g2, 16, y, cat_mgr.constellationStr());
     }
     
-  } while (u8g2_NextPage(u8g2));
+  } while (!fullBuffer && u8g2_NextPage(u8g2));
+
+  if (fullBuffer) {
+    uint8_t tw = u8g2_GetBufferTileWidth(u8g2);
+    uint8_t th = u8g2_GetBufferTileHeight(u8g2);
+    uint8_t statusRows = (icon_height + 7) / 8 + 1; // plus a row for descenders that reach below the icons
+    if (statusChanged && bodyChanged) u8g2_UpdateDisplayArea(u8g2, 0, 0, tw, th); else
+    if (statusChanged) u8g2_UpdateDisplayArea(u8g2, 0, 0, tw, statusRows); else
+                       u8g2_UpdateDisplayArea(u8g2, 0, statusRows - 1, tw, th - (statusRows - 1));
+    u8x8_RefreshDisplay(u8g2_GetU8x8(u8g2));
+  }
+  mainDisplayValid = true;
   lastpageupdate = millis();
 }
 
@@ -835,6 +888,7 @@ void SmartHandController::drawIntro()
 
 bool SmartHandController::SelectStarAlign()
 {
+  mainDisplayValid = false; // the star list draws over the main display
   cat_mgr.setLat(telInfo.getLat()); cat_mgr.setLstT0(telInfo.getLstT0());
   cat_mgr.select(0);
 
@@ -853,6 +907,7 @@ bool SmartHandController::SelectStarAlign()
 
 void SmartHandController::DisplayMessage(const char* txt1, const char* txt2, int duration)
 {
+  mainDisplayValid = false;
   uint8_t x;
   uint8_t y = 40;
   display->firstPage();
@@ -872,6 +927,7 @@ void SmartHandController::DisplayMessage(const char* txt1, const char* txt2, int
 
 void SmartHandController::DisplayLongMessage(const char* txt1, const char* txt2, const char* txt3, const char* txt4, int duration)
 {
+  mainDisplayValid = false;
   display->setFont(LF_STANDARD);
   uint8_t h = 15;
   uint8_t x = 0;
@@ -61,6 +61,9 @@ private:
   bool moveWest=false;
 
   unsigned long lastpageupdate = millis();
+  bool mainDisplayValid = false;     // false after anything else has drawn over the main display
+  uint32_t lastStatusHash = 0;
+  uint32_t lastBodyHash = 0;
   unsigned long time_last_action = millis();
 
   byte page = 0;
@@ -95,6 +98,7 @@ private:
   MENU_RESULT menuSyncGoto(bool sync);
   MENU_RESULT subMenuSyncGoto(char sync, int subMenuNum);
   MENU_RESULT menuCatalog(bool sync, int number);
+  MENU_RESULT menuSearch(bool sync);
   MENU_RESULT menuSolarSys(bool sync);
   MENU_RESULT menuFilters();
   void setCatMgrFilters();
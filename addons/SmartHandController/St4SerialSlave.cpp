@@ -18,6 +18,10 @@ Data is exchanged on clock edges similar to SPI so is timing insensitive (runs w
 One data byte is exchanged (in both directions w/basic error detection and recovery.)  A value 0x00 byte 
 means "no data" and is ignored on both sides.  Mega2560 hardware runs at (fastest) 10mS/byte (100 Bps) and 
 all others (Teensy3.x, etc.) at 2mS/byte (500 Bps.)
+
+Fast mode: every couple of seconds an idle SHC (not AVR) sends the ccFast control byte to let OnStep know
+it can keep up with a faster clock and bursts of several bytes.  Since data is exchanged on clock edges
+nothing else changes on this side, older OnStep versions ignore the byte.
 */
 
 #include <Arduino.h>
@@ -177,6 +181,7 @@ void dataClock() {
   static volatile boolean recv_error=false;
   static volatile uint8_t s_parity=0;
   static volatile uint8_t r_parity=0;
+  static volatile unsigned long lastFastMs=0;
   volatile uint8_t state=0;
   
   SerialST4.lastMs=millis();
@@ -210,6 +215,9 @@ void dataClock() {
       if ((!send_error) && (!frame_error)) {
         data_out=SerialST4._xmit_buffer[SerialST4._xmit_head]; 
         if (data_out!=0) SerialST4._xmit_head++;
+#ifndef __AVR__
+        else if (millis()-lastFastMs>2000UL) { data_out=ccFast; lastFastMs=millis(); } // ask for fast mode
+#endif
       } else { send_error=false; frame_error=false; }
     }
     i--;
@@ -20,6 +20,10 @@ Data is exchanged on clock edges similar to SPI so is timing insensitive (runs w
 One data byte is exchanged (in both directions w/basic error detection and recovery.)  A value 0x00 byte 
 means "no data" and is ignored on both sides.  Mega2560 hardware runs at (fastest) 10mS/byte (100 Bps) and 
 all others (Teensy3.x, etc.) at 2mS/byte (500 Bps.)
+
+Fast mode: every couple of seconds an idle SHC (not AVR) sends the ccFast control byte to let OnStep know
+it can keep up with a faster clock and bursts of several bytes.  Since data is exchanged on clock edges
+nothing else changes on this side, older OnStep versions ignore the byte.
 */
 
 #include "Stream.h"
@@ -37,6 +41,8 @@ all others (Teensy3.x, etc.) at 2mS/byte (500 Bps.)
   #define ST4RAe 5
 #endif
 
+#define ccFast 22
+
 void dataClock();
 void shcTone();
 
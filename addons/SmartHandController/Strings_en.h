@@ -242,6 +242,7 @@
 // -------------------- menu, sync/goto --------------------
 
 // root menu
+#define L_SG_SEARCH "Search"
 #define L_SG_SOLSYS "Solar System"
 #define L_SG_HERE "Here"
 #define L_SG_USER "User"
@@ -260,6 +261,7 @@
 #define L_SG_HOME6 "Home Position"
 #define L_SG_NO_OBJECT "No Object"
 #define L_SG_NO_INIT "Not Init'd"
+#define L_SG_NO_MATCH "No Match"
 
 // solsys
 #define L_SG_SUN "Sun"
@@ -1,37 +1,64 @@
 #include "Telescope.h"
 #include "LX200.h"
 
+// immediate requests wait for the response, background requests are queued and picked up by processQueueLX200()
 void Telescope::updateRaDec(boolean immediate)
 {
-  if (((millis() - lastStateRaDec > BACKGROUND_CMD_RATE) && connected) || immediate)
+  if (immediate) {
+    hasInfoRa = GetLX200(":GR#", TempRa) == LX200VALUEGET; if (!hasInfoRa) connected = true;
+    hasInfoDec = GetLX200(":GD#", TempDec) == LX200VALUEGET; if (!hasInfoDec) connected = true; lastStateRaDec = millis();
+  } else
+  if ((millis() - lastStateRaDec > pollPeriod()) && connected)
   {
-    if ((updateSeq%3==1) || immediate) { hasInfoRa = GetLX200(":GR#", TempRa) == LX200VALUEGET; if (!hasInfoRa) connected=true; }
-    if ((updateSeq%3==2) || immediate) { hasInfoDec = GetLX200(":GD#", TempDec) == LX200VALUEGET; if (!hasInfoDec) connected=true; lastStateRaDec = millis(); }
+    queueLX200(":GR#", TempRa, &hasInfoRa);
+    queueLX200(":GD#", TempDec, &hasInfoDec); lastStateRaDec = millis();
   }
 };
 void Telescope::updateAzAlt(boolean immediate)
 {
-  if (((millis() - lastStateAzAlt > BACKGROUND_CMD_RATE) && connected) || immediate)
+  if (immediate) {
+    hasInfoAz = GetLX200(":GZ#", TempAz) == LX200VALUEGET; if (!hasInfoAz) connected = true;
+    hasInfoAlt = GetLX200(":GA#", TempAlt) == LX200VALUEGET; if (!hasInfoAlt) connected = true; lastStateAzAlt = millis();
+  } else
+  if ((millis() - lastStateAzAlt > pollPeriod()) && connected)
   {
-    if ((updateSeq%3==1) || immediate) { hasInfoAz = GetLX200(":GZ#", TempAz) == LX200VALUEGET; if (!hasInfoAz) connected = true; }
-    if ((updateSeq%3==2) || immediate) { hasInfoAlt = GetLX200(":GA#", TempAlt) == LX200VALUEGET; if (!hasInfoAlt) connected = true; lastStateAzAlt = millis(); }
+    queueLX200(":GZ#", TempAz, &hasInfoAz);
+    queueLX200(":GA#", TempAlt, &hasInfoAlt); lastStateAzAlt = millis();
   }
 }
 void Telescope::updateTime(boolean immediate)
 {
-  if (((millis() - lastStateTime > BACKGROUND_CMD_RATE) && connected) || immediate)
+  if (immediate) {
+    hasInfoUTC = GetLX200(":GX80#", TempUniversalTime) == LX200VALUEGET; if (!hasInfoUTC) connected = true;
+    hasInfoSidereal = GetLX200(":GS#", TempSidereal) == LX200VALUEGET; if (!hasInfoSidereal) connected = true; lastStateTime = millis();
+  } else
+  // the clocks tick regardless of what the mount is doing
+  if ((millis() - lastStateTime > BACKGROUND_CMD_RATE) && connected)
   {
-    if ((updateSeq%3==1) || immediate) { hasInfoUTC = GetLX200(":GX80#", TempUniversalTime) == LX200VALUEGET; if (!hasInfoUTC) connected = true; }
-    if ((updateSeq%3==2) || immediate) { hasInfoSidereal = GetLX200(":GS#", TempSidereal) == LX200VALUEGET; if (!hasInfoSidereal) connected = true; lastStateTime = millis(); }
+    queueLX200(":GX80#", TempUniversalTime, &hasInfoUTC);
+    queueLX200(":GS#", TempSidereal, &hasInfoSidereal); lastStateTime = millis();
   }
 };
 void Telescope::updateTel(boolean immediate)
 {
-  if (((millis() - lastStateTel > BACKGROUND_CMD_RATE) && connected) || immediate)
+  if (immediate) {
+    hasTelStatus = GetLX200(":Gu#", TelStatus) == LX200VALUEGET; if (!hasTelStatus) connected = true; lastStateTel = millis();
+  } else
+  if ((millis() - lastStateTel > pollPeriod()) && connected)
   {
-    if ((updateSeq%3==0) || immediate) { hasTelStatus = GetLX200(":Gu#", TelStatus) == LX200VALUEGET; if (!hasTelStatus) connected = true; lastStateTel = millis(); }
+    queueLX200(":Gu#", TelStatus, &hasTelStatus); lastStateTel = millis();
   }
 };
+// background polling period, fast while the mount is moving and slow while it's parked or idle
+unsigned long Telescope::pollPeriod()
+{
+  if (!hasTelStatus) return BACKGROUND_CMD_RATE;
+  TrackState t = getTrackingState();
+  ParkState p = getParkState();
+  if ((t == TRK_SLEWING) || (p == PRK_PARKING) || isGuiding()) return BACKGROUND_CMD_RATE_FAST;
+  if ((p == PRK_PARKED) || (t == TRK_OFF)) return BACKGROUND_CMD_RATE_SLOW;
+  return BACKGROUND_CMD_RATE;
+}
 
 bool Telescope::getRA(double &RA)
 {
@@ -48,7 +48,6 @@ public:
   unsigned long lastStateTime;
   char TelStatus[20];
   unsigned long lastStateTel;
-  unsigned long updateSeq=0;
 public:
   bool connected = true;
   bool hasInfoRa = false;
@@ -63,6 +62,7 @@ public:
   void updateAzAlt(boolean immediate=false);
   void updateTime(boolean immediate=false);
   void updateTel(boolean immediate=false);
+  unsigned long pollPeriod();
   bool getRA(double &RA);
   bool getDec(double &Dec);
   double getLstT0();
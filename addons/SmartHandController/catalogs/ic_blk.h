@@ -0,0 +1,1290 @@
+// This data is machine generated from ic.h by make_blk.py, it's block compressed (see CatalogTypes.h.)
+// Do NOT edit this data manually. Rather, fix the import programs and rerun.
+#define Cat_IC_Title "IC"
+#define Cat_IC_Prefix "I"
+#define NUM_IC 5400
+
+const char *Cat_IC_Names=
+"";
+
+const char *Cat_IC_SubId=
+"A;B;A;B;A;E;A;B;A;B;A;B;A;B;A;B;A;B;A;B;A;B;A;B;A;B";
+
+CAT_TYPES Cat_IC_Type=CAT_DSO_BLK;
+// 30801 bytes for 5400 records, from 75600
+const unsigned char Cat_IC_Data[] = {
+  129,1,0,0,0,0,0,0,12,61,3,0,107,39,12,19,0,232,1,195,237,4,66,100,
+  105,255,4,61,122,222,24,4,19,248,2,109,242,4,66,122,87,251,0,1,17,15,0,14,
+  107,251,4,19,62,235,235,20,16,120,50,87,84,8,19,162,23,135,80,12,66,0,163,23,
+  58,252,0,6,244,10,8,3,200,1,235,14,12,19,0,238,3,234,255,0,16,97,237,4,
+  66,34,196,3,4,19,8,134,239,0,6,114,239,0,0,127,237,0,48,196,255,0,34,22,
+  243,0,118,233,237,12,0,3,38,220,43,12,19,0,5,108,255,8,19,52,8,237,8,0,
+  122,252,236,0,2,221,236,0,96,231,252,0,6,9,253,4,66,14,115,17,4,19,56,244,
+  252,61,6,0,0,0,0,0,0,12,19,0,0,246,252,4,66,48,250,12,0,186,1,187,
+  14,4,19,16,10,234,0,66,40,234,0,8,18,234,8,19,44,216,235,8,0,20,126,3,
+  0,30,215,235,0,128,1,15,234,4,0,116,40,42,12,19,19,7,52,1,12,0,4,30,
+  45,42,8,0,32,194,38,4,19,3,117,236,0,60,91,244,0,34,162,2,0,196,1,124,
+  242,0,28,226,236,4,66,182,1,210,5,0,206,1,19,15,12,19,3,10,191,252,12,66,
+  0,84,250,10,4,19,17,188,237,4,66,172,2,215,16,4,19,22,140,236,12,16,14,222,
+  1,245,86,12,19,0,127,1,237,4,66,96,173,10,0,146,1,203,16,12,16,11,68,161,
+  86,12,66,0,5,124,38,213,10,0,0,0,0,0,0,12,0,0,0,208,67,4,66,35,
+  205,43,32,78,37,44,4,4,19,29,18,0,8,2,24,96,246,0,24,92,246,12,66,0,
+  172,2,200,6,0,96,209,5,0,114,105,15,4,19,92,134,249,0,48,18,234,0,6,119,
+  233,0,2,81,233,8,5,2,22,234,8,0,48,151,253,0,23,63,233,0,126,103,2,0,
+  86,85,2,8,2,36,91,255,8,0,150,1,231,232,0,72,23,1,16,206,24,32,1,12,
+  66,19,140,1,27,6,12,19,0,40,168,244,0,196,1,162,3,12,66,19,104,154,46,28,
+  19,0,161,69,189,231,12,66,2,96,136,46,12,19,0,71,30,238,4,66,114,31,42,8,
+  19,47,35,21,12,19,0,82,19,238,169,14,0,0,0,0,0,0,44,19,0,0,148,237,
+  4,0,40,102,249,4,66,112,31,14,0,28,15,14,4,19,16,232,2,8,3,5,238,253,
+  8,0,20,244,2,8,19,5,190,253,12,66,0,64,36,21,4,19,69,8,238,0,52,240,
+  2,12,66,4,52,170,47,0,20,164,47,8,0,4,70,16,0,34,75,27,0,3,24,14,
+  0,48,84,27,4,19,5,234,248,24,2,130,54,91,253,8,0,16,229,248,0,28,25,253,
+  0,28,71,253,0,14,147,3,0,13,229,234,16,177,58,123,3,8,2,26,63,253,8,0,
+  14,29,237,0,46,46,253,16,117,0,19,246,0,146,1,12,238,0,10,1,238,0,3,211,
+  233,148,16,0,0,0,0,0,0,44,80,11,0,189,43,4,16,173,2,3,44,16,210,1,
+  238,43,24,2,185,14,242,43,8,11,78,140,43,8,13,0,119,43,0,55,105,43,12,19,
+  0,55,5,255,12,80,13,86,121,43,0,0,115,43,12,19,0,101,238,234,28,80,11,167,
+  98,190,43,0,22,197,43,12,19,0,192,2,16,237,0,86,14,1,8,19,2,164,230,8,
+  0,122,221,234,4,66,224,1,225,19,4,19,3,209,232,4,66,50,249,5,8,4,90,199,
+  18,0,16,138,18,0,44,246,17,8,0,60,37,15,12,16,4,206,1,51,86,12,66,0,
+  185,1,2,15,8,4,20,79,18,12,19,0,16,35,246,0,48,184,243,0,8,41,237,4,
+  6,202,1,242,14,0,16,247,14,108,19,0,0,0,0,0,0,44,6,0,0,117,29,4,
+  4,19,9,114,250,12,80,19,100,81,39,28,16,1,142,196,1,247,87,12,6,0,113,42,
+  31,4,19,61,225,243,0,18,248,237,0,118,227,243,4,80,166,2,45,50,4,19,25,39,
+  1,0,96,212,1,4,66,28,90,5,4,19,6,229,1,0,52,33,253,0,10,223,255,4,
+  0,174,1,40,52,0,116,19,54,4,6,15,146,33,0,2,166,33,4,66,15,138,10,4,
+  19,25,101,248,16,166,26,70,246,0,22,212,253,8,6,28,203,253,42,0,0,203,253,1,
+  34,2,204,253,1,4,6,98,169,37,0,24,193,37,0,10,127,33,0,22,126,33,8,19,
+  34,33,26,8,0,4,198,22,200,21,0,0,0,2,0,0,12,6,0,0,199,15,4,66,
+  52,184,3,4,6,60,235,20,0,8,246,20,4,66,22,247,3,4,19,180,1,56,13,0,
+  24,31,13,4,80,79,86,44,4,19,164,1,247,12,0,22,10,13,0,0,249,12,0,3,
+  247,253,0,2,7,253,0,186,1,23,246,0,14,40,246,0,109,24,9,0,48,246,245,0,
+  44,60,242,0,152,1,123,5,4,6,228,1,153,23,0,40,103,23,4,19,2,91,7,0,
+  6,82,246,0,160,1,34,253,0,22,10,239,0,88,211,1,0,138,1,47,246,0,50,210,
+  237,4,80,190,2,48,40,4,6,10,141,16,4,19,71,127,226,0,250,1,34,238,10,26,
+  0,0,0,2,0,0,12,19,0,0,167,1,4,80,118,30,40,0,26,18,40,12,19,19,
+  123,91,235,8,4,62,34,222,8,0,130,1,153,240,0,104,173,1,0,114,205,1,0,44,
+  255,3,0,3,205,255,4,6,110,91,29,4,19,8,208,255,0,54,159,1,4,6,168,1,
+  66,18,4,0,100,108,55,12,62,4,228,1,85,59,12,19,0,95,80,3,8,3,44,36,
+  246,8,0,12,47,246,0,80,225,3,0,45,168,235,0,142,1,134,3,0,29,80,239,4,
+  6,118,85,25,12,19,19,35,35,246,8,0,11,17,237,0,30,186,234,0,48,226,234,0,
+  30,154,234,0,0,132,234,4,6,196,3,42,23,4,62,238,1,199,66,46,30,0,0,0,
+  2,0,0,12,62,0,0,207,66,0,0,98,58,0,7,99,58,0,122,199,66,12,35,19,
+  177,1,108,235,12,62,0,242,1,233,60,4,19,185,1,231,255,16,194,79,216,255,4,62,
+  156,4,62,59,0,32,27,60,4,6,111,70,18,4,35,146,1,241,235,0,0,255,235,0,
+  26,203,235,0,24,236,238,0,10,211,235,4,19,98,242,3,12,62,4,136,2,225,62,8,
+  6,78,18,63,12,35,0,205,1,171,233,20,19,180,106,241,3,4,62,152,1,182,53,4,
+  6,27,13,23,12,62,4,168,1,62,60,8,19,142,1,63,60,0,146,1,132,59,28,19,
+  0,204,215,1,182,255,4,62,212,1,67,60,4,35,187,1,233,238,8,4,62,199,246,8,
+  0,16,213,238,4,62,236,1,72,60,214,33,0,0,0,2,0,0,28,16,9,157,0,52,
+  87,12,62,0,55,70,58,4,35,205,1,25,238,4,62,252,1,250,57,0,66,129,58,0,
+  10,198,57,8,4,3,195,57,0,6,199,57,8,3,204,1,241,59,12,19,5,181,1,223,
+  1,42,0,0,223,1,1,34,0,222,1,1,4,35,23,91,237,4,62,164,2,82,60,0,
+  48,12,60,20,19,155,175,1,178,6,4,35,15,96,239,4,62,214,1,224,53,0,4,216,
+  53,4,35,187,1,87,239,4,19,68,168,255,4,62,228,1,145,58,0,13,8,58,0,56,
+  198,58,0,6,228,56,0,124,98,59,0,128,2,149,59,12,35,19,193,1,50,253,12,19,
+  0,30,190,5,12,62,5,198,1,162,59,12,35,0,219,1,226,237,0,164,1,72,235,45,
+  36,0,0,0,4,0,0,44,62,2,0,231,58,3,8,0,228,1,2,58,4,35,135,1,
+  176,234,4,77,138,1,60,5,12,62,4,194,2,135,59,12,35,19,151,2,161,225,8,0,
+  138,3,250,245,0,17,124,235,0,50,27,235,0,2,47,235,4,77,76,102,0,0,10,129,
+  0,0,18,103,0,0,28,247,1,12,35,4,130,1,123,249,28,13,0,138,254,7,254,108,
+  4,36,249,6,3,207,12,77,10,222,1,58,33,12,35,4,79,113,246,12,77,0,52,111,
+  4,12,35,2,36,214,229,8,0,132,1,89,237,12,77,10,132,1,59,31,12,13,0,150,
+  4,216,96,20,35,157,223,4,197,229,0,124,93,249,0,29,244,229,0,54,5,230,0,72,
+  227,249,12,62,12,184,1,190,45,12,77,14,162,1,12,34,12,35,0,157,1,56,239,116,
+  40,0,0,0,4,0,0,60,62,9,144,0,216,49,3,12,35,0,6,149,243,12,77,10,
+  236,3,195,36,0,86,235,32,24,0,179,17,104,28,4,13,252,9,73,99,4,77,239,2,
+  132,31,0,1,75,28,0,156,6,102,39,42,14,182,4,60,40,1,8,10,237,6,42,37,
+  28,13,1,142,252,6,215,82,12,35,0,193,1,166,238,4,77,202,1,80,4,0,16,137,
+  4,0,12,195,4,0,42,91,3,4,35,90,251,234,0,184,1,15,238,0,70,59,239,0,
+  50,164,242,8,2,180,4,52,255,8,0,13,224,248,0,58,19,249,4,77,168,1,168,23,
+  4,35,135,1,140,237,0,16,81,238,0,4,73,238,0,18,130,238,0,34,181,245,0,13,
+  158,237,12,13,19,140,9,147,107,105,49,0,0,0,5,0,0,44,35,0,0,118,242,5,
+  4,77,94,18,14,4,35,30,218,244,0,20,232,245,8,19,42,141,242,8,0,160,1,236,
+  245,8,5,14,156,245,8,0,10,154,245,0,6,192,245,4,13,240,10,51,111,4,59,225,
+  7,252,4,4,35,130,1,236,233,8,4,90,18,247,12,59,19,66,92,0,12,13,0,254,
+  5,43,97,12,7,4,156,2,126,57,12,35,0,135,2,239,244,16,173,192,2,231,249,4,
+  47,184,1,129,233,4,35,52,171,241,0,176,1,12,243,12,7,4,180,6,217,56,12,59,
+  0,175,1,224,13,12,7,10,160,2,220,48,8,4,120,186,56,12,47,0,9,236,233,8,
+  3,34,52,220,12,59,5,136,1,184,4,12,7,19,160,2,133,47,12,47,0,219,1,252,
+  219,4,59,148,1,245,4,0,4,244,4,59,57,0,0,0,5,0,0,60,59,0,169,0,
+  193,4,5,4,47,51,229,233,0,236,1,116,231,12,7,11,250,2,245,48,28,47,9,119,
+  55,241,237,12,7,4,180,2,213,42,12,59,10,118,152,249,8,0,1,189,244,4,47,16,
+  129,231,12,59,10,96,32,255,0,22,106,255,12,7,4,196,2,31,46,12,59,10,57,147,
+  255,0,21,151,246,0,10,211,246,0,174,1,253,245,16,169,26,237,245,8,14,148,1,235,
+  253,0,64,219,253,12,47,0,35,105,239,12,59,11,44,131,252,8,14,182,1,182,252,12,
+  7,0,202,7,238,54,4,47,185,1,33,238,0,124,148,230,12,7,4,206,2,139,45,12,
+  13,0,134,16,223,113,4,47,223,11,57,238,4,13,232,23,255,117,12,37,15,243,13,11,
+  32,8,14,154,3,222,32,12,13,0,196,11,130,96,136,69,0,0,0,5,0,0,44,54,
+  12,0,224,14,5,8,11,9,19,14,0,160,1,130,10,12,13,0,152,9,119,101,16,167,
+  210,4,217,105,0,60,237,105,12,9,19,255,2,246,231,8,2,50,245,231,12,37,0,174,
+  1,97,18,4,18,152,31,166,121,4,9,211,24,26,213,12,50,19,196,6,83,71,8,0,
+  100,71,71,0,6,92,71,0,8,102,71,0,2,58,71,8,2,16,94,71,8,0,8,71,
+  71,0,6,78,71,8,19,44,118,71,28,54,11,146,137,2,220,249,12,13,0,180,15,152,
+  113,12,9,4,157,9,51,237,12,18,0,192,27,28,121,28,50,3,154,139,23,136,65,8,
+  0,164,14,163,70,0,22,143,70,12,10,4,129,1,42,13,12,37,0,210,2,178,37,0,
+  94,92,43,0,10,84,38,0,184,3,102,33,54,84,0,0,0,5,0,0,44,37,0,0,
+  173,37,5,0,62,105,38,0,92,9,38,0,206,2,92,34,4,22,68,16,36,8,3,8,
+  223,36,8,0,12,236,37,0,28,249,37,16,189,2,217,37,12,54,19,111,24,255,12,22,
+  4,156,1,214,36,8,2,72,249,36,8,0,156,1,181,36,0,54,184,37,16,197,156,1,
+  55,37,0,166,1,191,35,4,10,95,121,1,4,22,174,1,210,12,0,128,1,207,36,16,
+  168,34,114,35,4,10,53,131,7,4,13,184,25,240,121,4,67,151,23,44,233,4,22,174,
+  4,230,34,0,168,2,115,12,4,41,12,166,4,0,46,16,6,0,62,56,6,0,12,29,
+  6,8,19,140,1,41,255,12,22,0,176,2,187,35,0,206,2,38,34,14,91,0,0,0,
+  5,0,0,44,41,5,0,237,252,5,12,13,0,148,6,131,104,0,172,16,153,121,4,41,
+  237,21,110,238,0,208,1,23,253,0,14,76,253,0,30,87,253,0,46,20,253,8,4,21,
+  252,0,8,0,150,3,183,3,4,13,170,9,132,104,4,41,249,4,156,3,4,82,202,5,
+  77,81,4,22,125,3,13,4,41,202,3,181,228,0,160,2,93,253,4,22,118,107,15,4,
+  50,254,4,122,53,4,22,27,119,22,4,13,194,6,230,104,4,22,167,2,231,16,4,41,
+  232,1,155,255,8,4,112,44,232,8,0,120,83,250,0,78,123,4,0,94,133,254,4,46,
+  218,1,182,35,4,41,64,96,238,12,46,19,176,1,189,32,12,41,0,166,1,96,252,4,
+  46,94,61,11,12,41,4,32,243,249,136,101,0,0,0,5,0,0,44,41,0,0,65,237,
+  5,8,4,4,254,234,12,46,0,174,3,104,35,0,18,123,35,4,41,113,179,232,8,19,
+  116,80,238,12,46,0,202,1,111,13,4,74,218,1,162,5,0,21,31,246,4,46,48,221,
+  9,0,26,36,15,4,74,47,69,248,4,46,108,125,17,8,19,0,125,17,0,158,1,187,
+  15,8,0,32,161,15,16,164,88,227,41,0,23,173,13,4,74,106,158,255,0,8,121,4,
+  0,6,90,250,0,26,85,4,0,0,94,4,12,46,5,138,1,140,22,12,74,0,190,1,
+  172,255,12,46,2,56,47,18,8,0,52,95,22,0,30,136,15,0,36,104,22,0,62,111,
+  22,0,0,130,22,12,41,19,98,64,238,174,105,0,0,0,5,0,0,44,74,0,0,28,
+  246,5,0,10,63,246,4,46,50,179,15,0,88,238,14,0,18,234,14,4,41,36,105,236,
+  12,46,19,116,214,14,8,0,22,174,22,0,74,87,25,0,8,88,25,0,0,188,14,0,
+  60,121,18,4,74,8,40,246,0,168,2,150,252,16,168,87,89,4,0,208,1,236,247,8,
+  5,130,1,230,0,12,46,0,148,1,117,17,4,74,48,115,252,0,28,104,252,0,22,13,
+  255,4,46,100,165,15,0,82,72,14,4,74,29,48,246,4,82,238,1,92,61,4,74,36,
+  255,247,16,188,234,2,7,251,4,46,96,3,10,0,8,6,10,4,74,98,245,247,12,82,
+  19,138,3,26,81,12,74,0,121,180,1,218,110,0,0,0,5,0,0,44,46,19,0,150,
+  15,5,8,0,54,207,23,4,74,20,105,247,0,112,217,252,4,46,80,197,28,8,19,0,
+  197,28,8,0,58,185,15,0,2,169,15,4,74,23,19,251,4,46,46,194,15,0,238,3,
+  143,22,12,41,19,5,7,238,0,2,234,237,12,46,0,98,81,18,0,23,226,16,4,74,
+  19,184,3,12,46,19,126,237,15,12,74,0,56,16,5,0,84,38,244,4,41,196,4,246,
+  221,4,74,133,4,3,246,0,36,57,251,0,24,248,7,12,41,19,51,204,216,12,74,0,
+  140,1,205,245,0,38,248,245,16,167,20,107,255,16,171,18,114,255,0,138,1,133,8,4,
+  46,76,63,22,4,74,8,41,6,4,46,48,216,21,116,114,0,0,0,5,0,0,44,46,
+  0,0,155,22,5,0,188,1,20,24,12,44,4,88,114,49,0,90,80,49,12,46,0,28,
+  222,25,0,120,90,17,12,82,19,190,1,199,78,12,74,0,125,104,247,4,82,130,1,226,
+  78,4,27,91,184,237,4,46,40,122,17,8,5,11,168,1,12,27,0,17,226,236,4,46,
+  28,241,252,12,27,19,1,76,238,12,46,0,104,52,255,4,27,158,1,83,239,4,46,48,
+  123,255,8,4,70,12,25,8,0,250,1,6,249,0,36,185,11,0,19,25,247,0,36,247,
+  1,0,36,89,2,0,44,70,2,0,118,216,14,0,12,2,15,4,27,23,71,236,4,46,
+  68,232,14,0,232,3,117,21,0,4,100,21,0,56,247,8,170,118,0,0,0,5,0,0,
+  44,46,0,0,141,9,5,0,4,29,1,4,27,48,63,238,4,46,124,220,255,4,82,154,
+  1,14,62,12,46,3,13,29,5,8,0,156,1,225,12,0,116,127,17,0,14,91,9,4,
+  27,228,1,33,236,4,46,120,59,253,4,27,56,188,238,12,46,19,210,2,189,28,8,0,
+  65,234,3,8,19,2,255,3,8,0,52,64,25,0,88,7,8,4,82,110,12,68,4,27,
+  55,18,242,8,19,3,84,236,8,0,64,35,244,4,82,218,1,33,84,4,46,75,52,14,
+  0,84,226,248,4,82,148,1,79,83,4,27,43,87,239,4,46,64,241,12,0,7,175,253,
+  0,44,245,12,0,4,201,12,8,7,14,71,29,8,0,160,1,28,29,212,122,0,0,0,
+  5,0,0,44,46,0,0,0,249,5,12,27,19,75,148,239,0,10,149,239,12,82,0,250,
+  1,116,71,4,27,26,8,237,4,46,48,104,30,4,82,22,198,69,0,24,192,69,4,46,
+  20,205,36,4,82,28,160,69,0,4,204,69,12,46,2,7,246,23,12,27,19,162,1,255,
+  241,8,5,36,22,244,40,0,0,23,244,1,34,0,21,244,1,4,85,196,1,181,255,12,
+  27,19,19,243,240,12,85,0,94,159,12,0,40,208,12,8,5,188,1,120,12,12,27,0,
+  10,35,244,4,85,22,195,12,4,27,20,38,244,4,85,58,184,12,0,7,161,253,4,82,
+  24,125,47,4,46,66,86,15,4,85,32,185,253,4,82,42,105,47,12,85,19,26,153,4,
+  12,82,0,25,127,70,131,125,0,0,0,6,0,0,44,46,5,0,19,29,9,40,0,1,
+  20,29,1,32,2,17,29,1,4,27,1,103,244,8,5,8,62,244,12,46,0,196,1,201,
+  18,0,10,22,18,0,12,26,18,4,85,40,87,249,4,46,238,1,240,33,12,82,19,79,
+  185,78,12,85,0,9,31,249,4,46,46,149,29,4,27,212,1,35,237,4,46,66,252,32,
+  20,85,167,10,50,0,4,46,126,210,36,4,85,136,1,53,244,0,34,156,10,20,82,150,
+  102,199,60,16,147,28,194,60,16,169,0,139,60,0,34,138,60,4,85,3,65,255,0,16,
+  166,253,12,24,19,162,1,15,20,28,85,0,200,164,1,228,6,12,82,19,96,202,74,8,
+  0,16,229,88,12,24,4,88,208,28,12,41,0,66,87,214,4,29,0,250,237,117,129,0,
+  0,0,6,0,0,44,24,0,0,162,36,13,0,6,181,36,4,41,180,1,181,213,12,24,
+  4,26,242,22,12,29,0,34,1,238,4,85,14,55,17,0,68,69,17,0,68,62,17,0,
+  44,134,249,0,200,1,192,18,4,24,4,19,34,4,85,132,2,187,8,0,66,96,246,0,
+  4,93,18,0,14,152,12,4,24,32,67,40,12,82,19,201,3,169,79,12,24,0,224,3,
+  128,42,0,30,167,36,0,8,71,21,4,85,142,1,51,8,4,24,2,100,22,4,85,78,
+  98,249,4,29,48,50,237,0,14,56,237,4,24,204,1,238,22,8,19,64,3,23,12,85,
+  0,20,156,10,8,19,22,218,12,12,24,0,36,51,32,0,14,56,23,12,85,19,102,108,
+  13,1,133,0,0,0,6,0,0,60,85,0,159,0,51,17,13,4,24,34,37,33,0,84,
+  85,23,0,224,1,130,21,0,60,236,21,12,85,19,116,131,245,12,24,0,10,214,21,4,
+  11,17,81,74,12,33,2,202,1,171,105,12,24,7,204,2,151,23,12,85,0,150,1,224,
+  248,12,24,19,14,135,19,12,29,0,66,83,231,0,6,64,231,12,24,4,27,89,28,12,
+  85,0,22,183,16,0,0,234,17,8,19,240,1,127,241,8,0,6,177,249,4,24,32,195,
+  32,4,85,34,126,244,0,74,228,16,0,36,2,14,0,16,5,14,4,24,19,74,42,8,
+  19,51,181,43,0,2,177,43,8,0,114,93,42,0,30,198,42,8,2,8,178,38,12,85,
+  19,168,1,125,249,8,0,56,95,248,32,137,0,0,0,6,0,0,44,24,0,0,44,44,
+  13,0,54,40,23,4,85,30,111,244,4,29,18,238,233,4,82,105,94,76,4,24,132,1,
+  165,37,0,114,156,37,4,85,242,1,109,246,4,24,29,125,37,0,50,172,37,4,33,87,
+  120,90,4,24,148,1,180,37,0,64,149,37,16,171,2,0,40,4,85,42,25,15,4,24,
+  98,6,31,16,164,80,69,41,16,163,82,110,41,4,17,158,1,152,212,4,85,150,1,46,
+  17,4,24,36,217,32,12,82,19,18,90,76,12,24,0,134,1,196,22,4,85,58,169,254,
+  0,16,196,254,4,24,68,240,29,4,82,87,142,85,0,98,14,75,4,24,104,244,34,4,
+  85,72,159,249,4,24,6,53,29,0,158,2,73,24,79,141,0,0,0,6,0,0,44,24,
+  0,0,128,24,13,0,8,127,24,0,10,3,35,4,11,6,210,48,4,24,104,131,28,4,
+  85,86,118,231,4,24,5,109,29,4,85,40,180,247,4,24,27,109,29,0,4,90,29,0,
+  14,80,29,8,5,4,106,29,8,0,0,76,29,4,85,42,67,6,0,85,10,9,0,112,
+  89,6,4,41,68,181,216,4,82,171,1,213,81,4,85,132,1,97,6,8,4,55,166,8,
+  0,4,180,8,12,41,0,152,1,254,216,12,85,4,141,1,177,8,12,24,0,166,1,139,
+  22,0,16,156,22,4,11,44,141,48,12,85,4,120,229,237,12,24,0,54,81,30,4,85,
+  132,1,192,249,8,4,22,71,238,8,19,60,138,19,8,0,160,1,225,16,184,143,0,0,
+  0,6,0,0,44,85,0,0,29,233,13,0,144,1,111,0,0,160,1,36,252,0,2,73,
+  252,20,24,189,28,63,24,12,11,4,18,182,50,12,85,0,172,1,237,6,4,24,14,98,
+  25,4,85,15,227,18,0,76,126,244,0,23,71,13,4,8,90,245,18,4,82,28,14,71,
+  20,85,161,220,1,173,255,16,167,10,197,0,4,8,136,1,234,32,0,12,50,33,4,82,
+  71,155,72,4,85,176,1,210,249,4,8,41,206,34,0,26,28,33,0,26,16,33,0,6,
+  15,33,0,0,243,32,0,16,251,32,4,85,162,1,90,231,4,8,73,203,34,12,82,2,
+  9,32,79,8,0,10,249,78,0,14,246,78,4,85,238,1,30,238,4,82,205,1,37,79,
+  77,146,0,0,0,6,0,0,44,82,0,0,20,79,13,0,26,20,79,4,85,218,1,73,
+  238,4,82,213,1,24,79,0,34,30,79,4,85,202,1,70,238,4,82,187,1,7,79,0,
+  3,31,79,0,0,36,79,0,6,27,79,0,2,36,79,4,8,130,1,6,33,4,82,127,
+  39,79,8,19,0,39,79,8,0,26,57,79,0,30,30,79,0,4,29,79,4,85,162,2,
+  218,4,0,22,232,4,4,8,58,39,34,4,82,81,135,80,4,85,132,2,139,4,4,8,
+  88,11,20,4,83,141,3,127,102,4,8,200,3,19,20,4,85,40,42,1,4,8,11,10,
+  20,0,15,8,32,8,5,14,155,20,12,82,0,57,128,72,4,85,174,1,206,4,12,17,
+  4,114,239,212,140,147,0,0,0,6,0,0,44,83,0,0,53,101,13,12,17,4,142,4,
+  247,212,12,8,5,95,120,29,12,17,4,134,1,255,212,12,85,19,45,23,7,12,8,0,
+  38,53,19,8,5,5,229,24,42,0,0,227,24,1,34,0,232,24,1,0,19,192,36,0,
+  132,1,25,17,0,18,194,24,0,24,231,24,0,10,231,24,4,85,40,177,7,4,8,14,
+  144,20,12,85,5,204,1,221,251,8,0,104,14,250,4,8,72,178,20,4,85,120,148,241,
+  24,9,164,50,128,231,8,19,188,1,52,248,24,2,192,6,48,248,12,8,0,54,201,21,
+  4,85,142,1,89,254,0,1,187,251,0,24,197,251,4,8,52,24,21,4,85,76,143,245,
+  0,10,17,250,4,8,43,43,25,0,8,56,25,34,151,0,0,0,8,0,0,44,8,0,
+  0,30,26,17,4,85,130,1,108,251,0,9,212,1,4,8,8,68,27,4,85,146,2,137,
+  4,0,28,116,4,4,8,88,154,56,4,85,182,1,69,236,0,40,68,1,4,8,6,244,
+  15,0,6,236,15,4,82,169,1,55,82,0,78,246,81,12,85,5,238,1,171,249,8,0,
+  30,184,249,4,8,69,108,25,0,12,100,25,4,85,90,184,7,0,4,205,7,0,72,55,
+  7,4,8,41,44,25,12,83,19,145,1,208,101,12,8,0,194,2,215,33,4,85,148,1,
+  124,6,12,8,5,81,81,40,8,0,236,1,145,17,4,85,96,117,1,0,66,110,1,4,
+  8,83,4,44,0,76,201,36,0,30,153,19,8,7,0,238,21,59,154,0,0,0,8,0,
+  0,44,85,19,0,219,6,17,12,8,0,52,202,36,0,8,188,36,0,2,231,36,0,54,
+  6,37,0,42,96,29,4,85,68,94,5,12,17,1,218,1,21,205,12,85,0,87,72,4,
+  0,2,12,10,12,8,19,117,101,44,8,0,33,191,76,0,188,2,60,59,16,152,75,249,
+  70,8,19,18,10,45,8,0,160,1,81,68,0,24,56,68,0,2,45,68,0,232,1,219,
+  20,0,86,71,13,0,18,194,25,0,4,220,25,0,94,247,16,4,85,94,226,4,4,8,
+  9,122,13,4,85,24,206,4,0,0,239,4,0,8,204,4,4,8,68,106,13,8,19,119,
+  215,60,12,83,0,205,1,39,98,4,8,148,3,75,27,249,156,0,0,0,8,0,0,44,
+  85,0,0,244,6,17,4,33,183,2,46,88,4,8,160,3,158,25,0,8,13,27,0,4,
+  81,29,0,134,1,26,24,4,85,74,208,1,4,48,82,126,236,4,8,145,1,171,71,8,
+  19,0,171,71,8,0,180,2,53,24,4,48,136,1,193,254,0,98,183,245,4,8,49,173,
+  26,0,6,148,26,4,85,80,169,6,52,33,189,255,1,251,89,2,4,85,208,2,176,4,
+  0,2,189,4,0,42,96,4,4,8,251,1,98,77,4,85,152,2,245,4,0,32,193,6,
+  0,2,227,6,0,2,210,6,4,8,207,1,232,72,0,132,2,192,25,0,16,167,25,4,
+  48,216,1,173,228,4,8,79,78,13,0,10,83,13,4,48,128,1,112,246,207,159,0,0,
+  0,8,0,0,44,48,0,0,163,228,15,4,85,3,247,9,4,83,173,2,74,97,4,48,
+  134,4,95,245,4,8,134,1,137,24,0,70,87,24,4,85,166,2,95,5,8,2,6,101,
+  5,8,0,58,31,10,12,8,4,155,1,180,60,12,48,0,228,1,40,240,4,8,55,79,
+  13,0,0,177,20,8,6,10,205,20,8,0,80,113,19,0,21,75,27,0,16,73,27,12,
+  33,2,191,1,19,79,8,0,46,94,80,8,19,51,146,89,12,88,0,162,3,44,8,0,
+  12,27,6,0,48,81,27,12,48,2,112,207,248,12,88,0,36,25,6,0,64,179,6,0,
+  20,180,6,12,49,19,244,1,20,191,12,88,0,22,122,7,4,83,197,3,205,95,12,8,
+  19,231,1,133,77,12,88,0,240,5,68,10,63,163,0,0,0,8,0,0,44,88,0,0,
+  195,17,15,12,83,2,237,4,69,107,12,48,3,224,7,163,249,12,88,0,35,251,11,0,
+  224,1,7,22,0,54,31,19,12,48,5,68,205,250,4,88,42,215,26,8,0,140,1,173,
+  9,0,150,1,213,10,12,8,2,43,2,61,12,88,0,102,158,33,0,152,2,175,253,8,
+  2,176,1,25,7,24,0,164,5,109,33,8,19,169,1,175,253,12,83,0,97,15,97,4,
+  88,136,4,134,24,0,104,46,17,0,114,105,29,0,98,38,22,0,216,2,32,24,0,54,
+  44,25,0,182,1,205,253,0,88,55,12,4,26,25,69,37,4,83,175,13,115,117,12,88,
+  4,154,14,47,27,8,0,34,162,17,0,58,204,25,4,83,237,13,68,117,4,39,196,14,
+  191,61,217,167,0,0,0,8,0,0,44,83,0,0,3,103,15,4,33,128,3,174,98,0,
+  166,1,237,98,12,88,19,248,4,221,31,8,0,92,43,17,8,4,16,148,22,8,0,20,
+  206,24,4,39,165,1,102,68,0,30,129,68,4,83,159,3,22,100,4,88,228,5,79,22,
+  4,39,2,13,28,4,88,28,21,22,0,58,110,2,0,49,238,21,0,2,9,22,0,22,
+  64,22,4,39,0,36,25,4,88,20,13,22,12,83,2,203,4,99,100,12,88,5,134,5,
+  82,22,4,26,0,113,37,12,88,0,158,1,66,21,0,4,50,21,0,28,140,19,4,39,
+  28,52,25,8,2,30,145,25,8,19,12,106,25,8,0,20,199,24,4,88,22,94,21,12,
+  39,3,7,213,25,8,19,14,140,25,157,171,0,0,0,8,0,0,44,39,0,0,12,26,
+  15,0,20,8,25,8,19,15,64,25,8,2,12,208,25,8,0,6,5,25,16,177,4,81,
+  25,8,19,2,69,25,8,4,8,77,25,8,0,2,50,25,0,0,177,24,4,83,213,4,
+  88,100,12,39,5,250,4,213,24,42,0,1,213,24,1,34,2,213,24,1,0,10,220,25,
+  0,33,234,25,8,5,56,251,25,8,0,6,72,25,0,1,49,25,0,12,66,25,0,2,
+  115,24,4,88,118,85,15,0,28,185,10,16,174,28,137,17,4,39,180,1,71,14,12,33,
+  19,169,4,20,99,8,0,110,250,98,12,39,19,148,5,8,14,12,71,13,210,1,47,224,
+  12,83,0,215,5,116,99,4,39,254,4,144,13,0,86,17,16,32,174,0,0,0,10,0,
+  0,44,71,13,0,213,213,19,12,26,0,203,2,243,51,4,39,132,2,32,22,4,33,249,
+  2,240,88,0,214,1,98,75,0,121,87,91,12,58,19,222,4,216,253,12,33,0,159,4,
+  210,93,0,55,70,97,0,30,53,97,8,4,14,24,99,8,0,50,255,96,4,39,202,5,
+  181,27,0,216,3,5,12,0,204,3,250,65,16,160,42,185,65,0,50,0,70,0,146,5,
+  98,27,4,33,167,4,46,96,4,39,130,3,109,65,12,33,19,89,93,83,8,0,180,1,
+  70,93,0,134,2,248,72,12,39,5,4,230,72,28,33,0,157,178,1,23,83,12,39,19,
+  149,4,109,65,4,33,146,5,144,89,8,2,154,3,228,80,8,0,71,195,89,4,39,202,
+  4,129,28,4,33,203,1,66,78,12,39,3,130,3,210,32,120,181,0,0,0,10,0,0,
+  44,39,19,0,198,32,19,12,33,4,20,211,86,8,0,44,149,90,4,58,148,5,194,5,
+  8,4,154,1,80,15,12,39,0,14,161,51,0,186,1,18,54,8,2,146,1,200,28,4,
+  88,196,1,211,237,12,33,0,171,3,83,85,4,39,168,2,132,50,4,33,37,168,81,0,
+  133,3,251,102,0,128,4,150,81,12,39,19,244,2,178,23,28,33,0,163,249,5,248,102,
+  4,58,154,8,14,18,20,39,160,64,171,37,12,58,8,176,2,234,245,12,33,0,14,45,
+  83,8,5,14,57,83,8,0,8,42,83,8,5,247,2,90,101,12,39,0,238,6,60,62,
+  0,8,83,62,0,14,12,62,0,180,2,219,59,28,5,9,137,172,6,116,190,12,33,0,
+  235,4,112,84,4,39,186,8,122,24,16,157,130,1,173,30,12,33,2,247,2,126,88,237,
+  192,0,0,0,10,0,0,44,76,10,0,73,221,19,12,39,4,25,189,35,8,3,12,190,
+  35,12,76,11,180,3,94,222,8,10,26,53,222,12,88,8,56,192,245,12,39,0,25,24,
+  44,8,4,22,77,44,8,0,50,54,51,8,19,96,127,36,8,5,59,48,51,8,4,222,
+  1,3,30,12,76,11,162,2,229,227,8,10,36,6,228,12,39,4,135,1,178,35,12,33,
+  0,6,15,79,12,72,14,230,10,165,240,12,51,0,185,1,123,56,0,60,214,56,12,76,
+  13,138,6,187,221,12,33,0,171,3,21,70,12,76,4,214,7,113,216,4,33,149,2,24,
+  80,4,51,236,5,47,57,28,72,9,150,180,3,114,243,12,51,0,119,7,47,28,25,9,
+  132,144,17,170,199,12,3,4,110,187,253,12,87,1,246,2,127,29,12,30,19,122,68,76,
+  8,0,226,1,74,71,0,140,3,229,50,68,208,0,0,0,10,0,0,44,30,0,0,6,
+  51,19,8,13,244,2,120,58,12,87,4,210,2,184,28,12,30,13,218,1,152,53,4,87,
+  76,120,39,12,76,11,234,1,17,235,8,0,224,12,126,231,12,30,12,252,4,187,49,24,
+  1,156,72,143,58,12,75,4,168,4,170,25,12,14,0,170,1,230,231,12,87,13,81,175,
+  35,12,30,4,41,165,43,4,3,204,3,63,9,8,0,76,242,0,28,30,2,47,93,65,
+  57,12,14,0,218,2,175,229,4,31,36,35,4,4,14,160,1,252,229,0,178,1,88,234,
+  8,3,32,105,234,8,0,156,1,31,243,12,31,19,58,30,14,44,3,0,132,2,254,255,
+  2,4,14,186,4,20,228,12,31,4,158,1,47,22,12,4,0,232,1,14,236,0,142,1,
+  201,241,0,240,2,128,236,4,14,40,215,232,8,19,0,215,232,8,0,74,197,232,32,223,
+  0,0,0,10,0,0,44,14,0,0,89,230,17,0,164,1,105,232,0,8,139,232,0,88,
+  123,230,12,30,15,163,1,40,44,12,4,0,250,2,32,236,0,12,98,235,4,14,54,24,
+  234,4,4,24,249,236,0,8,242,236,0,24,37,236,0,10,17,237,0,0,1,237,0,10,
+  34,237,0,2,77,236,0,0,57,237,0,4,247,236,0,2,32,237,8,19,5,77,236,8,
+  0,10,68,237,4,14,82,131,233,4,4,152,2,194,240,4,14,48,244,232,4,61,204,1,
+  193,17,4,34,192,1,54,7,0,60,48,7,4,4,36,80,3,12,30,1,109,168,66,12,
+  34,0,248,1,240,3,8,7,48,166,3,12,4,0,18,135,2,4,34,4,66,4,135,226,
+  0,0,0,10,0,0,44,4,0,0,25,3,17,12,30,1,187,1,239,67,12,4,0,152,
+  2,30,3,0,202,3,17,249,0,2,7,248,0,30,142,1,0,40,112,2,4,34,3,171,
+  5,12,4,4,206,2,213,247,12,61,0,70,35,6,12,18,4,235,1,225,78,12,61,0,
+  160,2,104,4,0,106,221,3,4,4,34,79,254,12,61,19,237,3,140,26,12,4,0,248,
+  3,111,254,0,20,14,254,16,208,88,122,254,4,14,70,219,225,4,4,3,20,254,0,26,
+  26,255,4,14,206,1,96,230,4,4,26,90,253,0,236,1,70,255,4,30,50,88,50,4,
+  14,170,3,33,224,4,61,1,208,20,0,134,1,214,5,12,18,12,247,1,194,81,12,4,
+  0,206,3,14,249,4,61,166,1,122,13,0,26,67,6,223,231,0,0,0,10,0,0,44,
+  30,13,0,84,75,17,12,4,0,248,1,112,2,12,30,13,183,1,192,75,12,4,0,246,
+  3,35,252,4,14,40,210,242,4,4,9,224,2,0,24,211,2,4,61,118,224,4,4,14,
+  70,5,237,4,4,16,85,245,0,246,1,224,251,0,1,216,253,0,210,1,147,231,0,12,
+  150,251,4,61,13,251,11,12,4,4,38,236,1,0,10,16,2,8,0,140,1,77,237,4,
+  61,150,1,60,6,4,4,88,228,241,12,61,5,39,23,28,12,4,0,48,207,241,4,61,
+  5,178,3,0,20,29,6,8,2,5,237,15,8,0,24,177,3,12,4,3,40,229,241,12,
+  61,0,23,124,21,0,80,190,3,8,2,234,1,97,14,12,4,0,42,175,236,0,14,200,
+  236,117,236,0,0,0,10,0,0,44,61,0,0,63,5,17,12,4,6,192,1,216,237,12,
+  45,1,133,1,42,75,12,4,0,248,1,147,224,0,38,129,241,0,172,1,240,2,0,68,
+  134,225,0,16,113,225,0,9,57,233,4,45,111,13,53,24,1,116,64,201,76,12,4,0,
+  148,2,56,226,4,61,176,2,79,7,4,4,154,2,122,231,0,198,2,81,254,0,84,184,
+  248,8,19,156,3,155,237,8,0,54,137,243,12,61,3,132,2,30,49,12,4,0,230,5,
+  65,241,12,61,19,11,117,15,12,4,0,82,223,236,28,18,9,165,151,3,103,114,12,66,
+  0,138,8,244,1,4,4,140,1,229,237,8,4,8,23,248,8,19,118,129,245,28,38,0,
+  144,44,37,204,4,66,9,167,6,4,61,136,1,148,21,8,2,6,1,12,12,4,3,66,
+  6,241,231,245,0,0,0,10,0,0,44,4,5,0,55,243,17,42,0,0,54,243,1,34,
+  1,55,243,1,12,61,4,25,149,23,12,66,0,68,14,252,0,108,104,251,0,28,113,251,
+  4,4,122,192,236,12,18,11,117,174,85,12,4,0,196,2,6,238,4,61,34,140,24,0,
+  180,1,41,42,4,66,160,1,66,8,12,70,4,108,148,215,12,61,0,22,115,43,12,4,
+  19,138,2,43,246,4,61,94,165,14,12,4,0,50,54,241,12,61,19,18,33,16,12,66,
+  0,40,102,8,0,128,1,121,2,12,61,19,158,1,29,16,8,0,10,49,16,8,19,12,
+  45,16,0,100,192,13,0,40,213,20,8,0,118,214,21,4,4,82,51,238,4,66,156,23,
+  33,250,4,4,149,21,203,232,4,66,108,173,251,4,61,11,144,20,206,250,0,0,0,12,
+  0,0,44,4,0,0,231,237,21,0,2,210,236,4,66,8,212,251,12,61,4,185,1,12,
+  17,12,4,0,150,2,225,248,8,3,4,227,236,12,66,0,110,121,6,0,138,1,132,251,
+  4,18,152,1,150,107,4,66,192,1,212,6,0,134,2,183,5,4,4,26,238,250,4,66,
+  164,2,188,6,0,66,103,2,4,61,34,39,17,4,4,124,59,234,12,66,7,170,2,243,
+  2,12,61,2,42,124,38,0,0,112,38,8,0,226,1,24,16,12,4,19,70,173,236,12,
+  66,0,164,1,152,254,0,4,178,254,0,18,145,255,4,61,72,186,17,0,4,184,17,4,
+  19,70,9,236,0,98,214,245,4,66,6,114,2,0,6,198,9,8,19,6,33,250,12,0,
+  0,6,175,66,69,0,0,0,0,12,0,0,44,61,0,0,35,16,21,4,66,76,209,5,
+  4,19,250,1,233,245,0,12,164,239,12,0,19,190,1,96,46,12,70,0,208,1,25,210,
+  4,81,26,116,164,12,19,4,66,116,245,12,0,0,158,2,123,68,0,18,125,68,0,34,
+  120,68,12,70,4,140,1,42,200,4,0,196,1,181,42,8,19,32,199,42,8,0,132,1,
+  207,33,0,20,74,31,0,58,33,32,0,22,25,31,0,34,215,32,0,6,68,31,8,19,
+  12,2,32,8,4,10,2,32,8,0,30,76,31,4,66,82,232,9,4,0,148,1,79,54,
+  4,66,158,2,160,12,0,194,1,139,30,4,70,140,2,149,219,0,40,31,210,0,130,1,
+  79,213,4,19,46,173,242,0,48,233,251,93,6,0,0,0,12,0,0,60,70,0,147,0,
+  234,219,21,12,0,19,98,28,34,12,66,4,72,205,3,12,19,0,80,98,221,0,2,122,
+  221,8,19,40,46,243,12,66,0,8,144,8,0,32,148,9,0,10,177,9,8,19,9,148,
+  9,8,0,44,189,9,0,50,142,9,0,8,154,9,4,19,6,136,255,12,66,4,52,24,
+  23,12,19,0,88,115,222,16,168,82,92,224,16,174,44,37,250,4,70,62,74,220,12,19,
+  19,59,91,244,12,70,0,78,86,220,0,102,56,218,12,0,4,74,147,42,12,70,0,53,
+  35,219,4,19,46,120,221,4,0,82,209,32,0,12,147,39,0,5,201,32,0,64,209,31,
+  4,19,70,126,222,0,204,1,127,222,12,70,3,94,12,207,101,9,0,0,0,12,0,0,
+  44,16,12,0,142,80,21,12,19,19,65,191,223,12,66,0,122,53,8,8,3,110,64,46,
+  12,63,0,83,61,188,0,4,189,191,4,66,84,156,30,4,81,107,92,173,4,66,106,54,
+  8,4,19,13,150,222,0,48,139,222,0,48,166,221,0,24,204,241,4,63,104,106,191,12,
+  19,4,90,235,232,12,63,0,31,116,186,12,19,4,66,174,238,8,0,42,214,0,4,70,
+  54,46,207,4,63,34,163,198,4,19,174,1,220,233,28,81,1,145,173,1,33,153,16,148,
+  18,19,153,28,19,0,125,182,3,3,3,4,66,30,52,47,4,63,91,72,183,20,70,154,
+  74,254,216,4,63,59,108,183,4,66,152,1,25,46,0,130,1,7,47,0,11,217,19,4,
+  63,77,140,189,5,12,0,0,0,12,0,0,44,19,0,0,15,231,21,8,5,16,26,231,
+  42,0,0,26,231,1,34,0,26,231,1,28,81,1,149,219,1,139,153,12,63,0,214,1,
+  74,189,28,81,1,163,135,1,195,151,12,63,0,178,1,114,190,4,70,56,90,215,4,19,
+  46,167,3,4,63,93,130,189,0,44,231,189,4,66,180,1,38,25,4,63,73,173,190,4,
+  66,104,31,25,0,0,27,25,0,48,116,47,4,70,51,182,212,4,66,122,115,47,4,19,
+  51,14,255,0,6,26,255,28,81,1,175,199,1,239,153,44,19,0,226,1,107,255,2,28,
+  81,11,142,137,2,232,151,12,66,0,168,2,102,22,0,24,87,22,4,0,46,77,55,4,
+  66,42,62,47,4,63,167,1,144,176,0,42,82,184,12,19,4,104,241,2,12,66,0,134,
+  1,112,45,91,13,0,0,0,14,0,0,44,66,19,0,120,47,23,8,0,6,241,42,28,
+  81,1,165,171,2,142,154,12,66,19,212,2,7,47,12,70,0,137,1,145,209,12,66,19,
+  156,1,52,44,8,0,24,41,43,28,81,1,160,187,2,241,153,12,66,19,198,2,6,47,
+  28,81,1,165,203,2,136,151,12,70,19,142,1,145,209,12,81,4,18,183,156,4,0,184,
+  2,90,49,12,66,0,196,1,45,46,4,19,107,192,231,4,66,16,46,47,0,112,50,47,
+  12,19,5,115,26,232,42,0,1,26,232,1,34,6,26,232,1,8,19,14,189,231,12,66,
+  0,146,1,61,42,0,12,255,46,4,63,133,1,133,183,4,0,154,1,181,48,4,66,1,
+  9,43,0,14,61,47,0,7,232,7,0,64,162,47,0,10,85,47,4,19,43,33,0,4,
+  66,78,77,47,177,14,0,0,0,16,0,0,44,0,0,0,250,48,27,4,66,22,133,47,
+  0,20,52,47,8,19,8,150,47,8,0,12,83,47,0,14,13,47,0,30,3,47,0,2,
+  39,47,0,56,131,47,0,20,68,47,4,19,55,165,253,0,68,73,2,4,66,30,95,12,
+  4,19,21,179,253,0,16,162,0,4,66,28,26,21,8,19,0,26,21,0,4,36,21,8,
+  0,40,221,25,0,8,156,23,12,19,19,44,171,253,12,66,0,68,4,21,4,19,37,5,
+  251,4,66,70,19,21,12,0,4,44,201,52,12,42,1,151,2,195,154,12,70,19,148,2,
+  52,205,4,66,128,2,126,30,8,0,14,114,24,12,19,19,38,59,246,12,80,2,126,61,
+  50,12,19,0,14,122,237,162,16,0,0,0,16,0,0,44,66,0,0,230,17,27,12,19,
+  2,9,127,238,12,42,4,85,243,159,12,80,0,156,4,116,47,4,70,75,193,207,0,250,
+  1,226,214,4,66,96,32,12,4,70,150,1,97,207,4,66,16,164,12,4,70,5,77,207,
+  4,66,186,1,248,30,0,12,146,6,20,80,145,196,1,223,38,4,36,22,54,208,0,18,
+  193,217,4,6,186,1,78,31,4,80,22,174,38,4,0,54,26,51,4,80,7,12,47,4,
+  36,129,1,111,209,4,80,142,1,16,47,4,6,4,8,26,12,0,4,74,142,51,12,19,
+  0,51,19,242,4,36,57,145,207,8,3,149,1,54,213,12,19,0,154,2,32,232,4,6,
+  118,80,32,8,19,21,19,18,0,58,55,28,12,19,0,59,75,232,4,66,130,1,213,6,
+  232,20,0,0,0,16,0,0,60,16,9,145,0,14,90,27,12,6,0,131,1,23,25,4,
+  66,4,152,9,0,10,204,5,8,19,4,1,8,12,80,0,82,178,40,0,6,169,40,4,
+  66,43,186,5,4,6,30,177,20,4,19,5,86,255,0,8,83,255,0,27,121,232,4,36,
+  96,22,209,0,45,130,210,4,19,132,1,207,0,4,36,95,186,208,0,126,115,216,4,6,
+  108,245,34,12,80,19,66,88,45,0,50,67,45,12,19,0,151,1,62,240,4,36,76,104,
+  220,0,8,155,210,4,66,120,50,14,0,2,45,14,0,42,4,11,12,80,19,120,218,43,
+  12,6,0,3,201,21,0,118,53,19,4,66,3,175,8,4,6,82,161,21,12,19,19,16,
+  31,13,122,22,0,0,0,16,0,0,44,19,0,0,69,5,27,4,6,38,240,20,4,19,
+  2,67,255,12,36,19,42,209,219,8,0,252,1,39,209,4,80,172,4,111,46,0,12,117,
+  46,4,19,21,81,7,8,19,6,10,239,28,36,0,149,29,160,211,4,80,184,1,19,46,
+  4,6,19,202,17,0,4,188,17,4,80,122,3,49,0,230,1,73,46,4,6,3,106,22,
+  12,16,11,202,3,60,88,12,63,0,213,2,42,197,4,6,244,1,1,29,0,72,26,19,
+  4,0,228,1,97,65,12,80,4,21,172,44,28,6,0,165,27,218,27,0,94,212,32,0,
+  54,221,32,0,6,217,32,28,16,12,90,254,1,103,87,12,6,0,153,2,161,32,0,84,
+  163,32,12,19,19,0,1,250,12,6,0,106,152,32,4,35,201,1,189,194,200,26,0,0,
+  0,16,0,0,44,36,0,0,69,207,27,4,35,101,29,195,4,36,118,85,207,8,19,26,
+  193,204,12,80,0,166,2,31,46,20,36,168,225,1,217,203,12,6,5,180,1,239,15,12,
+  19,0,26,76,240,0,144,1,195,5,0,16,151,8,12,6,5,52,153,19,12,19,2,67,
+  210,243,12,80,0,138,2,156,45,12,16,19,232,2,153,87,12,19,0,203,2,240,12,4,
+  36,12,249,216,4,19,66,55,2,12,6,19,64,114,27,8,0,6,86,20,12,36,19,135,
+  1,249,216,12,16,10,188,3,195,88,12,6,0,179,1,16,27,4,36,27,239,215,4,19,
+  104,99,4,12,6,7,94,45,21,12,19,0,39,107,4,8,19,12,112,0,12,6,0,108,
+  171,27,0,0,173,21,12,19,19,91,170,233,12,6,0,174,1,236,26,0,19,76,16,104,
+  29,0,0,0,16,0,0,44,19,0,0,25,4,27,0,38,152,4,28,36,3,127,171,1,
+  57,216,12,6,19,216,2,218,18,8,0,16,161,20,28,16,12,90,170,2,231,85,12,19,
+  0,183,2,79,13,12,6,19,84,220,18,28,16,2,89,154,2,239,82,12,6,19,249,1,
+  206,18,12,35,0,85,25,236,20,6,173,116,116,27,0,23,30,19,4,19,21,233,254,4,
+  6,74,203,20,4,36,45,128,211,0,7,171,211,0,46,165,211,4,6,196,2,64,36,4,
+  36,103,150,208,4,19,132,2,126,12,4,36,107,93,207,4,19,154,1,142,12,4,35,41,
+  189,233,4,19,90,62,13,0,20,87,13,0,192,1,77,8,4,35,27,169,252,12,16,11,
+  47,73,86,12,62,4,144,5,226,60,12,19,0,61,172,13,4,62,226,1,56,51,179,32,
+  0,0,0,16,0,0,44,36,0,0,233,199,27,0,56,242,216,4,40,125,42,184,0,46,
+  229,181,0,18,225,181,4,35,238,1,41,242,12,62,19,128,2,247,54,12,19,0,133,1,
+  122,4,12,62,19,172,1,40,58,0,0,70,58,12,36,0,147,2,67,209,4,35,126,190,
+  249,12,62,19,196,1,250,57,0,66,129,58,0,10,198,57,12,6,0,97,81,27,0,20,
+  226,27,12,35,5,157,1,54,223,12,6,0,166,1,230,27,0,12,226,27,4,36,73,22,
+  220,4,40,157,1,230,178,4,35,136,2,165,240,0,39,35,224,4,36,172,1,3,220,20,
+  62,164,210,2,215,52,16,193,10,200,52,0,16,223,52,12,40,5,149,2,21,184,12,36,
+  0,168,1,84,212,12,62,4,218,2,212,58,12,36,0,247,1,34,207,138,35,0,0,0,
+  16,0,0,44,62,19,0,28,59,27,12,40,0,181,3,9,178,4,36,204,1,22,208,12,
+  35,4,58,132,225,12,62,2,132,2,60,50,12,40,0,245,2,246,183,4,36,132,2,212,
+  209,4,40,13,118,185,0,40,232,183,0,38,65,186,0,176,1,92,180,4,77,244,2,117,
+  6,4,36,23,56,209,4,40,147,1,8,181,8,4,26,230,183,8,0,2,215,183,8,5,
+  14,26,184,8,0,24,120,182,8,4,12,27,183,8,0,4,121,182,8,3,2,114,182,12,
+  35,0,196,1,86,225,4,40,187,1,23,183,4,77,176,2,60,6,0,18,125,2,4,40,
+  149,2,251,182,0,21,238,180,4,62,250,3,220,60,4,40,199,3,224,184,0,24,2,183,
+  0,28,188,186,0,36,156,180,239,36,0,0,0,16,0,0,44,40,4,0,94,183,27,8,
+  0,3,217,181,12,77,4,158,3,174,34,12,40,5,141,3,21,181,8,19,220,7,72,193,
+  8,0,185,6,190,187,0,35,40,181,0,10,42,181,0,106,105,184,0,26,201,187,0,4,
+  196,187,0,18,70,184,0,11,114,180,4,35,228,1,71,222,0,24,116,225,4,40,197,1,
+  47,182,4,69,9,152,174,4,77,248,2,53,7,4,40,173,2,102,181,0,50,215,182,16,
+  155,38,77,184,4,69,59,164,174,4,40,92,98,186,4,35,188,1,183,225,12,36,19,9,
+  3,207,12,69,0,181,1,97,180,0,29,146,175,4,40,80,3,183,4,77,212,2,167,4,
+  4,40,159,2,247,183,16,174,146,1,191,191,16,149,26,124,193,100,38,0,0,0,16,0,
+  0,44,40,0,0,31,181,27,0,38,24,182,0,1,14,182,0,32,136,185,4,35,216,1,
+  245,233,4,40,173,1,137,188,4,77,200,2,59,25,4,40,205,2,173,184,12,69,3,29,
+  152,173,8,0,20,141,173,12,36,19,192,2,204,217,12,69,0,253,1,213,173,12,35,19,
+  168,2,233,223,12,40,0,101,13,189,12,62,19,174,3,190,45,12,40,0,233,2,127,191,
+  12,69,7,35,180,177,12,35,4,234,1,70,199,12,40,0,77,135,183,12,77,10,228,3,
+  155,34,12,40,0,221,1,185,182,8,4,32,118,183,12,36,0,178,1,15,208,4,40,105,
+  142,182,12,77,10,144,3,97,36,12,69,0,215,3,121,174,0,23,229,171,4,77,222,4,
+  177,1,4,69,217,2,1,175,4,40,128,1,132,186,8,3,158,1,226,186,12,77,19,204,
+  2,58,15,5,42,0,0,0,16,0,0,60,62,9,139,0,45,48,27,12,40,0,161,3,
+  183,185,4,62,152,4,82,52,4,35,161,2,217,204,0,82,244,215,8,19,0,244,215,12,
+  40,0,161,1,84,186,4,69,147,1,197,170,8,3,44,69,174,8,5,44,150,172,12,35,
+  4,218,2,171,231,12,69,0,123,76,175,4,40,128,2,143,198,4,77,220,2,201,28,4,
+  69,231,3,136,171,4,32,116,240,180,4,77,234,2,5,8,4,69,145,2,31,179,4,32,
+  46,29,181,4,69,65,8,172,4,32,92,20,181,4,69,36,25,180,0,28,136,180,12,35,
+  19,194,2,26,240,12,62,0,250,1,201,52,4,32,231,3,10,181,0,0,232,180,12,35,
+  4,202,2,166,228,8,0,120,246,247,20,32,172,74,82,177,0,16,168,179,4,69,55,146,
+  173,70,44,0,0,0,16,0,0,44,40,0,0,68,191,27,4,35,80,142,199,4,69,145,
+  1,114,172,4,32,54,95,176,0,12,87,176,4,35,232,2,180,209,0,37,84,209,28,40,
+  2,134,77,198,188,12,32,0,51,166,179,0,8,114,178,4,35,178,2,67,237,4,32,161,
+  2,63,178,12,35,19,192,2,61,237,0,213,1,84,209,28,69,0,172,45,185,172,4,32,
+  170,1,243,179,4,52,203,15,199,136,4,32,170,16,185,178,0,88,206,185,4,52,133,6,
+  182,144,12,32,4,176,7,108,186,12,69,0,127,96,170,4,77,248,3,194,5,4,32,237,
+  2,116,176,4,35,230,1,226,210,4,69,231,1,123,175,12,77,4,172,4,252,29,12,13,
+  2,218,5,72,102,12,35,0,209,6,186,233,0,70,177,233,4,32,179,1,116,176,0,188,
+  1,41,178,39,48,0,0,0,16,0,0,60,62,10,140,0,105,50,27,12,12,0,129,3,
+  35,196,8,4,61,113,187,12,32,0,121,138,173,8,7,148,1,104,180,12,12,4,62,51,
+  187,28,32,0,170,29,92,180,12,77,4,182,3,244,10,12,35,19,47,193,247,12,12,4,
+  247,1,105,187,12,77,19,234,2,207,0,12,35,2,21,81,249,12,32,0,177,2,147,179,
+  4,35,178,2,208,247,4,32,131,2,192,179,8,5,10,115,179,8,0,148,1,59,179,12,
+  12,4,124,83,187,12,32,0,63,156,178,0,12,180,179,12,77,10,130,6,156,36,0,171,
+  6,215,37,12,52,0,160,1,146,148,12,12,4,188,8,168,207,4,35,174,1,91,249,0,
+  12,248,248,12,59,2,68,38,252,12,35,0,80,99,248,0,32,182,248,8,4,84,235,248,
+  8,0,66,198,248,0,30,75,248,182,51,0,0,0,16,0,0,44,35,19,0,11,249,27,
+  8,3,34,33,249,8,0,42,35,247,0,20,245,248,4,52,207,8,185,146,4,47,224,11,
+  136,233,28,32,12,138,241,4,149,157,12,12,0,136,5,118,215,12,59,19,162,1,183,11,
+  4,47,95,66,234,12,59,2,154,1,145,255,0,4,146,255,12,32,12,139,5,80,157,12,
+  59,0,146,6,61,6,12,47,19,87,127,233,4,32,207,3,156,157,24,2,138,246,1,149,
+  161,24,11,167,12,149,161,8,12,1,170,158,12,35,19,186,5,171,245,12,47,0,176,1,
+  17,227,12,7,4,226,8,78,54,12,47,0,52,91,220,4,23,65,65,203,12,59,19,138,
+  2,245,4,0,4,244,4,12,47,0,226,1,148,217,12,32,19,225,1,90,159,0,22,83,
+  159,24,12,136,46,52,159,12,47,0,188,6,21,223,8,19,0,21,223,20,59,0,0,0,
+  16,0,0,44,47,19,0,129,231,27,8,0,14,49,236,12,13,19,234,6,171,98,28,52,
+  8,164,189,13,179,148,12,23,0,152,7,60,204,8,19,0,60,204,12,47,0,104,136,222,
+  8,19,0,136,222,8,13,84,127,230,28,52,8,160,173,1,206,148,12,64,13,180,6,108,
+  183,12,52,0,199,6,11,145,4,47,226,9,94,229,4,77,176,2,243,33,28,32,10,145,
+  251,6,235,156,28,52,8,149,239,1,165,149,12,23,0,134,4,161,212,28,52,8,167,133,
+  3,137,148,28,7,9,133,158,12,146,65,12,23,0,207,3,128,201,4,47,120,180,230,0,
+  224,3,8,223,12,23,5,200,1,195,207,12,47,19,94,85,222,12,23,0,43,166,207,12,
+  37,1,130,3,92,34,16,109,7,60,34,12,23,0,46,98,216,12,59,10,168,3,15,29,
+  12,52,0,165,10,155,146,24,8,167,176,1,35,149,12,59,11,146,11,146,25,237,66,0,
+  0,0,16,0,0,44,9,0,0,154,225,27,4,52,231,6,209,148,28,9,9,130,198,10,
+  136,237,28,50,0,145,218,3,6,84,12,54,19,254,2,224,14,12,7,3,244,1,141,63,
+  12,54,19,253,1,19,14,12,7,4,152,2,142,63,12,9,0,176,7,127,230,44,37,2,
+  192,4,149,47,2,12,13,0,132,13,42,107,12,37,3,39,48,50,8,0,103,46,46,12,
+  54,14,135,2,28,241,12,37,0,146,2,61,46,4,13,208,5,86,92,4,37,255,2,129,
+  37,0,168,1,4,27,0,92,241,26,12,9,4,252,1,249,226,12,13,7,240,8,149,102,
+  12,37,0,175,4,55,46,0,43,158,30,0,5,142,30,0,0,152,30,12,10,4,204,1,
+  176,12,12,50,0,194,3,67,53,4,37,34,153,34,0,150,2,154,44,0,6,198,44,0,
+  24,144,44,12,15,4,217,3,26,183,189,80,0,0,0,16,0,0,44,37,0,0,170,44,
+  25,0,24,176,44,0,21,22,34,0,68,123,44,4,15,219,4,83,167,4,37,216,5,27,
+  47,4,86,249,5,230,159,4,37,128,9,174,48,16,188,66,175,48,0,128,4,56,38,28,
+  67,2,130,97,45,207,12,37,0,236,2,77,48,0,208,1,22,39,4,13,246,2,195,85,
+  12,50,3,64,157,80,12,37,0,74,78,46,0,110,97,46,0,14,15,39,4,50,72,88,
+  47,12,22,4,31,116,35,12,10,3,7,252,7,12,22,0,124,28,39,0,74,191,34,0,
+  88,5,39,12,15,14,139,4,234,171,12,50,0,242,5,67,53,0,10,75,53,0,54,70,
+  53,8,19,0,70,53,8,0,33,31,51,4,22,66,215,17,20,50,167,84,136,51,152,86,
+  0,0,0,16,0,0,44,22,2,0,106,11,25,8,19,240,1,207,36,8,0,110,135,36,
+  4,41,8,60,7,12,50,19,176,1,144,51,24,0,151,94,14,65,0,11,122,50,12,22,
+  3,25,62,34,0,4,52,34,8,2,48,25,35,0,0,19,35,8,0,1,241,33,8,2,
+  60,204,34,8,3,34,81,34,8,2,4,82,34,0,10,20,34,0,6,233,34,0,10,229,
+  34,0,48,235,33,8,0,1,254,32,0,8,231,32,0,46,214,34,0,3,156,33,8,3,
+  10,16,34,8,2,4,30,35,8,0,11,115,30,0,18,62,35,8,3,3,92,33,8,0,
+  18,98,34,8,3,24,162,33,8,2,8,136,33,0,4,132,33,112,88,0,0,0,16,0,
+  0,44,22,2,0,23,35,25,8,3,8,112,33,8,2,15,63,26,0,28,137,33,0,6,
+  186,33,0,8,104,34,0,17,47,26,8,0,36,46,35,0,8,68,35,0,2,199,32,8,
+  3,11,41,27,8,0,28,226,34,8,3,17,165,26,8,2,8,44,26,8,4,2,140,26,
+  8,2,0,47,26,8,4,24,71,26,8,2,4,134,26,8,4,4,65,26,8,2,0,104,
+  26,0,6,61,26,16,148,24,228,26,8,0,32,66,35,8,2,2,64,35,0,27,118,26,
+  8,3,6,230,26,8,2,2,245,26,0,6,151,27,8,0,22,198,33,8,2,21,79,26,
+  8,0,12,120,27,8,2,4,82,26,199,88,0,0,0,16,0,0,44,22,2,0,211,27,
+  25,8,0,14,109,30,8,2,7,0,27,8,3,2,48,26,8,2,2,225,26,0,54,36,
+  26,0,4,44,26,8,3,4,128,27,8,2,4,50,26,0,2,55,26,0,6,136,27,0,
+  2,158,27,8,3,26,166,27,8,2,6,170,27,0,1,46,27,8,0,6,166,27,8,6,
+  4,137,27,8,0,1,42,26,8,2,4,66,26,12,67,0,183,1,235,219,12,22,5,194,
+  1,83,26,8,2,2,85,26,8,3,14,175,26,8,2,10,231,26,8,3,8,26,28,8,
+  2,8,205,26,0,18,124,26,0,0,71,26,0,4,141,26,0,6,68,26,0,0,74,26,
+  0,2,121,26,62,89,0,0,0,16,0,0,44,22,2,0,76,27,25,8,4,14,229,26,
+  0,6,10,27,12,41,0,67,130,4,12,22,4,76,230,27,8,0,2,157,27,8,2,6,
+  208,26,8,3,18,253,27,8,2,8,86,28,0,32,35,27,0,1,121,26,8,0,10,154,
+  27,8,2,20,93,26,8,0,0,92,26,0,20,89,30,0,2,92,30,0,5,170,26,0,
+  18,124,30,8,2,15,108,26,0,34,15,27,0,2,138,26,0,20,96,28,0,4,7,28,
+  0,4,179,26,8,0,10,52,29,8,2,5,8,27,8,4,18,206,27,8,2,4,112,26,
+  0,14,225,27,0,3,136,26,8,3,6,140,26,0,16,26,29,200,89,0,0,0,16,0,
+  0,44,22,2,0,187,27,25,0,6,191,27,0,0,186,27,8,19,10,235,28,8,2,6,
+  194,27,8,0,44,165,39,8,3,3,93,28,8,0,6,169,27,8,3,8,26,28,8,0,
+  40,152,39,8,19,0,152,39,12,67,0,193,1,76,229,12,22,2,170,1,71,28,0,22,
+  198,28,0,10,238,27,0,22,40,28,0,4,71,28,8,0,14,246,28,0,140,1,76,43,
+  4,67,183,1,21,237,4,22,190,1,63,43,4,67,181,1,20,237,4,22,192,1,71,43,
+  4,67,187,1,24,237,4,22,206,1,62,43,8,3,33,38,28,8,0,38,93,31,0,84,
+  165,43,0,172,3,33,46,4,50,70,0,53,12,22,2,39,180,36,8,0,222,2,205,43,
+  111,92,0,0,0,16,0,0,44,22,0,0,240,27,25,4,13,218,5,150,104,12,22,19,
+  169,4,5,28,28,84,1,50,121,147,180,12,22,0,234,2,2,26,0,210,1,17,40,0,
+  28,40,40,28,84,1,71,163,3,133,187,12,22,2,252,2,26,25,8,3,2,30,25,8,
+  0,4,64,25,0,98,229,26,4,50,14,36,54,0,18,178,53,4,22,17,52,45,4,41,
+  165,1,41,234,20,22,172,184,1,241,41,4,50,48,238,52,4,22,57,45,25,0,8,12,
+  25,8,2,16,19,27,8,0,8,18,26,8,19,4,13,27,0,4,21,27,8,2,80,95,
+  26,8,3,12,169,26,8,0,28,186,26,8,2,18,135,26,0,46,101,26,16,170,56,125,
+  26,8,0,24,133,25,8,3,68,190,25,128,94,0,0,0,16,0,0,44,41,0,0,105,
+  4,25,4,22,254,1,122,46,0,4,195,28,0,36,194,28,12,50,19,182,1,2,56,12,
+  41,2,87,34,251,8,0,244,1,41,4,4,50,230,1,222,53,4,22,202,1,130,43,16,
+  171,42,170,41,0,60,193,39,8,7,20,193,20,12,41,0,6,215,7,4,22,74,37,32,
+  4,50,164,1,237,52,4,22,39,94,37,12,41,3,129,1,190,228,8,0,14,175,228,12,
+  13,4,142,6,106,104,28,22,0,186,245,3,90,46,12,13,2,144,5,121,104,12,22,5,
+  143,4,128,32,8,0,4,123,32,16,167,130,1,255,40,0,122,248,42,0,32,61,45,16,
+  161,28,45,41,8,19,0,45,41,28,15,9,129,199,4,136,156,12,22,19,204,4,170,42,
+  8,0,194,2,42,36,0,117,107,33,214,98,0,0,0,16,0,0,44,22,0,0,98,33,
+  25,0,3,196,29,0,12,88,25,8,19,72,186,28,12,50,0,52,80,49,4,22,29,148,
+  28,12,82,19,148,3,92,91,12,50,0,229,1,149,49,8,19,30,47,48,8,0,60,229,
+  52,4,46,142,2,68,32,0,6,43,32,0,34,47,32,0,14,196,34,0,20,223,34,4,
+  44,102,139,54,0,14,136,54,4,68,181,1,218,209,4,46,242,1,57,33,4,41,43,73,
+  246,4,46,124,106,30,0,76,75,43,0,19,194,32,0,66,95,42,0,1,165,42,16,172,
+  38,63,42,0,25,184,42,0,4,167,42,8,19,22,63,42,12,41,0,73,151,5,0,45,
+  199,238,4,46,222,1,20,44,197,100,0,0,0,16,0,0,44,84,4,0,18,195,25,4,
+  1,34,33,200,12,46,0,154,2,227,37,0,13,147,28,28,15,1,99,227,1,237,174,12,
+  41,4,196,2,162,247,12,46,0,170,1,144,42,4,44,198,1,101,49,4,1,181,1,38,
+  202,4,44,150,2,35,53,12,41,19,17,80,238,12,46,0,184,1,231,39,4,44,56,99,
+  49,0,212,1,101,49,4,46,28,252,39,0,4,172,39,4,44,88,178,51,28,15,9,129,
+  199,2,138,170,12,44,4,138,3,5,47,0,4,22,47,4,15,161,3,192,157,12,46,0,
+  212,4,200,38,0,10,194,38,4,1,59,202,210,4,44,232,1,168,47,12,74,2,15,28,
+  8,12,1,0,72,77,209,0,154,1,76,209,8,19,0,76,209,8,0,54,60,209,8,19,
+  0,60,209,12,44,0,168,3,52,53,190,105,0,0,0,16,0,0,44,44,0,0,153,53,
+  25,4,1,177,1,3,208,4,44,156,2,216,52,0,2,104,48,4,46,32,185,38,4,44,
+  84,82,48,4,1,191,1,224,208,0,0,197,208,4,44,218,1,208,47,0,80,196,52,4,
+  1,125,32,210,4,44,152,2,74,54,12,1,19,91,107,217,4,41,36,137,223,12,44,0,
+  184,1,233,52,4,1,145,1,225,213,0,16,82,207,0,40,144,211,0,88,124,207,4,44,
+  148,2,13,54,4,1,93,184,207,16,146,34,202,216,0,6,127,206,0,30,101,211,4,44,
+  228,1,196,44,4,41,87,52,231,4,44,186,1,205,48,8,5,50,210,53,8,0,8,109,
+  47,12,1,3,173,1,217,207,8,0,48,178,208,4,44,142,2,234,51,19,108,0,0,0,
+  16,0,0,44,1,0,0,230,205,25,4,44,204,1,220,51,4,46,28,194,39,0,18,185,
+  34,4,1,10,114,206,28,15,9,128,129,1,244,166,24,0,157,45,172,160,12,1,19,132,
+  2,0,211,8,0,84,156,206,4,44,188,2,51,54,4,1,123,42,207,0,2,144,207,16,
+  158,142,1,68,208,4,44,130,2,80,49,4,46,21,250,22,4,1,3,164,209,4,44,236,
+  1,215,51,4,46,13,185,39,4,44,94,7,52,4,46,33,16,35,4,44,50,13,52,4,
+  46,36,255,34,4,1,121,47,208,8,19,2,68,207,12,44,0,194,2,245,39,4,1,147,
+  1,147,205,20,82,134,190,3,75,97,4,1,143,2,150,209,0,52,53,209,4,44,186,1,
+  153,46,4,1,57,210,207,12,46,19,172,1,30,37,179,111,0,0,0,16,0,0,44,1,
+  0,0,45,211,25,28,15,1,68,73,15,174,12,1,0,154,1,217,212,4,46,180,1,14,
+  37,20,1,153,117,89,206,8,19,52,182,205,12,41,0,54,41,215,20,1,154,3,216,206,
+  0,78,202,212,4,41,46,208,221,4,44,230,2,88,38,0,32,218,49,12,84,19,135,1,
+  221,193,12,41,0,102,231,237,0,17,105,221,12,74,4,136,1,49,240,12,15,0,175,2,
+  215,151,4,41,198,2,124,217,4,44,174,1,3,38,12,15,11,205,1,120,172,12,82,0,
+  198,6,218,102,0,52,219,102,12,15,1,131,3,108,164,12,44,4,240,3,212,46,8,0,
+  92,156,46,8,4,34,229,46,8,0,46,251,53,0,2,9,54,0,5,154,46,12,41,19,
+  4,199,238,12,44,4,166,1,13,47,12,46,2,48,106,14,51,116,0,0,0,16,0,0,
+  44,44,0,0,154,46,25,8,19,215,2,232,46,12,82,0,170,8,48,55,0,44,247,53,
+  0,6,42,55,0,2,253,54,12,44,3,13,133,39,12,82,0,26,255,53,0,14,195,54,
+  28,15,9,137,189,1,52,163,12,27,19,244,1,213,232,8,0,78,109,227,8,19,186,2,
+  79,228,0,0,48,228,12,46,0,160,1,67,38,4,27,74,66,222,4,46,160,1,61,17,
+  0,88,55,17,8,2,10,133,17,12,20,10,129,2,10,147,12,46,0,164,2,154,16,0,
+  8,128,16,0,26,234,14,8,3,4,78,16,8,0,6,75,16,16,167,24,162,13,0,2,
+  6,15,0,6,183,13,0,16,164,15,8,2,6,94,13,8,4,8,114,17,8,2,18,103,
+  14,233,119,0,0,0,16,0,0,44,46,0,0,81,15,25,0,2,232,16,0,10,209,17,
+  8,2,2,69,17,8,0,10,139,14,0,2,211,15,0,8,179,19,0,0,104,17,0,0,
+  180,17,8,3,2,0,15,8,0,14,199,17,0,4,77,17,0,0,155,17,0,6,122,19,
+  8,2,0,124,18,0,28,84,18,8,0,2,176,17,0,0,91,19,8,4,2,42,18,8,
+  2,4,237,17,8,3,8,222,17,8,0,4,172,16,0,4,154,19,0,0,59,17,4,27,
+  17,217,235,12,46,3,32,25,19,8,0,10,194,16,8,2,6,170,18,0,0,114,14,8,
+  0,2,116,14,0,6,183,15,8,2,4,108,17,60,120,0,0,0,16,0,0,44,46,0,
+  0,248,13,25,0,0,96,17,0,4,254,16,0,2,23,17,0,4,243,13,8,4,12,240,
+  15,8,3,4,98,13,8,0,28,53,17,0,10,161,18,8,2,1,91,14,0,4,107,18,
+  8,3,14,114,14,40,0,12,110,18,2,0,2,116,18,8,2,6,28,17,8,0,12,80,
+  15,8,2,6,69,19,8,0,2,6,19,0,16,134,19,8,2,0,36,18,0,4,15,19,
+  8,0,0,231,16,8,2,2,240,16,8,0,2,37,17,0,4,208,15,0,0,99,13,0,
+  12,26,25,0,0,182,17,8,2,1,238,16,0,40,217,17,8,0,2,122,13,0,6,20,
+  18,169,120,0,0,0,16,0,0,44,46,0,0,221,17,23,8,3,2,75,19,8,2,4,
+  138,19,8,0,10,177,13,0,26,77,17,28,15,1,107,155,1,203,166,12,46,0,162,1,
+  0,17,0,2,163,16,8,2,4,35,17,8,0,4,25,17,0,16,39,17,0,6,45,17,
+  8,4,12,130,17,8,6,2,220,19,8,0,4,29,17,0,2,62,15,0,14,25,19,8,
+  4,0,20,19,8,0,4,29,17,8,2,6,24,19,8,0,4,18,19,8,2,0,150,17,
+  0,4,72,19,8,0,4,164,17,8,3,8,173,19,8,0,10,178,17,4,82,60,216,48,
+  12,46,2,13,166,17,0,20,84,20,12,82,0,24,221,48,4,46,17,242,16,0,8,115,
+  12,30,121,0,0,0,16,0,0,44,46,0,0,4,13,23,0,2,219,14,8,2,10,93,
+  12,28,82,0,173,26,223,48,4,46,15,24,19,0,8,177,16,8,3,6,133,12,8,0,
+  4,134,12,0,2,50,12,0,10,188,13,4,82,24,224,48,4,46,7,22,20,0,3,12,
+  14,0,4,30,20,8,2,0,158,19,8,0,1,42,14,0,2,240,11,0,2,29,11,0,
+  16,149,34,0,1,3,18,0,8,42,20,0,0,24,18,0,2,149,18,4,41,178,3,201,
+  214,4,46,171,3,50,20,0,0,90,18,0,0,153,18,0,0,210,17,0,4,48,20,0,
+  1,29,13,0,6,206,17,8,2,4,87,19,89,121,0,0,0,16,0,0,44,46,2,0,
+  78,19,23,0,4,204,17,8,0,4,203,17,0,0,245,18,0,0,26,17,8,4,2,209,
+  17,8,0,4,251,18,0,6,111,14,0,4,143,17,0,8,30,19,0,3,162,12,0,28,
+  168,18,0,6,11,19,0,2,12,19,0,4,98,19,0,12,15,18,0,8,46,20,0,2,
+  151,13,0,6,87,18,0,6,56,16,8,5,8,112,13,8,2,24,49,18,8,0,2,66,
+  17,8,5,6,74,13,8,0,20,166,16,0,4,168,17,0,4,178,19,0,0,93,17,0,
+  4,124,14,0,2,93,17,0,6,2,14,0,32,206,18,199,121,0,0,0,16,0,0,44,
+  46,2,0,238,19,23,0,24,186,13,8,0,2,102,16,8,2,14,253,12,0,18,32,12,
+  8,0,10,223,20,0,0,11,13,0,16,102,16,0,18,2,16,0,2,190,13,0,12,54,
+  18,0,2,33,15,8,2,2,3,13,8,0,12,96,18,0,0,177,19,0,0,144,14,0,
+  12,220,19,0,1,69,16,0,18,70,18,8,2,30,8,20,0,1,2,12,8,0,4,212,
+  18,8,2,4,96,16,8,0,2,107,12,0,6,174,14,0,10,29,11,8,2,2,197,12,
+  0,4,229,19,0,2,88,19,8,0,8,77,19,0,0,69,17,8,2,8,236,12,66,122,
+  0,0,0,16,0,0,44,46,0,0,171,14,23,0,4,237,19,0,2,99,15,0,2,24,
+  19,8,2,2,237,17,8,0,1,186,13,0,16,192,18,0,0,74,16,0,4,210,17,0,
+  0,222,15,0,4,208,19,0,16,136,18,8,2,1,239,12,8,0,0,227,12,0,4,52,
+  16,0,1,240,13,0,2,2,13,8,2,8,193,12,8,0,8,199,13,4,27,13,171,237,
+  4,46,22,243,12,0,8,110,19,8,2,8,244,12,8,0,4,248,19,4,82,22,65,55,
+  4,46,21,103,14,8,2,16,239,12,8,0,8,151,17,8,2,0,247,12,0,0,220,12,
+  8,0,2,237,12,8,2,8,239,12,132,122,0,0,0,16,0,0,44,46,2,0,211,12,
+  23,8,0,6,224,16,0,12,60,12,12,17,10,109,107,166,12,46,5,120,204,18,8,0,
+  0,30,15,8,2,12,121,18,8,0,1,211,12,0,6,72,18,0,0,45,14,0,10,210,
+  12,8,2,12,197,18,8,0,2,203,17,8,2,24,13,17,8,0,10,132,15,12,20,13,
+  235,1,154,142,12,46,2,246,1,230,13,8,0,2,114,16,8,19,8,90,13,8,4,8,
+  23,14,12,27,0,7,98,237,12,46,2,26,191,18,8,0,2,8,18,0,2,15,15,8,
+  5,6,11,19,8,0,6,211,18,8,2,0,48,14,8,0,24,144,17,8,2,10,109,16,
+  8,0,2,247,18,8,3,0,32,15,8,0,14,186,18,241,122,0,0,0,16,0,0,44,
+  46,0,0,16,18,23,8,2,0,58,20,8,0,12,251,17,8,2,2,192,18,0,8,244,
+  12,0,4,173,18,0,1,20,14,0,2,102,18,8,0,2,80,16,4,27,6,43,242,12,
+  46,3,14,117,18,8,0,4,167,16,4,41,23,192,212,4,46,32,48,19,40,2,6,158,
+  16,2,8,0,4,145,15,8,2,12,215,18,8,0,12,46,20,8,2,22,220,17,24,0,
+  194,0,165,14,8,2,4,97,18,8,0,2,185,18,8,2,1,213,12,12,82,0,32,187,
+  48,12,46,2,13,176,17,0,2,156,18,12,82,0,38,206,48,4,46,2,67,17,0,20,
+  89,14,8,2,10,187,17,8,3,4,255,14,12,82,0,28,204,48,112,123,0,0,0,16,
+  0,0,44,46,0,0,242,18,21,8,2,42,148,14,8,0,14,128,18,8,2,10,94,14,
+  8,0,50,117,19,8,2,2,55,15,8,4,38,60,31,8,0,10,77,14,0,4,206,16,
+  4,82,46,0,78,12,17,12,83,96,166,12,46,5,118,98,18,12,82,0,38,222,45,0,
+  2,154,44,12,17,12,144,1,198,165,8,3,164,1,239,189,12,82,0,66,8,54,20,46,
+  160,162,1,22,28,4,82,80,110,47,8,19,12,112,47,12,46,2,58,24,38,8,0,0,
+  231,27,0,22,17,38,4,82,28,131,44,0,8,39,47,8,19,44,22,47,8,0,14,200,
+  49,0,136,1,148,44,12,27,4,116,126,238,12,85,19,28,184,248,12,46,4,42,35,17,
+  12,27,19,250,2,43,228,67,126,0,0,0,16,0,0,44,55,14,0,189,163,21,12,82,
+  0,64,224,43,4,46,144,1,85,29,4,85,2,126,250,12,27,4,58,29,223,12,82,0,
+  26,168,43,12,85,19,20,81,250,12,82,0,16,116,47,4,85,3,167,248,8,19,0,167,
+  248,0,202,1,33,252,12,17,0,69,100,202,4,82,104,145,45,0,46,188,45,4,55,54,
+  53,151,4,82,161,1,199,45,12,24,19,194,1,162,39,12,85,4,40,0,253,12,82,0,
+  76,168,43,0,8,181,43,0,56,222,43,0,198,2,51,55,12,85,4,28,225,4,8,19,
+  78,144,2,8,0,6,183,15,0,52,34,15,4,82,6,226,43,4,24,34,174,46,4,85,
+  15,17,18,4,41,28,68,216,0,2,96,213,12,24,4,5,216,28,13,129,0,0,0,16,
+  0,0,44,24,4,0,132,29,21,8,0,4,149,44,12,41,4,18,205,213,12,11,0,12,
+  174,47,4,24,72,122,47,0,42,170,46,4,85,33,215,18,4,41,6,77,213,12,85,4,
+  16,123,18,12,24,0,10,149,44,0,32,79,19,12,85,4,12,252,17,12,41,0,3,218,
+  212,12,85,19,18,195,14,8,0,22,229,15,0,2,63,14,4,11,18,58,55,4,41,36,
+  44,211,4,85,28,65,16,4,24,6,94,19,0,4,78,19,0,5,230,19,0,8,59,20,
+  4,85,42,143,18,4,11,12,24,55,4,24,1,111,20,4,85,16,136,17,0,18,125,14,
+  12,41,4,16,114,213,4,24,5,48,20,12,85,0,8,186,16,0,10,246,18,249,129,0,
+  0,0,16,0,0,44,24,4,0,29,20,21,12,85,0,1,237,18,4,24,6,77,20,0,
+  2,83,19,0,58,50,20,12,85,19,36,215,18,8,0,6,195,17,0,8,52,14,0,18,
+  37,16,0,0,130,17,0,2,192,15,0,12,39,18,8,19,6,116,15,8,0,2,60,14,
+  4,24,2,225,19,12,85,4,16,45,18,8,0,14,95,18,0,10,124,18,8,2,10,150,
+  18,12,24,0,18,152,20,8,19,22,24,19,4,85,8,188,18,8,0,7,12,18,4,24,
+  6,58,20,0,34,67,19,12,85,6,12,50,17,24,0,172,22,57,18,12,17,4,40,192,
+  192,12,24,0,23,12,20,16,167,12,37,19,4,85,10,216,17,4,24,4,244,19,175,130,
+  0,0,0,16,0,0,44,24,0,0,86,19,21,4,85,2,23,17,8,19,14,134,18,12,
+  24,0,5,135,20,0,6,41,19,8,19,0,19,34,12,85,0,10,95,16,0,3,115,14,
+  8,2,6,139,18,0,12,147,13,0,10,151,13,12,24,0,3,94,19,4,85,16,55,15,
+  4,24,12,143,33,12,85,2,14,233,12,12,24,0,11,135,20,20,85,197,6,11,18,0,
+  6,104,16,4,24,1,46,20,4,85,10,13,18,4,24,4,232,33,4,85,14,209,17,4,
+  24,4,4,34,12,85,2,4,119,13,8,3,2,208,12,0,1,230,18,8,2,4,116,13,
+  12,24,0,2,227,33,12,85,3,2,109,13,12,24,0,3,238,19,4,85,6,74,14,4,
+  24,14,78,20,3,131,0,0,0,16,0,0,44,24,0,0,97,19,21,0,1,19,34,0,
+  3,164,20,4,85,14,97,13,8,19,12,58,10,8,0,0,182,17,0,5,122,17,0,22,
+  252,16,8,19,8,132,9,24,2,171,4,80,13,12,20,0,118,158,142,4,85,109,158,17,
+  8,2,18,172,13,8,0,2,108,15,0,5,7,19,0,2,187,18,4,11,2,48,53,4,
+  85,8,253,11,4,24,3,5,37,12,85,19,16,56,10,8,2,1,254,12,8,19,4,119,
+  9,12,24,0,3,170,35,12,85,3,12,233,12,8,0,10,131,13,4,24,3,28,35,0,
+  10,142,19,12,85,5,2,219,18,12,24,0,6,221,35,28,85,2,98,10,120,11,0,0,
+  163,13,4,24,1,167,34,79,131,0,0,0,16,0,0,44,24,0,0,166,19,21,4,85,
+  1,226,16,8,6,8,176,16,42,0,2,175,16,1,34,5,176,16,1,8,2,10,164,13,
+  8,3,8,181,11,8,0,2,46,11,8,19,0,46,11,8,4,6,221,10,8,0,2,191,
+  12,4,24,5,25,39,4,85,8,204,8,0,3,188,17,8,5,2,179,17,8,2,6,251,
+  12,4,24,3,149,38,8,0,2,102,34,8,5,6,226,19,8,0,4,211,38,0,6,250,
+  35,8,2,2,141,34,8,0,2,146,36,12,85,5,8,23,17,8,0,6,49,11,0,4,
+  127,17,0,6,23,11,0,8,100,13,4,41,4,209,218,4,85,2,173,7,4,24,5,99,
+  36,4,85,18,139,8,130,131,0,0,0,18,0,0,44,85,0,0,3,13,25,0,6,171,
+  17,8,3,4,54,13,8,0,4,154,16,8,2,10,242,12,0,2,204,12,0,4,204,12,
+  8,3,4,42,13,4,24,1,126,35,8,0,0,201,39,12,82,4,15,81,86,12,85,0,
+  36,147,13,4,24,0,181,39,0,4,104,36,4,85,8,103,13,4,24,3,90,36,0,2,
+  144,39,4,85,8,33,16,0,0,146,14,0,6,3,14,4,24,5,74,36,8,4,6,24,
+  20,8,2,2,56,37,8,0,4,54,37,12,82,4,21,81,86,12,24,19,28,188,41,12,
+  85,3,8,27,18,0,2,130,9,12,24,0,1,111,35,0,8,42,36,0,6,21,35,4,
+  85,1,224,15,184,131,0,0,0,18,0,0,44,85,0,0,168,15,25,4,24,2,41,36,
+  12,85,2,10,156,13,0,4,245,10,8,0,1,184,16,4,24,3,173,39,0,12,191,35,
+  0,12,180,36,4,85,14,185,16,12,24,2,1,48,36,0,8,127,37,12,85,0,22,18,
+  15,4,24,11,15,38,0,4,150,36,0,6,123,38,0,2,208,36,0,8,125,34,0,0,
+  118,37,0,2,126,37,0,0,163,34,4,85,6,5,17,0,16,184,16,4,24,7,111,40,
+  12,85,19,10,201,12,12,24,0,5,22,40,0,6,242,33,8,2,2,188,38,8,0,2,
+  13,37,0,2,246,35,0,2,135,37,4,85,10,218,9,4,24,5,232,36,250,131,0,0,
+  0,18,0,0,44,85,0,0,20,15,25,4,24,1,245,35,16,176,1,1,41,12,85,4,
+  16,126,13,8,0,8,74,17,0,6,127,9,12,24,2,5,19,37,8,0,0,65,34,0,
+  6,154,34,4,85,20,128,9,4,24,19,118,39,0,6,77,35,8,2,6,188,34,12,85,
+  0,12,223,17,4,24,3,251,39,0,8,68,19,4,85,4,94,14,4,24,3,134,40,0,
+  14,144,20,4,85,4,173,16,0,3,189,14,4,24,2,68,38,0,4,85,37,0,0,125,
+  39,0,2,119,20,12,85,4,8,252,12,8,0,0,144,18,4,24,5,24,41,8,2,6,
+  87,36,8,0,0,48,36,8,2,0,115,36,0,2,124,36,42,132,0,0,0,18,0,0,
+  44,24,3,0,179,40,25,28,17,0,141,30,195,206,12,24,19,23,161,27,12,85,0,8,
+  185,13,8,19,6,8,10,8,4,10,81,10,8,0,1,191,17,0,8,57,10,8,19,6,
+  28,10,8,0,0,84,16,4,24,7,246,38,0,4,27,40,0,2,89,36,12,85,2,10,
+  25,11,8,19,2,18,11,8,0,8,4,10,0,4,102,9,4,24,3,4,39,0,2,56,
+  39,4,85,12,79,11,4,24,7,29,33,12,85,19,8,36,12,0,0,46,13,8,0,8,
+  219,14,4,24,7,184,36,8,4,2,91,36,8,6,0,255,38,12,85,3,12,71,18,8,
+  0,6,210,18,8,4,0,31,11,12,24,2,2,130,36,8,0,0,179,38,97,132,0,0,
+  0,18,0,0,44,85,0,0,106,15,25,12,24,2,5,91,35,8,0,0,198,33,0,4,
+  250,34,0,4,124,35,4,41,28,251,218,4,17,18,111,199,4,85,31,24,17,4,24,0,
+  224,25,0,8,203,24,0,5,103,36,8,4,1,212,40,8,0,14,173,34,8,2,0,19,
+  38,8,0,10,51,24,0,1,238,38,0,4,235,36,0,18,40,20,0,9,206,36,20,85,
+  167,6,21,18,4,24,3,40,36,4,85,4,218,16,4,24,3,249,38,8,19,8,40,20,
+  8,0,2,254,37,0,2,93,40,8,2,54,77,22,12,85,0,33,112,17,4,24,5,138,
+  33,0,10,131,22,0,5,141,33,4,85,10,131,17,141,132,0,0,0,18,0,0,44,24,
+  0,0,53,37,25,0,4,11,36,28,85,2,139,18,226,13,8,4,0,199,14,8,19,0,
+  224,14,12,24,0,5,24,37,4,85,12,191,10,12,24,2,9,44,39,8,0,2,7,38,
+  0,4,252,33,0,2,206,33,0,14,42,21,4,85,5,76,14,12,24,11,3,51,39,8,
+  0,0,221,43,4,85,14,205,16,4,24,0,244,35,28,85,2,173,6,173,18,12,24,0,
+  2,124,40,0,14,41,37,0,0,43,38,0,4,255,35,0,0,209,36,12,85,19,12,158,
+  12,12,24,0,4,245,23,0,13,118,39,8,2,6,153,38,4,85,12,159,12,12,24,0,
+  3,80,19,0,2,168,34,4,85,16,47,16,0,0,135,15,188,132,0,0,0,18,0,0,
+  44,24,0,0,113,36,25,20,85,165,14,182,17,24,3,152,0,110,13,12,24,2,9,67,
+  39,12,85,4,12,116,12,12,24,0,5,178,39,12,85,2,10,52,17,24,0,174,0,189,
+  18,0,0,112,16,0,0,232,13,16,160,6,151,16,4,24,5,107,33,8,2,0,11,37,
+  12,85,0,6,43,15,4,24,0,245,37,20,85,170,12,221,17,4,24,4,91,36,0,8,
+  156,22,4,85,2,98,13,12,24,5,0,86,38,8,0,12,93,23,0,3,202,22,20,17,
+  146,30,14,200,4,85,21,116,15,4,24,2,247,35,0,6,51,36,4,85,8,58,14,12,
+  24,2,10,235,38,8,0,16,100,38,0,2,121,35,0,14,153,24,0,6,157,24,254,132,
+  0,0,0,18,0,0,44,24,0,0,239,37,25,4,85,16,196,16,4,24,1,77,19,20,
+  85,177,1,165,14,4,24,0,175,35,0,4,43,36,20,85,180,12,196,18,4,24,5,209,
+  39,20,85,172,14,61,18,4,24,7,154,39,0,8,73,35,0,1,49,26,0,24,85,21,
+  20,85,167,1,94,18,4,24,0,29,38,0,4,155,35,0,0,160,35,0,4,152,36,40,
+  2,14,139,36,2,20,85,140,10,97,13,12,24,0,5,162,37,16,177,0,12,41,0,4,
+  8,35,12,85,4,14,45,10,12,11,0,15,169,53,4,24,4,79,39,0,2,130,39,28,
+  85,2,134,18,228,16,12,24,0,8,8,21,0,21,7,27,0,8,247,34,4,85,16,53,
+  14,57,133,0,0,0,18,0,0,44,85,0,0,67,16,23,0,10,161,9,12,24,2,11,
+  17,38,12,85,0,20,90,15,8,2,8,46,11,8,0,6,56,16,4,24,2,94,21,8,
+  2,3,32,19,8,0,5,78,37,0,24,228,20,8,2,11,109,19,8,0,1,183,34,4,
+  85,18,25,15,28,24,2,174,6,87,19,12,85,19,14,85,15,12,24,2,3,172,33,8,
+  0,0,124,33,4,85,14,236,12,0,12,133,16,4,24,4,35,20,0,2,158,24,0,1,
+  192,26,0,20,132,21,0,15,251,27,4,85,24,34,16,8,19,22,125,11,12,24,0,1,
+  90,36,4,85,10,28,17,20,24,176,1,9,41,0,24,19,20,20,85,174,5,138,17,12,
+  24,3,3,46,39,146,133,0,0,0,18,0,0,60,85,0,184,0,30,18,23,0,4,88,
+  16,0,7,48,15,4,24,8,120,24,0,0,219,36,0,4,28,38,16,172,1,10,41,12,
+  85,19,14,136,16,12,24,0,6,34,21,0,2,27,39,0,10,172,36,8,4,1,84,40,
+  28,85,0,171,12,0,18,4,24,11,8,40,4,85,18,80,17,4,24,7,243,38,20,85,
+  174,18,233,16,4,24,12,195,21,12,85,4,7,133,17,12,24,2,5,252,36,28,85,0,
+  187,18,39,17,0,9,207,16,16,179,28,196,16,0,15,148,14,4,24,3,178,36,4,85,
+  18,5,16,4,24,0,200,22,0,5,43,35,0,0,242,25,4,85,26,201,3,16,158,8,
+  42,18,4,24,0,251,19,205,133,0,0,0,18,0,0,44,24,2,0,8,37,23,8,0,
+  10,49,20,0,5,34,36,8,3,2,40,38,12,85,0,16,56,16,4,24,14,148,39,4,
+  85,12,35,16,4,24,5,192,24,12,85,2,8,28,13,8,0,4,73,18,0,0,93,13,
+  4,24,7,121,37,4,85,8,107,17,0,0,139,15,4,24,5,136,38,20,85,178,16,72,
+  18,8,2,1,92,13,12,24,0,7,59,39,8,3,4,32,38,8,2,6,13,38,0,14,
+  64,36,8,0,0,7,38,4,85,24,163,15,4,24,8,220,19,4,85,2,242,18,4,24,
+  13,219,37,12,11,2,8,190,53,4,85,30,203,9,12,24,0,4,182,22,20,85,184,5,
+  31,18,4,24,1,18,36,0,4,238,37,20,134,0,0,0,18,0,0,44,85,0,0,35,
+  17,23,0,6,191,15,12,24,2,7,229,38,0,0,234,38,0,2,222,38,8,3,6,249,
+  37,8,0,2,160,39,0,0,11,39,4,85,22,5,13,0,0,176,13,4,24,10,49,22,
+  0,9,52,19,4,85,12,47,10,4,24,10,166,21,0,9,239,19,8,2,6,66,20,12,
+  85,0,6,121,14,12,24,3,9,135,36,0,2,50,37,24,0,195,22,35,22,8,2,9,
+  140,36,8,0,0,86,25,0,10,222,37,8,2,2,207,36,8,0,6,170,36,0,13,77,
+  21,8,2,28,152,36,8,0,2,188,37,12,85,2,16,226,10,4,24,9,80,37,0,6,
+  28,34,12,85,0,12,34,18,73,134,0,0,0,18,0,0,44,24,2,0,25,34,23,12,
+  85,0,30,152,16,12,24,19,0,98,37,8,3,10,87,20,8,19,9,184,37,0,2,75,
+  37,8,2,10,114,37,12,85,0,12,142,15,12,24,2,9,138,37,8,19,2,185,39,8,
+  11,4,197,39,0,0,208,39,8,2,2,64,37,0,0,184,39,8,11,0,206,39,8,0,
+  4,90,38,8,5,16,171,23,12,85,0,7,218,16,4,24,0,97,38,0,0,131,38,0,
+  2,66,38,4,85,8,29,14,12,24,11,3,184,39,8,13,2,184,39,8,0,6,13,38,
+  12,85,4,14,225,15,12,24,0,2,88,19,28,13,9,131,169,2,108,117,12,24,19,148,
+  2,123,27,8,2,14,62,34,8,0,4,25,37,12,85,3,12,134,16,123,134,0,0,0,
+  18,0,0,44,85,0,0,185,16,23,0,2,164,17,4,24,6,141,19,20,85,179,8,107,
+  9,8,4,1,235,16,8,0,4,202,15,12,24,2,9,32,37,8,0,3,7,26,0,12,
+  190,34,0,1,79,37,4,85,10,219,18,8,2,4,102,17,12,24,0,7,40,38,4,85,
+  22,206,17,4,24,9,46,39,8,19,12,56,20,12,85,2,8,222,9,12,24,0,15,203,
+  38,4,85,18,218,9,12,24,19,13,160,39,0,0,119,39,8,2,4,36,37,8,0,16,
+  212,33,8,4,18,184,37,8,0,10,240,33,0,5,30,40,16,190,30,252,37,0,0,149,
+  38,0,20,167,21,4,85,36,83,14,4,24,1,37,22,4,85,6,175,16,209,134,0,0,
+  0,18,0,0,44,24,0,0,203,27,23,4,85,6,239,17,0,12,194,14,0,8,230,14,
+  4,24,3,105,20,0,18,56,38,4,85,26,1,19,4,24,2,243,20,0,0,145,19,0,
+  5,104,37,0,0,226,25,8,19,6,243,20,12,85,0,30,84,11,4,24,11,241,37,8,
+  3,2,86,34,8,0,0,177,39,0,22,12,22,0,0,242,21,0,7,139,38,4,85,10,
+  10,17,0,1,153,15,4,24,1,133,36,0,0,27,39,8,2,10,81,37,8,0,12,63,
+  19,8,2,0,43,36,12,85,0,2,116,18,4,24,18,242,37,4,85,18,19,14,0,0,
+  1,14,0,4,79,18,12,24,3,2,101,31,43,135,0,0,0,18,0,0,44,24,0,0,
+  237,20,23,4,85,3,246,14,20,17,160,56,186,203,4,24,41,185,37,0,2,184,37,0,
+  1,4,38,4,85,22,165,17,4,24,5,178,37,8,2,2,191,37,8,0,2,186,37,4,
+  85,22,230,14,8,2,1,120,18,12,24,0,3,4,30,8,3,1,166,37,8,0,8,3,
+  38,4,85,8,232,15,0,26,50,16,4,24,5,32,32,0,4,100,29,0,0,34,32,0,
+  6,210,30,0,4,232,20,0,10,157,32,8,2,14,0,30,8,0,1,254,31,0,0,81,
+  33,4,85,6,107,17,12,24,2,2,93,28,12,85,0,8,87,16,8,2,10,40,11,12,
+  11,19,29,134,58,8,4,0,124,58,101,135,0,0,0,18,0,0,44,11,4,0,129,58,
+  23,12,85,0,30,191,16,4,24,5,112,33,12,85,19,26,183,16,12,24,2,5,16,30,
+  8,3,0,4,32,12,11,19,17,179,58,12,24,2,30,73,19,8,0,1,180,29,0,2,
+  178,29,8,3,1,116,32,12,11,2,15,157,55,0,2,149,55,4,24,26,172,29,8,0,
+  2,175,29,4,85,10,178,16,8,2,8,198,9,8,0,6,7,15,4,11,31,194,54,12,
+  24,19,34,107,20,8,0,0,167,29,4,85,18,187,14,4,24,0,99,32,0,6,218,29,
+  4,85,6,49,15,0,16,242,15,12,24,2,1,88,32,8,0,4,87,28,4,11,15,171,
+  56,4,85,28,242,15,12,24,3,0,6,27,8,5,4,102,27,188,135,0,0,0,18,0,
+  0,44,85,0,0,182,15,23,0,1,119,15,12,11,2,9,2,54,12,85,0,36,81,15,
+  12,24,5,7,124,27,12,85,3,10,33,13,12,11,2,27,5,54,12,85,4,36,175,18,
+  8,0,18,228,12,0,8,59,17,0,0,229,15,8,4,10,193,14,12,11,0,19,141,58,
+  4,85,30,126,14,4,24,1,122,28,12,85,4,36,134,11,12,11,0,33,53,56,4,85,
+  34,145,17,0,4,136,11,0,1,40,17,4,24,10,172,26,12,85,4,3,192,16,12,11,
+  0,29,239,57,4,85,34,160,14,12,24,19,0,172,26,12,11,0,15,218,57,4,85,34,
+  129,15,4,24,3,212,29,4,11,13,247,55,4,24,20,27,30,4,85,1,179,17,0,10,
+  175,14,13,136,0,0,0,18,0,0,44,85,2,0,229,9,23,12,24,0,11,196,32,0,
+  16,121,19,0,1,161,30,8,3,2,58,31,8,0,10,90,27,12,85,4,8,124,18,12,
+  24,0,1,155,29,8,3,4,80,27,12,85,0,1,246,18,8,4,14,202,15,12,24,0,
+  0,188,27,0,6,70,27,4,11,19,203,53,8,2,4,255,53,4,24,26,162,27,0,0,
+  200,27,0,8,43,27,12,11,0,17,203,53,12,24,3,30,10,27,8,2,0,50,27,12,
+  85,0,16,223,11,12,24,3,7,63,27,12,85,0,0,242,16,12,11,4,15,199,54,8,
+  0,0,253,57,4,24,28,143,29,4,85,0,227,16,4,24,14,219,28,0,16,163,31,0,
+  12,68,31,12,85,19,18,5,14,72,136,0,0,0,18,0,0,44,11,3,0,220,54,23,
+  12,24,0,28,46,27,4,85,4,123,14,12,11,2,23,189,57,0,12,142,57,4,85,42,
+  21,13,12,11,0,35,182,55,0,6,244,51,4,85,30,131,14,4,11,21,156,51,4,85,
+  22,186,16,4,24,5,250,31,12,85,2,20,1,13,12,11,0,33,188,57,4,85,28,78,
+  17,12,11,2,19,57,57,12,24,3,26,25,32,12,11,2,13,105,57,8,0,18,177,57,
+  4,24,34,145,27,0,4,106,27,4,11,23,136,55,8,3,8,198,57,12,24,0,38,214,
+  26,0,0,184,28,12,85,2,12,204,15,12,82,19,65,85,77,12,85,3,64,196,15,12,
+  24,0,1,61,27,8,2,14,67,27,12,11,0,25,233,57,12,24,2,34,127,28,163,136,
+  0,0,0,18,0,0,44,85,4,0,127,16,23,8,2,12,36,13,12,29,0,26,134,235,
+  12,11,5,49,4,52,12,85,4,52,149,15,12,11,2,27,101,54,4,85,32,31,15,12,
+  11,19,27,64,50,8,3,3,103,54,12,24,0,20,52,21,12,85,4,52,189,249,28,11,
+  0,197,47,188,57,0,8,229,51,8,2,1,207,57,4,24,34,134,30,12,85,0,44,114,
+  246,4,41,12,35,219,4,24,43,132,28,0,8,106,27,4,11,13,243,52,4,24,22,120,
+  32,0,4,239,30,4,29,46,140,235,4,11,55,202,52,12,24,3,28,210,29,12,29,0,
+  38,162,235,12,11,2,59,37,58,12,29,0,72,124,235,0,10,103,235,4,85,4,40,243,
+  4,29,18,100,235,4,11,47,248,53,73,137,0,0,0,18,0,0,44,41,0,0,144,213,
+  23,12,24,2,123,54,28,12,29,0,40,70,235,4,11,43,158,56,12,29,19,66,11,237,
+  8,0,0,198,235,4,11,55,39,57,0,12,38,57,4,24,44,13,28,12,29,19,61,100,
+  235,12,24,2,82,11,29,8,0,0,233,30,8,3,6,199,31,12,11,0,21,106,57,0,
+  6,120,55,0,42,161,56,8,2,2,236,54,12,24,4,46,105,19,8,0,7,97,31,8,
+  5,10,117,30,12,11,4,3,252,57,8,0,4,9,57,12,24,2,38,41,31,12,11,0,
+  1,224,50,0,10,57,55,0,6,24,58,0,12,81,52,4,24,36,147,28,0,16,227,27,
+  8,2,1,145,29,12,85,0,38,8,243,4,24,19,115,27,147,137,0,0,0,18,0,0,
+  44,11,0,0,114,54,23,8,5,4,82,51,8,0,0,186,54,4,24,28,244,26,0,2,
+  214,26,8,5,2,205,31,8,0,6,240,26,0,4,2,27,0,0,251,26,0,0,213,31,
+  0,6,236,26,0,8,248,26,0,2,219,26,0,4,246,26,0,4,87,31,0,16,11,27,
+  0,2,70,27,12,11,2,29,252,56,8,0,4,240,54,4,24,24,1,32,0,10,48,27,
+  0,1,27,32,4,85,30,116,244,4,24,23,254,27,4,11,21,215,52,4,24,26,10,27,
+  12,11,3,23,82,57,8,0,4,71,56,8,2,6,57,51,8,0,0,226,52,0,12,70,
+  51,0,12,200,55,205,137,0,0,0,18,0,0,44,11,0,0,238,54,23,12,24,3,30,
+  31,27,12,11,0,27,193,55,20,17,141,142,1,102,184,4,11,125,108,56,0,6,115,53,
+  4,24,26,89,29,0,0,193,38,8,2,14,52,31,4,11,17,49,51,0,2,117,57,8,
+  0,10,158,51,12,24,6,34,60,28,12,11,2,25,140,57,12,24,0,40,183,26,4,85,
+  34,63,245,4,11,55,111,57,8,3,2,125,56,8,5,8,175,50,8,2,3,195,56,12,
+  24,0,32,208,38,4,11,7,182,51,12,24,2,24,220,28,12,11,0,11,234,54,12,24,
+  2,32,76,31,8,0,2,210,31,4,11,5,225,54,0,2,212,56,0,10,244,54,0,0,
+  185,54,8,3,6,251,53,12,24,0,36,182,26,46,138,0,0,0,18,0,0,44,11,3,
+  0,204,51,23,12,24,2,22,113,32,12,41,0,62,119,223,4,11,79,132,57,4,24,34,
+  2,29,4,11,27,33,55,4,24,54,230,27,8,2,12,218,27,4,11,11,30,52,12,24,
+  0,30,198,26,8,19,7,139,37,8,4,12,27,27,8,0,6,195,26,8,2,2,171,26,
+  0,4,171,26,12,11,0,17,248,50,0,3,144,56,8,2,10,90,51,28,24,0,166,24,
+  252,39,0,14,210,33,4,11,23,204,56,20,24,164,30,141,39,16,171,4,132,39,0,10,
+  56,34,16,168,3,150,39,0,16,165,26,0,6,176,26,4,11,27,72,55,4,24,26,213,
+  32,0,6,105,27,16,168,9,209,39,4,11,15,48,53,131,138,0,0,0,18,0,0,60,
+  24,0,172,0,126,39,23,0,6,42,34,16,165,5,132,39,16,170,0,157,39,12,11,19,
+  7,148,49,12,24,2,20,169,33,24,0,172,3,128,39,24,2,184,2,156,39,8,0,12,
+  204,26,4,11,13,254,50,0,0,98,51,20,24,178,18,200,39,8,6,12,243,27,12,11,
+  2,31,117,57,12,24,0,30,125,32,12,11,2,21,5,53,28,24,0,165,22,168,39,12,
+  17,19,146,4,190,205,12,11,0,169,4,76,55,20,24,169,20,156,39,12,11,2,13,85,
+  52,12,24,0,28,232,27,12,11,2,25,169,51,8,0,3,174,55,8,2,4,242,52,0,
+  3,0,57,8,3,4,209,55,12,24,5,30,233,27,8,0,4,221,27,4,17,166,1,20,
+  210,4,11,193,1,22,55,8,2,2,248,52,147,138,0,0,0,18,0,0,44,11,2,0,
+  70,52,23,28,24,0,165,16,24,41,16,169,0,36,41,12,11,2,9,76,52,8,0,3,
+  190,57,4,24,32,79,32,12,11,2,25,134,55,8,3,3,141,57,8,0,8,48,52,20,
+  24,171,16,201,39,12,85,19,23,231,235,12,11,0,8,77,56,0,2,72,55,0,4,73,
+  52,0,1,52,55,0,6,50,55,12,24,3,30,51,32,12,11,2,21,163,52,12,24,5,
+  28,100,28,8,3,1,201,31,12,11,2,19,35,52,8,0,2,216,53,20,24,176,20,212,
+  39,16,171,2,239,39,12,11,2,15,231,52,12,24,0,24,0,32,12,11,19,21,229,52,
+  0,2,227,52,12,24,0,24,20,32,4,11,27,149,57,12,24,3,30,188,33,12,11,0,
+  21,233,54,182,138,0,0,0,18,0,0,60,24,0,172,0,225,39,23,12,11,2,15,185,
+  54,12,24,0,34,41,27,12,11,2,33,156,57,12,24,0,36,44,27,16,171,9,227,39,
+  4,11,11,210,52,0,4,143,51,0,3,32,55,20,24,178,22,194,39,4,11,19,172,55,
+  20,24,172,16,14,41,16,177,4,200,39,4,11,11,176,52,8,5,3,81,57,8,2,4,
+  126,52,8,0,1,120,55,0,4,173,52,4,24,28,217,30,16,173,3,231,39,16,173,6,
+  209,39,16,165,2,200,39,4,11,11,185,52,20,24,180,20,182,39,16,163,2,243,39,12,
+  11,2,13,45,52,12,24,0,26,0,28,4,11,27,166,56,0,6,177,51,8,3,2,64,
+  52,28,24,0,161,12,226,39,12,11,3,15,106,56,217,138,0,0,0,18,0,0,44,24,
+  2,0,154,32,23,0,0,147,32,8,4,2,148,32,12,11,0,27,138,56,12,24,7,32,
+  241,32,8,0,6,185,27,0,10,105,27,4,11,33,184,57,8,5,6,75,56,8,0,2,
+  176,56,0,12,208,55,0,0,169,56,0,8,134,56,12,24,2,44,105,27,12,11,0,31,
+  205,56,0,0,190,56,0,8,92,51,4,24,28,115,27,4,85,32,48,245,12,11,2,57,
+  32,53,8,0,0,196,56,4,24,34,9,27,0,0,101,28,0,0,67,33,4,11,21,43,
+  53,8,3,2,11,52,12,24,0,32,96,27,8,5,2,98,27,8,0,3,98,32,4,11,
+  23,27,53,0,0,63,54,8,3,2,146,52,245,138,0,0,0,18,0,0,44,11,0,0,
+  119,56,23,0,8,31,52,4,24,26,112,28,16,163,25,79,41,0,28,189,27,12,11,2,
+  23,100,52,12,24,0,42,75,28,8,2,0,73,27,8,4,13,60,41,12,11,0,7,192,
+  53,4,24,32,42,27,0,3,38,34,12,11,2,19,15,52,8,0,0,4,54,4,24,28,
+  44,34,4,11,27,120,57,8,2,14,205,56,8,0,6,106,51,0,2,17,54,0,1,227,
+  54,0,2,110,54,4,24,30,252,39,0,4,73,31,4,11,13,185,54,12,24,2,40,7,
+  27,8,0,0,88,27,0,1,236,39,12,11,2,17,236,52,12,24,5,28,29,29,12,11,
+  0,33,9,57,0,12,240,52,12,24,2,32,36,27,43,139,0,0,0,18,0,0,44,11,
+  2,0,162,57,23,8,0,4,118,54,4,24,36,90,27,12,11,2,21,189,52,4,24,32,
+  108,27,8,0,4,185,28,4,11,27,125,54,4,24,38,126,32,0,6,190,26,8,2,2,
+  123,27,12,11,0,29,28,54,4,24,36,192,28,0,6,217,26,16,168,4,104,27,4,11,
+  31,101,55,8,2,12,148,54,12,24,0,26,206,39,12,85,19,161,1,209,239,12,11,0,
+  142,1,62,57,12,85,19,62,31,245,12,24,0,29,87,32,0,4,100,29,0,4,113,27,
+  0,2,149,28,0,4,82,27,12,11,2,31,82,54,0,1,47,57,8,0,6,138,52,0,
+  0,115,54,4,24,32,107,27,0,1,205,28,0,2,100,27,105,139,0,0,0,18,0,0,
+  44,24,0,0,179,31,23,8,2,4,69,31,12,11,5,21,107,52,8,0,0,83,54,12,
+  24,2,42,22,27,8,0,2,135,33,12,11,2,29,233,56,12,85,19,72,178,244,12,11,
+  2,55,253,54,8,0,8,226,51,4,24,34,162,31,0,2,143,32,4,11,17,219,56,4,
+  24,40,60,29,0,8,138,29,0,10,57,29,20,11,204,25,200,56,0,32,183,44,4,24,
+  20,41,31,4,11,31,245,56,8,5,2,36,55,4,24,36,15,30,12,11,0,25,88,51,
+  4,24,114,127,32,12,85,19,239,1,163,239,12,11,2,142,1,195,51,12,24,0,28,250,
+  28,12,85,19,167,1,166,239,8,0,232,1,179,236,4,11,71,57,51,8,2,6,231,52,
+  12,41,0,108,252,221,193,139,0,0,0,18,0,0,44,24,0,0,145,30,23,4,11,25,
+  123,53,4,24,32,149,30,4,11,29,60,55,12,24,5,32,247,30,12,11,3,21,154,52,
+  8,0,2,159,51,0,6,170,51,0,0,44,51,8,2,6,125,53,28,55,9,131,244,1,
+  204,159,12,11,4,241,1,123,53,8,0,1,17,56,8,2,2,73,55,0,10,173,52,12,
+  41,19,120,219,221,8,0,46,40,222,12,24,19,31,73,35,12,11,2,15,0,51,28,17,
+  0,163,186,1,23,182,4,11,157,1,247,50,4,24,62,33,35,12,11,2,19,127,57,8,
+  0,4,31,56,12,82,19,30,14,75,12,11,2,62,127,55,8,0,8,202,53,8,2,16,
+  252,52,12,85,0,68,205,245,12,24,19,38,65,42,12,11,2,14,223,52,12,85,0,100,
+  20,246,213,140,0,0,0,18,0,0,44,11,0,0,187,50,23,20,17,142,248,3,88,210,
+  4,24,129,1,33,36,4,85,68,175,240,0,16,75,237,16,172,13,201,252,20,17,153,130,
+  1,4,211,4,85,51,167,236,0,54,57,235,12,41,19,106,254,216,12,85,0,67,22,11,
+  0,14,108,252,4,11,86,124,45,0,44,132,45,0,34,200,45,4,24,62,74,36,4,85,
+  80,144,252,4,24,41,5,38,4,41,114,153,218,0,12,222,218,12,17,19,134,1,230,212,
+  12,24,0,167,1,144,38,4,85,82,224,237,8,19,39,23,9,8,0,100,241,225,4,11,
+  49,254,43,0,38,8,44,0,4,14,44,4,24,28,7,38,4,11,7,32,44,4,41,106,
+  182,216,4,24,81,163,37,73,143,0,0,0,18,0,0,44,41,0,0,15,218,23,0,2,
+  15,218,20,17,168,68,210,212,20,41,173,4,129,213,16,171,28,62,216,4,24,85,168,37,
+  4,41,114,32,214,0,6,36,217,0,6,92,216,0,20,73,217,0,22,25,217,4,11,85,
+  14,44,8,4,26,167,66,8,0,50,139,40,4,17,144,1,37,213,4,41,18,205,215,0,
+  12,44,216,0,54,203,215,4,11,167,1,189,66,4,41,158,1,72,216,0,8,91,219,4,
+  11,115,126,53,4,41,136,1,169,218,4,11,125,143,53,0,12,130,53,4,41,134,1,249,
+  219,12,11,5,131,1,53,53,12,41,0,174,1,101,213,0,20,233,214,12,55,19,186,1,
+  44,162,28,41,0,191,153,1,183,213,0,24,245,215,13,144,0,0,0,18,0,0,44,11,
+  4,0,74,67,23,8,0,16,50,67,4,41,188,1,107,217,0,34,147,221,0,23,92,217,
+  4,11,117,27,67,0,76,96,40,0,57,141,66,0,20,151,66,4,41,168,1,180,216,12,
+  24,5,85,47,36,12,41,0,168,1,43,217,0,26,108,217,0,48,38,216,28,17,1,122,
+  148,1,177,167,12,41,0,105,165,216,16,160,24,49,219,0,44,17,215,0,4,161,214,20,
+  17,155,8,178,207,4,8,121,149,37,4,41,114,60,218,20,17,152,20,141,207,4,11,123,
+  135,47,0,16,119,47,0,0,157,47,4,41,154,1,62,215,4,11,121,139,47,0,2,155,
+  47,0,32,137,47,4,8,26,190,38,12,11,4,24,141,46,146,145,0,0,0,18,0,0,
+  44,41,0,0,208,213,23,0,10,62,219,4,17,108,107,183,0,36,94,183,4,8,197,1,
+  15,38,0,6,8,38,4,41,150,1,197,219,16,184,22,233,214,4,8,132,1,141,38,4,
+  41,148,1,205,214,0,6,157,213,0,56,70,217,4,17,42,35,213,4,8,71,29,36,4,
+  41,126,65,215,4,17,30,3,213,4,41,202,1,36,214,0,64,222,213,20,17,143,32,6,
+  213,4,41,30,109,213,20,17,140,4,234,212,4,41,167,1,181,215,4,8,196,1,198,35,
+  0,44,211,35,4,57,254,10,38,136,4,11,133,11,59,42,8,2,3,228,47,8,0,88,
+  120,56,4,8,146,1,76,20,12,85,19,54,106,254,28,11,2,140,52,99,53,8,0,6,
+  44,53,49,148,0,0,0,18,0,0,44,11,0,0,93,53,23,4,8,72,198,35,0,52,
+  187,35,0,24,150,35,0,2,161,35,0,42,198,35,12,17,19,186,1,37,199,12,8,0,
+  179,1,216,35,0,2,197,35,4,41,132,1,25,220,0,62,79,214,4,17,46,233,206,12,
+  11,4,121,168,53,12,85,0,132,1,19,238,4,11,37,108,40,0,60,82,53,0,178,1,
+  92,45,4,85,132,2,144,241,4,17,166,1,158,191,4,85,93,192,239,0,21,27,242,4,
+  17,114,135,196,4,85,105,74,242,0,10,202,241,12,8,19,47,139,13,12,17,0,128,1,
+  253,207,0,38,63,200,4,85,75,213,241,4,11,61,99,47,0,6,109,47,0,2,95,47,
+  4,85,144,1,128,240,90,150,0,0,0,18,0,0,44,8,0,0,226,35,23,4,41,160,
+  1,147,217,12,17,19,52,159,208,8,4,254,1,53,212,12,2,0,174,4,107,148,4,17,
+  181,3,69,207,0,0,66,207,4,8,193,1,103,53,8,19,84,67,36,8,0,8,75,36,
+  8,19,106,146,22,8,0,25,144,38,12,17,4,238,1,207,195,8,0,46,123,193,0,1,
+  112,193,0,94,216,210,0,66,84,198,4,49,18,9,192,4,17,47,240,210,12,85,4,51,
+  112,237,12,17,0,176,1,106,211,12,8,4,131,1,117,56,8,0,90,50,38,16,175,14,
+  245,40,0,44,144,37,0,6,14,41,0,32,135,37,12,17,4,220,2,220,169,12,85,0,
+  255,1,158,249,4,49,164,1,40,190,4,8,139,2,4,45,12,83,2,253,5,211,111,195,
+  152,0,0,0,18,0,0,44,8,0,0,103,37,23,28,49,9,127,160,2,54,193,12,85,
+  0,106,126,247,4,8,217,1,168,42,0,30,236,44,0,62,190,24,12,17,4,254,1,50,
+  206,12,8,19,167,1,91,37,8,0,19,95,53,8,19,68,81,40,8,0,68,170,23,0,
+  13,38,42,0,54,59,24,0,52,78,36,0,42,168,23,0,23,24,36,4,17,132,2,141,
+  202,4,8,229,1,87,43,0,28,84,37,12,85,19,114,219,6,12,8,0,73,171,38,0,
+  50,240,23,0,25,53,38,0,40,7,23,0,16,9,24,4,17,156,1,108,208,12,8,19,
+  197,1,4,44,12,17,0,152,1,192,199,4,8,83,8,23,0,2,13,23,0,45,75,53,
+  0,50,178,37,58,154,0,0,0,18,0,0,44,8,3,0,6,59,23,8,0,96,167,24,
+  0,8,54,24,0,30,162,24,20,49,140,240,1,64,194,4,8,133,2,49,41,0,48,3,
+  23,12,49,19,214,1,64,194,8,0,26,136,190,4,8,135,2,71,53,0,26,217,43,20,
+  2,165,248,7,235,143,4,8,187,6,173,21,0,76,157,40,4,17,220,1,101,204,4,8,
+  197,1,2,39,4,41,184,1,221,216,4,8,107,48,25,12,48,19,40,53,235,12,8,0,
+  40,4,23,0,30,235,25,4,17,200,2,209,199,4,8,195,2,13,44,0,6,16,43,0,
+  38,188,37,0,2,192,37,0,70,200,22,4,17,182,1,142,203,4,8,177,1,38,22,0,
+  86,23,26,0,8,32,26,4,48,142,1,48,224,249,155,0,0,0,18,0,0,44,8,0,
+  0,244,25,23,4,83,175,6,48,112,12,8,19,230,5,73,59,12,49,0,204,2,250,192,
+  12,8,7,207,1,143,22,8,0,44,82,33,0,0,47,33,4,48,136,1,230,232,4,8,
+  117,121,40,0,58,149,22,0,39,138,40,0,90,77,26,0,36,245,22,0,4,241,26,0,
+  12,187,23,4,2,162,5,191,151,4,8,143,5,198,40,0,104,100,26,0,18,107,26,0,
+  92,123,26,0,34,90,26,12,17,3,190,1,142,204,12,48,19,190,1,126,236,12,8,0,
+  187,3,68,53,8,19,164,1,64,17,8,0,6,30,22,0,15,129,33,0,29,131,47,0,
+  40,155,40,0,60,104,37,28,2,8,111,242,10,20,139,12,8,0,151,11,79,53,196,157,
+  0,0,0,18,0,0,44,48,0,0,34,224,23,4,8,197,1,12,53,0,128,1,247,22,
+  0,3,21,45,0,5,131,47,0,10,129,47,0,94,63,26,0,14,46,45,0,54,55,45,
+  12,48,4,204,1,132,226,4,17,128,1,105,198,12,8,0,197,1,101,39,12,48,4,216,
+  1,133,226,28,8,0,195,123,57,39,0,16,83,53,16,167,172,2,67,23,0,18,160,33,
+  12,49,5,156,2,169,194,42,0,1,169,194,1,34,4,169,194,1,4,8,143,2,53,53,
+  0,34,246,47,0,138,3,99,36,4,2,200,8,29,148,4,49,189,4,31,194,4,8,151,
+  2,105,36,0,28,118,36,0,20,53,33,4,49,150,2,161,195,4,8,247,2,217,69,4,
+  49,188,3,132,194,4,8,243,1,31,37,202,160,0,0,0,20,0,0,44,8,0,0,77,
+  33,27,0,42,19,33,0,35,135,39,0,200,1,159,33,0,182,1,111,53,4,48,162,3,
+  53,230,4,88,130,3,233,2,4,48,206,2,90,222,4,26,243,1,18,46,12,88,4,140,
+  1,138,2,12,2,0,130,7,158,155,4,8,201,5,37,47,12,88,19,136,2,31,19,12,
+  56,18,144,3,16,184,12,2,0,204,8,234,139,20,26,180,165,10,9,41,0,24,241,40,
+  0,14,8,41,4,8,168,1,175,46,12,56,19,184,4,244,183,4,88,192,1,127,8,8,
+  0,120,133,6,8,19,231,2,109,33,8,0,12,100,33,4,2,174,9,209,144,4,88,147,
+  9,250,35,4,8,69,128,56,4,88,106,12,36,0,10,10,36,4,8,2,159,56,4,88,
+  80,38,36,4,8,75,219,61,105,166,0,0,0,20,0,0,44,8,0,0,166,56,27,0,
+  36,228,61,0,12,194,61,0,10,236,61,0,48,148,61,4,26,136,2,10,40,0,62,61,
+  40,0,52,38,40,4,79,170,5,65,160,4,26,249,4,3,40,4,88,28,217,33,4,26,
+  19,42,40,4,88,30,220,33,0,24,170,33,0,16,214,33,4,2,180,7,150,149,4,88,
+  169,7,207,33,4,26,34,84,40,0,72,55,40,0,148,1,242,39,4,88,64,220,33,4,
+  79,236,9,151,161,0,8,174,161,12,88,19,137,3,112,8,12,26,0,226,2,228,36,4,
+  88,218,3,4,34,12,58,2,214,1,235,246,28,26,0,174,86,128,40,12,71,11,232,2,
+  72,216,8,14,29,85,228,28,39,9,132,21,43,17,8,19,33,21,34,91,174,0,0,0,
+  20,0,0,44,79,0,0,63,156,27,4,71,169,3,211,223,0,144,1,32,207,0,52,72,
+  211,8,9,106,230,195,8,4,113,152,223,8,10,196,1,111,227,12,39,19,178,2,195,16,
+  12,58,10,160,1,52,221,0,10,171,222,4,71,170,3,72,220,8,4,124,241,218,12,39,
+  0,117,243,34,4,2,234,11,204,145,4,39,237,9,108,32,0,56,213,55,0,6,186,55,
+  0,10,215,55,8,4,176,2,98,51,8,0,56,93,51,8,19,10,77,51,0,10,49,51,
+  8,0,248,2,44,52,4,2,150,11,129,146,4,39,217,9,66,25,0,136,3,117,27,4,
+  58,214,1,126,12,8,4,118,233,232,12,39,0,95,10,32,0,42,209,24,12,58,19,130,
+  1,106,3,8,3,34,83,3,75,180,0,0,0,20,0,0,44,58,0,0,36,245,27,12,
+  71,10,130,2,121,198,12,58,4,73,60,232,12,39,0,91,235,37,12,2,4,162,11,162,
+  145,4,39,237,8,151,32,12,2,0,236,10,187,145,28,58,9,134,217,8,246,224,12,2,
+  0,132,10,204,145,12,39,2,225,11,31,67,28,71,9,150,168,4,218,197,28,39,0,180,
+  231,2,169,47,0,154,1,156,32,4,2,252,14,34,142,0,18,4,142,12,5,9,233,8,
+  54,177,12,39,19,163,2,55,60,12,2,0,184,11,216,150,4,39,133,7,77,61,4,5,
+  194,6,172,170,4,2,198,1,243,141,12,39,3,131,7,97,62,12,33,19,29,150,81,8,
+  0,3,126,81,28,5,1,94,182,6,251,184,8,0,148,1,14,171,0,62,107,169,4,2,
+  142,7,55,150,12,5,4,229,1,165,169,8,0,158,2,93,165,12,58,4,201,3,20,231,
+  4,5,188,2,66,171,106,187,0,0,0,20,0,0,44,58,4,0,129,230,27,12,83,0,
+  237,8,223,107,4,2,236,20,182,150,20,60,136,227,2,17,164,28,71,9,150,151,1,35,
+  192,12,60,0,190,2,10,166,28,58,1,67,229,1,9,8,12,33,2,35,83,79,8,4,
+  24,119,79,8,2,62,162,81,8,0,20,95,87,44,88,4,208,5,95,241,2,12,60,0,
+  136,5,164,166,28,76,9,155,96,115,217,12,60,0,192,3,67,167,12,58,4,201,3,213,
+  242,8,0,27,209,16,12,33,4,163,3,196,94,12,76,10,242,5,239,221,12,78,0,186,
+  3,255,175,4,60,190,1,77,164,28,76,2,116,213,3,173,222,12,60,0,226,5,51,154,
+  12,76,4,163,5,120,218,8,14,12,172,222,8,10,14,227,221,12,60,0,140,3,229,173,
+  16,168,2,231,173,4,58,241,3,168,16,4,60,242,3,223,173,12,76,19,168,2,224,227,
+  12,58,0,229,5,211,16,163,194,0,0,0,20,0,0,44,60,0,0,135,172,25,12,39,
+  4,129,4,172,24,12,60,0,186,4,55,173,8,3,176,1,51,172,8,0,138,2,240,163,
+  4,39,201,5,41,36,4,60,138,6,232,165,28,78,9,155,223,1,155,190,12,76,19,133,
+  1,191,227,8,10,43,83,232,12,60,0,206,4,192,171,28,88,10,85,247,2,79,236,12,
+  60,0,174,6,40,154,0,26,10,154,12,76,10,137,6,51,233,0,26,59,233,12,33,0,
+  173,4,250,86,4,78,192,7,213,175,4,60,136,3,189,160,8,4,47,163,163,8,0,146,
+  2,10,154,16,165,101,101,160,0,86,54,161,28,76,13,70,249,9,171,229,12,60,0,160,
+  11,253,174,16,159,48,140,173,16,156,50,124,170,20,78,165,57,81,175,4,60,32,240,172,
+  16,141,78,207,172,0,10,207,173,0,130,1,222,165,224,198,0,0,0,20,0,0,44,60,
+  0,0,69,156,25,28,76,1,71,243,4,209,228,12,60,0,218,3,156,166,0,86,212,166,
+  0,2,18,167,0,182,1,28,160,0,101,232,165,0,9,124,166,28,76,9,146,181,3,204,
+  223,12,33,2,149,5,101,92,12,60,0,178,8,61,174,0,128,1,119,166,0,105,170,173,
+  0,118,249,166,0,44,247,167,0,36,247,167,0,196,1,200,158,0,115,14,165,0,14,45,
+  165,0,35,38,168,0,40,22,166,0,62,164,163,0,172,2,167,152,0,4,181,152,0,161,
+  2,225,164,0,6,27,166,0,20,113,166,0,26,170,167,0,40,221,164,0,19,172,167,0,
+  42,215,167,0,92,107,165,232,198,0,0,0,20,0,0,60,88,1,71,0,197,7,25,12,
+  60,0,206,3,179,174,0,216,1,123,162,8,5,55,72,166,8,0,8,118,166,4,78,167,
+  1,213,180,12,33,3,145,8,130,96,8,19,94,123,95,12,60,0,216,9,183,165,16,139,
+  16,238,165,16,159,26,253,165,16,155,10,211,165,12,72,1,183,4,33,248,12,60,0,186,
+  4,46,166,16,156,40,219,165,0,22,13,166,4,51,129,6,237,56,4,60,142,8,142,156,
+  0,159,2,155,173,0,22,173,174,28,76,9,133,235,1,149,208,28,78,0,171,214,1,106,
+  180,4,60,166,1,57,168,0,46,98,166,0,51,187,171,0,154,1,179,166,4,78,65,21,
+  177,4,60,58,91,172,0,114,9,166,0,10,186,171,4,78,15,95,175,4,60,176,2,82,
+  158,185,201,0,0,0,20,0,0,44,60,0,0,194,165,25,0,148,1,124,158,0,20,169,
+  163,4,39,171,5,126,27,4,78,224,4,201,175,4,60,112,174,168,0,20,178,167,0,12,
+  98,168,4,78,73,230,178,16,138,2,196,178,4,60,168,1,168,167,0,56,20,165,0,19,
+  52,166,0,82,5,164,12,76,4,155,3,184,223,12,60,0,250,3,187,167,0,42,16,168,
+  0,82,86,166,16,162,47,46,174,0,72,9,175,4,25,105,142,191,4,60,142,2,141,167,
+  20,78,169,99,33,176,4,60,250,1,134,160,12,25,10,169,3,75,203,28,60,0,151,166,
+  3,101,161,0,65,177,172,0,170,1,64,168,12,76,18,199,3,72,237,12,78,0,142,3,
+  34,176,0,13,150,177,4,60,98,109,171,79,204,0,0,0,20,0,0,60,60,0,117,0,
+  190,165,25,4,78,28,193,177,4,60,218,3,250,152,0,225,1,4,165,0,88,179,167,0,
+  238,2,138,152,0,189,3,166,174,0,90,114,169,0,30,181,167,4,78,101,151,175,4,60,
+  114,172,171,0,84,112,167,20,78,156,59,125,175,4,60,148,1,91,167,0,76,249,164,0,
+  97,45,173,16,152,76,98,170,20,78,147,95,67,178,20,60,164,140,1,96,168,20,78,162,
+  109,80,178,16,165,28,16,176,4,60,184,3,72,153,16,148,117,193,169,0,3,167,171,4,
+  78,29,82,176,20,60,141,122,30,170,28,3,9,144,227,2,35,243,12,60,0,132,5,214,
+  162,4,78,57,63,175,4,60,246,1,128,166,28,3,18,229,217,3,207,255,12,60,0,208,
+  3,251,173,93,207,0,0,0,20,0,0,60,60,0,149,0,49,170,25,0,142,3,237,154,
+  0,185,2,165,171,8,19,0,165,171,12,78,0,16,233,177,4,60,104,108,172,8,19,0,
+  108,172,8,0,192,1,176,161,0,62,48,160,0,197,1,30,174,0,218,1,65,160,28,76,
+  3,139,217,2,126,204,12,57,0,218,8,179,145,12,78,3,203,6,150,189,12,60,0,212,
+  2,10,169,12,30,19,219,5,74,71,28,78,3,131,128,5,187,190,12,60,0,226,1,53,
+  169,16,171,144,1,103,162,0,173,1,51,174,8,19,0,51,174,12,78,0,71,99,190,0,
+  130,1,200,188,0,118,240,181,0,6,217,180,0,20,15,182,4,60,82,49,173,4,78,70,
+  134,181,0,84,198,175,0,7,143,176,0,3,128,177,0,148,1,1,177,65,210,0,0,0,
+  20,0,0,44,60,0,0,85,173,25,0,108,190,169,4,78,55,82,182,4,60,208,3,9,
+  157,4,78,187,2,142,178,16,136,34,183,178,0,32,149,175,8,19,31,183,178,28,60,0,
+  175,134,3,32,156,0,94,225,152,4,78,197,2,68,182,12,76,19,183,1,242,234,12,60,
+  0,246,2,30,172,4,78,24,60,182,12,76,4,141,1,157,208,12,60,0,224,4,156,155,
+  4,78,243,2,250,182,4,60,238,2,128,172,4,78,2,210,175,4,60,218,2,205,155,0,
+  40,47,156,0,231,1,239,168,0,62,1,170,4,78,51,103,181,0,66,167,176,0,15,208,
+  184,4,60,92,33,175,4,78,5,17,182,4,57,190,6,252,145,4,76,145,7,234,202,4,
+  78,106,180,184,0,54,34,181,9,213,0,0,0,20,0,0,44,78,0,0,129,184,25,0,
+  54,168,181,0,28,168,181,0,84,64,177,0,0,20,180,4,60,162,2,138,159,12,76,4,
+  221,2,153,198,12,78,0,134,1,38,181,12,76,4,99,234,196,12,78,0,118,209,180,4,
+  76,85,34,201,4,78,146,1,82,179,4,57,252,5,14,146,4,60,191,2,14,154,12,78,
+  4,131,3,195,178,12,76,0,143,1,36,201,4,78,128,1,216,180,16,147,112,207,177,4,
+  60,214,2,48,157,0,243,1,22,174,0,118,163,168,4,78,51,254,175,4,60,82,94,170,
+  0,90,158,169,12,76,4,131,1,110,192,12,78,0,114,178,179,0,13,46,181,16,157,31,
+  52,187,0,62,145,178,12,60,19,248,2,2,155,28,76,0,143,130,9,110,193,4,78,215,
+  11,108,180,175,217,0,0,0,20,0,0,44,76,19,0,235,193,25,4,78,151,12,53,187,
+  8,0,102,33,176,20,60,163,98,10,168,4,78,81,35,177,4,60,124,179,166,12,87,11,
+  219,3,154,41,8,10,10,132,41,12,78,0,222,4,41,191,0,175,1,197,176,4,60,162,
+  4,151,152,12,78,4,165,3,127,180,12,60,0,148,3,175,155,4,78,227,2,114,180,4,
+  60,220,3,215,154,4,78,163,3,110,177,4,60,226,3,236,150,0,193,3,47,175,12,78,
+  4,15,190,179,12,60,0,246,2,165,155,0,139,1,216,163,4,78,173,1,81,179,20,60,
+  164,238,2,98,155,0,8,144,155,16,159,60,37,155,0,157,2,252,172,8,5,80,6,168,
+  12,78,0,125,5,181,4,60,148,1,1,168,12,14,4,217,2,59,225,12,78,0,250,1,
+  154,178,0,6,249,179,22,216,0,0,0,20,0,0,44,60,0,0,163,173,25,0,252,2,
+  62,155,0,62,4,155,4,78,129,3,236,181,0,18,12,181,4,60,148,3,11,155,4,78,
+  193,2,186,177,0,12,166,181,12,60,4,148,3,82,157,8,0,215,1,187,172,0,184,1,
+  223,160,4,76,147,2,159,197,4,60,206,3,57,154,0,137,1,188,160,4,78,199,1,253,
+  179,16,166,22,42,181,28,30,1,98,183,2,105,53,28,31,9,130,198,2,204,23,12,76,
+  0,186,1,133,201,4,14,160,1,1,219,12,3,19,143,1,37,9,12,78,0,234,2,26,
+  178,0,30,17,178,20,53,151,228,11,139,213,8,19,157,8,39,212,12,14,0,191,4,68,
+  219,12,31,3,139,1,44,9,12,53,0,136,14,194,213,4,60,215,7,157,152,0,15,93,
+  153,0,193,1,255,161,4,53,171,1,195,204,149,218,0,0,0,20,0,0,44,43,0,0,
+  77,175,25,12,53,19,87,195,204,12,60,0,226,4,138,151,12,53,19,83,132,210,12,60,
+  0,116,79,152,4,43,193,2,26,174,12,76,19,131,7,133,201,12,53,0,142,6,177,204,
+  16,152,11,97,208,4,43,138,2,118,178,4,57,174,5,70,147,4,60,137,2,116,160,0,
+  180,1,223,154,4,57,184,3,132,146,0,188,2,249,144,4,43,153,5,28,177,4,60,202,
+  1,163,162,12,53,19,11,139,213,0,30,194,213,12,60,0,162,1,242,159,0,2,238,159,
+  4,43,131,1,118,174,0,19,229,174,0,50,193,174,0,34,11,174,0,94,224,172,4,60,
+  110,137,163,12,53,19,201,2,139,213,12,57,0,188,6,240,146,12,53,19,157,6,194,213,
+  12,60,0,254,2,112,163,4,43,101,246,174,88,222,0,0,0,20,0,0,44,60,0,0,
+  191,153,25,0,14,187,153,12,53,19,179,5,139,213,0,30,194,213,12,60,0,226,5,227,
+  153,12,53,5,133,3,94,201,42,0,0,95,201,1,50,161,0,93,201,1,4,4,193,1,
+  1,248,4,60,136,5,231,153,16,142,25,149,157,0,138,1,211,154,0,14,253,154,0,73,
+  168,158,12,53,4,231,2,71,200,12,4,2,159,1,117,0,8,19,10,176,0,12,43,0,
+  226,2,245,173,4,60,194,2,31,154,12,4,4,137,5,122,0,8,3,50,28,244,28,43,
+  0,161,224,2,215,174,0,54,155,174,4,53,79,141,213,4,60,226,3,249,151,12,30,4,
+  199,6,25,63,8,11,242,1,105,60,12,60,0,246,6,223,153,12,30,11,197,6,38,63,
+  12,60,0,170,7,176,152,0,58,51,152,0,126,160,152,46,224,0,0,0,22,0,0,44,
+  60,0,0,48,166,29,0,202,2,203,153,12,30,14,185,6,104,67,12,60,0,190,9,69,
+  151,4,14,195,4,21,232,12,43,2,164,2,8,176,12,31,0,161,2,83,27,8,4,42,
+  74,27,12,4,19,150,1,116,238,12,34,0,71,187,16,4,60,234,3,254,165,0,128,3,
+  157,150,4,53,193,3,170,213,4,60,146,4,21,151,4,14,189,3,118,223,4,4,132,1,
+  130,250,0,56,28,253,4,60,172,4,133,155,0,125,82,164,0,230,1,144,155,0,85,135,
+  161,0,39,190,170,0,90,82,165,12,34,4,181,2,97,6,0,6,100,6,12,60,0,234,
+  4,13,155,0,7,59,162,0,18,95,162,0,134,3,189,151,0,144,2,169,150,20,61,163,
+  189,5,54,30,20,53,140,134,2,89,198,23,229,0,0,0,22,0,0,44,60,0,0,67,
+  155,29,0,33,131,162,4,43,162,3,170,152,0,78,153,150,16,153,143,2,171,170,4,61,
+  231,1,133,3,40,3,136,1,178,9,2,12,38,19,150,3,223,203,12,61,0,159,2,187,
+  16,4,43,174,4,13,155,28,30,9,140,159,3,109,63,12,43,0,244,6,123,154,4,61,
+  243,5,15,31,12,43,19,188,3,124,164,0,230,1,28,165,12,14,0,141,1,34,224,4,
+  43,204,3,1,153,4,14,189,3,27,224,4,43,174,1,242,180,4,4,123,250,246,12,61,
+  19,65,241,8,12,38,0,186,2,149,200,4,43,160,3,2,163,0,240,1,195,150,20,65,
+  149,143,2,100,206,12,18,10,175,3,26,94,0,10,31,94,0,18,3,94,12,65,19,230,
+  3,75,206,0,132,1,102,206,12,43,4,168,1,186,162,8,0,160,1,240,157,247,232,0,
+  0,0,22,0,0,44,65,0,0,236,211,27,4,43,222,2,62,160,0,89,100,171,0,188,
+  1,213,162,8,19,74,146,185,12,61,0,181,1,99,21,0,20,142,21,28,30,12,97,81,
+  57,67,12,43,0,158,4,235,162,28,38,9,135,14,252,199,12,65,0,55,3,217,12,38,
+  19,56,252,199,12,61,0,63,89,5,20,43,134,218,2,12,183,4,61,207,1,104,25,4,
+  43,246,2,250,161,12,4,3,219,1,178,0,28,65,0,147,104,224,207,0,20,78,206,4,
+  43,142,2,251,159,12,4,2,213,2,116,0,12,61,0,38,137,15,0,234,1,182,13,4,
+  38,218,1,8,181,12,61,4,205,1,133,38,8,2,16,119,38,12,81,0,250,2,41,164,
+  12,61,2,235,2,127,38,4,4,128,1,115,244,12,65,0,112,98,216,16,168,128,1,173,
+  204,4,38,212,1,216,188,157,236,0,0,0,22,0,0,44,38,0,0,119,190,27,4,61,
+  93,59,18,12,43,5,178,3,89,157,42,0,6,90,157,1,34,9,89,157,1,4,38,171,
+  1,183,201,0,4,199,201,4,81,194,1,238,160,4,61,177,2,199,16,4,4,90,91,223,
+  20,38,144,200,2,154,203,4,45,195,3,93,55,20,38,142,198,1,142,190,4,81,248,1,
+  233,162,12,38,19,6,154,203,0,0,154,203,12,81,0,142,1,87,162,20,38,143,96,169,
+  203,4,81,43,58,171,0,14,46,171,12,4,2,199,1,226,248,12,81,0,252,1,214,170,
+  4,45,233,2,12,53,0,18,2,53,0,44,247,52,12,4,4,130,1,83,233,12,45,19,
+  131,1,13,53,12,81,0,152,3,252,162,0,31,122,170,12,4,19,191,1,219,233,12,38,
+  0,168,1,159,202,4,81,246,1,120,162,100,238,0,0,0,24,0,0,44,38,0,0,135,
+  190,31,4,81,180,1,107,162,0,31,254,170,12,4,19,254,5,22,236,12,81,0,233,5,
+  249,170,0,116,235,160,0,51,222,169,0,98,60,163,4,38,129,1,247,201,4,4,55,42,
+  229,0,18,38,229,4,38,70,231,201,4,81,144,1,254,169,12,65,4,125,239,216,12,81,
+  0,170,2,41,162,12,4,4,201,1,71,230,28,45,9,138,73,124,72,12,81,0,250,2,
+  28,170,0,58,74,162,0,61,16,171,0,84,70,162,0,86,158,162,4,61,15,93,11,4,
+  38,70,150,190,12,65,19,148,1,225,219,8,0,34,129,219,4,81,142,1,253,163,12,4,
+  19,151,1,235,235,12,81,0,222,1,180,168,0,76,120,168,4,61,149,1,49,33,4,43,
+  200,2,13,158,42,241,0,0,0,24,0,0,44,61,0,0,164,36,31,4,81,204,2,98,
+  162,0,112,80,161,0,6,66,161,12,65,19,74,65,213,12,81,0,73,151,169,4,38,175,
+  7,235,201,16,138,210,7,85,192,4,61,19,193,3,0,35,74,33,0,14,62,33,4,81,
+  130,2,235,164,0,64,13,163,0,156,1,180,163,0,16,43,163,12,4,4,191,1,132,255,
+  12,81,0,216,1,204,163,8,5,22,122,163,58,0,136,3,121,163,1,34,8,122,163,1,
+  12,61,4,199,1,223,15,12,43,0,142,2,2,158,4,61,241,1,4,31,0,48,11,30,
+  12,45,4,21,133,51,28,43,0,169,234,2,79,158,0,230,1,30,160,4,61,67,211,32,
+  4,45,210,2,39,52,12,38,19,85,22,200,12,4,0,10,10,227,20,65,157,84,206,207,
+  5,245,0,0,0,26,0,0,44,43,0,0,204,157,35,4,38,121,3,204,8,19,26,37,
+  204,12,81,0,106,96,163,20,38,130,101,72,194,12,45,4,91,12,52,12,65,0,138,1,
+  196,204,0,16,1,205,0,12,3,208,4,81,134,1,72,163,20,38,140,5,97,202,4,61,
+  89,232,26,8,4,18,211,26,8,0,0,196,26,4,81,176,2,71,163,4,4,157,1,94,
+  244,4,43,254,1,146,157,4,81,72,67,163,12,61,2,131,1,104,38,8,0,38,28,31,
+  0,46,166,12,0,186,2,50,27,0,20,159,32,4,43,140,2,239,158,20,66,196,53,19,
+  1,4,43,220,1,40,159,12,70,5,41,216,209,12,4,0,146,1,159,222,4,61,70,37,
+  13,0,12,119,19,0,86,193,35,12,38,19,132,1,112,195,22,248,0,0,0,26,0,0,
+  44,61,0,0,186,35,35,0,22,176,35,0,22,151,35,0,4,89,36,0,28,169,29,0,
+  22,159,29,4,43,222,1,18,157,4,81,56,44,164,12,66,3,153,1,96,0,12,4,0,
+  86,105,241,4,61,69,166,14,0,8,146,14,0,16,143,14,12,38,19,90,231,195,12,61,
+  0,13,136,11,4,4,146,1,128,224,12,61,3,15,145,24,8,0,32,121,27,12,38,19,
+  94,150,195,12,61,0,77,119,27,0,14,26,36,0,54,39,30,0,144,1,25,30,12,4,
+  19,58,34,239,12,61,0,64,232,19,4,81,194,2,162,159,4,4,183,1,118,230,4,81,
+  198,1,162,159,0,81,142,159,0,62,140,159,20,63,138,40,55,197,4,70,78,255,214,207,
+  250,0,0,0,26,0,0,44,4,19,0,210,236,35,28,63,0,135,226,1,251,191,4,61,
+  11,52,30,12,66,2,26,230,251,12,61,0,1,13,30,20,70,132,96,168,204,12,81,19,
+  38,255,162,12,4,0,25,141,249,4,81,108,38,160,12,61,5,50,1,30,8,0,8,20,
+  30,0,8,19,30,4,81,144,1,170,158,12,4,4,40,25,249,12,61,0,7,97,38,0,
+  18,106,38,4,4,66,1,224,8,4,9,240,248,24,0,167,26,32,224,4,61,142,1,124,
+  35,0,46,100,35,12,63,19,180,2,249,194,12,70,5,126,44,216,8,0,78,61,216,4,
+  66,8,182,252,0,0,194,252,20,70,156,14,6,216,0,0,252,215,4,0,19,159,46,4,
+  66,12,168,252,0,0,186,252,20,70,172,34,251,215,205,253,0,0,0,26,0,0,44,66,
+  0,0,181,252,35,12,70,4,24,76,203,12,4,19,198,2,248,236,12,70,0,12,169,215,
+  8,19,0,169,215,8,5,182,3,185,214,8,4,106,88,203,4,16,8,20,75,12,61,0,
+  88,237,31,12,66,19,44,198,9,12,0,0,66,130,46,0,227,255,7,143,46,0,8,177,
+  46,0,2,163,46,0,20,159,46,4,66,54,102,6,0,0,117,6,4,0,24,26,49,4,
+  61,68,152,23,8,5,50,173,23,8,0,4,156,23,4,81,14,223,161,4,61,32,181,22,
+  4,81,22,71,163,
+};
+const unsigned long Cat_IC_Blocks[] = {
+  0,169,343,514,673,849,1016,1174,1339,1522,1703,1895,
+  2073,2267,2462,2652,2827,3010,3179,3347,3518,3688,3859,4038,
+  4221,4393,4570,4742,4916,5088,5260,5437,5609,5775,5948,6132,
+  6314,6490,6665,6856,7055,7259,7462,7630,7815,7993,8186,8370,
+  8548,8723,8896,9076,9267,9460,9631,9816,9986,10172,10367,10558,
+  10747,10928,11105,11307,11497,11691,11889,12091,12309,12514,12694,12857,
+  13018,13180,13337,13512,13691,13882,14048,14242,14419,14606,14800,14977,
+  15133,15289,15457,15612,15759,15910,16066,16239,16410,16591,16770,16941,
+  17110,17284,17455,17622,17788,17948,18112,18284,18446,18616,18790,18961,
+  19133,19303,19475,19640,19819,19988,20148,20314,20489,20666,20841,21022,
+  21202,21376,21533,21709,21879,22068,22251,22430,22596,22766,22936,23118,
+  23306,23479,23654,23824,24002,24174,24359,24532,24709,24886,25067,25256,
+  25435,25616,25830,26047,26246,26407,26593,26771,26955,27139,27320,27507,
+  27702,27900,28092,28287,28475,28677,28879,29075,29260,29448,29632,29807,
+  29990,
+};
+const blk_catalog_t Cat_IC[1] = {{ Cat_IC_Data, Cat_IC_Blocks, NULL }};
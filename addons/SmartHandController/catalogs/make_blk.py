@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# Builds a block compressed catalog (see CatalogTypes.h) from one of the DSO or general star catalogs in this directory
+#   make_blk.py [--sort] ngc.h ngc_blk.h
+# records keep the catalog's order (which is how they're browsed) unless --sort puts them in RA order, either way they
+# keep their original id, names and subIds follow the records and are dictionary coded
+import re, sys
+
+BLK_RECS = 32   # CatBlkRecs
+DICT_MAX = 127  # bytes 128 to 254
+
+# field order of the supported record types, the block format uses the compact scaling (full records are rounded to it)
+FIELDS = {
+  "dso_t":            ("Has_name", "Cons", "Obj_type", "Has_subId", "Obj_id", "Mag", "RA", "DE"),
+  "dso_comp_t":       ("Has_name", "Cons", "Obj_type", "Has_subId", "Obj_id", "Mag", "RA", "DE"),
+  "dso_vcomp_t":      ("Has_name", "Cons", "Obj_type", "Has_subId", "Mag", "RA", "DE"),
+  "gen_star_t":       ("Has_name", "Cons", "Obj_type", "Has_subId", "Obj_id", "Mag", "RA", "DE"),
+  "gen_star_vcomp_t": ("Has_name", "Cons", "Obj_type", "Has_subId", "Mag", "RA", "DE"),
+}
+FULL = ("dso_t", "gen_star_t")
+BLK_TYPE = {"dso_t": "CAT_DSO_BLK", "dso_comp_t": "CAT_DSO_BLK", "dso_vcomp_t": "CAT_DSO_BLK",
+            "gen_star_t": "CAT_GEN_STAR_BLK", "gen_star_vcomp_t": "CAT_GEN_STAR_BLK"}
+REC_SIZE = {"dso_t": 14, "dso_comp_t": 9, "dso_vcomp_t": 7, "gen_star_t": 14, "gen_star_vcomp_t": 7}
+
+def c_string(src, name):
+  m = re.search(r"const char \*%s=\s*((?:\"(?:[^\"\\]|\\.)*\"\s*)+);" % name, src)
+  if not m: sys.exit("can't find " + name)
+  s = "".join(re.findall(r"\"((?:[^\"\\]|\\.)*)\"", m.group(1)))
+  return bytes(s, "latin-1").decode("unicode_escape")
+
+def elements(s):
+  return s.split(";") if s != "" else []
+
+# the dictionary is the words (with their leading space) that save the most bytes, each use costs one byte
+def tokens(s):
+  return re.findall(r" ?[^ ]+| ", s)
+
+def make_dictionary(strings):
+  count = {}
+  for s in strings:
+    for t in tokens(s): count[t] = count.get(t, 0)+1
+  score = sorted(((n*(len(t)-1)-(len(t)+1), t) for t, n in count.items() if len(t) > 1), reverse=True)
+  return [t for sc, t in score[:DICT_MAX] if sc > 0]
+
+def encode_string(s, words):
+  index = {w: i for i, w in enumerate(words)}
+  out = ""
+  for t in tokens(s): out += chr(128+index[t]) if t in index else t
+  return out
+
+def c_literal(s, indent):
+  lines, line = [], ""
+  for ch in s:
+    c = ord(ch)
+    if c >= 128: line += "\\x%02x\"\"" % c
+    elif ch in "\"\\": line += "\\" + ch
+    else: line += ch
+    if ch == ";" and len(line) > 100: lines.append(line); line = ""
+  if line != "" or not lines: lines.append(line)
+  return ("\n" + indent).join("\"%s\"" % l for l in lines)
+
+# full records have RA in hours, DE in degrees, and Mag in 100ths (9990 or more is unknown)
+def compact(r):
+  r["RA"] = int(round(r["RA"]*65536.0/24.0)) % 65536
+  r["DE"] = max(-32767, min(32767, int(round(r["DE"]*32767.0/90.0))))
+  r["Mag"] = 255 if r["Mag"] >= 9990 else max(0, min(254, int(round((r["Mag"]/100.0+2.5)*10.0))))
+
+def zigzag(v):
+  return v << 1 if v >= 0 else ((-v) << 1)-1
+
+def varint(v, out):
+  while True:
+    b = v & 0x7f; v >>= 7
+    if v: out.append(b | 0x80)
+    else: out.append(b); return
+
+def main(src_fn, dst_fn, sort):
+  src = open(src_fn, encoding="latin-1").read()
+  m = re.search(r"const (\w+) (Cat_\w+)\[(\w+)\] = \{(.*?)\n\};", src, re.S)
+  if not m or m.group(1) not in FIELDS: sys.exit("unsupported catalog type")
+  rtype, cat, num = m.group(1), m.group(2), m.group(3)
+
+  recs = []
+  for i, line in enumerate(re.findall(r"\{([^}]*)\}", m.group(4))):
+    r = dict(zip(FIELDS[rtype], (float(x) if "." in x else int(x) for x in line.split(","))))
+    r.setdefault("Obj_id", i+1)
+    if rtype in FULL: compact(r)
+    recs.append(r)
+
+  # names and subIds belong to the records that have them, in order
+  names, subIds = iter(elements(c_string(src, cat+"_Names"))), iter(elements(c_string(src, cat+"_SubId")))
+  for r in recs:
+    r["name"] = next(names) if r["Has_name"] else None
+    r["subId"] = next(subIds) if r["Has_subId"] else None
+  if sort: recs.sort(key=lambda r: r["RA"])
+
+  words = make_dictionary([r["name"] for r in recs if r["name"] is not None] + [r["subId"] for r in recs if r["subId"] is not None])
+
+  data, offsets, nameCount, subIdCount = [], [], 0, 0
+  for i, r in enumerate(recs):
+    if i % BLK_RECS == 0:
+      offsets.append(len(data))
+      ra, cons, otype, idOffset = r["RA"], 89, 24, 0
+      data += [ra & 255, ra >> 8, nameCount & 255, (nameCount >> 8) & 255, nameCount >> 16,
+               subIdCount & 255, (subIdCount >> 8) & 255, subIdCount >> 16]
+    flags = r["Has_name"] | (r["Has_subId"] << 1)
+    if r["Cons"] != cons: flags |= 4
+    if r["Obj_type"] != otype: flags |= 8
+    if r["Mag"] != 255: flags |= 16
+    if r["Obj_id"] != i+1+idOffset: flags |= 32
+    data.append(flags)
+    if flags & 4: data.append(r["Cons"]); cons = r["Cons"]
+    if flags & 8: data.append(r["Obj_type"]); otype = r["Obj_type"]
+    if flags & 16: data.append(r["Mag"])
+    varint(zigzag(r["RA"]-ra), data); ra = r["RA"]
+    de = r["DE"] & 0xffff
+    data += [de & 255, de >> 8]
+    if flags & 32: varint(zigzag(r["Obj_id"]-(i+1+idOffset)), data); idOffset = r["Obj_id"]-(i+1)
+    nameCount += r["Has_name"]; subIdCount += r["Has_subId"]
+  if nameCount >= 1 << 24 or subIdCount >= 1 << 24: sys.exit("too many names or subIds for a block header")
+
+  header = [l for l in src.split("\n") if l.startswith("#define ")]
+  out = []
+  out.append("// This data is machine generated from %s by make_blk.py, it's block compressed (see CatalogTypes.h.)" % src_fn.split("/")[-1])
+  out.append("// Do NOT edit this data manually. Rather, fix the import programs and rerun.")
+  out += header
+  out.append("")
+  out.append("const char *%s_Names=\n%s;" % (cat, c_literal(";".join(encode_string(r["name"], words) for r in recs if r["name"] is not None), "")))
+  out.append("")
+  out.append("const char *%s_SubId=\n%s;" % (cat, c_literal(";".join(encode_string(r["subId"], words) for r in recs if r["subId"] is not None), "")))
+  out.append("")
+  out.append("CAT_TYPES %s_Type=%s;" % (cat, BLK_TYPE[rtype]))
+  out.append("// %d bytes for %d records, from %d" % (len(data)+4*len(offsets), len(recs), len(recs)*REC_SIZE[rtype]))
+  out.append("const unsigned char %s_Data[] = {" % cat)
+  for j in range(0, len(data), 24): out.append("  " + ",".join("%d" % b for b in data[j:j+24]) + ",")
+  out.append("};")
+  out.append("const unsigned long %s_Blocks[] = {" % cat)
+  for j in range(0, len(offsets), 12): out.append("  " + ",".join("%d" % o for o in offsets[j:j+12]) + ",")
+  out.append("};")
+  out.append("const blk_catalog_t %s[1] = {{ %s_Data, %s_Blocks, %s }};" % (cat, cat, cat, c_literal(";".join(words), "  ") if words else "NULL"))
+  open(dst_fn, "w", newline="\n").write("\n".join(out) + "\n")
+
+if __name__ == "__main__":
+  args = [a for a in sys.argv[1:] if a != "--sort"]
+  if len(args) != 2: sys.exit("usage: make_blk.py [--sort] source.h dest_blk.h")
+  main(args[0], args[1], "--sort" in sys.argv)
@@ -0,0 +1,2074 @@
+// This data is machine generated from ngc.h by make_blk.py, it's block compressed (see CatalogTypes.h.)
+// Do NOT edit this data manually. Rather, fix the import programs and rerun.
+#define Cat_NGC_Title "NGC"
+#define Cat_NGC_Prefix "N"
+#define NUM_NGC 8154
+
+const char *Cat_NGC_Names=
+"";
+
+const char *Cat_NGC_SubId=
+"A;B;A;A;B;B;A;A;A;B;A;B;C;D;A;B;A;B;A;A;A;A;B;B;A;B;A;B;C;A;B;A;B;A;A;A;A;B;A;A;B;A;A;A;A;B;C;A;A;B;A;"
+"A;B;A;B;A;B;A;A;B;A;A;B;A;B;A;B;A;A;B;A;B;A;A;B;A;B;A;B;A;B;C;A;A;B;B;A;B;A;B;A;B;A;A;A;B;A;B;A;B;A;A;"
+"A;A;B;A;B;A;B;A;A;A;B;C;D;E;A;B;C;A;B;C;D;E;A;B;C;A;B;C;D;A;B;A;B;A;B;A;B;C;A;A;A;B;B;A;B;B;A;B;A;A;A;"
+"A;A;B;A;B;A;A;A;A;B;A;A;B;A;B;B;A;A;A;B;A;B;A;A;A;A;A;B;A;B;A;B;C;B;A;B;A;B;A;A;A;B;C;A;B;C;A;B;C;D;A;"
+"B;A;B;A;A;B;A;B;C;D;E;A;B;A;A;A;A;B;A;B;A;A;A;B;A;A;B;C;A;A;A;A;B;A;A;B;A;A;A;B;A;A;B;C;B;C;B;A;A;B;C;"
+"A;B;A;B;B;A;A;A;B;C;D;E;B;B;A;B;C;A;A;A;B;A;A;A;B;A;A;A;A;A;B;C;D;A;B;B;C;D;E;F;A;A;A;A;B;A;A;A;A;B;A;"
+"A;A;A;A;A;B;A;A;B;A;A;B;A;B;A;B;A;B;C;B;A;A;A;B;A;A;A;B;A;A;B;A;B;C;A;B;A;A;A";
+
+CAT_TYPES Cat_NGC_Type=CAT_DSO_BLK;
+// 49665 bytes for 8154 records, from 114156
+const unsigned char Cat_NGC_Data[] = {
+  75,1,0,0,0,0,0,0,12,61,0,0,104,39,0,2,93,39,4,66,1,206,11,0,
+  12,233,11,4,0,38,75,50,0,156,1,95,47,4,70,107,117,213,28,61,3,178,36,231,
+  33,8,0,16,223,33,4,70,31,217,207,4,0,12,66,53,4,66,4,143,6,4,0,4,
+  140,47,4,61,1,126,22,0,24,193,30,16,146,4,112,39,20,19,160,186,1,200,238,12,
+  61,3,157,1,113,39,12,0,0,118,232,46,8,19,103,95,47,8,0,114,111,47,0,89,
+  149,39,0,8,222,36,20,70,141,4,127,220,20,63,180,6,232,174,4,0,40,189,36,0,
+  10,61,41,4,63,11,244,174,12,0,19,34,111,47,12,61,3,6,65,31,12,63,0,19,
+  244,174,12,61,2,24,187,26,242,1,0,0,0,0,0,0,12,66,3,0,58,5,28,19,
+  19,160,16,200,238,8,0,6,231,238,4,66,18,22,9,4,63,0,255,174,4,66,36,14,
+  248,4,0,48,45,44,28,18,9,144,64,36,103,12,61,0,17,82,31,0,12,110,31,4,
+  0,6,248,43,8,3,20,127,44,28,19,0,132,76,8,223,28,66,2,142,10,132,8,12,
+  19,0,30,206,245,4,0,41,153,68,0,30,158,68,4,19,34,142,245,4,0,13,161,68,
+  4,66,8,109,26,4,81,4,52,170,4,19,36,229,245,20,70,104,19,65,200,12,66,4,
+  40,179,17,8,0,16,165,24,12,19,19,91,206,245,24,0,151,84,129,225,20,66,174,50,
+  145,255,8,5,40,3,247,42,0,0,2,247,1,34,1,3,247,1,4,19,64,210,236,40,
+  3,0,0,0,2,0,0,44,66,0,0,73,16,3,4,19,21,75,246,0,134,1,118,223,
+  0,8,97,223,4,0,79,191,42,0,10,196,42,0,4,185,42,0,2,199,42,0,2,193,
+  42,0,8,185,42,34,8,184,42,1,4,19,8,54,234,4,0,16,193,42,4,66,56,44,
+  9,4,0,16,146,42,4,19,36,245,223,12,66,5,38,46,1,42,0,0,45,1,1,34,
+  2,47,1,1,4,0,54,24,32,0,12,204,31,0,4,213,31,8,2,6,241,31,8,0,
+  8,232,31,8,2,1,43,32,8,0,6,4,32,34,6,2,32,1,0,1,20,32,4,63,
+  19,216,186,0,10,211,186,0,4,202,186,4,0,42,219,31,227,3,0,0,0,6,0,0,
+  44,0,2,0,208,31,11,12,63,0,29,217,186,4,0,48,222,31,0,16,250,31,4,66,
+  0,236,14,4,0,6,17,32,0,18,78,42,4,63,30,159,191,20,66,162,106,110,22,0,
+  4,114,23,4,70,11,186,209,4,19,64,39,236,28,16,1,123,60,55,87,28,81,8,66,
+  107,125,153,12,66,0,110,83,18,0,51,173,248,4,19,90,56,244,4,0,26,139,41,0,
+  22,4,31,12,16,1,108,136,101,12,19,4,71,68,252,12,0,0,16,22,45,4,19,10,
+  113,252,0,4,118,253,4,70,17,27,208,4,19,30,24,245,0,8,230,1,0,8,120,253,
+  4,63,27,248,174,4,19,50,217,253,28,81,8,137,63,67,154,12,19,2,76,171,253,235,
+  4,0,0,0,6,0,0,44,19,2,0,175,253,11,8,0,20,109,253,4,66,86,10,4,
+  0,28,255,3,0,6,22,4,0,4,19,4,28,16,1,90,66,162,85,12,66,0,59,21,
+  4,20,70,157,30,179,208,4,19,48,250,2,28,16,1,119,102,25,90,28,70,0,126,83,
+  185,208,4,19,128,1,8,237,12,16,1,23,122,87,12,66,0,49,133,14,0,2,87,7,
+  0,12,57,7,4,0,20,203,43,4,66,3,94,7,4,19,13,213,223,0,12,234,223,0,
+  8,203,223,0,38,172,248,28,16,1,116,118,9,90,24,0,120,12,253,68,20,70,146,96,
+  203,210,4,0,37,178,43,20,70,136,38,117,216,20,19,141,19,51,242,28,81,1,148,105,
+  2,152,12,19,19,106,51,242,8,0,26,0,238,42,6,0,0,0,6,0,0,44,19,0,
+  0,176,240,11,8,3,5,36,244,24,0,215,16,15,244,8,3,28,34,244,12,63,0,45,
+  168,176,4,0,134,1,19,34,4,19,43,243,251,12,0,2,52,20,34,28,19,0,152,13,
+  155,241,4,66,50,233,3,20,19,156,5,161,241,0,59,165,236,0,39,194,222,0,116,222,
+  223,20,0,156,20,31,34,34,0,28,34,1,4,19,9,175,2,0,54,166,227,0,11,225,
+  223,0,1,195,2,4,70,19,20,214,12,19,19,34,166,227,28,81,1,155,125,242,151,12,
+  19,0,146,1,238,223,0,142,1,216,235,0,123,157,230,4,66,18,72,12,4,0,38,234,
+  41,4,66,15,225,3,4,0,26,248,41,0,10,225,41,20,16,117,32,191,68,213,6,0,
+  0,0,7,0,0,44,66,0,0,129,4,13,4,19,98,40,235,28,18,1,106,212,5,69,
+  121,20,16,113,203,5,227,86,12,66,5,61,10,10,12,19,0,6,50,243,34,2,46,243,
+  1,0,20,59,1,4,66,8,189,4,0,0,82,4,20,19,160,26,236,242,0,27,76,1,
+  0,2,69,1,4,66,6,251,3,0,16,119,4,0,2,27,4,4,19,0,57,1,4,66,
+  8,7,5,0,0,229,4,0,8,177,4,20,0,106,56,73,59,8,13,14,240,57,12,19,
+  0,75,193,235,4,66,56,236,3,4,19,111,137,229,0,138,1,69,236,12,66,19,83,229,
+  4,12,63,0,52,36,176,4,66,86,108,23,4,0,26,68,36,4,63,57,14,176,20,19,
+  156,58,18,226,100,7,0,0,0,8,0,0,60,19,0,146,0,191,241,15,4,0,196,3,
+  169,51,4,19,139,3,73,1,28,81,1,169,153,1,155,151,28,0,0,106,200,1,30,58,
+  28,81,1,151,177,1,162,151,12,19,0,140,1,52,1,20,0,59,42,177,58,28,16,1,
+  95,80,216,87,12,0,0,65,86,46,4,19,25,211,253,4,0,28,109,33,0,16,111,33,
+  4,19,57,101,222,28,81,1,154,121,174,151,12,19,0,150,1,126,222,4,0,78,128,43,
+  4,66,5,102,20,12,19,5,59,132,222,42,0,0,133,222,1,34,0,132,222,1,4,66,
+  52,53,4,20,19,156,0,211,255,4,63,1,162,184,4,19,108,167,250,4,66,36,178,8,
+  12,81,1,135,1,142,151,0,4,140,151,12,0,0,222,1,156,42,4,19,21,210,233,0,
+  30,141,253,24,9,134,88,30,239,98,8,0,0,0,10,0,0,60,19,0,116,0,122,226,
+  19,34,28,254,226,1,34,12,242,226,1,42,5,4,234,226,1,42,0,1,222,226,1,12,
+  81,12,201,1,164,151,8,11,14,17,152,12,66,0,156,1,64,11,0,58,223,27,20,0,
+  150,12,73,39,20,70,165,43,9,220,16,143,7,80,211,4,19,30,177,239,28,81,1,150,
+  173,1,118,151,12,66,0,196,1,205,11,4,0,16,85,39,4,19,13,14,252,4,0,48,
+  98,39,12,81,10,191,1,9,152,28,0,0,156,210,1,115,45,4,19,2,92,237,4,70,
+  41,160,201,28,81,1,147,105,129,151,28,66,0,141,238,1,232,45,12,81,1,157,1,203,
+  151,12,19,0,192,1,157,248,28,81,1,151,163,1,109,151,12,19,0,198,1,178,243,0,
+  14,73,253,12,0,1,66,242,50,12,19,0,55,53,246,0,20,247,245,20,9,0,0,0,
+  14,0,0,44,19,0,0,243,245,27,0,96,191,223,0,75,198,243,4,16,72,160,67,4,
+  19,6,216,252,4,66,34,162,34,12,16,11,44,135,80,12,66,0,25,147,43,4,19,46,
+  71,237,0,16,73,237,0,10,72,237,0,0,90,237,4,66,1,50,46,28,70,8,106,61,
+  47,218,24,0,159,7,159,211,28,81,1,142,133,1,244,151,12,19,0,206,1,136,243,20,
+  81,47,67,109,152,4,19,138,1,182,245,28,81,1,147,107,164,151,44,66,0,186,1,220,
+  44,2,4,19,13,140,245,0,6,146,245,28,81,1,142,149,1,83,153,28,70,0,106,136,
+  1,104,202,4,19,130,1,210,240,8,2,10,214,240,8,0,137,1,80,232,20,0,152,108,
+  80,34,12,66,4,22,41,17,28,81,1,146,191,1,66,153,12,19,0,210,1,123,253,15,
+  10,0,0,0,14,0,0,44,19,2,0,119,253,25,8,0,12,231,241,8,2,8,125,253,
+  28,66,0,155,68,17,43,4,63,115,239,180,12,66,4,136,1,48,43,12,70,0,81,139,
+  210,20,66,137,86,43,43,8,2,6,43,43,30,0,0,161,19,75,62,50,164,2,72,62,
+  1,4,66,38,69,43,4,63,103,167,193,4,19,166,1,93,226,0,101,196,248,4,63,43,
+  208,193,0,43,169,180,0,50,192,197,4,19,50,187,248,12,66,5,54,53,38,12,19,0,
+  41,180,248,4,63,87,188,180,4,19,98,202,248,28,81,1,120,157,1,242,152,12,19,0,
+  195,6,30,252,4,66,170,8,29,10,6,19,4,148,232,34,1,147,232,1,4,70,1,15,
+  206,4,19,46,17,230,0,115,219,229,16,141,162,1,57,245,242,10,0,0,0,18,0,0,
+  62,19,0,147,0,53,245,31,4,66,87,158,43,28,81,8,147,135,2,22,150,12,19,0,
+  134,2,60,246,0,16,240,242,0,6,94,246,0,219,1,248,222,8,19,0,248,222,8,0,
+  142,2,54,246,12,81,1,207,1,90,153,12,19,0,228,1,108,246,4,63,65,71,180,4,
+  19,90,84,246,0,8,86,246,0,2,63,253,0,18,246,249,0,22,55,253,4,66,80,198,
+  31,4,19,15,2,247,0,2,16,246,0,22,252,246,12,16,4,166,1,52,88,12,19,0,
+  81,234,254,4,81,129,1,177,162,24,1,143,63,42,154,24,8,91,98,62,155,12,19,0,
+  148,2,121,232,0,143,1,220,254,4,70,33,13,206,12,16,1,192,1,128,88,12,19,0,
+  55,192,238,4,63,131,1,116,194,149,11,0,0,0,19,0,0,44,19,0,0,190,230,31,
+  12,66,4,146,1,31,46,12,81,1,167,2,134,153,12,66,19,168,2,31,46,8,0,20,
+  243,45,0,12,164,46,0,0,1,46,28,81,1,134,163,2,111,152,12,19,0,244,1,21,
+  227,4,70,33,21,213,4,66,96,64,46,0,4,50,46,28,16,1,118,90,149,87,12,66,
+  0,81,22,46,16,146,2,25,46,0,0,237,45,0,4,247,45,0,6,6,46,0,2,17,
+  46,0,22,243,45,4,0,64,116,56,12,66,2,53,32,46,12,19,0,47,81,1,20,66,
+  152,94,31,47,4,0,20,98,56,20,66,163,15,36,47,12,81,1,171,2,158,153,12,66,
+  0,144,2,114,6,16,171,34,22,47,0,34,62,46,0,10,105,46,8,2,4,141,46,74,
+  12,0,0,0,19,0,0,44,66,2,0,151,46,31,0,8,168,46,8,0,2,148,46,20,
+  0,142,20,204,50,28,63,4,94,79,161,189,12,81,0,105,159,156,4,66,164,2,29,47,
+  8,2,22,38,47,12,70,0,119,20,205,20,66,140,130,1,38,47,28,81,1,146,149,2,
+  239,153,44,19,0,164,3,7,252,2,12,66,5,111,24,47,12,70,0,109,135,205,28,81,
+  8,143,191,1,25,153,12,19,0,156,2,49,230,4,70,45,5,213,28,81,8,130,209,1,
+  89,152,12,66,0,224,2,175,45,8,4,8,175,45,28,81,1,158,255,1,239,153,12,70,
+  0,176,1,108,214,16,166,8,215,201,4,0,144,1,35,55,20,19,181,19,150,255,4,70,
+  45,103,210,4,19,56,101,1,0,2,130,255,0,4,164,255,4,0,98,239,47,4,81,209,
+  1,127,168,12,16,1,180,2,130,85,216,12,0,0,0,19,0,0,44,81,0,0,41,173,
+  29,34,22,55,173,1,4,19,138,1,242,2,28,16,1,113,178,1,166,83,12,66,0,143,
+  1,110,8,4,70,73,25,202,0,20,218,210,4,81,87,29,173,4,70,94,203,210,4,19,
+  72,140,254,4,66,44,120,47,0,64,52,44,4,19,85,186,2,4,66,108,27,6,0,39,
+  7,47,4,19,31,176,253,20,66,175,76,15,47,4,19,55,199,254,4,66,64,6,47,0,
+  4,35,44,8,4,4,244,46,12,63,5,173,1,55,177,12,66,0,144,1,93,7,12,81,
+  1,201,1,197,151,20,16,89,144,4,230,82,20,81,142,167,3,61,154,12,66,0,168,2,
+  250,24,12,81,12,189,2,202,151,12,70,0,246,1,223,207,4,66,76,3,6,0,72,56,
+  23,12,0,3,44,182,49,117,13,0,0,0,20,0,0,44,81,1,0,180,151,31,8,0,
+  138,1,56,172,20,66,144,178,1,178,4,0,58,154,46,0,23,39,21,16,143,18,217,4,
+  0,24,7,21,0,44,133,46,16,151,51,136,23,16,140,18,219,4,0,7,35,21,0,28,
+  201,22,4,0,92,149,57,4,19,107,45,224,4,66,100,126,5,4,19,61,243,241,0,58,
+  230,242,4,63,79,189,197,4,66,146,1,172,47,4,81,213,1,197,172,4,66,170,1,251,
+  9,0,24,154,7,4,19,18,184,232,4,66,11,122,7,0,10,24,13,16,170,14,162,7,
+  20,70,150,63,142,207,34,115,202,207,1,4,66,196,1,180,7,4,19,5,88,1,4,66,
+  70,46,47,0,0,154,47,202,14,0,0,0,21,0,0,44,66,0,0,175,47,33,4,19,
+  71,193,254,4,66,72,161,47,16,148,0,150,47,0,47,169,7,0,64,140,47,0,39,223,
+  12,0,50,103,47,0,0,57,47,0,47,119,13,8,2,58,72,47,8,0,8,76,47,0,
+  0,85,47,0,23,107,13,8,3,48,163,47,8,0,37,15,16,4,0,44,57,48,16,159,
+  40,18,48,20,66,142,33,95,18,0,52,155,47,0,45,150,13,0,54,139,47,0,39,69,
+  13,4,19,18,170,253,12,66,5,10,101,5,12,19,0,1,118,2,4,66,18,55,14,4,
+  0,52,100,48,4,66,49,145,13,0,8,205,13,12,70,5,81,13,206,58,0,171,5,33,
+  206,1,237,14,0,0,0,22,0,0,62,70,0,170,0,32,206,37,0,2,15,206,34,0,
+  11,206,1,4,0,144,1,227,47,0,10,94,49,4,19,87,190,253,4,0,146,1,109,49,
+  4,66,91,45,13,20,19,166,20,128,2,4,70,69,198,201,4,19,70,255,253,4,0,76,
+  91,49,8,19,91,100,48,12,19,0,8,203,253,0,5,43,230,0,162,1,129,227,16,146,
+  127,10,254,4,0,70,80,49,4,19,61,41,254,4,70,55,211,201,20,19,158,70,24,254,
+  4,70,69,220,201,20,19,158,72,22,254,0,4,66,254,4,70,83,242,201,4,19,144,1,
+  224,2,4,0,88,225,52,12,66,2,135,1,130,47,8,0,4,130,47,6,19,86,174,223,
+  34,0,174,223,1,0,2,161,223,129,15,0,0,0,26,0,0,44,19,0,0,184,223,41,
+  0,71,171,253,0,78,50,253,28,16,1,120,208,1,7,90,12,19,0,193,1,72,253,4,
+  0,80,203,48,0,16,209,68,12,19,19,155,2,43,230,8,0,222,1,84,253,0,34,37,
+  254,4,66,80,251,45,4,19,183,1,103,241,20,70,151,84,52,205,4,66,106,213,15,4,
+  19,13,166,254,4,66,88,57,46,4,70,119,25,200,4,0,200,1,173,58,4,70,159,1,
+  95,205,20,66,155,156,1,126,30,4,63,163,1,158,182,4,19,156,1,42,253,16,134,17,
+  195,223,4,80,118,207,47,12,19,19,99,42,253,28,16,1,99,244,1,68,86,12,80,0,
+  125,156,47,4,19,203,1,235,229,16,130,146,1,59,246,0,32,172,254,16,157,7,50,246,
+  4,80,86,73,50,126,16,0,0,0,26,0,0,60,80,11,169,0,150,43,41,12,19,0,
+  9,224,238,4,0,94,230,63,16,164,15,186,50,12,80,13,29,149,43,12,19,0,75,110,
+  238,0,54,124,232,12,80,11,56,166,43,12,19,0,61,0,246,4,70,57,92,208,20,80,
+  82,146,1,155,43,4,19,85,169,238,0,18,154,245,0,2,163,238,28,42,1,155,207,2,
+  98,151,12,80,4,226,3,255,42,8,11,15,200,43,12,0,0,44,170,58,4,66,17,118,
+  30,12,19,4,51,117,245,12,80,0,110,222,47,28,16,1,135,84,200,91,12,19,4,189,
+  1,90,227,0,0,96,227,28,70,0,156,31,26,204,16,152,32,41,214,4,80,142,1,231,
+  47,4,19,69,144,245,12,80,3,88,7,48,28,19,0,172,183,1,25,242,12,80,19,166,
+  1,231,47,12,70,0,91,27,204,62,17,0,0,0,26,0,0,44,0,0,0,49,60,41,
+  4,80,15,129,50,20,19,158,73,242,0,4,70,81,27,204,4,19,68,198,241,20,63,138,
+  69,18,197,4,70,12,84,200,12,80,19,60,231,47,28,66,0,120,76,114,22,12,16,4,
+  206,1,161,103,12,70,0,177,2,7,200,4,66,108,77,8,0,46,92,8,4,70,81,236,
+  202,4,80,174,1,76,50,4,19,0,100,223,0,74,81,245,28,16,1,107,230,2,18,91,
+  12,66,0,183,2,75,10,4,70,57,113,213,4,19,38,161,242,4,63,67,133,195,4,70,
+  40,117,213,12,42,1,241,2,139,148,34,143,3,214,147,1,42,0,140,6,82,149,1,34,
+  238,1,245,148,1,4,63,139,2,112,195,4,66,116,37,8,12,42,5,247,1,181,163,12,
+  19,0,228,1,219,242,0,115,164,230,205,17,0,0,0,29,0,0,44,19,0,0,208,242,
+  47,28,62,9,126,200,1,89,73,8,19,0,89,73,12,66,0,145,1,90,11,4,0,156,
+  1,175,50,28,16,1,90,142,1,2,88,12,19,0,189,1,101,237,4,66,50,46,37,12,
+  16,1,80,105,79,12,66,0,107,236,17,28,16,1,104,204,1,72,86,28,66,0,137,123,
+  104,19,4,80,110,211,40,20,0,163,32,156,53,28,16,1,96,152,1,16,87,12,66,0,
+  227,1,1,6,0,108,211,14,4,80,106,227,48,4,19,105,104,223,4,0,130,1,218,51,
+  0,82,148,50,20,80,152,14,169,39,20,6,192,39,171,18,20,80,136,84,4,39,4,6,
+  42,99,16,0,138,2,204,31,0,195,1,147,18,20,66,145,15,103,8,4,6,24,145,18,
+  0,18,73,31,4,0,28,229,50,4,6,6,63,31,105,19,0,0,0,29,0,0,44,19,
+  0,0,44,241,47,0,9,180,234,4,6,64,164,16,4,80,42,81,39,4,35,229,1,247,
+  180,4,19,112,40,222,20,0,158,146,1,186,51,4,80,18,46,50,4,36,79,240,216,4,
+  19,187,1,56,232,4,6,136,2,242,30,4,63,181,1,208,186,20,66,149,166,1,189,8,
+  4,6,42,73,31,0,24,30,32,4,36,157,1,92,206,12,6,19,162,1,204,31,12,36,
+  0,141,1,119,206,4,19,90,226,238,4,0,142,1,64,51,4,19,109,51,242,8,5,22,
+  61,250,12,0,0,122,113,51,2,2,95,51,34,3,97,51,1,0,6,103,51,20,66,150,
+  77,245,8,4,19,35,231,243,20,0,158,122,106,51,0,6,132,51,0,4,70,51,4,6,
+  39,232,24,29,20,0,0,0,31,0,0,44,0,0,0,93,52,49,4,19,202,1,21,243,
+  4,0,169,1,131,51,4,19,25,177,237,4,6,17,19,18,4,0,84,134,51,20,66,142,
+  63,248,5,4,6,38,55,28,4,19,57,118,236,4,0,160,1,3,56,4,6,2,112,29,
+  4,19,93,54,222,8,19,0,54,222,8,0,105,130,232,0,140,2,164,240,4,36,155,1,
+  2,205,12,66,4,110,1,6,12,36,19,109,2,205,12,66,2,134,1,4,8,12,19,0,
+  31,47,243,4,0,138,1,87,52,12,80,2,10,3,47,12,19,0,151,2,212,231,4,80,
+  158,2,155,48,0,4,254,46,8,4,0,0,47,8,0,8,4,47,0,14,80,47,0,0,
+  244,46,4,66,51,1,8,0,6,1,8,12,16,1,192,1,145,85,17,21,0,0,0,31,
+  0,0,60,62,1,104,0,229,78,49,12,35,7,139,3,96,175,12,0,0,208,2,226,63,
+  4,19,29,139,242,0,103,165,249,4,36,61,114,213,4,80,170,1,59,47,0,0,57,47,
+  28,0,1,82,2,206,53,8,0,12,20,51,4,35,177,2,71,175,4,19,184,1,29,243,
+  8,5,171,1,61,232,8,19,42,47,243,8,0,70,164,251,4,0,194,1,176,51,12,80,
+  3,3,112,47,8,0,2,120,47,4,19,77,81,248,8,19,53,29,243,8,3,62,40,233,
+  12,6,0,160,1,103,35,4,66,9,223,11,4,19,14,94,242,0,15,193,0,4,80,84,
+  246,43,20,6,160,33,245,26,28,16,2,64,128,3,255,102,28,6,0,128,245,2,8,27,
+  4,19,41,160,239,4,6,64,236,19,4,36,93,155,218,81,21,0,0,0,31,0,0,44,
+  6,0,0,160,33,49,20,80,140,32,179,44,0,6,136,44,4,19,55,133,247,4,80,80,
+  36,40,4,6,39,0,18,4,35,225,1,208,173,4,80,186,2,88,45,16,146,16,3,41,
+  0,34,67,45,4,6,21,65,22,4,19,55,50,243,16,153,28,79,246,4,80,120,157,45,
+  4,19,97,93,248,4,66,34,23,12,4,6,48,88,22,12,80,3,60,123,45,12,6,0,
+  37,33,26,4,35,243,1,156,176,12,42,1,153,2,114,150,12,0,5,228,4,53,54,12,
+  80,0,9,159,45,4,19,101,219,255,0,1,209,255,20,0,160,142,1,105,54,4,42,167,
+  3,122,159,4,6,168,3,205,22,4,80,26,218,43,0,42,250,40,4,19,89,223,241,4,
+  80,130,1,58,41,9,22,0,0,0,31,0,0,44,19,0,0,217,222,49,0,34,148,243,
+  12,6,5,106,217,18,12,19,0,81,160,241,4,0,206,1,100,63,4,42,221,3,171,158,
+  4,19,182,6,145,233,8,5,2,131,233,12,80,0,227,1,155,41,4,6,53,119,24,4,
+  0,108,38,55,4,80,15,147,41,4,6,13,104,20,16,138,5,163,15,4,63,153,1,120,
+  197,4,36,62,209,219,0,39,40,204,4,19,150,1,254,8,4,80,80,184,43,4,19,43,
+  86,11,4,0,112,188,55,4,19,131,1,236,244,0,24,244,244,0,54,172,8,12,80,3,
+  132,1,140,50,28,19,0,155,151,1,151,241,4,0,152,1,145,53,20,19,150,145,1,150,
+  241,0,90,162,224,0,11,25,224,0,57,146,241,16,139,8,132,241,41,23,0,0,0,31,
+  0,0,44,19,0,0,40,11,49,4,0,92,84,53,20,19,152,131,1,246,244,12,80,4,
+  118,166,45,12,19,0,81,155,8,4,0,190,1,77,53,0,9,98,63,8,19,0,98,63,
+  12,19,0,173,1,82,241,0,9,65,224,0,94,227,253,0,1,96,5,4,35,207,1,79,
+  175,4,19,252,1,196,242,4,36,15,9,205,20,80,152,232,1,166,39,20,19,190,37,251,
+  254,4,36,91,146,210,4,19,11,11,224,8,19,104,251,254,12,80,0,124,198,43,0,78,
+  19,51,4,63,255,1,57,196,20,19,163,138,1,233,254,0,82,137,8,4,80,72,173,40,
+  12,19,19,153,1,233,254,8,0,230,1,197,1,0,101,252,254,28,62,1,62,146,2,59,
+  81,12,6,0,165,1,168,20,16,161,2,177,20,19,24,0,0,0,31,0,0,44,19,0,
+  0,182,230,49,16,152,102,220,239,0,47,220,222,8,19,98,197,1,12,6,0,72,167,20,
+  0,10,175,20,4,19,7,190,222,16,180,95,64,243,16,176,146,1,5,250,16,149,28,143,
+  246,4,6,82,126,22,4,19,51,88,246,28,62,1,63,186,2,69,81,12,19,19,213,5,
+  233,254,12,16,1,146,6,180,90,12,19,0,203,2,37,233,4,40,189,1,222,170,4,63,
+  150,1,160,196,20,80,141,136,2,79,47,20,0,124,50,58,60,4,19,153,1,33,223,4,
+  63,81,30,197,12,19,4,146,1,42,248,24,0,142,4,38,248,12,16,10,222,2,52,88,
+  12,36,0,139,3,11,208,4,0,204,1,170,59,4,19,133,1,99,226,4,6,150,1,180,
+  37,0,4,197,37,4,19,109,72,232,4,6,150,1,232,38,158,25,0,0,0,31,0,0,
+  44,6,0,0,227,38,49,4,19,123,154,243,20,0,154,230,1,220,59,4,19,201,1,139,
+  226,16,127,4,205,225,4,0,208,1,200,59,0,6,123,59,0,24,171,59,0,2,106,59,
+  0,2,114,59,0,32,240,59,4,6,29,183,38,0,2,190,38,4,80,30,99,45,20,6,
+  175,23,78,26,0,38,179,38,4,0,144,1,88,65,4,19,117,118,233,20,36,147,135,1,
+  191,220,4,0,228,1,179,59,4,6,71,39,29,20,80,126,46,193,47,20,19,159,105,135,
+  255,4,6,46,73,17,0,96,183,38,4,19,33,207,238,12,6,4,50,238,28,28,80,0,
+  172,36,136,44,4,6,29,235,28,4,0,124,75,65,20,19,156,157,1,167,255,20,6,153,
+  58,224,27,63,26,0,0,0,31,0,0,44,19,0,0,91,254,49,4,0,166,1,22,60,
+  4,6,81,217,28,4,35,199,1,202,192,4,80,154,2,0,45,4,19,89,93,254,0,64,
+  151,240,0,1,154,240,0,223,1,91,235,0,176,1,3,241,4,0,184,1,16,60,4,19,
+  189,1,235,228,0,18,12,241,20,80,145,188,1,209,52,4,19,147,1,82,240,0,21,55,
+  224,12,80,4,214,1,107,49,8,0,11,21,42,4,35,209,1,30,197,20,19,145,154,1,
+  108,254,28,0,1,114,178,1,107,63,20,62,101,74,224,81,12,19,0,237,1,210,251,20,
+  80,149,154,1,123,50,4,19,63,198,242,0,210,6,35,246,4,6,249,5,236,39,4,19,
+  195,1,1,250,4,36,54,193,204,4,19,120,126,229,0,57,186,227,0,38,132,231,101,27,
+  0,0,0,31,0,0,44,80,0,0,9,49,49,16,149,4,219,46,8,5,4,230,46,8,
+  2,8,234,46,12,6,0,3,176,41,4,80,10,59,46,0,8,222,46,4,19,95,168,13,
+  4,6,58,213,29,4,19,85,179,240,6,80,156,1,183,46,34,2,181,46,1,4,35,157,
+  2,174,192,4,0,204,2,52,58,4,19,209,1,101,240,4,0,220,1,32,58,4,80,192,
+  2,61,49,4,6,255,2,76,33,20,19,168,7,129,243,20,36,134,95,121,200,50,165,79,
+  29,200,1,4,80,248,2,102,47,4,19,123,178,242,0,153,1,133,232,4,6,232,1,143,
+  16,4,19,69,211,245,4,6,172,1,2,30,4,19,59,235,2,8,19,0,235,2,12,62,
+  0,160,1,16,59,0,12,59,59,12,19,5,129,1,101,10,246,27,0,0,0,34,0,0,
+  44,19,0,0,111,10,53,4,62,138,1,67,59,0,2,247,58,0,36,68,59,12,80,19,
+  25,61,49,12,62,0,32,33,58,4,19,143,1,207,2,4,62,162,1,1,59,4,19,171,
+  1,82,240,0,26,17,3,0,4,245,2,0,36,73,3,8,19,65,82,240,8,0,6,89,
+  240,4,6,146,1,225,42,4,19,127,162,239,8,3,14,99,242,8,0,18,32,254,0,12,
+  4,3,0,45,87,240,0,32,109,242,16,174,26,183,2,0,24,44,3,0,6,39,3,16,
+  138,21,129,246,20,62,118,168,1,142,55,34,20,140,55,1,4,6,129,1,109,15,4,40,
+  131,2,249,177,4,19,144,2,79,9,28,16,1,92,168,2,153,87,28,6,0,173,141,2,
+  108,15,96,28,0,0,0,35,0,0,60,6,0,156,0,90,15,55,0,22,162,25,4,40,
+  163,2,251,177,4,19,250,1,142,1,0,80,133,243,0,185,1,132,233,0,114,111,244,4,
+  6,92,114,27,12,19,4,45,137,253,8,0,12,37,2,28,62,1,77,182,1,203,60,8,
+  0,100,5,59,4,19,253,1,67,248,16,135,1,2,244,0,34,233,1,8,5,30,109,12,
+  8,0,55,246,239,0,66,103,12,0,59,106,244,0,8,221,243,50,204,3,216,243,1,12,
+  36,8,71,71,207,28,62,0,153,254,1,113,49,12,19,19,141,1,35,246,24,0,130,4,
+  66,244,12,62,19,194,1,5,59,12,6,0,85,232,25,20,19,131,45,161,0,4,6,94,
+  163,40,4,80,24,53,46,20,62,142,40,27,53,12,6,3,81,152,25,6,29,0,0,0,
+  36,0,0,60,80,0,143,0,29,46,57,0,0,44,46,8,2,14,43,46,12,19,0,113,
+  21,248,0,22,175,242,0,25,137,234,4,80,156,1,47,46,16,162,2,61,46,20,19,114,
+  105,251,255,0,28,54,244,0,34,17,7,0,21,134,243,0,36,112,0,0,14,245,1,0,
+  5,211,232,0,3,246,232,0,7,4,235,6,62,234,1,5,57,34,3,4,57,1,4,19,
+  169,1,143,242,20,36,139,35,193,214,4,35,130,1,77,249,0,5,213,233,0,54,94,244,
+  0,1,41,234,16,132,30,57,245,4,19,38,33,5,4,62,138,1,169,58,4,19,137,1,
+  74,255,12,6,5,60,10,23,12,35,0,83,144,234,4,19,38,166,255,102,29,0,0,0,
+  38,0,0,44,35,0,0,17,231,59,0,12,13,231,4,80,252,1,243,48,4,19,73,152,
+  255,0,16,152,6,4,40,217,2,203,170,20,36,120,226,1,242,212,34,13,3,213,1,4,
+  35,113,227,230,0,36,209,230,0,28,216,230,4,19,240,1,131,6,4,35,93,106,224,0,
+  80,38,236,4,19,50,157,255,0,193,3,170,233,4,62,252,4,68,59,4,19,123,130,11,
+  4,35,61,177,244,4,6,83,218,18,4,35,132,1,219,244,4,6,45,220,18,0,32,206,
+  18,8,2,98,244,18,12,35,0,87,213,231,4,6,118,222,18,0,16,247,18,0,56,192,
+  18,4,35,111,179,238,0,153,1,107,230,0,70,108,235,0,146,1,137,253,187,30,0,0,
+  0,39,0,0,44,62,0,0,6,60,61,8,19,0,6,60,12,36,0,113,115,219,20,35,
+  156,6,82,232,4,19,58,40,254,4,6,50,218,18,12,19,5,184,3,145,8,28,62,0,
+  161,165,2,34,59,0,5,44,59,0,16,27,59,4,19,155,1,48,254,4,35,13,123,243,
+  4,6,90,130,18,4,40,135,2,225,177,0,10,208,177,4,19,158,2,54,4,4,62,234,
+  1,57,61,4,35,221,2,86,235,16,150,162,1,189,241,4,19,56,191,255,16,169,4,189,
+  255,8,19,3,191,255,0,4,189,255,12,35,0,59,127,229,12,62,4,152,2,7,66,4,
+  35,225,1,8,243,8,0,176,1,18,245,4,19,30,143,255,4,35,33,153,234,0,4,166,
+  234,0,44,247,244,4,19,56,200,4,171,31,0,0,0,39,0,0,44,35,0,0,67,241,
+  61,0,8,72,241,20,6,142,136,1,229,35,4,35,145,1,128,234,0,83,135,235,4,62,
+  198,2,99,61,0,42,239,63,16,146,0,218,63,4,35,209,1,94,238,0,132,1,155,231,
+  4,62,148,1,144,60,4,36,163,2,89,210,4,6,164,1,216,16,20,62,153,102,18,50,
+  4,6,83,190,16,4,62,254,1,248,65,12,6,4,103,129,38,12,62,0,140,1,184,61,
+  4,35,215,1,230,234,12,62,4,214,1,71,60,8,0,142,1,235,60,0,87,55,60,8,
+  2,4,75,60,8,0,2,63,60,8,2,2,45,60,12,35,0,181,1,32,229,0,71,160,
+  234,0,11,152,234,0,160,1,63,242,12,62,2,118,66,60,28,18,0,147,194,8,231,114,
+  4,35,227,9,3,243,251,32,0,0,0,39,0,0,44,62,19,0,235,60,61,12,35,0,
+  133,2,123,223,0,98,250,233,0,27,200,233,0,2,186,233,0,8,177,233,0,6,180,233,
+  28,62,1,151,214,1,31,63,28,19,0,167,191,1,110,254,4,35,25,225,238,0,4,211,
+  238,12,62,4,242,1,170,62,8,0,1,132,59,20,35,155,233,1,204,233,0,24,242,238,
+  20,36,131,20,237,218,4,35,82,197,246,2,18,140,235,34,0,141,235,1,0,51,115,238,
+  8,19,107,63,242,8,0,244,1,112,243,4,62,192,1,150,54,4,35,187,1,110,242,0,
+  13,204,233,4,36,64,109,219,4,19,12,223,254,4,62,130,2,40,58,0,37,247,54,4,
+  35,213,1,109,242,0,20,92,242,0,14,84,242,22,33,0,0,0,41,0,0,44,36,0,
+  0,124,200,63,4,19,212,1,217,5,0,2,0,3,28,62,1,143,164,2,223,75,12,35,
+  0,181,2,241,249,0,62,204,251,0,55,29,250,4,62,136,2,212,58,4,35,221,1,43,
+  250,4,62,210,1,84,50,0,2,61,50,4,35,137,2,102,223,16,170,1,88,223,0,10,
+  80,223,0,163,1,220,233,16,124,170,2,188,226,34,26,180,226,1,4,62,228,1,235,55,
+  4,35,135,2,215,244,12,62,19,136,2,235,55,12,6,0,97,95,15,12,35,3,119,163,
+  243,8,0,66,183,240,0,2,94,252,12,6,3,232,1,99,43,28,35,0,145,199,1,80,
+  243,16,162,6,87,243,8,3,10,71,243,12,40,0,189,3,8,161,28,62,1,109,232,5,
+  47,67,12,40,0,185,5,205,160,4,35,218,3,24,241,71,34,0,0,0,42,0,0,44,
+  35,0,0,146,248,65,4,40,253,1,38,180,4,62,230,3,209,58,12,19,3,109,18,2,
+  12,40,1,181,2,219,173,12,35,0,182,2,252,251,34,22,4,252,1,4,19,0,207,3,
+  4,36,77,106,219,4,35,40,187,224,12,62,3,146,2,16,59,12,35,0,135,2,8,225,
+  4,62,164,2,220,58,0,14,227,58,28,40,8,111,215,3,121,177,12,35,0,172,2,107,
+  233,0,10,135,234,4,62,212,1,13,59,0,24,135,59,4,35,203,1,140,252,4,62,248,
+  1,249,58,0,0,1,59,20,35,113,129,1,137,197,4,62,150,1,250,58,0,20,208,58,
+  16,162,16,2,59,16,167,8,20,59,0,20,23,59,16,150,12,9,59,8,3,6,57,59,
+  8,0,0,32,59,16,166,4,28,59,142,35,0,0,0,43,0,0,44,62,0,0,254,58,
+  67,4,19,185,1,194,255,4,62,196,1,53,59,0,8,213,58,0,6,224,58,4,35,227,
+  1,94,241,0,12,159,245,0,7,43,245,0,70,30,252,20,36,146,121,172,209,4,35,146,
+  1,50,253,0,54,27,236,8,19,191,1,137,197,12,36,0,86,188,216,4,62,176,2,222,
+  58,0,6,210,58,4,35,145,1,24,236,0,111,108,237,16,165,38,214,228,0,88,254,252,
+  0,3,24,247,16,129,43,101,228,0,82,98,229,4,36,65,240,218,4,35,74,124,245,0,
+  48,123,249,0,16,180,252,4,36,29,183,219,12,35,19,14,123,249,8,0,116,20,252,0,
+  33,25,234,20,36,146,95,60,203,148,35,0,0,0,43,0,0,60,40,0,154,0,200,181,
+  67,12,77,3,196,2,175,1,28,69,0,125,237,3,109,161,34,168,1,36,161,1,4,35,
+  234,1,12,250,0,40,154,225,20,36,110,37,21,203,34,86,132,203,1,34,2,130,203,1,
+  34,120,94,203,1,16,135,203,1,59,203,8,19,0,59,203,12,35,0,110,98,225,16,165,
+  78,172,251,0,0,182,251,0,10,217,251,0,2,253,251,0,8,212,247,16,140,53,92,225,
+  50,153,34,168,225,1,20,36,130,77,36,204,34,108,73,204,1,34,18,65,204,1,0,4,
+  122,219,4,35,24,34,250,0,36,251,230,12,62,4,148,2,69,59,12,35,0,235,1,161,
+  225,0,17,168,225,12,62,12,240,1,157,44,8,0,102,126,59,0,26,32,59,184,36,0,
+  0,0,50,0,0,44,36,0,0,53,205,81,4,35,142,1,18,244,0,74,183,238,4,36,
+  73,21,210,16,128,20,209,211,0,31,43,203,28,62,1,92,208,2,41,53,12,13,0,178,
+  4,54,103,12,36,19,225,6,209,211,12,35,0,110,183,230,16,189,62,30,248,8,5,47,
+  79,224,12,62,1,150,3,33,73,12,77,0,243,1,59,6,20,36,130,29,45,208,0,49,
+  110,206,34,161,1,248,205,1,4,35,250,1,149,228,16,138,46,100,226,0,40,90,234,0,
+  82,228,248,4,40,247,1,115,184,4,35,238,1,145,236,16,156,34,195,248,0,12,71,228,
+  28,36,9,119,49,53,219,12,35,0,96,23,247,0,37,40,227,0,86,1,242,0,14,2,
+  242,20,36,121,125,154,204,0,28,163,211,58,38,0,0,0,51,0,0,44,36,0,0,138,
+  220,83,4,35,3,188,233,0,162,1,112,204,0,137,1,6,227,12,36,19,19,138,220,12,
+  35,0,180,1,106,233,20,36,158,183,1,251,205,16,136,26,231,205,16,149,2,217,205,4,
+  35,164,1,212,248,0,39,70,226,12,36,3,61,236,205,24,0,134,8,153,205,16,124,36,
+  66,206,50,149,30,152,206,1,42,19,34,242,205,1,24,0,140,57,206,205,16,154,58,242,
+  205,20,35,150,46,235,229,4,77,142,1,128,22,20,36,134,157,1,40,221,20,35,137,65,
+  205,204,20,36,132,18,129,205,4,35,114,99,233,16,140,91,42,205,0,60,247,228,16,158,
+  94,230,229,0,99,152,204,16,145,78,203,229,16,153,42,252,229,0,55,64,223,4,36,35,
+  153,205,19,39,0,0,0,53,0,0,44,35,0,0,92,249,87,4,36,83,139,218,16,121,
+  35,149,205,20,35,135,94,108,229,0,11,174,223,0,12,167,229,0,29,41,224,20,36,125,
+  27,97,205,4,35,132,1,234,233,4,36,83,117,211,20,35,122,72,147,229,12,36,3,81,
+  131,205,12,35,0,172,1,38,254,16,177,0,39,254,4,40,221,1,72,193,20,36,156,160,
+  1,204,217,4,35,27,204,233,0,70,31,225,0,0,233,223,0,8,176,223,0,84,79,249,
+  0,28,70,249,0,143,1,167,202,8,4,180,1,173,247,8,0,15,209,236,0,87,42,225,
+  0,104,237,246,0,52,70,249,4,36,95,125,213,20,35,139,58,143,224,4,36,45,170,205,
+  34,197,1,86,205,1,137,39,0,0,0,54,0,0,44,36,0,0,1,206,89,12,35,4,
+  154,1,74,249,8,2,59,21,230,12,77,0,114,8,4,8,11,106,168,34,28,40,0,125,
+  217,2,215,188,4,35,252,2,59,242,12,77,10,3,204,33,12,35,0,231,1,3,205,8,
+  19,0,3,205,42,0,210,1,75,204,1,0,57,73,223,0,41,211,224,0,20,6,230,0,
+  62,46,250,8,19,61,6,230,8,2,76,60,250,28,62,1,91,200,2,227,74,12,35,0,
+  157,3,252,241,24,2,160,94,39,250,8,0,15,44,243,4,40,113,130,192,4,35,138,1,
+  29,250,0,39,222,242,0,46,54,250,0,67,128,229,0,98,91,250,8,2,41,161,226,8,
+  19,55,128,229,28,77,3,135,252,1,21,32,12,40,19,199,2,130,192,12,35,4,222,1,
+  15,230,89,40,0,0,0,55,0,0,44,36,0,0,180,219,91,4,35,65,208,203,0,202,
+  1,176,232,4,77,176,1,235,9,4,69,247,2,240,170,4,35,214,3,24,234,4,62,192,
+  1,54,46,28,42,8,141,175,6,18,154,12,35,0,154,5,110,243,0,30,248,246,4,13,
+  240,5,136,97,4,35,243,5,52,243,8,19,67,24,234,8,0,216,1,208,243,4,42,193,
+  4,250,158,20,77,163,132,5,58,15,4,35,61,109,244,20,40,163,153,1,171,192,4,35,
+  174,1,206,243,0,6,213,243,8,4,20,123,241,0,18,105,241,8,0,3,243,226,16,146,
+  14,215,226,4,40,167,1,122,188,4,35,140,1,108,203,4,13,208,7,248,100,4,35,155,
+  6,247,224,12,40,5,49,191,195,12,77,3,136,3,104,26,12,35,0,221,1,172,228,4,
+  69,241,2,28,162,61,43,0,0,0,55,0,0,44,62,11,0,251,72,91,12,35,0,197,
+  3,151,205,4,40,69,72,190,0,24,114,186,0,58,195,192,28,62,1,121,178,4,229,74,
+  12,77,0,219,1,230,32,12,35,1,163,1,232,238,12,62,10,138,2,185,51,12,32,0,
+  199,3,148,181,28,13,9,140,158,6,164,86,24,1,94,76,166,88,12,69,0,129,8,20,
+  162,4,35,156,4,185,242,0,10,190,242,4,32,203,1,59,181,4,35,244,2,227,252,4,
+  77,122,35,36,4,35,169,1,26,240,20,40,157,33,71,194,4,42,229,2,208,159,34,64,
+  145,159,1,34,54,216,159,1,20,40,130,144,2,90,194,28,62,1,109,164,4,108,70,28,
+  77,9,127,57,197,43,28,32,0,135,219,3,15,179,34,19,11,179,1,6,35,134,3,113,
+  243,34,2,111,243,1,4,77,96,77,12,20,35,143,215,1,228,225,29,44,0,0,0,60,
+  0,0,44,35,0,0,140,231,99,12,52,1,197,7,186,146,12,35,0,214,7,15,226,20,
+  32,163,197,1,25,181,8,4,4,20,179,12,35,19,176,1,113,243,0,2,111,243,12,69,
+  0,137,2,93,162,4,40,162,2,226,187,28,62,1,89,246,4,213,72,12,69,0,215,5,
+  140,166,4,13,188,11,21,107,34,250,14,147,107,1,4,35,141,23,72,209,0,8,63,209,
+  20,32,134,199,1,49,176,4,69,99,177,166,28,35,9,121,244,3,226,237,28,69,0,156,
+  169,2,173,175,4,35,244,1,255,210,0,114,61,237,4,77,246,2,39,38,4,35,223,2,
+  124,215,34,0,126,215,1,4,77,168,1,48,1,16,164,20,205,6,20,69,131,153,3,227,
+  173,4,18,188,35,160,122,28,62,1,87,207,29,121,71,28,32,0,134,191,4,70,176,4,
+  35,236,1,154,230,12,62,1,246,2,128,52,120,45,0,0,0,62,0,0,60,32,0,123,
+  0,240,176,103,4,77,224,2,109,3,8,19,0,109,3,12,35,0,60,4,255,20,32,119,
+  245,2,172,176,12,77,2,248,3,195,27,8,14,24,200,27,12,32,0,129,3,168,184,12,
+  42,1,157,3,216,155,12,12,0,132,5,245,191,20,69,130,243,1,182,166,4,13,234,10,
+  59,102,4,35,251,6,119,233,0,109,152,233,0,100,160,233,0,10,158,233,0,34,156,233,
+  20,32,122,179,2,222,177,4,12,104,96,187,4,35,170,2,240,254,20,13,135,198,4,58,
+  92,4,12,147,6,243,193,8,19,0,243,193,8,0,50,66,198,4,13,230,8,49,104,20,
+  69,130,167,9,249,174,4,35,142,3,163,241,0,3,218,250,8,19,4,163,241,12,32,0,
+  233,1,158,182,12,62,12,202,4,41,50,12,35,0,173,1,163,248,17,47,0,0,0,62,
+  0,0,44,32,0,0,221,177,103,28,62,1,95,128,5,69,62,12,35,0,183,2,250,230,
+  0,15,20,231,4,12,55,9,196,4,35,152,2,145,255,4,77,2,241,0,0,6,242,0,
+  0,2,58,1,0,38,218,10,4,35,149,1,2,218,16,166,14,5,217,4,77,222,1,207,
+  0,4,35,113,193,247,4,12,227,1,255,187,20,32,135,65,190,177,4,35,200,2,241,239,
+  4,12,241,1,11,188,4,35,152,2,121,249,0,2,196,248,0,2,206,248,20,32,158,215,
+  2,179,177,4,35,228,2,193,248,0,14,93,248,28,62,1,132,136,2,98,64,12,35,0,
+  255,1,216,248,0,1,168,249,12,77,19,6,207,0,12,35,0,58,200,249,0,136,1,81,
+  249,0,103,227,249,0,12,17,250,156,48,0,0,0,62,0,0,44,35,0,0,239,249,103,
+  16,165,52,205,243,4,77,184,1,95,28,4,12,173,2,212,193,20,32,128,93,89,178,4,
+  35,148,3,134,251,8,19,169,1,81,249,8,0,216,1,204,255,0,17,232,248,0,18,119,
+  251,0,97,184,236,28,62,12,143,206,3,196,71,12,35,0,191,2,77,251,8,19,61,232,
+  248,8,0,110,13,249,0,1,75,249,28,42,8,152,215,5,213,153,12,35,0,184,5,30,
+  229,0,104,162,226,0,144,1,141,242,4,77,16,116,10,0,2,112,10,4,35,3,57,255,
+  0,50,194,243,0,72,239,251,0,12,109,253,8,4,65,214,231,24,0,142,124,240,226,12,
+  32,1,221,4,121,162,12,59,0,156,5,225,0,4,35,74,111,248,28,32,8,154,167,4,
+  218,161,130,50,0,0,0,62,0,0,44,35,0,0,58,248,103,0,26,221,243,28,77,1,
+  89,140,1,40,27,12,35,0,121,241,243,12,32,8,181,4,86,158,12,35,0,236,4,110,
+  233,28,52,8,148,183,5,157,155,12,32,19,76,86,158,12,59,0,164,5,153,252,0,0,
+  9,253,12,77,4,128,1,194,29,12,35,0,119,178,248,4,59,22,12,253,4,12,191,1,
+  8,197,4,35,226,1,49,249,4,12,209,1,252,196,4,59,138,2,20,253,24,1,89,124,
+  140,15,16,170,84,180,18,20,7,101,154,1,30,62,12,35,0,255,1,72,248,0,24,168,
+  246,16,154,6,3,247,4,12,227,1,98,192,4,32,153,2,102,162,4,59,226,4,19,252,
+  0,11,92,0,20,32,122,223,2,189,171,28,52,1,166,149,2,180,156,12,77,4,248,6,
+  0,34,0,0,0,34,12,32,1,133,6,29,158,182,51,0,0,0,62,0,0,44,35,0,
+  0,11,249,103,4,59,66,69,252,4,12,153,1,138,210,4,64,121,255,187,20,35,159,170,
+  2,191,247,4,59,44,149,251,0,1,179,251,0,20,149,251,16,177,4,206,251,4,35,32,
+  45,234,4,12,141,1,188,207,4,32,141,2,244,170,12,35,19,20,3,247,12,59,0,136,
+  4,85,2,0,28,166,4,20,47,165,70,190,226,28,32,8,154,193,5,98,157,12,35,0,
+  184,5,98,249,28,32,8,147,175,5,87,157,24,1,164,70,242,158,24,8,151,8,127,158,
+  16,146,46,181,157,12,35,0,208,5,60,249,0,5,20,249,4,12,97,128,213,28,52,1,
+  150,197,4,169,156,12,32,0,182,2,9,171,24,1,140,139,2,203,156,28,64,0,151,136,
+  3,28,180,4,32,155,1,108,166,12,59,4,146,4,183,11,12,13,1,200,3,35,75,28,
+  53,0,0,0,62,0,0,44,59,0,0,82,255,103,4,47,131,1,66,234,28,52,8,136,
+  223,4,120,156,12,32,13,34,74,157,12,59,0,210,5,78,255,28,32,12,141,231,4,211,
+  160,8,16,2,216,160,12,47,0,166,4,10,227,12,59,2,102,173,255,28,32,1,148,243,
+  4,164,160,12,59,0,138,5,161,255,4,35,21,211,244,0,3,48,240,12,32,12,149,5,
+  86,157,12,35,0,162,5,98,240,12,7,1,246,2,99,70,12,35,0,249,2,43,240,0,
+  30,248,244,12,32,12,169,5,99,157,12,35,0,148,5,46,240,4,59,72,59,251,4,47,
+  65,127,233,12,32,13,161,4,210,160,24,1,148,31,94,158,16,158,82,42,161,16,156,47,
+  51,158,16,133,70,147,160,8,16,117,55,159,8,11,88,159,157,12,47,0,196,5,45,230,
+  0,2,42,230,4,59,10,80,251,160,53,0,0,0,62,0,0,44,35,0,0,242,249,103,
+  34,3,240,249,1,12,59,2,36,80,251,28,32,10,138,211,5,150,157,28,47,0,139,156,
+  4,254,218,28,32,10,159,255,3,165,157,28,77,1,86,224,6,205,33,20,32,119,147,6,
+  121,160,24,10,148,67,156,157,24,1,161,46,6,159,4,77,184,6,161,33,28,32,8,142,
+  249,6,185,156,12,35,0,212,5,72,244,4,59,34,62,251,28,52,8,141,235,5,209,155,
+  20,32,124,84,0,159,16,147,37,136,157,12,35,4,200,5,72,249,12,77,1,186,1,210,
+  33,12,12,0,223,2,0,201,12,32,11,243,2,99,161,24,13,124,9,117,161,12,59,0,
+  252,4,61,2,28,32,12,119,233,4,142,161,24,1,151,33,186,159,8,0,178,1,201,167,
+  28,52,1,147,223,1,33,156,20,32,131,46,77,157,16,153,50,240,158,8,16,72,120,161,
+  8,12,47,178,158,8,0,152,1,251,165,199,52,0,0,0,63,0,0,60,32,1,135,0,
+  20,157,105,8,10,120,160,161,24,1,133,5,95,160,20,52,150,109,213,155,20,32,155,158,
+  1,134,161,28,52,8,153,131,2,90,150,28,7,1,102,224,8,167,52,12,35,0,253,1,
+  254,242,4,47,94,81,228,0,144,1,33,230,28,32,1,130,147,7,80,157,24,8,134,118,
+  39,162,12,47,0,188,4,30,239,12,32,13,225,4,30,158,8,8,36,167,159,24,1,134,
+  238,1,99,162,12,59,14,212,3,64,251,28,52,8,156,181,6,190,153,12,7,1,166,9,
+  10,74,20,52,156,179,8,53,156,28,23,0,127,174,4,252,201,28,32,1,149,253,3,20,
+  157,12,47,19,242,5,33,230,28,32,1,149,229,5,187,156,24,0,150,140,2,12,169,34,
+  212,1,143,168,1,34,134,2,250,168,1,4,35,15,152,244,12,7,1,228,2,213,67,12,
+  35,0,227,2,171,244,20,23,152,119,142,210,28,32,8,147,147,4,255,156,38,55,0,0,
+  0,65,0,0,44,77,1,0,79,34,109,12,64,0,177,3,129,185,28,32,1,144,143,3,
+  193,157,8,8,120,250,161,0,13,80,159,28,77,1,95,138,6,124,23,28,23,0,124,149,
+  2,166,202,4,32,255,3,16,157,24,1,144,120,152,161,12,23,0,228,3,93,214,0,16,
+  102,214,28,52,1,153,181,4,255,155,28,32,12,153,100,73,160,28,52,1,149,119,144,155,
+  20,32,155,126,88,160,20,77,102,142,6,186,23,12,32,8,231,5,133,161,12,59,0,172,
+  5,101,7,28,32,1,140,191,5,86,160,12,47,0,192,5,122,234,28,32,1,156,217,4,
+  214,161,20,52,146,157,1,248,155,12,32,0,192,2,16,171,24,1,145,237,1,249,157,16,
+  158,112,207,161,12,23,0,156,3,112,203,28,32,1,150,137,4,81,157,8,12,60,53,159,
+  24,1,151,33,99,157,24,8,137,150,1,173,163,12,47,0,142,4,176,233,12,52,12,183,
+  5,105,155,66,54,0,0,0,65,0,0,44,32,1,0,147,157,109,24,8,131,7,76,157,
+  24,1,147,42,102,158,20,52,148,57,111,155,20,32,154,108,169,158,16,143,7,103,158,4,
+  52,65,241,153,24,8,139,149,14,138,136,28,32,1,165,204,15,83,160,12,59,0,234,4,
+  227,240,28,32,1,146,215,4,65,160,28,52,13,127,159,1,159,155,28,32,8,138,166,1,
+  15,160,24,1,150,39,233,157,20,52,122,30,191,154,20,32,153,192,1,176,161,24,8,115,
+  75,53,158,20,23,97,234,3,12,199,20,32,145,173,3,156,159,8,0,134,2,94,174,24,
+  8,129,139,2,22,158,24,13,129,3,23,158,24,8,126,18,176,157,28,7,1,95,198,7,
+  244,55,28,32,12,124,163,7,6,158,24,1,148,152,1,52,163,16,135,79,57,158,20,52,
+  157,25,88,155,20,32,158,202,1,235,161,0,83,66,158,16,154,92,213,159,16,154,23,50,
+  158,195,55,0,0,0,65,0,0,60,32,8,122,0,229,162,109,24,1,158,4,185,161,24,
+  8,141,82,12,165,8,12,59,45,160,24,8,138,71,180,157,24,12,126,64,18,160,24,8,
+  135,61,109,157,24,12,129,68,61,160,16,153,65,86,157,12,59,0,140,6,131,9,28,32,
+  12,142,129,6,91,157,8,10,30,83,157,28,52,1,154,71,199,155,12,23,0,250,4,74,
+  210,28,32,11,153,197,4,84,157,8,1,18,114,157,16,148,176,1,244,161,20,7,145,174,
+  7,30,66,12,32,4,135,7,231,161,24,1,145,79,231,157,12,47,0,228,4,35,222,28,
+  32,1,152,135,4,175,161,12,47,0,206,4,165,239,0,0,166,239,28,52,1,153,161,6,
+  126,153,4,23,214,5,26,205,12,32,0,161,3,158,163,28,7,1,100,252,3,133,47,20,
+  32,147,241,4,52,157,24,10,154,92,63,160,12,7,1,152,6,157,41,20,32,160,219,5,
+  19,160,78,56,0,0,0,65,0,0,60,32,1,144,0,240,156,109,8,11,100,111,159,24,
+  1,161,122,94,166,0,81,172,158,16,143,6,62,161,24,8,144,85,101,157,20,47,107,236,
+  4,31,221,28,32,1,157,141,4,82,160,12,47,0,196,4,83,233,28,7,1,107,172,2,
+  61,50,12,59,4,197,1,103,252,12,35,14,245,14,171,245,28,32,11,122,232,9,138,157,
+  8,1,66,42,161,20,7,89,204,6,254,50,20,32,136,177,7,27,157,28,52,12,145,59,
+  169,154,12,32,13,186,1,248,160,24,8,129,99,75,157,16,148,40,223,157,8,15,6,237,
+  156,8,10,110,222,160,24,11,150,22,7,161,24,1,154,107,192,156,16,140,40,59,157,24,
+  12,137,160,1,222,162,12,59,0,204,4,114,248,12,32,13,189,4,110,162,24,8,143,103,
+  31,157,12,59,4,228,5,22,244,28,32,1,150,195,5,49,157,0,60,107,159,242,57,0,
+  0,0,65,0,0,44,64,0,0,139,189,109,28,7,12,126,242,3,180,48,28,32,2,163,
+  189,6,235,161,24,1,163,14,235,161,24,12,130,59,98,159,8,11,18,90,159,24,16,141,
+  22,83,159,8,13,24,113,159,28,52,8,156,97,137,156,16,143,2,133,156,20,32,144,118,
+  115,160,24,12,145,36,153,161,24,1,160,146,1,16,165,28,52,8,144,205,1,58,156,16,
+  143,45,231,152,12,32,16,140,2,124,161,24,1,151,34,147,161,24,0,133,138,1,82,165,
+  24,12,131,93,194,161,24,10,149,61,159,158,28,52,1,157,47,150,156,20,32,131,142,1,
+  73,161,28,77,15,109,254,5,79,31,28,32,8,142,185,6,26,158,12,47,0,156,5,0,
+  236,28,32,11,114,219,4,2,160,12,52,0,213,4,117,145,4,47,190,9,230,235,28,32,
+  8,155,163,5,174,156,28,52,1,147,10,141,156,20,7,85,204,7,142,48,28,13,0,135,
+  142,4,171,98,2,58,0,0,0,65,0,0,60,32,1,140,0,26,158,109,4,23,160,4,
+  60,204,28,47,0,133,100,202,224,28,32,1,142,239,4,37,158,16,143,22,32,158,16,133,
+  3,186,157,24,13,107,60,14,160,24,1,150,75,172,156,16,128,32,26,158,16,144,11,169,
+  156,16,151,4,173,156,12,59,10,242,5,69,249,28,32,1,128,133,5,28,160,12,59,10,
+  154,5,86,249,24,12,65,1,86,248,0,1,28,249,28,32,8,132,207,4,205,161,12,47,
+  0,224,3,217,222,28,59,12,50,128,1,152,247,16,67,23,181,249,24,11,115,32,130,248,
+  12,32,1,195,5,228,157,16,125,5,174,157,12,7,14,154,7,126,45,28,52,8,136,157,
+  7,124,156,0,31,102,155,12,77,2,156,7,45,30,12,23,0,149,2,50,212,28,59,2,
+  42,166,1,74,254,12,32,19,235,5,28,160,12,23,0,212,4,15,212,4,47,82,170,230,
+  96,58,0,0,0,65,0,0,44,32,1,0,171,157,109,12,64,3,172,3,198,186,12,77,
+  1,222,3,186,36,20,32,159,191,5,30,166,12,64,0,244,1,191,186,12,59,14,160,2,
+  115,246,28,52,1,146,173,6,198,153,12,32,13,142,1,51,158,24,8,133,118,225,160,16,
+  138,54,121,161,0,19,79,160,16,141,47,205,156,24,13,134,106,195,160,12,64,0,204,2,
+  149,183,0,6,132,183,28,32,1,135,241,2,156,157,20,52,142,37,72,155,20,32,131,160,
+  1,248,159,12,52,0,247,6,112,142,12,7,1,160,15,89,79,28,32,10,115,167,8,188,
+  159,24,13,129,19,134,157,12,52,1,41,134,156,4,47,182,5,158,230,28,52,11,134,203,
+  5,237,154,24,8,134,48,56,156,12,32,16,116,178,159,24,1,146,26,18,160,28,59,9,
+  141,142,6,236,12,8,14,41,202,252,8,10,8,92,253,28,52,1,134,193,6,2,154,2,
+  61,0,0,0,65,0,0,44,77,1,0,164,28,109,20,32,135,231,5,213,160,20,52,154,
+  107,132,156,20,32,148,170,1,22,162,24,11,148,61,236,159,28,52,8,133,117,11,155,12,
+  32,11,150,1,232,159,24,13,141,75,195,156,0,94,218,160,24,10,135,1,226,159,28,52,
+  1,153,89,91,156,20,32,128,44,212,156,20,52,144,27,166,155,12,59,4,208,6,92,12,
+  28,32,10,140,209,5,232,159,24,8,129,34,187,160,24,1,121,27,251,157,4,52,17,87,
+  156,28,32,13,131,12,150,157,28,77,2,90,172,6,84,18,28,52,1,151,213,6,27,156,
+  16,156,22,44,156,28,32,16,147,4,243,156,12,23,0,156,5,57,213,28,32,13,118,217,
+  4,83,157,28,52,1,142,47,2,155,12,32,10,98,197,156,24,1,147,42,32,160,12,59,
+  4,180,5,169,241,28,32,13,109,133,6,41,157,28,52,1,143,15,126,155,16,147,32,17,
+  156,229,59,0,0,0,65,0,0,60,52,1,144,0,55,156,109,16,154,10,68,156,28,32,
+  15,121,70,160,157,12,23,1,190,3,162,207,20,32,152,239,1,228,160,12,59,4,222,4,
+  125,12,8,14,35,2,0,28,52,1,137,149,6,28,156,16,156,8,54,156,12,59,14,162,
+  6,48,0,16,105,22,29,0,28,32,10,126,215,5,232,157,24,11,98,5,186,157,12,59,
+  12,254,5,107,0,28,52,1,157,153,6,29,156,12,47,0,170,5,183,224,12,32,12,237,
+  4,41,157,20,52,140,63,121,155,12,47,0,128,6,34,232,28,32,10,142,141,5,239,156,
+  24,16,134,4,208,156,24,11,143,1,203,156,16,129,12,244,156,8,12,20,75,157,8,0,
+  170,1,141,164,24,10,133,169,1,210,156,0,12,202,156,16,146,4,234,156,16,145,6,235,
+  156,12,64,0,240,2,6,177,28,32,1,150,169,2,161,158,12,47,0,240,4,247,230,178,
+  61,0,0,0,65,0,0,60,23,0,137,0,74,207,109,28,32,1,146,167,4,64,157,0,
+  36,141,157,24,13,141,42,251,157,8,1,34,252,157,16,156,36,67,160,16,138,27,164,158,
+  24,8,162,180,1,181,166,24,1,132,159,1,231,158,20,7,81,252,6,76,46,12,32,8,
+  155,7,146,157,12,64,0,130,3,236,181,28,32,1,139,241,2,45,157,28,52,11,133,59,
+  141,154,12,64,0,236,3,175,182,28,32,8,147,251,1,213,160,12,47,0,204,4,84,225,
+  28,52,1,140,175,5,138,155,28,32,8,148,66,156,157,24,1,147,40,131,158,28,59,0,
+  160,200,5,101,245,28,52,1,150,183,5,9,155,20,59,116,198,6,150,0,12,32,12,247,
+  5,197,156,24,1,150,72,57,159,14,64,0,210,3,16,184,34,2,12,184,1,28,32,1,
+  154,243,2,146,158,16,142,46,19,160,16,159,9,175,157,12,59,0,252,6,254,16,28,32,
+  8,152,241,4,112,165,232,61,0,0,0,67,0,0,60,52,8,149,0,88,154,111,24,12,
+  129,60,89,156,28,32,8,151,130,2,26,163,12,47,0,176,4,112,227,12,32,1,249,4,
+  48,157,4,7,164,8,235,70,20,32,141,249,7,92,157,12,13,0,178,9,245,81,28,37,
+  1,92,187,2,43,33,28,32,8,146,151,6,61,160,12,47,0,198,4,24,218,12,64,1,
+  149,2,198,170,4,52,131,3,199,154,8,8,44,227,154,20,32,146,148,1,26,160,16,132,
+  55,43,157,24,1,152,22,47,157,24,8,163,148,1,94,162,28,47,0,142,188,4,85,222,
+  28,32,1,149,239,4,112,158,20,59,119,148,6,219,14,28,54,2,74,97,238,240,12,59,
+  1,108,75,8,12,52,0,217,15,54,139,24,1,146,198,9,43,155,28,13,0,131,160,17,
+  112,111,50,154,226,3,175,111,1,28,32,1,154,131,20,1,159,12,64,0,146,2,234,171,
+  12,54,14,176,3,41,242,28,32,0,168,191,5,18,157,8,1,50,216,157,42,64,0,0,
+  0,68,0,0,44,64,0,0,214,183,113,28,32,8,156,149,2,145,161,16,143,21,87,160,
+  16,151,84,225,162,16,139,65,163,158,16,127,21,151,157,28,37,1,111,128,7,69,34,28,
+  32,8,139,211,6,104,158,24,1,147,14,225,158,28,52,8,154,227,1,65,150,20,32,152,
+  180,3,96,165,12,59,14,154,5,137,26,28,32,8,128,167,6,143,158,12,7,1,208,8,
+  127,73,20,32,154,151,8,96,159,28,54,2,91,162,5,46,247,28,37,1,76,192,1,157,
+  34,20,59,84,59,220,19,12,54,14,79,230,246,12,52,4,137,6,109,155,28,32,1,142,
+  100,99,158,28,52,8,144,191,1,56,152,12,59,10,144,8,98,29,24,12,93,24,35,29,
+  12,32,8,247,5,236,160,24,1,153,3,172,159,12,64,0,138,1,81,165,20,47,150,222,
+  3,19,225,12,59,1,142,1,179,6,28,32,8,161,241,4,47,163,12,54,14,234,4,1,
+  247,8,11,116,42,247,244,65,0,0,0,68,0,0,44,59,1,0,7,251,113,12,54,10,
+  2,37,247,28,59,1,112,102,195,7,14,32,0,251,5,8,157,34,12,12,157,1,20,23,
+  143,188,4,127,207,12,59,4,184,1,132,1,28,52,8,154,245,7,186,149,12,64,0,158,
+  5,81,181,28,7,1,134,244,4,174,56,28,32,8,159,179,6,107,163,28,59,1,110,168,
+  5,55,18,8,3,74,22,25,12,9,0,219,1,253,224,28,32,8,160,163,4,147,160,12,
+  59,4,196,5,106,1,12,52,0,193,6,157,151,4,67,138,6,231,193,0,22,216,193,12,
+  59,1,174,2,135,8,28,52,8,138,209,8,183,148,28,9,1,111,218,7,116,229,12,64,
+  0,197,3,15,167,4,9,240,3,239,217,16,132,34,155,225,20,7,151,182,4,211,73,28,
+  52,8,156,249,9,253,150,20,32,134,138,2,178,157,12,9,0,252,4,163,229,0,8,169,
+  229,28,52,1,149,205,5,70,154,20,32,134,204,1,236,158,180,67,0,0,0,70,0,0,
+  60,54,1,110,0,164,245,115,12,9,0,62,150,224,16,144,14,69,217,12,37,4,148,2,
+  130,27,12,54,1,87,89,249,12,67,4,231,1,88,192,12,64,0,83,29,174,0,2,45,
+  174,4,9,138,3,133,223,12,37,4,132,2,233,17,12,54,1,81,78,242,0,6,73,242,
+  12,9,0,59,181,224,4,32,171,3,84,164,0,12,159,163,0,6,146,163,24,8,157,67,
+  250,159,28,54,1,64,152,5,27,249,12,32,0,193,4,131,163,12,37,1,188,5,200,23,
+  12,32,0,251,4,167,163,28,54,1,110,152,5,183,9,8,10,114,46,7,8,11,21,33,
+  7,24,12,73,114,8,7,12,7,1,114,34,50,20,32,158,171,7,250,157,28,7,9,175,
+  130,8,174,63,28,9,1,119,157,3,131,211,12,54,19,214,1,8,7,8,14,70,114,14,
+  8,10,11,75,7,226,69,0,0,0,70,0,0,44,54,14,0,174,14,115,12,37,4,138,
+  1,105,37,28,32,8,147,159,6,252,157,28,54,1,114,218,5,197,248,16,98,74,230,11,
+  16,102,6,162,7,12,13,0,178,6,188,92,28,54,1,116,203,5,234,10,12,23,0,169,
+  1,126,206,4,13,184,9,148,105,28,32,8,151,139,12,132,164,12,13,0,188,12,237,105,
+  28,54,1,133,215,6,122,15,0,27,232,253,24,14,144,100,112,12,8,1,44,160,1,12,
+  9,0,105,169,220,28,54,12,64,228,1,19,14,12,37,1,66,238,16,16,120,148,1,91,
+  38,12,9,0,223,1,206,209,4,13,226,23,2,120,28,54,1,125,133,22,148,6,0,62,
+  242,4,12,9,0,97,157,222,16,144,17,243,216,20,50,160,166,5,137,86,34,143,7,114,
+  85,1,34,198,4,209,85,1,4,37,70,189,47,0,2,201,47,4,18,178,28,245,121,127,
+  72,0,0,0,72,0,0,44,37,4,0,147,47,119,8,3,44,126,47,8,4,12,134,47,
+  12,9,0,197,2,177,216,28,7,1,79,188,2,108,58,12,54,11,129,1,223,1,12,9,
+  0,89,26,230,12,37,4,170,2,53,47,8,3,40,115,47,28,54,1,100,175,1,134,251,
+  20,9,70,151,1,124,226,12,37,0,188,3,151,47,0,2,157,47,0,6,142,47,0,2,
+  174,47,4,9,173,2,246,217,0,6,243,217,4,37,188,2,174,47,4,9,217,2,250,217,
+  0,114,246,231,4,64,129,3,98,165,28,67,8,114,160,3,203,204,28,54,1,114,138,2,
+  237,245,12,18,0,224,28,229,121,28,54,1,85,237,28,167,0,8,19,14,237,245,12,50,
+  0,144,3,179,64,28,37,1,125,99,151,25,12,86,0,213,4,152,164,12,54,1,150,4,
+  193,245,12,86,0,129,4,129,164,4,50,250,6,76,64,247,73,0,0,0,72,0,0,60,
+  54,1,130,0,204,245,119,28,67,0,143,195,1,227,197,28,54,1,121,226,2,113,249,0,
+  90,164,14,8,2,65,179,244,12,13,0,240,8,33,107,4,50,213,5,243,71,12,54,10,
+  133,2,240,244,0,2,241,244,12,9,1,21,133,236,20,54,144,98,84,4,12,50,0,214,
+  3,239,71,0,26,47,72,0,2,214,71,28,54,1,84,175,2,27,244,16,109,134,1,124,
+  1,12,9,0,133,1,48,215,4,50,246,3,20,72,34,36,2,72,1,12,9,14,149,3,
+  233,239,12,67,0,137,1,44,196,20,50,165,210,4,36,69,16,156,32,83,71,28,37,1,
+  110,225,1,197,38,12,50,0,234,1,94,71,4,37,109,5,50,4,50,164,2,118,71,28,
+  54,1,97,175,3,189,241,28,13,0,150,180,14,7,114,4,50,253,11,58,63,12,54,1,
+  221,1,222,247,12,37,0,50,181,26,167,76,0,0,0,73,0,0,44,50,0,0,92,71,
+  121,20,37,154,179,1,77,29,16,146,10,89,29,28,54,1,92,107,231,240,28,50,0,146,
+  142,3,20,67,28,9,1,102,251,2,60,237,28,54,9,141,98,217,254,12,13,0,224,4,
+  7,92,12,86,1,161,9,39,160,4,54,194,5,199,243,12,10,0,220,1,114,17,12,54,
+  1,30,20,241,4,9,41,205,221,20,54,96,130,1,102,241,20,9,90,37,119,219,20,37,
+  122,136,2,142,19,8,19,0,142,19,8,0,62,56,33,12,9,1,65,168,231,8,11,142,
+  1,48,237,24,1,97,71,193,233,8,10,62,55,237,24,1,66,26,131,220,12,13,0,252,
+  6,104,98,12,54,1,189,5,67,245,12,37,0,146,1,104,31,20,13,139,210,4,112,98,
+  28,9,1,104,163,6,224,224,20,54,143,94,64,241,12,15,0,151,3,86,167,34,192,1,
+  126,166,1,34,160,1,192,167,1,30,79,0,0,0,75,0,0,44,37,0,0,211,33,125,
+  24,9,137,50,241,41,8,19,0,241,41,8,0,94,26,48,28,9,1,105,243,1,35,237,
+  12,37,0,166,2,29,48,0,51,208,32,20,54,173,149,1,67,242,12,37,3,224,1,29,
+  48,8,0,2,22,48,4,9,191,2,217,216,4,15,231,2,79,166,12,9,19,232,2,217,
+  216,24,1,109,68,53,226,16,99,46,27,226,12,37,0,172,2,32,48,8,4,16,8,48,
+  28,7,0,190,30,115,52,4,37,5,25,48,0,16,40,48,8,2,0,31,48,0,4,27,
+  48,24,9,121,6,190,29,8,0,82,101,48,12,10,1,133,1,20,10,20,37,105,127,90,
+  19,20,67,99,76,85,239,12,86,0,225,4,222,157,34,19,181,157,1,34,74,23,158,1,
+  4,37,246,5,211,34,12,10,4,37,178,255,252,79,0,0,0,77,0,0,44,10,4,0,
+  178,255,129,1,28,67,1,151,45,35,236,12,10,5,126,186,13,28,13,0,109,168,4,76,
+  93,8,11,24,79,93,12,37,0,187,3,216,36,0,39,2,26,0,14,19,26,12,13,1,
+  140,6,237,101,20,67,98,171,6,141,231,28,37,0,188,184,2,174,46,0,37,0,26,12,
+  10,2,23,40,12,12,67,1,97,96,237,16,104,5,6,234,12,37,0,212,2,31,50,4,
+  10,113,132,16,4,15,243,3,119,167,4,37,202,4,111,25,28,50,8,126,136,1,75,55,
+  28,37,1,108,24,175,30,20,67,108,199,1,176,226,16,69,36,103,235,16,92,48,70,236,
+  12,50,0,194,2,204,55,12,67,1,215,1,215,234,12,50,0,202,3,104,74,20,67,141,
+  239,4,65,188,8,1,136,2,126,232,14,50,0,148,3,118,74,34,6,115,74,1,12,67,
+  1,251,2,211,232,181,82,0,0,0,79,0,0,44,50,0,0,123,75,131,1,28,67,1,
+  127,137,3,225,228,12,10,4,166,1,43,13,28,86,0,138,203,5,119,157,4,37,212,6,
+  3,45,12,50,19,92,123,75,28,67,1,86,185,2,240,234,24,9,133,6,11,235,24,1,
+  94,97,237,210,24,9,119,106,27,230,12,13,0,140,7,215,103,20,86,129,131,11,29,157,
+  8,19,0,29,157,12,50,0,186,7,131,55,0,4,125,55,0,158,1,171,77,28,67,1,
+  87,251,2,20,222,0,6,233,220,12,37,0,254,1,77,38,0,18,109,38,28,67,1,120,
+  207,1,1,202,24,9,145,200,1,32,217,24,1,108,12,83,217,12,37,0,146,2,71,23,
+  28,67,1,127,145,1,182,225,12,50,0,216,3,237,78,0,54,255,78,0,74,176,80,12,
+  10,1,193,2,152,13,12,13,0,184,3,212,85,12,50,2,39,153,80,8,0,10,159,80,
+  214,84,0,0,0,79,0,0,44,50,0,0,155,80,131,1,8,4,32,160,80,8,2,9,
+  208,80,12,86,0,211,8,113,154,12,67,12,136,5,101,218,12,50,0,130,4,39,80,0,
+  2,156,80,4,10,209,2,88,6,12,50,3,254,2,191,80,8,0,14,164,80,0,155,2,
+  176,80,0,220,1,44,75,0,2,46,75,0,113,201,56,28,67,1,83,161,3,51,201,8,
+  19,137,11,103,235,24,1,121,148,13,209,230,12,37,0,190,1,210,33,0,4,205,33,28,
+  67,1,98,185,1,129,221,16,101,42,87,216,28,50,0,174,130,2,189,53,4,10,151,1,
+  163,10,20,37,158,104,201,35,16,147,36,196,35,4,50,184,2,110,80,28,67,1,104,245,
+  3,64,213,12,37,0,148,2,130,38,4,10,75,91,11,4,37,94,112,38,4,50,82,165,
+  56,4,54,115,24,255,110,85,0,0,0,79,0,0,44,50,0,0,169,56,131,1,4,10,
+  173,1,107,11,4,50,196,2,251,80,4,22,231,1,136,35,4,10,69,168,10,20,50,141,
+  146,2,40,72,4,67,179,2,150,235,4,15,239,1,156,181,4,22,176,3,219,31,4,10,
+  67,250,7,4,50,132,3,40,76,28,54,1,101,243,2,175,240,12,22,0,144,1,88,22,
+  0,30,42,12,28,67,1,118,103,232,228,12,22,0,124,126,13,0,8,92,13,0,80,68,
+  33,0,65,99,13,0,38,123,22,8,3,48,182,28,28,15,1,101,219,3,153,169,12,67,
+  0,168,3,123,238,4,50,158,3,184,72,8,2,60,183,72,28,67,1,90,145,2,248,215,
+  12,50,0,222,2,41,82,4,22,235,1,47,25,4,13,158,6,164,104,34,219,7,79,105,
+  1,34,162,6,159,104,1,34,180,3,69,104,1,201,86,0,0,0,82,0,0,44,50,0,
+  0,176,55,137,1,4,67,229,1,192,239,4,22,122,98,11,12,67,19,181,1,248,215,12,
+  50,0,222,1,190,55,12,22,4,36,88,25,8,0,10,87,25,8,4,8,88,25,12,50,
+  0,204,1,75,48,28,67,1,101,161,2,128,213,28,50,0,161,148,4,45,79,20,22,151,
+  153,1,217,35,16,164,4,207,35,20,50,142,180,1,104,65,34,40,105,65,1,4,41,209,
+  1,43,5,28,67,1,90,69,196,237,12,22,0,198,1,126,37,20,50,143,172,1,198,69,
+  28,67,3,72,181,2,158,237,12,50,0,154,1,144,51,20,13,156,154,6,58,105,4,22,
+  165,5,95,30,28,67,1,88,179,1,137,202,20,84,72,189,1,5,186,20,41,83,196,2,
+  210,247,12,50,0,222,3,53,82,4,13,252,3,66,105,34,246,2,226,104,1,16,146,219,
+  2,104,104,20,50,151,243,3,31,71,4,22,159,1,186,29,132,88,0,0,0,84,0,0,
+  44,22,0,0,98,33,141,1,4,41,4,15,1,4,22,98,199,29,0,14,124,30,0,4,
+  44,29,4,67,191,1,244,216,4,22,250,1,216,29,4,41,21,160,6,4,22,72,13,30,
+  16,149,18,246,29,4,67,191,1,249,224,4,22,120,85,31,4,67,95,188,219,24,1,99,
+  15,110,212,0,25,59,203,12,22,0,150,2,173,29,0,2,189,29,28,67,1,95,221,1,
+  177,213,12,22,0,226,1,59,27,4,57,165,156,2,243,128,34,184,146,7,67,129,1,4,
+  41,201,246,4,81,243,4,22,178,1,142,34,0,18,155,36,0,19,19,32,20,67,155,121,
+  15,237,8,12,45,126,204,24,1,122,52,235,212,12,22,0,150,2,115,26,0,62,235,28,
+  4,41,187,1,227,248,0,12,238,248,128,89,0,0,0,85,0,0,44,41,0,0,2,249,
+  143,1,8,4,8,245,248,28,67,1,117,11,9,214,16,143,21,26,209,12,41,4,122,136,
+  243,8,0,50,41,255,4,13,232,8,248,110,4,22,169,7,239,36,0,29,182,24,0,44,
+  206,36,0,38,140,30,0,23,149,24,8,3,230,1,148,30,8,0,8,144,30,0,194,1,
+  22,32,4,82,234,1,249,74,4,86,201,6,32,159,4,82,230,6,35,75,0,49,38,75,
+  20,22,174,101,2,42,34,18,244,41,1,4,82,118,25,75,0,62,19,75,4,22,147,1,
+  92,38,0,122,127,40,12,15,1,141,4,23,169,28,41,9,152,226,2,8,233,12,22,0,
+  190,1,152,35,4,41,149,1,67,237,20,68,129,39,84,223,4,82,216,6,201,103,4,41,
+  237,5,97,252,168,91,0,0,0,86,0,0,44,41,0,0,94,253,145,1,0,8,48,250,
+  0,22,1,1,20,22,152,150,1,211,40,0,5,123,35,0,12,142,35,16,166,52,104,35,
+  16,159,20,161,36,0,21,14,28,0,20,10,28,12,84,14,135,2,42,198,28,68,1,109,
+  162,1,104,213,12,22,0,156,2,122,33,4,82,242,4,204,103,8,4,11,210,103,0,0,
+  210,103,28,22,1,56,229,4,250,27,12,13,0,188,5,98,105,0,32,50,105,34,20,40,
+  105,1,28,68,1,137,161,7,140,206,12,13,0,140,7,198,104,4,22,139,5,1,28,4,
+  50,108,239,52,20,82,142,110,103,71,4,15,181,4,155,177,4,82,192,7,172,103,4,41,
+  145,5,35,250,4,22,104,5,28,4,41,31,21,7,28,84,1,98,223,1,66,190,12,13,
+  0,134,8,122,104,237,92,0,0,0,87,0,0,44,22,0,0,242,27,147,1,16,143,3,
+  81,20,4,50,134,1,96,49,4,82,148,4,250,99,4,22,167,4,190,16,12,41,4,61,
+  221,250,12,13,3,168,8,125,111,12,82,0,137,4,165,85,20,13,136,202,4,63,111,20,
+  82,175,191,5,159,76,4,22,239,1,184,13,28,68,1,117,163,1,143,209,20,84,111,81,
+  0,192,16,113,8,223,188,12,22,0,176,2,243,17,4,41,39,127,234,20,68,148,35,240,
+  207,12,22,1,180,1,237,17,12,41,0,99,140,228,12,50,1,214,2,148,63,12,22,0,
+  119,13,27,34,4,21,27,1,4,50,78,53,52,28,84,1,86,143,2,179,180,16,103,79,
+  156,186,16,141,64,113,196,12,22,0,160,2,33,27,0,4,32,27,4,41,17,172,235,20,
+  82,158,134,2,65,76,0,45,163,67,4,22,141,1,9,27,59,94,0,0,0,88,0,0,
+  44,22,1,0,32,16,149,1,8,0,136,1,229,43,0,2,230,43,20,82,128,180,1,250,
+  72,28,22,1,94,199,1,204,16,28,50,0,123,122,136,47,4,82,202,1,234,69,16,152,
+  62,136,83,18,196,53,228,69,34,2,228,69,1,2,6,233,69,34,2,233,69,1,0,8,
+  220,69,0,22,218,69,4,41,253,1,76,252,20,50,166,194,1,59,56,4,82,200,1,12,
+  74,16,144,2,6,73,0,0,1,73,4,41,231,1,163,251,0,211,2,224,248,0,134,3,
+  192,251,0,56,121,251,0,18,141,251,8,2,4,145,251,12,82,0,168,2,121,76,12,41,
+  2,161,2,164,251,8,3,11,76,251,12,50,0,92,2,56,12,41,2,71,182,251,8,0,
+  18,91,252,8,2,9,164,251,80,95,0,0,0,92,0,0,44,41,0,0,57,251,153,1,
+  0,8,99,251,4,82,198,2,57,79,4,22,219,1,150,24,4,50,194,1,224,63,4,41,
+  197,1,40,4,4,15,221,2,200,171,4,13,178,10,13,111,4,41,187,7,101,4,4,68,
+  53,233,220,20,41,167,166,1,243,8,4,50,130,1,208,50,34,0,205,50,1,4,22,101,
+  219,15,4,41,17,7,249,0,15,185,250,0,134,1,133,4,4,50,72,220,50,4,22,2,
+  201,15,4,82,226,2,60,85,12,41,19,161,6,57,251,12,22,0,250,3,195,15,4,41,
+  19,75,5,4,22,72,242,23,0,11,206,11,4,13,130,8,158,112,12,41,19,179,10,185,
+  250,12,22,0,132,3,252,23,0,35,226,36,34,6,228,36,1,12,84,11,219,1,167,190,
+  12,22,0,210,2,40,31,182,96,0,0,0,94,0,0,44,22,0,0,62,31,157,1,4,
+  82,186,1,151,73,0,4,148,73,4,22,255,1,248,25,4,82,134,3,3,86,34,220,1,
+  135,88,1,4,22,205,3,143,35,8,5,21,65,26,8,0,0,247,25,4,50,122,80,50,
+  4,22,63,58,26,4,13,254,5,195,108,4,22,247,5,11,26,0,40,45,36,0,23,249,
+  25,0,16,21,26,0,130,1,11,36,4,41,177,1,220,228,4,50,254,1,81,59,4,82,
+  94,149,76,12,41,4,197,2,233,228,8,0,8,235,228,4,50,154,2,129,53,4,33,140,
+  11,215,108,4,22,239,11,56,26,4,82,218,1,180,71,4,41,153,2,245,233,4,22,134,
+  1,127,30,4,41,61,211,4,4,22,108,121,42,4,82,128,1,174,71,16,124,130,1,98,
+  85,224,97,0,0,0,95,0,0,44,82,0,0,186,71,159,1,4,50,89,28,47,4,82,
+  100,166,71,4,68,141,2,104,222,4,22,186,1,52,10,0,84,151,26,16,130,29,2,10,
+  20,50,142,174,1,239,63,4,22,139,1,64,10,4,50,156,1,209,49,0,6,218,49,0,
+  24,172,49,4,41,115,238,234,20,50,141,238,1,13,57,4,22,37,168,42,34,9,170,42,
+  1,20,41,127,111,159,221,4,50,138,2,49,58,4,22,149,1,177,17,20,82,143,136,4,
+  107,98,4,15,165,7,99,159,38,86,197,4,248,158,1,38,15,86,86,159,1,20,22,156,
+  140,8,72,42,0,6,3,28,0,1,5,25,28,84,9,141,235,1,169,195,12,50,0,140,
+  3,247,48,4,22,67,4,25,0,2,18,25,0,58,248,43,0,29,54,25,23,99,0,0,
+  0,98,0,0,60,82,0,148,0,187,59,165,1,16,162,12,185,59,0,98,175,74,4,22,
+  167,1,90,28,0,3,248,26,0,2,245,26,0,10,186,28,4,82,192,2,42,91,12,22,
+  2,181,2,139,28,10,0,2,124,28,34,4,127,28,1,28,15,8,82,195,3,193,163,12,
+  22,0,206,3,139,28,4,82,196,3,45,102,4,41,151,4,205,232,4,22,136,1,84,28,
+  0,6,80,28,4,82,184,2,97,91,20,41,143,185,3,100,222,12,82,19,157,6,3,86,
+  12,41,0,236,6,62,249,28,68,9,141,105,233,203,42,12,8,233,203,1,12,22,0,186,
+  1,9,23,4,82,200,2,99,91,34,21,92,91,1,4,68,171,3,221,217,20,15,145,143,
+  2,244,156,4,50,242,3,94,48,4,22,23,92,37,4,50,32,253,47,0,2,210,47,111,
+  99,0,0,0,102,0,0,44,50,0,0,47,48,171,1,0,24,50,48,8,5,5,219,47,
+  8,0,16,251,47,16,172,6,254,47,16,157,2,0,48,0,18,64,48,0,6,241,47,4,
+  41,195,1,53,224,4,15,249,2,101,157,12,41,3,168,3,143,232,12,50,0,212,1,234,
+  55,0,9,219,47,0,24,77,50,20,82,117,106,127,72,4,15,201,4,78,166,4,22,188,
+  3,235,26,4,50,120,26,57,4,84,161,2,241,201,12,41,3,96,33,235,8,11,44,130,
+  232,8,0,2,127,232,28,84,1,150,71,95,198,12,41,0,142,1,249,248,0,39,138,232,
+  4,50,250,1,31,57,0,4,44,57,4,82,70,250,69,20,41,147,235,1,16,239,4,82,
+  254,1,11,70,16,148,34,50,70,4,41,155,1,125,4,82,100,0,0,0,102,0,0,44,
+  44,0,0,22,49,171,1,4,50,54,101,58,20,41,156,117,10,3,4,46,120,20,38,4,
+  41,119,41,241,0,60,115,8,16,139,67,15,223,12,84,1,129,1,83,183,28,15,9,122,
+  59,18,173,12,41,0,184,1,43,241,8,19,14,41,241,12,82,0,136,3,153,81,12,46,
+  2,203,1,71,16,8,0,4,66,16,0,10,74,16,0,1,63,16,8,4,2,66,16,12,
+  41,0,53,115,246,0,50,44,3,0,2,249,2,8,4,37,110,239,12,82,0,254,2,223,
+  88,12,41,5,205,2,241,238,12,46,0,64,80,11,4,68,117,128,207,4,41,100,145,239,
+  20,46,188,82,189,32,12,41,4,59,22,225,12,15,0,167,2,63,165,4,68,138,2,33,
+  216,4,41,80,113,239,0,63,86,235,202,100,0,0,0,102,0,0,44,1,0,0,193,220,
+  171,1,4,82,158,4,42,96,20,46,156,237,1,3,42,0,69,250,10,4,82,136,2,192,
+  81,4,46,193,1,167,33,4,41,47,35,3,0,2,240,2,28,84,9,143,247,1,53,176,
+  12,41,0,164,2,229,5,12,46,4,210,1,63,44,12,41,0,153,1,11,235,20,46,116,
+  118,148,30,4,1,171,1,201,212,12,46,19,172,1,148,30,8,0,5,1,12,20,41,146,
+  43,51,232,4,33,188,8,89,113,12,82,3,209,4,199,93,28,84,1,97,209,4,191,180,
+  28,46,0,163,172,2,112,14,8,2,16,127,14,8,0,8,123,13,0,0,96,14,20,20,
+  152,201,5,6,147,20,46,146,158,6,222,30,4,41,45,112,252,4,46,116,23,45,0,85,
+  160,14,4,41,51,86,226,0,28,63,226,4,44,214,1,156,53,105,102,0,0,0,102,0,
+  0,44,46,0,0,214,23,171,1,4,41,79,174,232,28,84,1,108,181,1,16,180,12,46,
+  0,138,3,181,46,0,23,141,33,0,5,37,24,0,30,241,32,0,4,0,33,0,6,13,
+  33,12,84,13,159,1,68,189,12,46,0,188,1,51,24,0,0,65,24,20,41,125,107,244,
+  225,16,156,90,237,3,16,162,2,232,3,4,33,58,138,108,4,46,21,139,13,0,5,173,
+  13,0,30,62,24,4,44,66,93,48,4,46,53,57,24,8,5,70,243,45,12,41,0,147,
+  1,170,224,4,46,122,55,24,4,41,137,2,80,238,4,46,134,2,228,9,8,5,88,224,
+  23,12,82,0,240,1,178,83,12,41,5,135,2,170,255,8,0,187,1,132,241,12,46,4,
+  246,1,24,21,8,0,8,57,21,87,103,0,0,0,102,0,0,44,44,0,0,8,51,171,
+  1,4,41,181,1,214,228,12,82,5,216,5,204,103,42,0,2,204,103,1,4,46,217,4,
+  232,16,20,82,152,150,3,142,97,4,41,157,3,22,5,20,82,172,178,3,147,97,4,74,
+  151,3,89,7,4,82,248,4,197,103,4,46,191,3,75,45,20,44,189,38,141,51,4,74,
+  103,165,6,0,11,122,0,20,46,168,104,105,45,4,74,117,196,243,4,46,148,1,122,45,
+  4,44,22,116,51,28,84,1,124,197,2,111,184,12,1,4,126,68,213,12,74,0,90,189,
+  250,4,41,117,73,232,20,82,127,162,4,151,96,4,33,189,2,119,106,4,74,43,36,242,
+  0,11,60,241,0,4,84,242,4,46,158,1,58,44,12,84,1,137,2,99,193,28,41,0,
+  142,152,1,225,226,4,46,0,187,15,20,82,131,224,4,203,102,223,103,0,0,0,103,0,
+  0,60,41,0,134,0,189,225,173,1,4,74,128,1,7,7,4,46,102,78,31,20,41,170,
+  125,222,229,4,74,80,30,8,4,46,50,79,31,20,41,147,103,160,235,16,151,10,145,235,
+  4,46,132,1,106,31,12,84,13,169,2,90,178,12,41,0,228,1,82,225,20,1,119,77,
+  164,211,4,82,154,2,177,62,12,84,19,137,6,111,184,12,82,3,148,6,195,62,28,1,
+  0,143,229,1,182,212,12,82,2,240,1,168,62,12,44,0,31,136,47,12,82,2,40,188,
+  62,8,0,18,195,62,0,4,157,62,4,74,137,1,216,246,4,82,164,1,185,62,0,56,
+  255,62,0,34,6,63,4,46,79,211,45,4,44,18,95,49,0,26,190,47,4,74,93,65,
+  249,0,22,161,1,4,46,42,14,18,4,74,71,253,251,213,104,0,0,0,103,0,0,44,
+  74,0,0,226,0,173,1,4,46,40,33,18,0,0,57,18,4,44,76,184,47,4,74,117,
+  167,248,16,152,20,225,0,4,46,52,40,18,4,41,87,20,225,4,46,132,1,155,40,4,
+  82,176,3,176,102,4,41,141,4,183,228,4,74,89,141,244,4,41,116,157,238,20,82,94,
+  232,3,57,98,20,46,158,181,2,148,41,28,84,1,113,195,2,191,175,28,82,0,109,152,
+  5,25,99,20,74,160,231,2,76,246,12,15,1,241,1,221,166,12,1,0,194,1,150,217,
+  16,141,11,108,209,4,74,112,16,3,12,46,5,52,165,27,8,0,6,184,23,4,74,18,
+  254,0,4,82,138,2,88,84,4,74,233,1,63,2,4,41,35,124,229,20,1,175,64,50,
+  217,6,74,50,42,254,34,3,43,254,1,12,46,5,42,104,23,191,105,0,0,0,105,0,
+  0,44,46,0,0,47,13,175,1,12,74,19,165,8,60,241,4,1,218,7,50,217,12,41,
+  0,44,126,229,4,46,100,95,23,4,41,99,114,219,4,74,76,19,6,4,1,67,193,215,
+  4,33,242,7,46,114,12,41,5,201,8,64,238,28,15,0,137,185,2,223,150,4,46,178,
+  4,240,23,4,33,9,229,107,4,74,36,8,2,12,82,3,208,3,144,102,12,74,0,161,
+  4,243,246,20,82,157,182,4,164,102,0,24,147,102,4,46,219,2,9,46,16,166,28,18,
+  41,0,65,214,14,0,16,188,14,0,70,248,44,4,41,135,1,121,228,20,82,159,188,2,
+  26,79,4,44,107,86,50,4,46,67,130,20,4,41,117,38,230,20,82,126,134,4,192,97,
+  20,41,136,191,3,181,217,20,82,134,196,2,48,79,20,46,189,185,1,141,18,148,106,0,
+  0,0,105,0,0,60,41,0,160,0,137,223,175,1,4,1,55,211,212,4,74,86,232,251,
+  4,1,65,107,217,20,41,154,34,71,228,4,74,64,196,251,20,1,140,93,83,207,6,46,
+  180,1,220,31,34,4,220,31,1,4,1,141,1,181,215,4,74,82,199,251,20,41,131,23,
+  19,228,4,74,50,183,251,0,8,198,251,4,46,50,110,22,20,1,141,121,32,211,20,41,
+  156,42,10,228,12,82,4,210,2,130,85,12,46,0,181,1,37,35,4,44,30,132,46,20,
+  1,150,173,1,248,210,4,74,82,190,251,4,82,140,2,124,85,12,1,19,221,2,248,210,
+  12,44,0,170,2,247,57,28,84,1,122,171,2,21,178,12,44,0,184,2,90,44,4,46,
+  26,95,19,4,1,171,1,243,210,20,41,125,56,204,218,4,74,84,203,246,4,82,190,1,
+  55,67,96,107,0,0,0,107,0,0,44,41,0,0,114,226,177,1,4,1,42,140,215,28,
+  15,1,67,177,1,124,170,12,74,0,250,1,6,245,4,44,138,1,58,44,4,74,51,37,
+  4,4,44,92,249,46,4,46,29,113,20,4,1,133,1,85,207,12,46,19,134,1,113,20,
+  4,74,129,2,203,246,8,4,146,2,24,0,12,41,0,33,170,228,20,1,155,9,109,213,
+  4,44,162,1,80,45,4,41,173,1,17,233,0,35,18,233,12,46,3,208,1,54,26,8,
+  0,9,48,14,0,36,238,25,28,84,9,117,141,1,126,198,12,41,0,16,252,238,4,46,
+  224,3,154,17,4,82,143,1,90,65,20,15,135,207,3,45,160,34,205,1,20,160,1,34,
+  224,4,181,160,1,4,1,99,170,214,4,41,14,255,238,0,74,64,239,0,57,90,232,0,
+  11,81,232,119,108,0,0,0,109,0,0,44,74,0,0,241,243,181,1,4,41,3,27,238,
+  4,33,242,3,142,105,4,41,233,3,81,238,0,92,81,226,20,33,131,138,4,100,104,28,
+  82,2,91,159,2,209,71,12,20,0,141,7,160,141,4,44,242,6,250,54,0,4,237,54,
+  0,8,62,55,4,46,65,4,18,0,16,58,24,4,33,168,3,188,105,4,74,197,3,115,
+  4,4,1,89,0,211,4,44,196,1,33,55,0,2,249,54,0,4,62,55,0,6,250,54,
+  4,46,41,86,32,4,44,54,249,54,4,82,98,153,80,4,74,151,1,205,4,0,22,223,
+  4,12,44,4,76,23,42,12,82,0,162,1,170,85,20,74,149,193,1,238,4,12,82,3,
+  182,1,75,66,12,41,0,57,163,226,4,83,148,65,181,126,4,1,241,65,158,216,110,109,
+  0,0,0,109,0,0,44,33,19,0,142,105,181,1,12,1,0,75,240,214,12,41,4,54,
+  239,228,12,46,0,116,10,30,4,41,37,139,233,4,82,164,1,121,58,8,11,18,241,58,
+  0,4,229,58,8,0,122,199,82,4,33,208,1,126,105,4,82,193,2,234,58,20,46,147,
+  57,216,30,0,159,1,231,9,16,159,174,1,28,31,4,82,174,1,171,81,34,7,169,81,
+  1,20,46,136,139,1,13,31,8,19,0,13,31,12,82,0,90,17,66,8,19,0,17,66,
+  28,46,0,134,59,35,31,12,33,19,67,188,105,28,20,9,141,245,5,1,141,12,46,0,
+  222,6,90,39,4,33,139,3,173,110,20,82,128,240,3,200,64,12,15,10,227,1,160,173,
+  12,41,0,110,109,230,28,84,8,107,91,255,189,12,82,0,138,2,47,61,4,41,87,8,
+  218,4,46,56,144,39,95,110,0,0,0,110,0,0,44,82,0,0,29,61,183,1,0,86,
+  247,80,0,69,34,61,4,41,119,73,219,4,46,86,70,36,12,33,3,156,5,137,113,28,
+  15,9,132,153,7,223,166,12,33,0,180,7,134,113,4,46,249,4,243,27,4,82,168,1,
+  31,81,4,33,248,3,130,113,4,46,251,4,6,34,0,168,1,150,15,12,33,19,155,1,
+  126,105,12,44,0,72,222,54,4,82,102,26,81,4,46,127,173,30,0,22,72,28,20,1,
+  133,89,68,207,0,10,168,206,4,82,188,2,179,82,20,46,158,155,1,77,28,16,143,6,
+  64,28,28,84,1,85,195,1,113,182,12,74,4,186,1,24,0,12,46,0,30,224,17,12,
+  82,1,166,2,6,95,12,44,0,233,1,220,39,4,41,221,1,85,224,4,44,148,2,219,
+  39,8,19,0,219,39,12,82,0,166,1,36,87,61,111,0,0,0,110,0,0,44,82,0,
+  0,98,56,183,1,0,92,99,81,4,46,149,1,105,24,4,41,51,2,225,4,1,19,206,
+  209,28,41,9,102,44,125,229,12,74,0,144,1,69,252,20,1,148,79,92,199,4,44,166,
+  1,139,40,34,25,187,40,1,4,74,27,126,5,28,15,11,101,223,1,218,173,12,46,0,
+  192,2,126,32,4,1,125,70,206,16,135,14,49,199,34,124,255,198,1,54,84,158,13,127,
+  198,1,54,1,167,1,28,199,1,34,22,96,199,1,34,96,255,198,1,4,46,24,30,37,
+  4,33,210,3,232,104,4,46,155,4,17,18,20,44,141,80,241,41,28,15,1,135,255,1,
+  182,169,28,84,0,138,120,144,193,34,181,1,200,193,1,34,160,2,218,192,1,34,8,163,
+  193,1,20,1,150,27,74,205,16,142,10,93,205,50,161,51,148,205,1,19,112,0,0,0,
+  120,0,0,46,1,0,0,108,205,205,1,34,90,233,205,1,34,48,164,205,1,34,44,58,
+  206,1,20,82,194,14,128,92,20,1,169,187,2,97,205,20,84,135,5,125,192,16,163,6,
+  50,193,0,12,64,193,4,82,154,2,195,79,20,44,160,109,244,40,4,82,198,1,22,92,
+  20,1,158,189,2,196,205,16,143,18,195,205,16,160,3,232,205,4,46,140,1,94,35,20,
+  1,142,95,182,205,12,44,3,124,125,40,28,1,0,154,119,91,205,4,46,164,1,90,39,
+  4,1,129,1,193,203,0,26,49,199,20,44,142,162,1,140,40,4,1,121,45,199,4,46,
+  158,2,237,15,12,41,6,179,1,7,238,42,0,2,8,238,1,34,3,7,238,1,34,4,
+  7,238,1,20,1,165,81,111,206,34,10,241,205,1,34,9,239,205,1,136,112,0,0,0,
+  129,0,0,46,1,0,0,99,206,223,1,34,120,18,207,1,4,41,175,1,72,224,4,84,
+  107,57,190,20,82,162,214,3,94,83,20,41,146,249,1,244,216,34,71,220,216,1,34,164,
+  1,172,216,1,12,82,19,158,1,94,83,12,46,0,141,1,202,30,20,82,165,150,1,71,
+  83,20,1,166,209,1,196,205,4,41,106,110,231,12,44,2,74,3,53,12,74,0,47,54,
+  247,28,15,1,72,22,50,173,12,44,0,40,21,53,12,41,19,191,2,7,238,8,0,0,
+  234,237,0,40,250,237,4,82,238,2,72,71,4,46,73,18,18,0,22,39,20,0,28,31,
+  31,4,1,103,251,209,12,46,5,108,203,25,12,44,0,58,69,53,20,41,153,129,1,95,
+  217,4,46,88,254,17,20,41,170,79,217,216,16,149,8,250,216,16,143,20,221,216,143,113,
+  0,0,0,133,0,0,60,82,0,146,0,23,76,229,1,20,41,134,185,1,218,216,16,165,
+  28,204,216,0,36,254,219,8,5,17,161,216,58,0,156,1,161,216,1,34,2,161,216,1,
+  0,8,84,217,16,155,28,194,216,8,4,8,221,216,28,84,0,145,41,204,196,50,145,155,
+  1,163,196,1,34,184,1,7,197,1,20,82,136,146,1,73,59,0,40,105,67,4,41,69,
+  111,239,8,19,0,111,239,12,44,0,74,3,36,28,15,12,92,215,1,162,172,28,74,0,
+  155,188,1,183,255,0,18,68,7,4,44,40,67,34,12,46,2,5,58,13,12,33,0,176,
+  3,61,109,28,84,1,99,151,4,4,179,12,41,0,126,32,222,4,46,30,15,13,4,1,
+  59,192,204,4,44,154,1,17,53,4,41,177,1,250,221,16,147,66,127,216,4,74,138,1,
+  24,7,40,114,0,0,0,137,0,0,44,46,0,0,141,19,237,1,12,74,2,4,122,255,
+  24,0,157,12,119,255,0,20,44,7,12,46,19,185,1,15,13,12,33,0,134,4,82,104,
+  20,44,124,241,1,114,35,12,46,3,2,12,17,8,0,10,39,21,20,1,138,79,77,204,
+  34,219,1,56,204,1,34,150,1,121,203,1,34,99,100,204,1,4,82,186,4,151,103,4,
+  46,173,2,158,9,4,44,50,178,43,20,46,122,39,165,16,0,26,209,31,20,82,153,104,
+  150,79,20,1,157,211,1,73,204,20,41,160,147,1,190,222,4,46,252,1,157,9,0,14,
+  8,20,20,1,140,71,56,204,20,82,131,150,2,235,89,4,74,213,1,3,240,0,20,15,
+  240,20,46,195,34,98,9,0,28,102,31,4,82,176,2,0,103,4,74,207,1,148,2,4,
+  84,239,7,221,193,243,114,0,0,0,140,0,0,60,46,0,140,0,142,19,243,1,16,118,
+  16,207,16,4,41,1,25,220,4,46,30,145,24,0,110,246,17,12,15,11,157,2,220,170,
+  12,46,0,174,2,211,17,4,82,39,107,61,4,74,91,221,241,0,40,154,8,20,46,129,
+  24,228,19,50,161,29,2,20,1,4,1,59,23,199,20,46,123,100,229,17,4,44,34,173,
+  40,0,20,94,49,8,3,0,59,52,12,41,0,99,63,221,12,46,19,88,246,17,12,74,
+  0,7,2,7,0,0,28,7,0,8,16,7,12,46,19,158,2,47,12,0,141,2,211,17,
+  28,41,0,159,33,39,211,4,46,78,57,20,20,82,186,192,1,142,93,20,41,164,241,1,
+  55,220,4,82,206,1,122,93,20,44,146,73,232,46,16,150,6,235,46,12,33,19,221,3,
+  61,109,212,115,0,0,0,141,0,0,44,82,0,0,199,78,245,1,4,46,187,1,17,23,
+  4,44,118,125,40,12,74,4,39,68,8,12,27,0,10,188,237,4,33,188,2,205,104,4,
+  41,199,2,199,238,12,46,5,51,25,23,4,82,182,1,145,72,8,0,52,75,87,0,9,
+  28,83,4,27,167,1,195,231,4,82,140,1,138,72,12,27,19,131,1,188,237,28,46,0,
+  130,42,19,19,4,44,40,154,46,0,5,201,39,4,82,40,43,62,0,8,62,62,4,46,
+  69,13,12,4,44,34,251,39,4,46,9,213,19,34,4,242,19,1,4,41,105,122,231,4,
+  27,72,76,238,0,30,93,238,4,46,3,78,8,4,44,48,202,46,4,46,31,47,12,0,
+  24,72,26,0,21,205,11,0,4,50,13,210,115,0,0,0,142,0,0,44,46,19,0,50,
+  13,247,1,12,44,0,64,221,46,4,27,85,208,231,20,44,142,116,20,52,4,46,41,111,
+  14,0,7,101,5,4,82,130,2,42,87,4,46,213,1,131,11,16,145,12,158,32,0,13,
+  0,15,0,0,44,12,4,82,126,60,81,4,46,117,70,10,4,82,56,58,48,4,46,11,
+  254,24,0,1,133,14,20,82,150,146,1,13,81,12,84,1,225,1,206,191,14,46,0,118,
+  218,23,34,8,223,23,1,4,82,106,59,77,4,1,159,1,44,209,4,41,183,3,89,226,
+  4,44,188,4,189,38,4,27,9,200,239,4,41,51,2,225,4,46,76,171,24,0,2,149,
+  24,4,27,41,53,233,4,46,68,16,25,4,82,110,59,81,4,27,115,195,231,105,116,0,
+  0,0,144,0,0,44,46,19,0,16,25,249,1,8,0,10,47,25,0,40,242,10,4,41,
+  11,211,218,0,49,10,226,4,33,186,3,239,106,4,46,169,2,223,13,0,44,225,13,4,
+  82,70,60,58,4,27,49,169,235,4,82,162,1,163,84,0,38,130,87,12,27,4,161,1,
+  18,228,12,46,0,64,91,24,0,6,80,24,0,24,116,34,0,25,49,13,0,8,28,13,
+  4,82,114,152,65,4,27,49,185,234,12,46,19,71,49,13,12,27,0,120,70,245,4,84,
+  79,192,189,4,41,40,128,215,12,27,4,145,1,20,228,12,46,0,240,1,27,21,20,44,
+  130,32,53,41,4,46,36,3,25,4,82,56,7,82,20,46,128,99,197,19,0,35,80,13,
+  0,62,76,17,129,117,0,0,0,144,0,0,44,46,5,0,241,14,249,1,12,44,0,46,
+  108,39,12,46,3,25,94,5,8,0,8,41,5,28,15,1,107,155,1,49,170,12,27,0,
+  194,5,79,228,12,46,4,253,3,105,20,12,82,0,134,1,245,79,4,33,119,243,106,4,
+  46,84,150,25,12,27,19,223,2,185,234,12,15,14,216,1,227,170,28,44,0,154,172,1,
+  200,39,4,27,15,213,232,4,46,20,193,15,0,18,203,25,12,27,19,37,213,232,12,46,
+  0,126,222,6,4,44,59,21,41,4,27,29,43,223,20,44,154,60,224,39,4,27,25,241,
+  222,0,20,74,229,4,44,58,37,40,20,82,149,196,1,53,103,0,105,99,80,12,74,19,
+  229,43,203,246,28,15,1,102,214,42,185,168,12,27,0,156,2,94,230,20,46,115,121,243,
+  255,0,78,145,28,4,33,195,2,212,106,127,118,0,0,0,144,0,0,44,46,0,0,49,
+  16,249,1,12,27,19,70,79,228,12,46,0,33,52,10,4,82,34,146,40,12,27,19,0,
+  79,228,8,0,0,48,228,4,82,124,100,81,12,46,19,157,1,52,10,28,15,1,55,103,
+  107,172,12,17,0,122,34,203,20,46,165,164,1,216,37,50,174,2,211,37,1,0,35,223,
+  6,4,82,26,127,40,12,27,5,35,105,241,12,33,3,156,2,121,107,12,82,0,219,1,
+  199,40,0,10,58,51,4,27,65,20,241,4,82,126,139,52,0,92,63,87,4,27,52,253,
+  229,6,82,117,146,52,34,2,147,52,1,4,27,41,248,236,4,46,14,63,15,12,82,19,
+  59,58,51,8,0,154,1,237,75,8,5,27,234,40,12,46,0,81,242,30,4,82,88,207,
+  40,0,3,203,40,65,119,0,0,0,147,0,0,44,82,0,0,195,40,253,1,4,46,87,
+  5,31,20,82,126,152,1,46,79,20,17,129,139,1,157,202,50,147,39,226,202,1,4,82,
+  128,1,152,40,4,46,15,23,17,8,19,0,23,17,12,82,0,42,208,40,0,160,1,166,
+  103,12,46,5,141,1,88,38,42,0,1,88,38,1,34,2,89,38,1,20,17,147,73,154,
+  202,4,27,255,1,135,227,8,19,0,135,227,12,46,0,192,2,77,8,20,17,151,45,190,
+  202,4,82,122,107,50,4,46,7,61,39,12,27,19,49,253,229,28,15,1,91,107,81,170,
+  28,17,0,154,90,142,203,4,46,82,74,39,8,19,221,41,86,32,12,15,11,160,41,187,
+  168,12,82,0,202,1,167,68,12,27,4,79,78,233,12,15,10,79,231,168,12,46,0,116,
+  52,5,12,15,11,111,209,168,8,10,16,220,168,219,119,0,0,0,150,0,0,44,82,0,
+  0,184,68,131,2,12,15,10,169,1,236,168,12,41,0,88,243,217,12,15,10,71,191,168,
+  28,82,9,124,210,1,63,78,12,46,5,67,255,28,12,82,0,106,83,86,28,15,1,107,
+  203,1,140,169,12,27,0,98,247,235,4,46,36,140,24,0,16,59,18,4,82,146,1,57,
+  79,0,73,122,67,20,46,140,27,8,21,4,27,37,65,222,4,46,46,141,24,0,22,194,
+  25,4,82,38,38,59,4,46,27,70,7,0,24,197,24,12,15,12,63,224,168,12,46,0,
+  218,1,123,6,0,65,160,25,4,41,47,228,207,20,46,153,60,172,25,0,6,208,25,0,
+  78,222,37,4,82,54,155,83,12,46,19,83,123,6,8,0,68,220,37,4,82,32,125,82,
+  0,21,16,65,146,120,0,0,0,150,0,0,46,82,0,0,5,65,133,2,4,46,7,70,
+  33,8,2,2,0,21,12,41,0,25,213,218,4,46,62,97,33,4,82,74,36,82,4,20,
+  169,2,155,147,20,41,121,200,1,85,209,4,82,176,1,161,95,20,46,118,115,159,18,0,
+  7,178,10,4,82,152,1,45,82,4,46,41,27,26,16,114,18,122,18,16,120,2,84,19,
+  0,24,89,38,0,23,55,4,4,82,70,158,75,12,46,19,89,27,26,8,0,34,25,5,
+  4,27,8,46,243,0,0,46,243,0,7,97,241,0,22,106,241,0,45,121,244,4,46,130,
+  1,64,26,16,129,43,154,4,16,157,4,139,4,20,82,165,104,4,84,4,46,79,73,4,
+  0,12,255,3,8,19,115,55,4,50,121,0,0,0,151,0,0,60,46,0,136,0,175,28,
+  133,2,0,7,29,4,20,82,151,80,182,56,4,46,23,189,28,0,30,114,29,8,5,11,
+  142,34,12,82,0,18,181,53,4,46,13,136,34,4,82,154,1,184,98,20,46,144,115,152,
+  23,20,82,152,66,147,76,0,26,67,75,0,4,216,54,4,46,17,87,25,20,27,170,19,
+  176,243,0,8,84,236,4,46,12,110,254,4,27,22,131,238,4,46,36,187,4,34,2,149,
+  4,1,20,82,141,28,33,55,4,46,27,33,16,4,27,11,75,236,34,6,75,236,1,4,
+  82,104,59,90,0,5,23,82,4,46,55,14,34,4,82,96,3,86,4,27,75,18,242,4,
+  41,16,250,217,4,82,112,34,81,0,27,253,61,228,121,0,0,0,153,0,0,44,27,0,
+  0,40,240,137,2,4,82,60,206,66,4,46,1,162,39,0,149,3,208,247,28,17,1,101,
+  218,2,126,194,12,46,0,80,252,23,4,33,108,180,94,4,82,13,228,80,34,152,1,65,
+  81,1,4,46,181,1,56,24,0,98,39,6,0,49,127,24,20,82,151,26,248,41,4,27,
+  23,247,242,4,46,40,127,36,12,82,5,32,73,83,42,0,1,73,83,1,34,4,73,83,
+  1,4,46,35,16,24,0,22,97,13,4,27,19,60,237,4,82,66,93,50,0,34,152,50,
+  4,27,49,244,239,4,46,10,147,29,12,82,19,40,152,50,28,17,9,138,121,187,170,12,
+  82,0,154,1,130,50,4,46,13,68,34,4,27,68,101,243,0,97,253,243,0,84,148,239,
+  176,122,0,0,0,156,0,0,60,46,0,136,0,49,13,143,2,34,34,90,13,1,34,69,
+  24,13,1,20,17,136,2,63,204,4,27,40,149,239,12,46,4,42,107,251,0,0,95,251,
+  8,0,42,97,32,4,27,151,1,62,240,4,82,156,1,161,40,4,46,50,10,40,0,18,
+  85,40,4,27,31,195,235,4,46,12,246,4,4,41,13,230,212,20,82,131,96,121,75,4,
+  46,31,42,1,0,12,37,1,4,27,162,1,137,242,0,22,60,242,0,169,1,210,241,0,
+  178,1,67,242,4,82,71,4,88,0,29,226,66,4,27,30,67,236,4,46,37,197,34,4,
+  82,52,142,75,4,27,42,98,242,4,46,7,203,17,4,27,2,255,241,4,82,72,2,78,
+  4,27,29,249,235,186,123,0,0,0,158,0,0,44,33,0,0,80,100,147,2,0,23,118,
+  104,4,82,7,38,78,16,145,18,139,77,4,46,15,174,35,4,82,52,76,85,16,167,9,
+  103,64,4,17,49,5,202,4,46,38,229,30,0,0,186,32,0,162,1,81,31,0,1,77,
+  31,4,33,217,3,200,105,4,46,226,3,83,31,4,17,173,1,246,201,4,46,178,1,64,
+  31,0,4,51,31,4,33,231,3,34,106,4,46,232,3,67,31,0,2,68,31,4,82,123,
+  200,51,0,22,55,77,0,22,20,83,4,46,49,183,30,4,82,38,248,77,34,6,115,78,
+  1,12,46,19,215,42,31,31,8,0,194,42,179,32,4,82,60,213,87,4,27,79,255,241,
+  12,46,5,36,113,25,8,0,14,69,34,199,123,0,0,0,159,0,0,60,17,1,78,0,
+  99,168,149,2,12,46,0,92,1,24,0,1,95,25,4,82,46,29,68,34,10,25,68,1,
+  0,12,201,84,4,27,102,181,242,4,46,117,69,32,0,38,58,17,4,27,26,60,243,0,
+  5,223,240,4,85,13,59,251,4,27,197,1,32,238,4,17,204,1,224,183,4,27,44,243,
+  240,4,82,48,7,80,4,46,27,126,37,4,82,26,39,66,20,17,159,27,84,202,4,46,
+  42,107,37,0,4,104,37,20,82,162,16,97,45,4,46,7,23,29,20,82,150,10,105,45,
+  4,27,143,1,86,242,4,46,148,1,49,25,4,27,7,174,242,12,85,3,5,65,7,12,
+  82,2,36,86,45,8,0,78,238,79,0,69,92,83,34,69,222,82,1,137,124,0,0,0,
+  161,0,0,44,82,0,0,193,85,153,2,24,2,174,25,96,45,12,46,0,0,32,35,0,
+  5,204,21,0,6,210,21,0,6,54,25,0,2,68,25,0,1,81,25,12,82,19,54,238,
+  79,12,46,0,17,238,28,0,8,79,25,8,2,104,87,25,8,5,107,233,31,42,0,0,
+  230,31,1,34,2,236,31,1,4,82,46,43,85,4,46,25,80,16,4,82,28,211,67,4,
+  46,13,77,35,4,82,16,250,51,4,46,14,71,35,0,18,69,35,16,150,14,151,28,4,
+  85,6,168,14,0,8,63,247,0,12,185,14,0,0,197,14,20,46,154,6,228,28,4,85,
+  2,158,14,4,27,6,71,236,4,82,46,16,75,4,85,31,153,14,230,124,0,0,0,163,
+  0,0,44,46,0,0,172,37,157,2,0,4,205,26,0,34,115,23,4,82,44,247,74,12,
+  46,19,81,172,37,12,27,0,68,175,237,4,46,20,82,32,4,85,3,116,14,4,46,14,
+  38,27,4,82,42,128,85,34,172,2,194,85,1,12,27,5,225,2,29,232,12,46,0,40,
+  75,28,4,82,26,106,82,4,46,27,86,15,16,163,6,142,28,0,4,103,28,16,143,0,
+  95,28,4,85,9,70,11,20,46,164,8,124,28,0,8,112,28,4,82,36,38,79,34,21,
+  69,78,1,0,1,170,47,12,85,19,185,1,158,14,8,0,182,2,153,4,4,82,0,123,
+  79,4,46,113,107,28,12,85,19,175,1,153,14,12,46,0,188,1,140,23,4,27,36,222,
+  242,4,82,39,112,47,50,125,0,0,0,165,0,0,44,82,19,0,170,47,161,2,12,46,
+  0,56,199,27,4,27,32,193,242,4,46,29,171,27,0,3,39,28,16,152,22,104,28,16,
+  165,2,226,27,4,85,2,12,12,4,46,14,148,27,12,27,19,35,222,242,0,30,193,242,
+  12,46,0,28,151,27,0,0,167,27,0,24,101,15,4,82,16,101,71,0,22,22,47,4,
+  46,31,148,19,0,5,31,28,12,85,3,11,50,12,12,46,0,18,29,28,4,85,33,7,
+  13,4,82,62,140,67,0,14,57,47,4,33,48,173,98,4,82,39,41,47,0,18,21,47,
+  4,17,41,206,175,4,46,62,103,29,16,154,53,0,29,20,41,144,52,74,216,4,46,30,
+  54,28,4,27,1,8,232,202,125,0,0,0,165,0,0,44,82,0,0,152,79,161,2,0,
+  22,171,79,4,33,138,1,172,105,4,82,115,45,43,4,27,1,105,240,20,82,132,56,71,
+  69,0,18,128,84,0,20,134,84,16,161,9,57,69,0,4,205,49,0,24,195,79,4,46,
+  74,169,37,0,81,110,38,4,13,191,4,10,110,4,46,206,4,38,37,4,17,23,165,202,
+  20,41,135,14,93,214,4,27,11,42,242,4,82,54,223,68,4,85,15,116,254,34,9,117,
+  254,1,4,46,44,85,17,12,17,1,24,102,187,12,46,0,13,87,30,0,55,120,35,8,
+  19,64,169,37,12,82,0,52,185,78,4,85,7,87,9,0,103,184,248,4,82,132,1,109,
+  78,0,9,180,73,28,17,9,106,39,173,174,88,126,0,0,0,166,0,0,44,46,0,0,
+  119,28,163,2,0,53,113,35,20,82,151,94,85,78,0,10,85,71,20,41,123,17,8,215,
+  12,82,19,18,85,71,12,46,0,10,33,31,2,10,84,31,34,2,83,31,1,8,4,6,
+  5,40,12,82,0,24,60,69,4,46,7,223,29,4,82,4,16,54,0,47,244,73,0,114,
+  235,68,4,46,41,232,23,0,16,247,23,4,82,18,22,46,4,41,3,188,217,4,46,32,
+  87,29,20,82,129,10,191,62,12,33,19,189,2,172,105,12,46,0,186,2,218,29,20,82,
+  141,14,154,52,4,27,129,1,193,239,4,46,132,1,32,29,0,12,69,37,4,82,14,75,
+  86,4,46,10,229,29,0,0,131,29,8,2,24,204,29,12,82,0,8,16,68,225,126,0,
+  0,0,168,0,0,44,82,0,0,26,68,165,2,4,46,0,65,33,4,85,1,81,250,4,
+  82,14,107,74,4,46,11,179,29,20,27,144,24,14,223,0,4,192,226,0,2,43,228,20,
+  82,157,48,2,83,4,27,6,248,244,28,17,1,108,241,2,212,176,12,33,0,146,3,154,
+  98,20,27,147,27,32,236,4,82,28,48,83,4,46,5,50,40,12,27,4,20,135,240,12,
+  82,0,146,1,138,45,4,27,141,1,216,244,4,46,28,5,17,4,27,29,21,229,0,30,
+  217,238,20,82,156,12,169,42,0,14,173,78,4,46,13,16,17,4,29,6,229,238,4,82,
+  20,21,86,4,85,6,153,9,4,82,14,199,78,0,6,19,86,4,85,13,33,252,12,82,
+  19,8,199,78,12,29,0,2,180,227,95,127,0,0,0,168,0,0,60,82,0,142,0,102,
+  78,165,2,4,46,5,242,33,12,82,19,71,169,42,8,0,100,189,68,8,19,2,138,45,
+  12,46,0,56,213,35,0,6,166,39,0,4,227,35,4,82,12,223,78,8,5,5,253,45,
+  24,0,124,8,232,75,4,24,2,230,35,20,82,154,1,232,45,0,12,238,45,4,24,2,
+  85,20,0,4,240,35,20,82,146,12,221,78,4,24,0,167,35,0,2,195,35,4,82,14,
+  82,67,4,24,11,255,32,0,0,227,32,0,10,166,39,34,21,162,39,1,0,30,186,35,
+  4,85,7,252,252,12,24,19,8,186,35,8,0,10,24,40,8,2,3,211,35,12,82,0,
+  36,55,67,4,24,19,177,35,4,85,4,65,14,189,127,0,0,0,169,0,0,44,82,0,
+  0,128,62,167,2,4,24,6,2,23,8,5,12,157,35,8,0,21,39,39,0,26,11,39,
+  0,7,1,36,0,226,1,15,20,4,82,201,1,64,43,4,24,8,172,35,0,1,223,35,
+  0,8,138,35,4,29,51,232,229,4,82,58,192,53,0,24,122,72,20,29,136,6,154,228,
+  34,0,130,228,1,12,24,19,81,2,23,12,85,0,132,1,163,11,0,32,111,254,4,82,
+  12,111,45,4,24,2,140,28,4,29,2,160,230,4,33,84,151,98,4,29,91,82,233,20,
+  82,137,88,7,88,4,24,5,15,19,4,29,46,43,229,0,0,36,229,4,24,18,89,25,
+  4,82,10,95,88,4,24,54,173,28,4,85,37,40,6,113,128,0,0,0,170,0,0,44,
+  85,0,0,179,255,169,2,0,20,208,2,34,0,199,2,1,8,19,0,208,2,12,82,0,
+  12,43,69,4,24,0,159,25,0,8,171,26,4,29,1,183,232,20,82,154,24,85,63,28,
+  28,1,113,97,22,166,12,24,0,100,15,28,12,82,6,2,86,82,12,24,0,74,198,28,
+  0,5,227,28,0,14,199,28,4,85,25,12,5,4,24,34,7,29,0,15,236,28,8,19,
+  0,198,28,28,82,0,137,4,93,45,4,85,4,160,2,4,24,8,59,26,8,19,7,199,
+  28,8,0,4,240,28,4,85,4,112,15,4,82,15,202,74,4,24,8,231,28,8,19,8,
+  7,29,28,55,9,155,6,70,160,12,24,0,1,190,28,20,85,157,20,178,2,20,24,169,
+  4,229,28,211,128,0,0,0,171,0,0,44,85,0,0,243,2,171,2,4,24,7,188,28,
+  4,85,8,139,2,0,14,18,15,0,4,157,252,4,24,2,99,38,4,82,25,164,91,4,
+  85,56,45,15,0,4,24,15,4,24,2,44,30,20,82,153,12,156,71,4,24,10,203,28,
+  4,41,8,72,218,4,82,1,224,71,4,24,6,60,29,0,13,226,28,0,18,60,29,0,
+  16,31,29,0,2,48,29,4,29,2,87,235,4,24,2,66,29,4,82,10,134,67,4,11,
+  2,109,52,12,24,5,2,78,29,8,19,0,78,29,12,82,0,6,132,70,4,24,4,89,
+  36,4,82,20,247,74,28,28,1,99,24,228,168,28,24,0,161,0,18,40,20,41,150,2,
+  173,213,16,138,6,170,213,218,128,0,0,0,171,0,0,44,85,19,0,18,15,171,2,12,
+  33,0,178,1,133,95,34,83,165,95,1,34,124,159,95,1,4,11,29,38,61,4,24,18,
+  91,26,20,11,132,0,63,61,4,17,10,209,198,4,24,1,237,46,4,29,6,211,235,12,
+  24,2,3,125,20,28,85,0,145,42,212,3,4,11,14,85,61,0,10,80,61,4,85,24,
+  195,14,4,33,34,232,98,0,51,155,92,12,24,19,73,237,46,12,85,0,96,24,4,8,
+  19,3,195,14,28,33,0,122,3,176,92,4,24,46,245,22,4,13,15,59,109,4,33,10,
+  205,97,4,85,30,38,243,8,19,0,38,243,28,24,0,158,7,173,41,16,165,22,153,41,
+  4,33,17,135,106,20,24,156,30,127,41,20,11,165,1,149,62,4,24,14,144,42,167,129,
+  0,0,0,173,0,0,60,11,0,168,0,180,62,175,2,16,138,18,33,62,4,85,191,3,
+  144,2,8,19,6,139,2,12,82,0,212,3,178,83,0,23,134,75,20,11,146,8,126,60,
+  4,82,34,18,66,4,11,4,185,56,4,24,26,151,37,24,8,132,17,95,26,12,11,0,
+  2,6,51,4,82,38,235,82,20,24,141,2,61,43,20,11,140,1,11,56,20,24,158,8,
+  205,22,8,19,47,95,26,4,82,40,235,82,12,24,0,20,20,27,20,11,168,6,35,56,
+  16,138,22,204,71,4,24,8,178,28,4,33,23,68,108,12,11,3,102,51,62,12,82,0,
+  41,29,82,4,24,28,79,34,20,11,157,26,112,51,4,85,5,200,18,16,160,10,215,18,
+  4,24,3,65,25,12,11,19,0,112,51,28,85,0,137,12,200,18,48,130,0,0,0,173,
+  0,0,60,24,0,148,0,128,41,175,2,8,2,7,123,41,0,38,144,41,12,82,0,35,
+  229,79,20,24,158,10,138,41,16,161,10,117,41,16,160,6,124,41,4,85,8,249,242,4,
+  29,6,18,236,4,85,8,116,15,0,10,217,1,0,16,3,10,4,82,21,61,75,12,85,
+  19,22,3,10,12,11,0,20,38,62,12,28,1,24,205,166,12,24,0,15,140,40,0,68,
+  241,20,4,11,55,42,72,4,29,58,26,238,20,24,142,29,24,19,20,11,158,3,26,52,
+  4,85,8,62,10,20,24,126,3,49,21,20,85,148,8,188,18,20,82,158,24,140,77,0,
+  14,201,84,4,24,18,108,40,4,85,12,66,8,4,82,23,169,79,8,5,42,51,85,42,
+  0,1,51,85,1,164,130,0,0,0,174,0,0,46,82,0,0,51,85,179,2,4,85,9,
+  83,17,0,3,135,239,0,186,2,125,254,20,24,145,149,2,54,47,0,14,97,29,4,33,
+  29,182,90,20,85,146,32,134,18,0,22,162,13,4,24,14,197,19,8,2,21,125,40,12,
+  33,0,13,216,93,4,24,30,19,40,34,2,16,40,1,8,19,4,197,19,8,0,3,27,
+  34,20,11,124,2,170,51,4,85,24,27,9,16,125,0,179,18,4,11,5,249,66,0,5,
+  115,68,20,17,138,62,99,194,34,140,1,20,194,1,4,11,163,1,25,68,4,33,17,49,
+  94,4,85,34,237,18,0,96,132,9,0,77,157,10,4,29,6,120,238,4,11,17,225,66,
+  0,12,173,47,8,19,83,170,51,246,130,0,0,0,177,0,0,44,11,0,0,187,47,183,
+  2,28,17,1,119,46,96,177,12,11,0,31,126,67,0,0,119,67,4,85,30,216,10,0,
+  2,61,5,16,161,0,58,10,20,33,126,41,202,98,4,24,44,203,21,4,33,21,46,90,
+  4,24,28,131,23,4,85,14,217,241,0,54,119,9,20,11,133,43,225,64,12,85,19,9,
+  217,241,12,11,0,8,197,53,4,24,12,28,42,4,85,32,56,10,0,0,88,10,20,11,
+  150,13,109,67,4,85,16,246,7,4,33,49,178,100,4,24,62,18,40,4,85,36,232,7,
+  20,24,161,7,102,42,16,124,36,129,20,4,85,10,207,6,4,33,19,184,93,4,85,36,
+  37,8,20,11,109,13,70,67,4,85,38,165,7,0,0,172,8,114,131,0,0,0,177,0,
+  0,60,85,0,154,0,73,8,183,2,20,24,140,12,41,21,4,29,18,157,238,4,85,9,
+  81,8,12,29,19,10,157,238,12,85,0,0,224,7,0,4,52,18,0,4,132,7,0,2,
+  142,8,0,0,197,7,4,82,25,177,80,4,24,24,38,43,4,85,12,153,7,20,24,129,
+  7,30,42,0,4,72,39,4,85,22,240,10,0,5,153,7,20,24,127,4,164,41,4,29,
+  28,104,239,8,4,10,110,239,12,85,0,13,169,7,0,4,237,7,20,24,146,5,175,41,
+  4,82,11,158,82,4,29,40,113,239,4,24,4,188,41,4,85,10,5,8,4,11,15,214,
+  65,34,4,201,65,1,4,85,32,75,5,4,82,21,158,82,4,33,43,49,107,200,131,0,
+  0,0,178,0,0,60,85,0,147,0,137,6,185,2,4,24,3,37,26,4,85,6,95,16,
+  4,24,11,14,40,4,85,28,118,9,0,0,125,9,20,24,138,8,198,20,4,85,10,91,
+  16,0,2,168,7,8,19,70,126,6,28,24,0,141,67,195,20,20,85,122,18,93,6,50,
+  155,50,126,6,1,20,41,145,21,97,208,4,85,13,31,18,0,0,48,18,0,4,221,12,
+  34,2,201,12,1,4,24,15,197,42,4,85,24,41,10,4,24,20,138,41,8,3,2,115,
+  41,24,0,142,6,25,22,4,85,10,200,16,20,24,131,9,132,42,12,85,3,12,53,13,
+  8,0,4,70,13,12,24,4,0,36,44,12,85,0,2,169,11,4,33,89,31,107,4,85,
+  112,0,15,20,24,118,3,128,22,9,132,0,0,0,180,0,0,44,24,2,0,158,22,189,
+  2,24,0,164,30,159,22,4,85,6,120,7,0,2,27,15,0,8,163,8,12,24,2,7,
+  97,22,8,0,20,128,22,4,29,0,36,238,4,85,3,43,16,4,33,61,85,108,0,16,
+  164,93,4,85,54,151,8,0,2,161,10,4,82,33,30,83,4,24,42,161,27,28,28,1,
+  114,52,86,173,12,24,19,147,1,138,41,12,85,0,104,166,8,4,24,2,200,23,4,85,
+  26,28,10,0,21,8,10,0,0,228,9,4,24,1,242,24,12,33,19,171,1,31,107,12,
+  11,0,158,1,213,66,12,85,2,141,6,100,251,8,0,182,6,27,251,28,28,1,99,18,
+  2,168,28,24,0,136,11,190,23,4,85,4,91,17,0,6,244,15,0,7,18,11,69,132,
+  0,0,0,180,0,0,44,85,19,0,91,17,189,2,24,0,159,136,2,192,254,0,243,1,
+  36,12,20,11,152,23,96,69,4,82,6,9,83,4,24,14,212,44,4,85,16,55,13,34,
+  11,46,13,1,28,29,9,134,26,73,229,12,82,0,29,0,83,4,33,65,152,106,12,82,
+  19,66,0,83,12,85,0,26,104,10,0,28,117,10,8,3,17,83,17,8,19,133,1,27,
+  15,12,11,0,136,1,2,56,20,85,163,28,151,10,16,133,0,165,16,28,55,8,124,76,
+  170,152,28,17,0,136,41,116,199,50,154,30,21,200,1,34,100,88,200,1,20,85,130,149,
+  1,84,18,4,24,5,158,40,4,85,26,42,8,4,24,7,255,20,20,85,160,8,1,7,
+  20,24,142,3,50,22,4,85,12,63,14,12,11,19,127,96,69,28,24,0,116,130,1,223,
+  25,133,132,0,0,0,183,0,0,60,24,0,146,0,108,23,195,2,4,82,19,133,77,20,
+  85,166,46,208,0,4,33,111,106,107,20,85,146,110,56,18,16,135,8,2,18,4,11,17,
+  249,64,4,85,24,224,14,4,33,47,89,92,4,11,0,52,65,4,24,50,51,39,0,6,
+  231,25,20,11,126,9,182,47,20,24,151,14,74,22,8,4,0,7,26,12,85,2,14,51,
+  15,12,11,4,37,170,47,0,20,170,47,0,2,175,47,12,85,0,16,166,18,0,8,18,
+  245,0,6,20,245,4,24,13,3,23,20,85,114,6,105,18,16,148,32,239,17,4,24,23,
+  163,39,4,85,64,140,3,2,45,212,12,34,2,212,12,1,34,8,218,12,1,0,7,158,
+  12,34,26,163,12,1,187,132,0,0,0,187,0,0,44,85,0,0,163,5,201,2,8,19,
+  5,239,17,28,24,0,126,7,104,44,4,85,20,255,11,16,141,10,67,11,0,6,161,13,
+  8,19,6,192,254,28,24,0,137,2,102,21,12,85,19,4,140,3,28,24,0,141,6,253,
+  21,4,85,14,181,247,0,3,93,8,0,4,102,13,16,143,2,28,18,12,24,3,3,151,
+  39,8,19,0,151,39,12,85,0,26,98,244,0,1,204,15,0,0,232,8,16,154,2,123,
+  17,0,8,221,8,0,8,58,244,0,1,153,11,16,133,6,154,18,16,155,0,132,17,0,
+  206,3,42,0,16,127,199,3,128,18,28,28,1,109,62,134,170,28,85,0,142,49,124,17,
+  4,33,49,41,92,4,85,66,241,13,16,137,90,192,18,22,133,0,0,0,187,0,0,44,
+  17,0,0,121,194,201,2,4,85,31,108,13,4,24,13,201,19,0,10,196,19,0,4,180,
+  40,20,11,121,5,182,62,20,24,126,28,76,24,4,85,16,43,13,16,145,4,184,16,8,
+  5,6,65,9,24,0,144,6,62,253,4,24,9,116,32,4,41,77,50,213,4,85,100,20,
+  5,16,146,1,213,18,4,24,4,225,19,4,11,21,206,63,12,85,19,26,192,18,28,29,
+  0,140,28,14,223,28,55,1,97,52,220,163,12,85,0,51,154,11,0,4,106,11,0,10,
+  242,10,0,0,94,11,4,24,0,251,19,4,85,3,114,12,0,14,33,11,16,184,0,72,
+  11,16,147,14,97,11,20,24,127,4,25,19,0,6,2,20,0,7,191,38,85,133,0,0,
+  0,187,0,0,60,85,0,147,0,144,17,201,2,20,24,129,4,101,19,20,85,140,24,137,
+  17,20,24,149,0,79,19,4,85,14,10,6,4,33,57,17,91,4,85,32,85,15,0,46,
+  210,12,4,29,163,1,110,239,20,11,144,150,1,78,59,20,85,111,28,159,17,34,12,115,
+  17,1,34,37,195,17,1,0,48,140,244,0,19,228,11,4,24,2,214,23,20,11,123,23,
+  58,59,20,85,150,32,85,16,0,4,125,11,0,12,223,0,20,24,122,24,168,36,16,160,
+  1,112,41,6,85,26,154,5,34,2,149,5,1,16,150,11,136,16,4,24,10,248,23,4,
+  17,38,35,199,4,82,63,112,82,20,24,157,56,130,20,0,6,188,23,20,85,136,4,229,
+  15,0,18,62,245,161,133,0,0,0,191,0,0,44,85,19,0,154,5,207,2,12,24,0,
+  46,22,19,20,17,160,186,2,62,199,12,85,3,173,2,71,8,12,11,0,74,164,45,4,
+  33,119,90,91,4,82,32,80,80,4,33,60,239,90,0,69,86,94,20,24,165,62,66,42,
+  0,34,34,23,0,4,186,20,12,85,19,33,42,0,42,0,25,142,0,1,0,66,43,11,
+  0,28,79,12,34,7,92,12,1,0,38,131,245,12,33,19,93,239,90,12,85,0,78,12,
+  13,4,24,12,146,21,4,29,10,229,238,4,24,3,15,43,4,85,18,243,10,0,8,198,
+  3,16,146,3,26,16,4,24,111,180,28,12,11,2,84,208,58,12,85,0,42,152,18,0,
+  6,51,9,0,4,79,3,4,11,25,131,50,27,134,0,0,0,193,0,0,44,85,0,0,
+  169,11,211,2,16,130,10,29,3,4,11,32,65,72,4,85,11,186,4,4,24,7,227,25,
+  0,24,30,22,4,85,30,175,255,12,11,19,33,65,72,12,85,0,48,178,8,0,26,81,
+  4,4,33,95,88,90,20,85,128,84,155,250,4,82,55,202,83,20,24,161,52,158,20,4,
+  82,7,214,83,20,85,142,14,97,17,16,145,12,113,17,16,122,2,219,17,20,17,157,42,
+  233,199,12,85,3,11,5,16,12,24,0,27,184,37,0,8,69,38,8,4,6,122,38,8,
+  0,4,99,38,16,125,8,196,39,34,84,160,39,1,34,0,119,39,1,42,11,93,185,39,
+  1,12,85,19,163,1,243,10,12,24,0,190,1,123,27,0,51,195,36,0,58,81,38,123,
+  134,0,0,0,196,0,0,60,85,0,136,0,69,16,217,2,20,24,149,9,246,36,42,19,
+  69,195,36,1,42,0,12,75,37,1,34,1,98,37,1,20,82,158,28,29,77,20,85,138,
+  50,3,16,16,137,2,252,15,16,120,24,184,18,0,6,78,10,4,24,4,56,20,4,33,
+  107,151,105,4,17,180,1,247,193,0,0,125,205,16,156,12,89,198,4,85,27,54,6,0,
+  150,1,141,8,0,153,1,151,13,16,122,20,207,16,0,8,163,7,0,24,26,2,8,2,
+  8,67,0,28,11,0,170,7,150,47,4,85,20,165,18,20,24,167,7,39,41,4,85,24,
+  36,6,0,10,199,3,0,16,160,9,4,33,121,132,105,28,41,8,105,186,1,247,217,12,
+  85,19,23,141,8,8,0,10,62,255,13,135,0,0,0,199,0,0,60,85,0,156,0,102,
+  248,223,2,20,29,105,30,120,239,4,24,11,194,21,4,85,6,121,14,0,26,193,247,0,
+  1,236,11,0,24,180,1,0,5,111,4,20,17,167,36,216,197,4,85,15,179,248,20,17,
+  138,28,185,197,34,117,15,198,1,34,80,151,197,1,34,20,7,198,1,50,153,130,1,242,
+  197,1,4,85,125,117,248,4,82,69,159,87,4,85,88,241,16,0,22,232,16,0,2,113,
+  14,28,28,1,94,96,105,166,12,85,19,255,8,33,11,12,24,0,178,8,135,19,4,85,
+  12,103,10,4,24,5,26,37,0,4,10,37,0,8,21,37,20,17,153,60,51,198,4,11,
+  107,171,71,16,133,42,134,58,0,18,222,49,4,85,22,104,18,121,135,0,0,0,203,0,
+  0,60,85,0,121,0,144,16,231,2,20,17,149,54,14,198,34,108,25,198,1,34,2,24,
+  198,1,4,85,149,1,235,10,16,130,138,2,89,4,20,11,148,165,2,179,58,4,85,50,
+  251,245,20,11,149,39,83,46,4,85,40,22,246,0,10,20,254,0,1,162,5,20,11,117,
+  33,72,46,4,85,36,226,255,4,24,8,107,20,0,6,85,20,16,155,3,94,28,20,85,
+  143,16,211,3,0,8,68,16,16,137,11,70,16,16,152,8,219,18,0,8,121,17,0,16,
+  36,17,0,14,21,255,0,4,208,2,4,82,55,109,78,20,17,142,132,1,160,196,34,97,
+  46,197,1,50,155,40,45,197,1,4,82,59,4,78,20,85,150,60,121,16,4,33,161,1,
+  215,105,195,135,0,0,0,207,0,0,60,85,0,113,0,110,16,239,2,20,17,144,60,18,
+  198,50,161,46,25,198,1,20,24,134,101,80,23,4,82,33,220,83,4,85,48,52,255,0,
+  8,171,18,4,11,29,86,58,8,5,32,192,45,8,0,14,206,45,4,85,46,169,241,4,
+  24,11,51,19,4,85,4,234,15,4,17,64,241,197,4,11,73,203,52,4,85,32,127,241,
+  8,19,30,89,4,0,0,89,4,8,0,4,88,255,8,19,215,1,70,16,8,0,250,1,
+  61,255,4,82,67,11,78,4,24,46,148,38,4,85,46,242,245,20,17,168,42,176,196,4,
+  24,61,124,38,4,85,44,177,243,4,82,47,217,77,12,24,5,60,179,43,42,0,1,181,
+  43,1,34,2,177,43,1,20,17,152,70,221,196,214,136,0,0,0,210,0,0,44,85,0,
+  0,125,249,245,2,20,17,144,199,1,185,199,4,29,53,115,239,4,17,52,95,194,4,85,
+  19,176,241,20,17,163,40,240,196,4,85,37,31,252,4,24,7,175,27,4,82,47,143,77,
+  4,11,66,71,50,4,85,34,43,6,4,24,0,147,19,4,85,14,165,253,16,136,28,67,
+  251,4,24,27,183,38,4,33,69,58,101,20,85,159,100,159,15,4,82,65,85,77,4,17,
+  118,64,197,34,171,1,252,196,1,34,40,90,197,1,34,62,243,197,1,34,28,173,196,1,
+  34,6,200,197,1,4,85,16,192,247,16,148,19,18,12,0,60,173,243,16,168,8,198,239,
+  0,6,210,4,4,24,15,167,38,4,85,26,12,243,4,11,47,159,59,201,136,0,0,0,
+  215,0,0,44,85,0,0,156,248,255,2,20,17,160,44,75,197,4,11,137,1,196,72,4,
+  85,120,57,240,20,17,138,32,38,197,4,24,37,145,21,4,11,79,64,50,4,24,74,57,
+  36,4,85,36,142,7,4,29,32,13,237,4,24,31,146,39,4,85,54,143,242,0,2,139,
+  242,0,3,125,248,4,11,35,41,47,4,85,52,23,250,4,24,33,220,38,4,29,110,11,
+  237,0,45,45,237,0,13,158,235,20,24,149,39,68,36,4,29,28,181,235,0,18,158,235,
+  4,24,43,4,39,4,17,118,129,197,0,22,123,197,4,85,89,232,246,4,82,81,42,75,
+  4,85,90,133,15,0,10,233,6,20,24,169,17,36,41,20,11,107,11,123,58,12,137,0,
+  0,0,215,0,0,44,11,0,0,148,48,255,2,20,24,163,24,241,40,4,85,42,10,244,
+  12,29,19,59,158,235,12,11,0,4,204,67,4,85,72,34,241,20,17,158,44,35,197,16,
+  148,4,155,197,4,24,79,255,38,4,85,44,47,17,4,24,13,169,36,20,29,165,40,236,
+  236,4,33,91,225,101,0,97,164,103,4,17,248,1,84,195,4,24,123,154,19,20,85,124,
+  80,75,254,0,5,23,16,12,28,1,120,42,170,12,29,0,65,20,234,4,85,3,86,241,
+  4,24,9,138,22,12,85,5,32,234,242,8,0,4,19,241,0,4,235,242,0,21,249,15,
+  4,29,48,209,231,4,85,31,213,242,0,12,89,6,0,9,62,241,20,17,140,68,133,199,
+  34,77,89,199,1,188,137,0,0,0,216,0,0,46,17,0,0,83,199,131,3,12,85,2,
+  133,1,114,242,8,3,2,112,242,8,0,20,110,242,0,15,206,1,16,135,12,21,3,0,
+  10,183,243,12,11,5,43,94,52,12,85,0,60,149,246,0,63,235,242,0,82,133,243,0,
+  77,233,242,0,68,207,13,0,22,189,243,34,3,177,243,1,0,32,4,241,20,29,152,18,
+  32,238,16,153,0,36,238,4,85,2,232,240,20,17,146,105,172,186,4,85,98,63,246,4,
+  24,39,127,38,0,16,213,38,16,146,4,127,38,50,164,19,157,38,1,4,85,70,109,241,
+  0,11,116,11,20,29,175,30,58,238,20,24,144,35,40,41,20,29,155,46,18,238,4,85,
+  11,120,11,0,4,121,11,195,137,0,0,0,219,0,0,60,24,0,157,0,252,38,135,3,
+  8,19,0,252,38,12,85,0,32,31,4,4,11,57,45,66,4,82,0,129,75,4,85,110,
+  219,238,0,23,184,11,8,19,24,219,238,12,24,2,39,203,39,12,41,0,74,11,214,20,
+  24,160,65,36,39,4,85,30,31,6,0,87,198,3,0,0,193,3,4,17,184,1,143,196,
+  0,2,137,196,4,85,25,78,246,4,82,111,250,82,28,55,1,111,236,1,157,163,28,24,
+  0,153,159,1,118,39,0,26,188,39,4,85,30,224,243,20,24,157,31,97,38,4,85,50,
+  125,236,4,24,47,86,38,4,85,52,178,240,0,34,133,236,12,24,2,75,4,39,12,85,
+  0,54,145,236,20,24,110,41,214,30,16,154,0,167,38,0,1,218,39,53,138,0,0,0,
+  219,0,0,44,85,0,0,118,236,135,3,0,4,255,227,4,41,14,48,217,4,17,16,116,
+  199,28,55,8,103,164,1,52,155,12,11,0,159,2,96,74,20,17,142,156,1,52,190,34,
+  83,12,190,1,4,85,32,224,237,12,11,5,67,176,68,12,85,0,102,109,237,20,24,146,
+  47,27,39,0,12,68,39,2,1,128,40,34,4,130,40,1,2,2,26,39,34,2,23,39,
+  1,4,85,36,218,250,24,2,166,12,102,237,24,0,188,9,62,2,4,11,21,186,51,4,
+  85,64,80,237,4,24,35,43,40,0,10,139,37,16,165,14,198,39,16,174,0,8,40,28,
+  17,1,114,156,1,58,171,28,24,0,155,135,1,63,39,16,167,20,92,39,4,85,46,47,
+  237,0,4,155,234,4,33,185,1,216,99,127,138,0,0,0,224,0,0,60,24,0,175,0,
+  252,39,141,3,0,0,35,38,16,157,2,255,39,20,11,148,1,148,49,4,85,44,231,235,
+  0,16,12,236,20,24,164,43,202,39,16,162,10,241,39,4,85,12,39,20,20,24,166,17,
+  200,39,4,11,9,16,53,20,24,160,22,178,39,4,11,7,176,52,20,24,166,18,194,39,
+  16,166,6,191,39,16,166,1,204,39,16,139,4,195,39,16,171,4,176,39,16,167,10,178,
+  39,4,85,64,68,234,0,9,82,247,8,2,8,79,247,8,0,21,193,17,20,24,161,19,
+  44,40,16,168,10,206,39,16,168,11,223,39,16,138,18,202,39,4,85,38,65,246,12,24,
+  19,43,206,39,12,85,0,52,36,235,0,3,92,247,12,24,19,41,202,39,200,138,0,0,
+  0,224,0,0,44,85,0,0,116,249,141,3,8,2,12,232,236,12,24,0,65,65,38,4,
+  11,5,229,52,34,2,227,52,1,20,24,175,24,198,39,16,156,2,28,40,50,174,11,16,
+  40,1,0,32,80,40,4,85,34,223,236,12,24,5,53,195,39,58,0,164,0,194,39,1,
+  50,168,0,194,39,1,4,85,60,43,236,0,27,143,3,4,11,63,34,67,4,85,96,92,
+  235,4,17,34,1,212,4,85,35,246,255,4,17,48,26,212,20,24,166,75,182,39,16,163,
+  14,12,40,16,160,8,213,39,4,17,102,44,195,12,85,19,235,2,62,2,28,24,0,158,
+  136,2,134,39,12,11,4,13,40,53,0,0,28,53,8,0,5,18,53,4,85,70,137,249,
+  12,11,4,51,34,53,8,0,2,41,67,255,138,0,0,0,228,0,0,44,85,0,0,153,
+  249,149,3,4,24,49,141,39,4,85,70,209,239,4,24,57,169,39,8,5,1,176,41,8,
+  0,10,155,39,4,85,62,182,234,0,7,9,245,4,24,19,73,39,34,22,82,39,1,0,
+  15,212,39,4,85,96,128,244,4,24,25,227,39,20,17,145,124,27,197,4,24,97,222,39,
+  4,11,35,188,71,12,85,6,122,166,239,42,0,3,163,239,1,34,2,166,239,1,34,8,
+  169,239,1,4,24,67,221,39,4,85,6,115,20,20,17,147,86,150,212,8,13,52,216,188,
+  12,11,0,173,1,252,72,20,85,163,118,76,241,4,17,68,210,188,20,85,147,69,27,248,
+  0,8,31,245,4,24,51,241,39,0,8,22,40,20,17,169,148,1,166,185,213,139,0,0,
+  0,232,0,0,46,17,0,0,85,185,159,3,0,97,1,194,16,144,11,190,205,34,89,230,
+  205,1,4,85,52,178,244,34,16,101,244,1,20,24,175,73,73,41,4,17,120,34,194,4,
+  85,43,196,246,20,24,155,13,107,41,4,17,110,140,202,4,33,221,2,61,107,4,41,212,
+  2,175,213,4,11,95,8,50,4,24,18,54,39,4,85,54,152,244,4,11,11,48,47,4,
+  24,10,113,39,8,19,0,113,39,0,73,107,41,12,11,0,82,86,59,4,82,41,26,80,
+  4,41,158,1,219,215,20,24,160,77,85,41,4,82,61,46,76,20,41,173,136,1,84,222,
+  12,85,5,3,101,19,12,41,0,46,219,221,4,24,59,154,40,12,33,19,159,3,61,107,
+  12,82,0,164,2,90,76,0,36,80,76,15,140,0,0,0,235,0,0,44,85,0,0,221,
+  248,163,3,20,17,127,72,152,185,4,82,231,1,39,79,4,24,162,1,49,26,0,11,73,
+  35,4,41,132,1,68,215,4,85,31,92,246,8,4,3,241,240,12,24,0,29,71,40,4,
+  85,46,239,233,4,11,67,69,59,0,18,18,50,0,37,218,73,4,17,176,1,178,194,4,
+  85,59,83,248,16,163,2,128,248,0,1,87,3,0,13,140,16,4,41,62,190,222,8,19,
+  0,190,222,12,85,0,9,220,244,0,13,56,1,0,30,131,232,4,11,153,1,14,72,4,
+  85,126,97,2,20,24,159,22,28,41,4,82,21,20,76,4,11,100,26,52,0,181,1,52,
+  62,20,24,156,216,1,38,42,50,167,2,17,42,1,50,172,21,65,42,1,156,140,0,0,
+  0,237,0,0,60,11,0,162,0,180,52,167,3,4,85,76,155,228,4,82,229,1,109,88,
+  4,8,242,43,67,36,4,11,229,42,62,71,4,85,152,1,136,233,20,17,138,38,182,194,
+  34,63,105,194,1,4,24,49,151,32,4,85,46,141,4,4,11,53,154,51,4,85,78,213,
+  249,20,24,151,23,68,34,4,85,72,40,232,0,10,62,228,0,27,186,6,0,3,235,17,
+  4,11,49,179,65,4,85,128,1,52,228,4,11,119,162,62,28,24,8,103,66,215,25,12,
+  11,0,15,61,45,20,17,159,134,1,231,194,4,85,79,159,8,0,38,116,237,4,11,103,
+  239,66,4,85,116,140,232,0,14,18,233,4,24,53,138,39,20,11,145,0,11,52,4,83,
+  103,122,100,4,85,228,1,139,232,72,141,0,0,0,238,0,0,44,85,0,0,15,250,169,
+  3,0,26,104,232,0,4,80,233,0,15,22,250,4,11,119,230,72,4,24,90,171,43,4,
+  41,90,228,221,12,17,1,66,155,170,12,85,0,75,178,232,12,17,13,176,9,174,165,12,
+  85,0,143,9,200,232,0,4,130,232,4,41,30,152,215,4,85,13,174,232,0,25,24,4,
+  4,41,58,198,215,20,24,161,67,52,42,24,8,125,78,43,25,12,85,0,48,88,232,20,
+  11,111,103,198,59,4,24,34,4,44,0,24,34,44,4,85,38,217,17,0,8,40,11,0,
+  28,150,8,20,41,129,74,213,217,4,17,28,146,205,0,2,185,205,16,141,52,222,187,4,
+  24,133,1,56,44,4,85,86,114,241,8,3,0,146,241,7,142,0,0,0,238,0,0,60,
+  85,0,125,0,20,226,169,3,8,19,39,114,241,8,0,68,43,238,0,53,73,11,8,19,
+  54,43,238,8,0,12,227,234,4,11,83,193,44,4,85,62,35,11,0,36,225,237,16,154,
+  2,0,238,4,41,28,4,217,4,85,17,241,237,0,27,253,11,4,24,15,139,40,4,17,
+  138,1,218,193,4,11,145,1,78,56,20,85,147,112,245,224,20,41,136,0,62,221,12,17,
+  3,64,206,193,28,85,0,146,51,176,226,0,7,31,238,4,24,61,8,43,20,17,140,142,
+  1,216,193,34,169,1,236,193,1,34,86,158,193,1,16,158,92,211,193,4,24,131,1,182,
+  32,4,11,19,112,57,4,85,104,250,235,0,13,191,252,12,11,6,43,15,47,12,85,0,
+  78,67,238,69,142,0,0,0,240,0,0,44,11,5,0,35,47,173,3,12,85,0,96,116,
+  237,8,5,31,198,12,28,41,0,130,72,253,216,20,17,122,18,232,203,4,11,131,1,70,
+  61,4,85,80,125,0,0,40,56,237,0,75,197,12,4,11,38,207,54,4,17,174,1,1,
+  210,4,82,221,1,251,81,4,85,188,1,144,237,8,19,0,144,237,12,11,0,91,22,55,
+  12,82,19,95,251,81,12,17,0,158,2,0,210,4,85,91,215,19,4,24,7,95,38,4,
+  11,2,69,40,4,85,46,23,9,0,50,138,238,28,17,1,133,150,1,192,165,24,0,139,
+  79,105,202,34,70,215,202,1,4,85,117,217,240,4,11,97,71,61,4,17,152,1,230,212,
+  4,85,75,207,13,4,17,82,220,212,4,11,103,228,44,20,17,93,154,1,210,194,247,142,
+  0,0,0,241,0,0,44,85,0,0,225,19,175,3,0,26,123,241,4,11,45,18,44,4,
+  85,48,11,20,0,36,50,250,0,40,242,225,20,41,158,38,146,213,4,85,79,138,19,0,
+  2,5,20,28,17,1,78,216,1,9,172,24,8,78,43,123,188,24,0,155,37,213,207,4,
+  11,135,1,189,51,0,14,196,51,0,0,210,51,12,83,5,191,1,72,100,12,11,0,212,
+  1,137,61,4,85,126,121,238,0,25,253,2,0,28,74,3,4,11,43,27,51,20,41,150,
+  132,1,245,213,4,24,83,255,23,4,41,106,225,213,0,6,225,213,4,11,129,1,55,51,
+  12,17,19,192,1,174,165,24,0,145,12,110,186,4,11,131,1,142,45,4,24,46,73,25,
+  4,85,44,62,4,8,3,8,135,8,221,143,0,0,0,241,0,0,60,17,0,135,0,210,
+  208,175,3,4,85,18,168,15,4,82,229,1,6,75,0,28,234,78,4,85,132,1,50,16,
+  4,11,37,142,45,4,85,38,20,18,28,17,1,116,220,1,85,169,12,11,0,135,2,96,
+  66,20,85,133,150,1,115,230,0,41,176,16,4,24,3,64,24,4,11,81,67,66,12,85,
+  19,92,168,15,8,2,0,163,15,8,0,1,193,16,0,0,199,16,0,8,136,16,0,2,
+  180,16,4,24,5,238,23,4,85,22,236,18,4,41,90,247,215,4,85,51,142,253,0,8,
+  162,253,0,13,20,19,0,2,81,17,4,11,23,70,44,20,17,144,152,1,132,206,12,55,
+  9,188,1,44,162,12,24,0,135,2,202,25,4,85,14,238,15,0,6,120,253,86,144,0,
+  0,0,241,0,0,60,17,0,144,0,188,208,175,3,34,5,186,208,1,20,11,109,177,1,
+  31,67,16,120,12,57,67,4,85,120,180,253,0,10,152,253,4,11,111,96,66,0,46,137,
+  49,12,85,3,92,245,255,12,82,0,221,1,126,75,4,85,248,1,150,253,0,20,129,243,
+  4,82,237,1,21,83,0,42,231,88,4,17,206,2,133,187,4,85,135,1,194,19,0,20,
+  104,10,0,22,108,10,0,10,50,10,16,156,26,135,254,0,13,93,10,8,5,156,1,225,
+  5,28,11,0,162,167,1,141,59,6,17,210,1,98,208,34,4,98,208,1,20,82,186,149,
+  2,44,89,4,24,182,1,101,25,4,82,175,1,68,89,4,17,210,4,201,190,0,249,1,
+  108,208,4,85,93,172,19,8,5,2,140,19,201,144,0,0,0,244,0,0,44,11,0,0,
+  86,49,179,3,4,85,66,56,9,4,11,163,1,58,73,4,85,156,1,205,19,16,190,32,
+  2,2,4,11,73,118,49,0,49,37,68,4,8,136,1,115,19,20,85,186,24,68,4,0,
+  30,234,243,4,11,81,81,49,4,17,206,1,31,185,4,85,133,1,94,9,20,41,100,90,
+  135,213,20,17,152,58,16,195,4,82,139,2,103,73,4,85,158,1,123,10,4,11,47,157,
+  50,4,85,68,13,244,8,4,42,241,3,12,11,0,79,136,54,12,17,19,224,1,201,190,
+  12,85,0,119,139,5,0,10,214,5,0,50,145,230,4,8,45,163,12,16,165,8,183,22,
+  4,82,135,1,222,72,4,8,116,255,38,20,85,167,78,118,6,20,17,130,152,1,1,211,
+  4,85,27,167,239,76,145,0,0,0,244,0,0,44,82,0,0,56,81,179,3,24,5,159,
+  90,169,68,28,85,0,155,146,1,50,1,16,153,6,47,1,12,11,5,49,19,44,12,41,
+  0,84,18,222,4,85,5,56,7,20,83,162,163,3,184,106,4,11,134,3,100,40,20,41,
+  149,152,1,117,213,4,11,131,1,108,52,20,17,136,134,2,127,187,50,163,219,1,64,187,
+  1,4,11,4,44,55,28,85,2,138,142,1,74,236,12,17,1,230,1,135,166,12,85,0,
+  233,1,16,6,4,11,41,216,42,24,8,89,44,91,40,24,0,156,5,181,50,0,24,115,
+  42,0,0,107,42,0,1,170,50,0,24,154,42,4,82,87,44,79,0,6,46,79,4,11,
+  108,122,42,28,17,1,84,206,2,133,166,12,11,0,159,2,196,42,20,33,166,211,1,62,
+  96,12,17,13,188,4,225,171,12,85,0,139,2,0,3,236,146,0,0,0,245,0,0,60,
+  17,8,108,0,240,182,181,3,12,11,0,141,1,87,42,28,21,1,143,224,2,1,164,28,
+  11,0,156,199,2,6,59,16,190,16,83,59,20,17,165,190,1,193,212,0,24,0,212,4,
+  8,71,37,23,4,82,143,1,162,78,4,13,219,4,1,113,4,11,184,5,93,62,0,8,
+  101,62,20,17,156,202,1,186,212,8,1,166,1,190,170,12,85,0,197,1,158,5,4,11,
+  167,1,147,65,20,17,147,220,1,156,212,4,11,97,122,54,20,17,161,206,1,131,212,4,
+  11,189,1,204,53,4,85,114,186,245,28,17,9,137,170,1,45,183,12,82,0,239,2,183,
+  86,4,85,160,2,202,233,8,2,33,25,0,28,11,0,158,77,222,56,0,82,209,47,0,
+  9,222,56,4,83,193,2,9,100,28,21,9,123,194,5,104,161,28,17,1,85,0,3,168,
+  12,85,0,204,1,34,7,170,147,0,0,0,245,0,0,44,11,0,0,239,47,181,3,0,
+  6,4,48,0,29,213,58,0,34,213,47,4,82,133,1,154,85,4,83,203,2,67,109,4,
+  85,208,4,98,247,4,11,109,111,54,0,3,72,56,4,85,110,221,252,4,41,76,124,215,
+  20,85,149,65,79,3,4,41,74,130,215,12,85,5,63,254,2,12,8,0,13,34,24,4,
+  17,208,1,2,187,4,85,135,1,106,254,0,2,1,4,4,11,69,128,61,0,20,113,56,
+  4,85,96,104,7,0,50,185,244,4,83,197,3,84,103,4,11,192,2,200,53,4,82,99,
+  35,85,4,85,252,1,53,245,12,83,5,255,2,45,105,12,85,0,132,3,245,253,4,11,
+  109,74,56,16,152,24,161,47,4,85,82,111,7,4,11,87,224,53,39,148,0,0,0,245,
+  0,0,44,11,0,0,104,57,181,3,0,10,236,53,0,16,100,51,0,17,74,57,0,0,
+  81,57,0,28,94,57,4,85,112,150,7,20,17,160,92,217,212,4,11,179,1,72,57,12,
+  21,1,176,4,228,155,12,85,0,155,3,23,7,4,11,95,175,54,0,28,193,58,20,85,
+  130,112,121,7,8,19,6,34,7,28,17,0,136,150,1,134,193,50,160,107,105,193,1,34,
+  182,1,122,193,1,4,85,203,1,166,255,12,17,14,120,37,199,12,82,0,167,2,69,77,
+  4,85,196,1,57,248,4,82,225,1,76,86,20,11,144,138,1,139,57,4,82,81,111,83,
+  4,85,214,1,120,7,0,34,172,8,20,11,146,49,122,41,4,82,151,1,161,84,20,11,
+  140,92,45,67,0,52,193,53,4,82,115,247,84,202,148,0,0,0,247,0,0,44,11,0,
+  0,125,53,185,3,12,17,1,214,2,66,171,12,85,0,221,1,231,8,4,11,105,131,59,
+  4,85,102,69,9,12,83,1,133,4,81,108,12,85,0,148,4,4,9,0,4,162,8,8,
+  4,50,224,235,12,82,0,131,2,247,84,12,11,19,39,139,57,8,4,178,1,226,65,12,
+  85,0,164,1,112,251,4,41,102,239,214,20,11,156,179,1,68,53,16,150,6,57,53,8,
+  19,153,1,122,41,12,17,0,130,3,185,207,16,149,16,250,208,4,11,165,1,116,49,4,
+  85,100,240,251,4,11,81,137,51,4,82,131,1,17,85,4,11,142,1,77,54,12,85,3,
+  118,31,0,12,8,0,2,244,10,4,11,73,88,55,0,44,176,55,4,17,230,1,39,197,
+  4,8,143,1,127,13,4,11,77,75,58,4,8,98,182,12,215,148,0,0,0,247,0,0,
+  44,83,0,0,178,104,185,3,4,33,60,81,92,4,8,252,2,31,14,4,83,209,3,160,
+  100,4,8,222,3,109,13,0,2,110,11,0,8,238,10,20,17,138,122,173,207,4,85,32,
+  54,235,28,11,5,168,207,1,26,48,12,82,0,91,116,78,4,8,192,1,73,13,0,12,
+  102,13,4,82,195,1,229,68,4,85,240,1,94,247,16,165,2,108,247,8,3,2,125,247,
+  0,8,106,247,12,82,0,253,1,96,84,4,8,214,1,81,13,12,85,4,52,128,247,12,
+  11,0,97,60,46,4,8,70,112,13,12,85,3,56,144,247,12,8,0,27,157,13,0,10,
+  139,13,0,0,171,13,4,11,165,1,221,65,0,96,111,49,0,16,84,49,4,85,138,1,
+  47,242,4,82,229,1,97,79,240,149,0,0,0,247,0,0,44,11,0,0,247,49,185,3,
+  0,12,208,49,12,8,19,24,171,13,12,82,11,119,49,77,8,0,32,239,69,8,4,33,
+  68,77,8,11,4,47,77,0,10,80,77,12,83,0,233,5,62,111,12,82,11,136,6,60,
+  77,12,8,0,166,1,116,20,12,82,11,157,1,36,77,12,8,0,178,1,226,16,20,82,
+  104,161,1,75,77,8,11,0,57,77,12,8,0,164,1,173,18,28,17,1,81,224,1,64,
+  187,12,82,11,215,2,64,77,0,18,81,77,12,8,0,208,1,77,13,20,17,154,82,79,
+  213,28,85,2,170,55,43,248,28,8,8,122,89,149,40,28,85,2,176,94,52,248,8,0,
+  8,63,248,4,8,154,4,77,12,4,85,157,4,147,8,12,82,11,187,1,93,77,12,85,
+  0,222,1,60,248,4,82,199,1,17,78,16,133,28,81,76,0,16,70,79,200,150,0,0,
+  0,247,0,0,44,85,0,0,86,247,185,3,20,82,165,235,1,116,77,4,85,236,1,148,
+  253,4,83,199,1,109,93,4,8,38,36,72,0,30,35,72,0,166,1,180,12,20,17,139,
+  172,1,98,194,4,82,199,2,67,78,16,147,36,57,78,0,20,94,78,4,8,210,1,122,
+  11,4,17,151,1,159,208,0,232,2,116,190,20,8,180,187,1,244,24,34,16,14,25,1,
+  4,85,76,13,9,4,8,33,228,27,4,85,82,212,248,20,17,145,84,107,212,20,41,160,
+  1,115,217,4,85,67,90,254,4,8,101,80,55,0,50,140,36,0,23,19,51,0,49,11,
+  69,4,85,190,1,207,1,4,82,251,1,234,85,8,19,0,234,85,12,8,0,244,1,136,
+  22,34,3,146,22,1,34,4,149,22,1,144,151,0,0,0,250,0,0,44,8,0,0,236,
+  18,191,3,20,85,169,64,112,251,16,150,8,134,251,4,8,75,9,35,0,14,254,28,4,
+  85,88,108,230,4,8,47,71,12,0,35,226,43,0,42,9,29,8,5,44,229,10,8,0,
+  91,232,55,4,17,170,2,146,187,4,8,149,2,202,50,0,86,166,29,0,50,176,10,0,
+  177,1,155,71,4,85,146,2,69,6,4,8,49,139,21,0,2,2,36,8,3,95,190,51,
+  8,0,168,1,80,20,4,82,159,1,41,82,4,8,50,198,51,0,172,1,203,11,0,69,
+  133,51,20,49,135,134,2,75,194,12,8,5,157,1,123,15,8,0,16,95,15,0,69,68,
+  50,4,85,142,1,115,245,4,8,13,172,11,0,101,46,56,119,152,0,0,0,250,0,0,
+  44,85,0,0,9,10,191,3,0,8,162,10,4,8,5,162,11,4,82,247,1,89,85,4,
+  8,148,1,77,56,0,122,192,10,0,18,227,10,0,93,3,52,0,4,4,52,0,98,194,
+  10,4,83,253,5,201,111,20,8,162,238,5,192,35,4,85,60,126,10,4,8,15,82,18,
+  4,85,40,193,7,0,14,0,10,4,8,51,99,37,4,85,68,252,9,0,39,200,228,4,
+  41,160,1,106,214,4,8,193,1,230,51,12,85,19,58,0,10,12,8,0,14,69,35,20,
+  85,149,78,174,5,4,82,245,1,142,83,4,8,128,2,152,14,4,85,2,9,10,8,19,
+  87,252,9,8,2,6,243,9,24,0,130,94,152,5,4,8,95,249,49,0,6,232,49,252,
+  152,0,0,0,250,0,0,44,85,0,0,170,5,191,3,12,8,19,179,4,176,10,8,4,
+  216,3,254,49,8,0,6,102,51,4,85,100,211,9,16,149,22,155,4,0,6,210,8,16,
+  135,6,167,4,0,14,227,4,8,19,19,210,8,12,8,0,49,11,50,0,108,17,50,0,
+  33,101,33,0,49,116,56,0,88,210,18,4,85,66,115,255,20,82,137,235,1,174,80,12,
+  8,4,210,1,192,18,8,0,6,203,19,0,69,41,50,8,19,0,41,50,0,20,17,50,
+  8,5,84,130,19,28,41,0,152,124,51,215,12,49,1,158,1,17,178,12,8,0,225,1,
+  91,37,4,48,96,56,232,4,8,159,1,203,52,20,48,167,180,1,41,232,4,8,179,1,
+  88,57,4,85,124,90,9,4,8,0,210,20,103,153,0,0,0,250,0,0,44,8,0,0,
+  84,57,191,3,0,51,210,71,0,64,109,57,4,85,154,1,111,251,4,48,38,72,237,28,
+  17,1,102,242,1,49,171,12,83,0,247,5,208,101,4,8,224,2,106,59,0,46,141,49,
+  0,52,1,35,0,27,0,47,20,2,146,138,7,133,144,4,8,135,7,159,49,0,2,147,
+  49,0,0,150,49,0,20,219,51,28,17,1,88,236,3,169,169,12,85,0,231,1,200,252,
+  0,10,213,6,34,22,219,6,1,12,83,19,225,5,208,101,12,8,4,252,5,184,11,24,
+  0,159,147,1,17,69,16,150,86,75,47,0,51,93,73,8,5,40,211,56,12,41,0,254,
+  1,177,213,4,8,111,47,16,0,13,126,25,0,13,195,36,0,59,173,58,20,82,150,95,
+  120,80,140,154,0,0,0,251,0,0,44,85,2,0,93,255,193,3,28,8,0,154,167,1,
+  161,65,28,85,8,126,194,1,128,247,12,8,0,97,251,38,4,85,102,165,4,4,8,59,
+  252,32,20,85,137,62,153,4,4,8,81,65,43,4,13,223,5,243,113,4,8,142,6,253,
+  40,0,5,180,42,20,49,161,188,2,45,193,4,8,205,1,247,16,4,85,22,89,10,4,
+  8,99,111,50,0,94,228,16,0,5,241,19,8,19,0,241,19,12,85,0,44,129,8,8,
+  2,18,138,255,8,19,17,129,8,12,8,0,75,101,44,0,13,182,51,0,74,222,19,16,
+  149,37,60,50,0,28,128,41,12,85,2,108,122,255,12,8,0,73,15,36,0,115,147,70,
+  4,85,194,1,228,8,28,17,1,80,206,2,123,175,12,48,0,153,1,107,232,84,155,0,
+  0,0,251,0,0,44,48,0,0,53,235,193,3,4,8,117,125,11,42,4,2,125,11,1,
+  8,0,64,243,14,4,33,251,1,148,84,4,85,148,2,84,6,4,8,61,17,14,4,49,
+  134,2,160,190,4,83,207,5,30,99,4,8,194,3,10,45,0,101,13,71,20,85,162,214,
+  1,195,7,4,8,109,161,51,0,10,87,70,0,130,1,56,36,4,33,191,1,96,82,12,
+  85,6,150,2,158,7,42,0,3,158,7,1,34,4,159,7,1,34,4,157,7,1,0,50,
+  251,255,4,8,1,206,11,0,87,56,69,16,186,12,53,69,0,86,249,51,0,38,137,42,
+  0,17,234,51,0,107,121,77,4,49,174,3,250,191,4,8,243,2,82,69,4,85,198,1,
+  66,3,0,20,111,255,36,156,0,0,0,255,0,0,44,85,0,0,218,4,201,3,4,8,
+  191,1,25,69,28,41,8,134,184,2,66,218,28,8,0,161,203,1,2,52,0,37,125,59,
+  0,37,73,59,0,64,176,54,0,134,1,84,43,0,153,1,10,69,20,85,134,198,1,161,
+  7,4,8,23,42,29,0,7,75,43,0,51,137,57,4,85,142,1,250,254,12,8,19,101,
+  84,43,8,0,107,85,73,8,19,68,137,57,0,52,75,43,8,0,40,129,28,0,8,110,
+  28,4,83,239,6,41,112,20,85,137,186,7,151,255,4,8,181,1,84,66,28,21,1,123,
+  228,3,29,174,12,48,0,219,1,37,231,4,8,223,1,93,66,4,85,190,1,238,4,0,
+  22,140,255,4,8,217,1,69,72,0,30,97,66,0,2,94,66,0,6,103,66,70,156,0,
+  0,0,255,0,0,44,8,2,0,104,66,201,3,12,85,0,176,1,28,3,4,48,178,1,
+  197,229,4,8,225,1,87,48,20,48,159,178,1,119,231,0,25,48,243,4,8,203,1,202,
+  60,0,26,215,60,0,44,243,54,4,85,194,1,128,255,4,48,216,1,82,226,20,8,159,
+  235,1,219,40,0,88,239,15,0,29,218,26,4,85,68,72,2,4,8,131,1,130,59,4,
+  85,174,1,100,2,4,48,134,1,14,239,0,23,52,239,0,37,66,226,0,132,1,172,229,
+  8,6,145,1,42,236,12,85,0,9,200,2,12,8,5,51,64,17,8,0,66,43,31,28,
+  49,1,113,220,2,127,178,28,85,0,181,247,1,175,255,4,8,213,1,242,75,0,128,1,
+  20,55,0,8,48,55,0,0,21,55,0,8,39,55,202,157,0,0,0,255,0,0,44,48,
+  0,0,224,234,201,3,16,162,20,222,228,4,8,67,112,19,8,5,18,36,19,8,0,42,
+  80,26,4,48,132,1,6,227,4,8,39,183,17,0,24,195,17,28,49,1,151,160,3,24,
+  181,14,85,0,245,1,72,7,34,2,70,7,1,4,48,210,1,147,225,4,8,199,2,97,
+  67,4,48,234,1,103,252,4,8,50,72,11,20,85,148,52,162,5,4,8,91,114,42,0,
+  53,189,57,0,78,100,42,20,85,154,110,24,5,16,138,22,10,5,0,54,56,4,4,33,
+  167,2,225,83,4,8,166,2,131,26,4,33,215,1,128,79,20,8,165,202,1,40,41,4,
+  48,210,1,122,231,4,8,69,223,16,0,221,1,16,74,0,72,134,60,8,19,71,16,74,
+  12,17,0,242,3,64,196,40,159,0,0,0,1,1,0,44,8,0,0,116,60,203,3,0,
+  179,1,4,74,0,174,2,0,43,0,92,200,11,4,48,106,153,228,0,35,115,254,16,158,
+  94,66,232,4,8,191,2,184,70,0,40,65,70,4,48,152,2,92,232,4,8,145,2,173,
+  70,0,112,159,42,4,2,212,5,253,152,12,49,1,215,2,42,182,12,48,0,123,58,236,
+  0,6,52,236,0,6,61,236,20,8,184,185,2,163,70,8,5,8,148,70,28,85,0,142,
+  254,1,177,2,4,33,253,2,226,90,4,83,159,1,2,104,4,48,238,4,219,235,0,166,
+  1,151,230,12,85,5,205,1,79,2,12,48,0,44,101,245,20,85,130,24,108,2,0,16,
+  84,2,4,48,79,15,232,0,35,29,233,0,37,253,232,4,8,63,219,70,241,158,0,0,
+  0,1,1,0,44,83,19,0,2,104,203,3,12,8,0,164,3,163,76,0,30,176,76,28,
+  49,1,90,232,3,163,178,20,21,104,106,236,176,28,49,8,121,139,1,249,208,12,8,19,
+  219,6,131,26,12,33,0,200,8,231,78,4,8,169,3,237,36,0,101,26,71,0,176,1,
+  47,33,0,77,22,68,4,85,206,1,188,1,20,83,148,193,4,242,101,4,2,134,10,98,
+  152,12,49,19,207,5,249,208,12,8,0,141,1,131,69,4,83,135,2,23,105,4,8,214,
+  3,248,17,4,85,68,252,2,16,147,2,83,2,12,8,4,99,246,41,12,85,0,204,1,
+  218,2,4,8,157,1,247,29,4,49,238,1,86,204,12,79,9,164,2,6,164,28,85,0,
+  137,167,3,83,2,0,42,73,2,50,159,0,69,2,1,0,9,19,9,8,19,20,218,2,
+  12,48,0,24,71,235,68,161,0,0,0,2,1,0,44,85,0,0,50,2,205,3,4,8,
+  19,74,18,0,4,69,18,0,95,53,56,4,85,174,1,167,3,0,2,171,5,28,8,3,
+  85,43,58,26,24,0,156,10,223,27,4,48,124,15,240,20,8,150,111,217,27,8,5,91,
+  165,60,28,48,0,151,246,1,230,239,4,33,163,2,9,79,4,48,176,3,202,229,4,85,
+  113,87,4,0,24,193,0,20,33,124,175,2,78,79,34,130,4,86,79,1,0,135,4,67,
+  79,12,85,19,182,2,193,0,8,0,0,171,0,12,33,19,167,2,231,78,12,85,2,192,
+  2,181,0,12,48,0,76,172,239,28,49,9,135,176,1,199,201,12,8,0,197,3,222,77,
+  0,124,180,74,0,28,133,77,12,48,3,176,2,254,248,8,0,80,181,235,4,33,233,2,
+  17,81,4,48,222,3,68,235,33,161,0,0,0,3,1,0,44,33,0,0,146,89,207,3,
+  28,49,9,127,186,7,20,191,12,48,0,151,1,54,235,12,8,3,181,1,80,45,12,48,
+  0,174,1,168,241,4,8,209,1,164,58,4,88,180,1,164,1,4,8,147,1,176,58,0,
+  14,199,58,4,48,162,3,252,230,0,149,1,167,239,0,219,1,2,234,4,8,19,172,59,
+  4,33,171,1,15,85,4,8,196,1,190,59,0,0,196,59,28,48,8,110,196,2,31,226,
+  24,0,140,74,186,221,20,8,157,159,2,205,59,16,159,4,8,60,8,2,3,14,60,8,
+  0,61,148,71,20,48,140,130,3,197,221,28,88,8,84,3,246,2,12,33,0,161,2,245,
+  78,0,46,28,80,8,19,0,28,80,8,0,76,205,78,20,83,161,221,3,54,107,12,88,
+  6,212,5,183,29,8,0,80,1,5,20,83,155,143,6,54,107,184,163,0,0,0,3,1,
+  0,44,88,0,0,85,252,207,3,4,8,199,1,138,59,34,4,148,59,1,4,48,254,1,
+  98,237,0,6,69,237,34,35,94,237,1,0,28,130,245,4,8,191,1,64,65,4,88,200,
+  1,250,10,0,22,247,10,0,8,54,7,12,8,3,71,67,59,8,0,8,87,59,4,26,
+  72,107,44,28,56,1,109,236,3,115,178,12,88,0,237,2,21,18,28,56,8,114,162,3,
+  239,183,12,88,0,179,1,180,25,20,8,165,6,67,59,0,2,69,59,4,88,178,2,197,
+  10,4,8,243,1,36,69,0,20,35,69,0,108,14,61,0,6,19,61,4,88,158,1,121,
+  18,0,68,250,251,4,79,132,4,234,160,4,83,165,8,191,97,20,88,174,212,4,155,10,
+  0,32,112,10,0,3,102,10,73,165,0,0,0,5,1,0,44,8,0,0,215,60,211,3,
+  4,88,188,1,101,10,4,8,185,1,10,61,28,56,8,132,138,4,244,183,12,8,0,187,
+  3,192,60,12,88,3,216,1,170,5,12,33,0,195,3,27,92,4,8,190,2,128,57,4,
+  88,202,1,88,21,0,110,13,7,16,150,35,156,21,0,4,158,21,0,56,51,7,0,19,
+  182,16,0,36,34,17,4,26,49,193,40,4,48,232,1,102,232,4,88,97,15,8,4,26,
+  93,229,43,20,88,138,114,159,23,20,33,162,149,2,112,80,20,88,143,248,2,127,8,4,
+  33,195,2,158,80,4,8,166,1,143,56,4,2,234,8,97,148,34,117,55,148,1,20,49,
+  168,255,4,140,212,4,33,207,3,73,80,4,88,204,2,85,17,4,33,133,2,76,80,20,
+  88,168,172,2,55,24,4,48,122,197,243,241,166,0,0,0,6,1,0,44,26,0,0,43,
+  45,213,3,4,88,84,137,30,4,33,159,2,121,84,4,88,214,2,92,24,4,48,172,1,
+  46,237,28,79,9,140,220,3,240,168,12,88,0,177,4,116,22,4,33,201,2,119,84,0,
+  72,106,84,4,88,244,2,184,11,0,12,61,20,20,33,167,169,2,97,84,28,49,8,94,
+  202,4,67,202,12,33,0,171,4,153,82,4,88,164,3,164,14,4,33,145,2,252,84,4,
+  88,174,3,111,3,0,89,7,35,4,8,83,111,58,0,8,123,58,4,88,222,1,107,25,
+  20,48,162,138,1,111,236,4,88,129,1,111,25,0,44,214,11,12,71,1,198,1,91,215,
+  20,56,115,228,1,176,175,12,71,0,209,1,53,214,4,26,187,1,188,40,8,2,1,176,
+  40,12,88,0,152,1,17,27,0,88,239,26,28,56,1,132,238,3,80,174,110,169,0,0,
+  0,6,1,0,44,88,0,0,19,17,213,3,0,32,2,17,0,41,2,30,0,42,38,17,
+  0,84,198,0,4,83,195,5,163,102,20,88,149,188,5,196,20,20,39,161,121,207,57,4,
+  88,152,2,112,8,20,33,136,157,3,158,88,4,26,154,3,90,38,4,88,122,136,8,0,
+  22,147,22,4,33,229,3,55,92,4,88,196,3,221,31,0,34,177,22,0,26,40,23,0,
+  4,50,23,4,33,171,3,83,92,28,79,1,76,158,7,14,170,28,49,9,154,177,1,223,
+  206,12,88,0,193,1,135,29,34,1,132,29,1,34,1,135,29,1,34,2,130,29,1,34,
+  2,134,29,1,34,2,136,29,1,4,39,204,1,137,27,4,88,46,226,17,4,39,11,138,
+  25,28,56,1,110,138,4,46,179,12,39,0,159,3,206,29,118,171,0,0,0,11,1,0,
+  44,88,0,0,252,252,223,3,4,39,83,118,24,0,11,182,29,4,88,100,128,5,0,1,
+  109,5,4,26,165,1,34,53,4,39,182,1,44,25,8,5,19,61,25,0,12,51,25,8,
+  19,8,44,25,8,5,32,71,25,8,0,1,106,25,0,12,65,25,8,19,203,2,137,27,
+  8,0,206,2,55,25,4,83,183,5,136,100,28,88,2,88,228,5,132,11,12,39,0,21,
+  65,25,34,1,64,25,1,4,88,37,9,34,12,39,5,24,55,29,8,0,40,213,25,0,
+  1,69,25,0,7,211,25,0,1,140,25,8,19,12,213,25,24,9,154,109,220,57,12,58,
+  4,252,1,225,246,12,39,0,121,142,30,16,175,36,244,25,0,10,33,28,34,5,27,28,
+  1,243,171,0,0,0,13,1,0,44,88,0,0,89,11,227,3,12,39,19,181,1,55,29,
+  12,88,0,198,1,192,19,0,18,213,19,28,56,1,81,254,3,228,178,28,83,0,155,207,
+  12,89,112,50,166,57,85,112,1,4,26,150,9,94,55,4,88,208,1,2,1,4,83,203,
+  5,37,100,28,71,9,142,220,7,121,204,12,39,0,253,1,192,23,8,5,100,71,20,8,
+  0,8,21,34,12,26,5,13,56,38,8,0,2,74,38,4,39,78,53,20,4,33,179,5,
+  20,99,12,88,5,134,6,25,3,12,39,0,3,8,14,12,71,4,228,1,81,207,12,39,
+  0,203,1,45,20,0,98,65,25,4,26,153,1,195,41,0,0,239,41,28,56,1,79,184,
+  4,155,173,12,33,5,225,5,185,81,4,26,178,1,252,46,4,33,91,154,74,12,83,0,
+  217,2,107,99,12,26,3,180,4,0,40,28,71,8,98,142,2,83,223,213,171,0,0,0,
+  14,1,0,44,83,0,0,26,103,229,3,4,33,166,3,34,87,4,39,198,2,197,37,4,
+  26,29,238,49,4,39,102,174,27,0,2,171,27,4,88,118,50,1,28,2,8,126,172,6,
+  81,153,12,26,0,159,7,12,40,0,12,117,45,16,198,70,201,50,0,58,155,49,4,39,
+  150,1,138,10,4,26,131,1,163,49,0,8,248,49,0,22,200,49,0,6,230,49,12,33,
+  5,177,2,248,89,12,26,0,202,2,239,49,4,39,106,26,20,4,26,69,6,50,28,56,
+  1,123,166,4,31,182,12,26,0,247,3,255,49,0,36,194,52,4,58,228,1,193,252,4,
+  26,191,1,196,53,0,10,185,53,28,71,8,79,216,2,71,218,12,26,0,183,2,193,53,
+  4,33,129,2,23,88,28,71,1,83,218,5,47,198,12,33,0,175,4,119,82,124,174,0,
+  0,0,14,1,0,44,26,0,0,188,51,229,3,12,33,19,207,1,119,82,0,0,119,82,
+  12,26,0,230,1,10,54,4,33,195,1,240,81,4,26,210,1,94,55,4,39,162,1,195,
+  16,12,33,4,177,2,146,80,28,56,1,97,170,5,25,186,12,33,0,191,9,107,92,0,
+  214,4,154,79,4,26,188,1,239,53,4,39,168,1,98,58,28,71,8,122,252,1,192,200,
+  12,33,0,225,4,255,92,4,39,194,1,28,58,4,26,22,253,52,4,33,149,1,88,78,
+  28,71,8,121,248,3,253,218,12,39,0,199,1,60,58,0,12,40,58,0,5,53,58,0,
+  180,1,68,34,0,30,223,27,0,143,1,149,57,12,2,4,248,8,210,151,28,56,1,106,
+  255,3,33,181,28,71,9,134,113,193,198,12,39,0,161,4,226,70,0,56,201,68,4,5,
+  156,6,202,169,4,33,185,6,188,78,150,175,0,0,0,14,1,0,44,39,0,0,2,56,
+  229,3,0,21,179,60,0,24,53,58,0,60,170,46,0,2,184,46,0,8,183,46,28,5,
+  10,92,220,3,159,187,16,92,34,133,187,28,39,0,143,237,3,64,56,34,22,67,56,1,
+  34,43,71,56,1,28,5,1,92,180,4,55,185,12,39,0,165,2,181,28,28,71,1,91,
+  248,1,92,193,12,33,0,205,4,181,84,28,58,8,114,192,3,111,237,8,0,173,7,216,
+  253,4,39,178,5,11,58,8,5,4,33,58,0,14,200,57,12,33,19,213,1,181,84,12,
+  39,0,148,2,219,49,28,71,1,97,212,3,22,191,12,39,0,197,3,236,49,0,19,168,
+  57,0,162,1,50,28,4,33,253,1,245,78,4,79,208,8,87,157,4,39,151,7,177,57,
+  0,156,1,67,50,0,102,163,30,4,33,255,1,18,82,204,177,0,0,0,16,1,0,44,
+  5,10,0,203,186,233,3,12,33,0,253,5,205,84,0,38,28,83,0,211,14,155,83,28,
+  71,1,110,198,20,83,194,4,5,86,167,186,12,39,0,173,3,124,51,0,5,129,55,0,
+  122,77,51,0,10,49,51,4,33,225,1,194,81,12,39,2,234,2,72,51,28,5,1,99,
+  166,3,128,188,12,39,0,225,2,204,33,4,33,158,2,39,88,4,39,137,2,208,33,28,
+  5,1,107,134,4,34,189,28,39,8,83,149,3,219,51,12,33,0,141,1,93,83,20,39,
+  142,138,2,98,52,28,5,1,97,200,4,151,179,12,2,0,244,3,197,152,28,39,9,122,
+  183,7,217,33,12,33,0,147,2,46,82,4,39,174,1,157,56,4,33,159,1,57,82,0,
+  189,1,236,93,20,5,138,158,8,26,172,34,170,1,42,172,1,28,71,1,126,197,2,98,
+  192,28,83,0,164,243,11,54,111,28,58,8,86,176,10,59,253,233,178,0,0,0,17,1,
+  0,44,39,0,0,218,12,235,3,4,58,78,156,255,20,5,160,248,3,200,171,12,71,19,
+  177,2,98,192,12,33,0,191,4,148,87,4,39,220,3,250,8,0,6,218,8,12,33,19,
+  197,3,39,88,28,71,2,77,232,5,93,197,12,39,0,191,2,72,37,24,8,124,95,152,
+  67,12,58,5,214,2,141,6,28,71,1,51,186,2,133,196,12,33,0,219,7,116,100,4,
+  39,246,4,137,33,4,58,154,1,60,6,24,8,97,134,1,118,224,12,33,0,165,6,170,
+  100,8,4,39,117,100,8,0,158,2,98,88,20,39,150,128,2,201,60,20,58,159,136,2,
+  106,3,4,39,253,1,153,64,28,71,1,89,232,3,225,199,12,39,0,155,2,47,33,4,
+  33,141,3,118,88,8,4,243,1,178,100,8,0,154,3,254,78,34,32,196,78,1,0,171,
+  1,144,89,0,179,1,16,100,28,71,1,107,134,8,69,192,247,180,0,0,0,18,1,0,
+  60,5,12,84,0,171,190,237,3,28,83,0,154,135,18,98,117,0,14,112,117,28,5,1,
+  127,228,18,10,181,28,58,8,75,175,1,44,250,12,39,0,213,1,233,51,12,71,8,176,
+  3,53,203,12,39,0,189,2,98,56,4,33,195,2,16,86,28,71,1,105,240,5,126,192,
+  12,33,0,171,6,157,90,4,39,168,3,202,39,4,33,202,1,52,81,4,39,181,1,145,
+  39,0,50,155,39,0,20,153,39,28,58,8,99,210,2,45,213,12,39,0,149,2,176,32,
+  28,71,1,120,238,2,128,199,28,39,0,162,253,2,157,39,0,70,159,39,0,10,197,39,
+  0,12,185,39,28,58,8,81,204,2,164,218,12,39,5,169,2,150,42,28,33,0,199,217,
+  2,241,89,4,39,218,3,198,32,8,2,4,196,32,8,0,4,186,32,0,165,1,46,67,
+  12,58,5,138,2,123,9,28,71,1,79,250,1,250,201,121,181,0,0,0,18,1,0,44,
+  39,0,0,105,42,237,3,0,121,255,70,28,58,8,99,202,3,200,220,12,33,0,167,4,
+  217,83,0,10,209,83,28,58,8,128,220,4,181,223,12,33,0,193,5,92,97,0,32,113,
+  97,0,162,2,222,83,0,0,210,83,0,192,1,209,86,28,58,8,115,136,5,50,218,8,
+  3,10,53,218,12,33,0,255,4,208,85,4,58,244,3,138,5,4,33,209,3,54,88,8,
+  19,0,54,88,8,0,132,1,212,88,20,5,156,190,8,168,166,4,39,129,6,55,60,28,
+  71,9,121,218,3,60,203,12,33,0,151,6,227,97,28,58,8,115,224,6,25,214,28,5,
+  0,151,188,2,217,171,20,33,162,177,7,94,86,0,6,102,86,4,39,136,3,64,33,28,
+  58,9,140,190,1,164,237,12,33,0,171,4,189,86,4,39,250,1,60,59,0,8,36,60,
+  0,41,189,68,149,183,0,0,0,18,1,0,60,39,0,171,0,24,33,237,3,0,10,7,
+  33,28,58,8,115,224,2,251,215,12,33,0,181,5,116,89,28,71,1,143,142,5,238,199,
+  12,33,0,203,4,143,89,4,39,164,2,68,57,0,134,1,228,28,28,71,1,85,238,2,
+  241,194,12,39,0,209,3,68,62,4,83,205,5,62,107,12,58,8,248,8,51,222,12,5,
+  9,254,1,101,182,12,39,0,229,4,20,62,20,5,157,238,6,139,163,4,39,217,6,33,
+  62,0,136,1,209,41,4,83,209,8,211,111,4,39,146,8,24,62,28,58,8,109,250,2,
+  171,229,12,71,15,148,1,168,204,8,13,117,26,213,12,39,0,167,2,82,62,28,71,9,
+  148,160,4,69,201,12,33,0,241,4,166,81,4,39,158,1,23,58,20,33,135,225,4,212,
+  102,28,39,8,90,228,4,89,61,20,58,125,240,2,37,228,12,39,0,227,2,98,58,8,
+  3,4,89,60,12,33,0,173,1,144,81,19,184,0,0,0,18,1,0,44,33,0,0,134,
+  81,237,3,20,39,160,154,3,178,23,0,141,1,59,59,0,68,73,51,0,35,76,59,8,
+  5,44,73,51,28,5,8,114,188,4,34,187,12,39,4,131,3,80,22,4,71,178,2,48,
+  201,28,58,8,136,53,133,218,16,99,35,171,230,12,71,12,104,92,207,12,33,0,147,4,
+  212,74,16,151,91,221,87,12,58,13,216,4,132,213,12,33,0,141,4,50,86,28,5,8,
+  114,180,9,165,160,12,39,0,201,6,116,58,0,162,1,204,41,22,33,205,155,1,105,88,
+  34,0,108,88,1,12,58,8,200,3,200,248,12,39,0,235,1,180,53,4,58,186,1,107,
+  16,24,9,139,196,1,54,222,12,33,0,155,4,7,81,4,39,230,2,178,37,0,16,167,
+  37,4,33,179,2,231,83,28,71,1,80,194,7,170,209,12,39,0,229,3,12,23,20,33,
+  215,239,2,166,83,217,185,0,0,0,20,1,0,44,33,0,0,168,83,239,3,4,58,228,
+  3,239,8,4,39,11,42,23,12,71,8,226,2,112,200,12,33,0,141,5,90,85,0,58,
+  225,80,12,71,19,234,4,170,209,12,58,0,209,1,10,10,4,33,141,3,206,81,0,76,
+  251,74,16,193,41,215,81,12,71,8,206,5,97,192,28,39,0,149,201,2,84,23,4,33,
+  253,2,119,85,0,32,178,83,4,2,184,10,193,156,4,33,191,9,170,84,0,20,210,84,
+  0,221,2,29,101,28,71,1,110,242,7,48,206,28,5,8,110,152,2,171,179,12,60,0,
+  186,1,66,168,4,33,223,7,201,84,28,71,1,113,250,5,116,203,28,58,8,132,143,1,
+  255,221,16,82,91,98,251,12,60,0,142,4,71,168,28,71,1,131,213,2,184,208,16,67,
+  66,33,210,12,39,3,185,1,201,26,12,60,0,222,4,158,169,4,39,177,4,217,26,215,
+  187,0,0,0,20,1,0,44,33,0,0,51,72,239,3,8,3,113,117,86,8,0,18,125,
+  86,0,153,4,170,107,12,58,4,238,7,244,17,12,33,0,147,7,199,105,12,71,13,224,
+  9,31,206,8,1,0,250,209,12,39,0,229,1,171,33,20,33,193,203,2,129,83,0,187,
+  1,238,96,0,16,200,96,12,71,13,222,6,21,208,12,33,0,199,6,203,96,0,34,244,
+  96,0,61,137,99,28,71,1,97,218,7,41,211,12,58,8,193,1,130,4,12,39,0,113,
+  66,36,8,3,20,88,36,8,0,20,14,36,0,104,204,25,8,19,143,1,66,36,12,76,
+  4,210,2,155,220,12,39,0,183,2,86,52,4,33,135,5,134,102,0,178,2,22,89,0,
+  94,248,85,12,71,13,138,5,180,205,28,57,0,141,144,24,139,134,34,28,137,134,1,28,
+  76,9,151,173,24,144,232,6,190,0,0,0,21,1,0,60,76,8,126,0,12,227,241,3,
+  20,71,105,122,79,203,12,39,0,177,2,135,29,0,207,1,109,68,12,71,1,200,3,123,
+  206,28,76,9,137,29,139,227,12,39,0,155,2,150,50,0,14,151,50,12,33,4,177,1,
+  37,76,8,0,51,201,80,12,39,4,216,2,107,26,28,71,1,107,158,2,9,213,12,39,
+  0,245,1,163,29,12,71,8,134,2,203,206,28,33,0,160,153,4,57,79,12,71,13,180,
+  4,190,205,12,33,0,143,6,33,96,0,32,138,94,4,39,190,4,150,29,4,33,181,2,
+  83,79,4,39,210,2,136,29,4,33,229,6,74,105,0,188,3,12,88,0,113,37,96,0,
+  202,1,155,86,12,76,4,138,5,225,219,12,33,0,179,3,25,73,4,39,230,1,241,24,
+  8,19,0,241,24,28,76,1,107,232,1,82,224,12,33,0,175,6,43,96,8,5,2,33,
+  96,42,189,0,0,0,21,1,0,44,33,0,0,47,96,241,3,8,2,150,2,129,81,8,
+  0,0,126,81,28,71,1,58,230,4,133,206,12,76,13,16,141,214,12,33,0,225,6,40,
+  96,0,248,2,193,72,0,25,2,77,12,71,13,170,4,177,212,12,58,4,147,1,237,5,
+  28,39,0,140,91,208,32,4,60,190,5,116,165,4,39,191,5,210,34,0,8,191,44,0,
+  66,104,42,0,10,112,42,4,33,177,2,126,88,0,62,118,85,4,39,152,3,34,26,4,
+  33,153,3,130,87,4,60,142,9,134,161,4,33,235,8,140,87,28,76,1,80,226,4,0,
+  229,12,39,0,203,1,16,26,12,25,8,128,3,12,193,12,33,0,193,5,148,84,8,19,
+  0,148,84,12,39,3,240,2,28,26,24,0,150,60,21,26,0,6,33,26,4,60,230,5,
+  250,162,20,33,128,193,10,194,99,78,191,0,0,0,21,1,0,44,39,0,0,58,47,241,
+  3,4,33,195,3,50,93,12,76,1,158,6,229,220,16,121,3,47,231,12,33,0,147,7,
+  109,102,4,58,238,6,241,8,4,33,177,3,126,86,8,19,0,126,86,8,0,16,24,89,
+  4,39,176,3,98,35,28,76,10,110,156,2,84,223,12,33,0,223,3,37,72,0,195,1,
+  33,89,12,58,8,214,4,66,243,12,39,0,191,1,14,41,12,76,3,200,2,157,213,24,
+  1,101,6,87,216,12,33,0,179,5,12,89,28,76,8,120,194,5,73,213,24,10,83,12,
+  84,221,12,39,0,147,3,66,65,12,58,1,130,2,179,15,12,76,10,184,1,61,221,12,
+  39,0,211,1,15,28,28,76,8,132,150,2,65,213,8,13,58,98,204,24,12,71,85,92,
+  221,24,1,84,27,4,224,12,33,0,197,3,249,79,12,76,19,150,3,84,221,12,33,0,
+  175,5,108,91,28,88,8,124,190,5,148,255,132,191,0,0,0,21,1,0,44,33,0,0,
+  91,92,241,3,28,76,9,141,210,5,200,227,12,33,0,225,7,108,104,12,88,8,192,7,
+  54,245,4,76,118,132,216,20,25,98,174,1,212,193,12,33,0,251,5,68,87,24,9,115,
+  99,196,94,28,76,8,124,160,6,115,220,12,60,0,190,3,77,165,28,76,1,105,185,3,
+  222,222,12,39,0,201,1,227,35,0,60,93,26,8,19,0,93,26,8,0,14,111,26,12,
+  76,4,146,2,247,213,12,33,0,167,6,189,94,12,76,8,196,6,40,219,8,1,10,221,
+  229,12,39,0,143,1,10,25,12,76,13,194,1,219,216,12,57,0,148,8,22,147,28,76,
+  8,138,243,7,212,210,8,10,31,183,221,12,39,0,173,3,173,66,12,76,1,226,3,55,
+  232,12,33,0,245,3,4,80,28,76,9,135,128,5,213,207,12,39,4,145,2,189,24,28,
+  76,9,141,132,2,237,215,12,33,0,187,3,83,74,28,76,9,135,230,4,223,228,68,194,
+  0,0,0,21,1,0,60,76,1,111,0,62,225,241,3,24,8,120,82,188,210,12,58,0,
+  229,1,11,20,4,39,25,52,30,28,58,9,106,116,191,9,12,76,13,208,1,119,224,12,
+  39,0,231,1,79,21,0,79,65,44,0,76,122,30,0,20,134,30,28,76,9,154,132,3,
+  234,226,12,39,0,213,2,119,30,0,4,121,30,0,23,127,36,8,5,113,251,70,28,76,
+  1,125,178,3,132,224,28,78,8,107,128,2,190,181,12,39,0,185,4,93,56,0,116,254,
+  29,0,18,198,26,12,60,4,138,5,64,165,12,76,10,241,2,224,227,8,14,14,191,227,
+  12,39,0,145,2,245,29,4,33,255,2,90,87,4,39,128,3,177,31,4,33,233,2,241,
+  86,12,76,19,252,4,191,227,8,1,44,82,232,12,33,0,191,4,3,87,0,207,1,58,
+  98,20,39,153,232,4,110,35,203,194,0,0,0,21,1,0,44,39,19,0,110,35,241,3,
+  12,33,0,233,2,102,87,4,39,184,3,158,35,28,76,1,136,172,1,211,229,20,88,90,
+  37,151,238,16,85,151,1,165,234,12,51,0,151,1,137,61,4,33,223,1,58,87,0,22,
+  45,87,0,8,58,87,12,39,19,65,79,21,28,88,10,85,250,4,93,236,12,51,0,239,
+  1,79,51,28,76,1,94,218,2,174,231,12,60,0,212,3,13,166,4,58,211,4,222,18,
+  4,39,79,161,31,4,33,203,2,53,87,28,76,10,95,230,4,0,233,12,39,0,169,1,
+  164,33,28,76,9,152,234,2,219,217,12,33,0,139,7,58,97,0,6,54,97,12,39,5,
+  228,4,183,33,12,76,8,234,2,210,212,28,72,1,115,59,230,238,28,76,8,94,138,1,
+  161,220,12,39,0,171,1,83,22,0,25,100,33,28,76,9,138,176,2,0,223,28,60,0,
+  165,242,4,252,165,28,72,1,142,235,3,228,238,116,196,0,0,0,21,1,0,44,39,0,
+  0,41,39,241,3,28,58,1,71,200,1,65,9,28,76,8,108,248,2,255,209,12,39,0,
+  213,2,19,21,12,33,5,249,3,191,94,12,76,19,208,6,255,209,24,8,122,39,189,219,
+  12,72,1,4,74,237,12,51,0,129,2,201,48,4,39,74,146,32,28,76,8,127,140,2,
+  157,222,12,33,0,207,8,13,106,28,76,9,132,142,9,67,220,24,1,110,4,253,231,12,
+  51,0,143,2,178,56,28,76,1,105,162,2,127,231,12,33,4,143,5,104,92,28,72,1,
+  114,202,5,53,241,12,33,0,215,5,183,96,0,103,213,101,28,76,8,122,146,8,21,209,
+  12,60,0,168,6,206,151,4,33,203,14,20,104,34,240,10,165,104,1,12,72,3,189,3,
+  148,247,28,76,8,87,172,1,1,222,12,51,0,179,2,113,48,4,39,82,141,32,8,1,
+  6,142,33,8,0,56,149,32,8,19,0,149,32,12,51,0,37,154,45,247,197,0,0,0,
+  22,1,0,44,51,0,0,245,56,243,3,28,72,1,103,146,2,79,244,12,51,0,187,1,
+  177,43,8,4,22,197,47,12,33,0,241,2,177,96,8,19,0,177,96,12,39,4,214,4,
+  145,31,12,33,6,203,2,44,85,42,0,2,44,85,1,34,3,44,85,1,4,51,224,2,
+  146,37,8,3,109,20,61,12,60,0,168,6,103,167,4,39,211,4,23,36,4,51,101,248,
+  56,4,33,133,3,58,95,0,40,114,95,8,19,137,2,177,96,8,0,130,2,123,95,4,
+  39,182,4,189,31,28,76,8,116,190,2,19,210,12,72,1,199,2,39,249,16,119,238,1,
+  42,247,28,60,0,130,228,4,80,163,34,184,2,204,163,1,4,51,233,8,220,56,0,14,
+  21,57,4,33,249,1,211,84,4,51,172,2,156,51,4,33,145,4,76,100,8,19,0,76,
+  100,8,0,140,3,34,79,105,199,0,0,0,25,1,0,44,51,5,0,142,49,249,3,8,
+  4,11,128,52,28,72,1,114,214,2,168,242,28,51,0,160,235,1,105,57,4,33,239,1,
+  98,84,4,39,214,3,73,36,12,76,1,130,2,196,219,28,60,0,145,232,2,123,174,4,
+  51,157,4,232,45,4,33,133,2,67,86,20,51,156,214,2,0,65,16,138,32,200,64,28,
+  72,1,117,186,2,153,248,16,83,32,21,247,12,60,0,138,4,43,166,20,78,161,133,1,
+  118,179,16,154,20,152,179,28,3,1,92,133,3,173,14,12,51,0,67,43,38,20,33,158,
+  139,1,199,67,28,72,8,112,242,2,159,243,12,51,0,213,1,76,48,12,33,4,189,3,
+  229,94,28,76,8,102,200,6,167,212,24,1,100,43,178,227,24,8,128,48,183,223,12,60,
+  0,196,4,251,161,0,150,1,117,158,28,51,9,113,227,6,249,46,28,60,0,145,148,5,
+  219,173,0,130,2,181,163,12,76,8,247,2,231,203,24,202,0,0,0,25,1,0,44,3,
+  1,0,213,14,249,3,12,78,0,214,3,102,179,12,25,14,25,137,203,0,4,142,203,12,
+  3,1,139,2,64,243,12,25,10,160,2,113,203,12,60,0,130,4,254,157,12,51,3,173,
+  7,67,61,12,33,0,73,126,74,4,60,250,6,139,167,0,96,231,162,12,3,1,217,4,
+  83,255,12,60,0,240,4,243,162,12,76,1,215,3,159,229,28,3,13,108,83,133,16,12,
+  60,0,202,4,185,168,4,51,249,4,235,40,28,3,9,140,162,1,92,255,20,33,159,171,
+  2,237,68,12,51,1,184,1,163,41,28,60,0,108,254,5,47,165,34,93,93,165,1,12,
+  51,6,255,4,245,57,12,60,0,148,6,222,167,4,33,211,10,126,103,12,87,4,130,6,
+  187,30,28,3,8,149,130,1,180,2,12,33,0,167,3,37,84,28,3,9,144,228,3,122,
+  247,28,60,8,88,194,3,178,170,24,0,135,48,222,174,4,78,4,250,183,14,204,0,0,
+  0,26,1,0,60,3,1,100,0,17,6,251,3,16,131,82,177,6,12,33,0,203,2,61,
+  79,20,78,141,162,6,235,175,4,33,245,4,153,71,28,3,8,123,130,3,119,1,28,78,
+  0,162,226,2,245,183,4,33,221,6,237,90,8,19,0,237,90,28,30,0,168,242,1,112,
+  72,28,51,9,154,130,2,113,43,8,4,95,229,65,8,3,138,1,167,53,12,25,0,198,
+  3,209,198,20,60,142,166,1,245,169,16,144,22,247,169,16,150,4,229,169,28,3,9,152,
+  241,2,39,252,8,1,50,232,6,4,76,102,224,232,4,3,40,172,254,28,60,0,145,144,
+  6,46,165,34,19,110,165,1,8,19,143,10,178,170,28,3,9,148,176,5,187,253,28,51,
+  8,109,165,1,238,42,12,78,0,186,4,173,176,28,3,9,139,143,3,77,9,28,60,0,
+  143,244,3,200,170,4,30,139,5,114,65,4,60,252,6,174,162,34,5,171,162,1,241,205,
+  0,0,0,28,1,0,44,3,19,0,187,253,255,3,12,33,0,171,5,103,104,0,224,3,
+  237,85,4,78,202,7,217,177,4,33,153,7,251,90,28,3,9,130,184,4,39,2,28,51,
+  1,120,187,1,184,53,8,0,6,88,61,12,87,1,208,1,125,31,12,76,0,184,3,167,
+  200,12,3,1,153,1,0,5,12,33,0,185,3,245,86,12,76,4,170,5,127,219,12,30,
+  0,195,3,68,76,4,78,238,5,125,176,12,87,1,213,3,193,35,12,30,0,44,84,77,
+  28,87,1,113,144,2,209,28,28,3,9,139,62,77,14,16,145,28,31,13,12,76,0,216,
+  3,151,202,0,28,217,195,28,3,9,145,229,1,21,8,28,60,0,151,212,6,140,155,28,
+  76,8,90,227,2,247,211,28,60,0,137,198,2,149,172,28,30,1,93,187,4,249,65,12,
+  78,0,226,5,73,177,12,87,9,201,3,215,38,28,3,0,167,210,1,81,241,12,87,13,
+  175,1,14,38,12,76,0,172,2,156,215,80,209,0,0,0,28,1,0,44,33,5,0,184,
+  88,255,3,28,76,9,118,214,4,223,235,28,30,1,98,241,1,39,57,12,87,10,106,214,
+  32,12,3,0,176,1,72,246,20,76,106,52,242,234,28,87,12,96,163,1,35,33,12,30,
+  0,48,204,79,12,33,5,161,1,32,91,28,30,9,119,136,2,219,71,12,87,1,244,2,
+  44,30,4,3,128,1,61,11,12,33,0,161,2,51,85,28,87,1,104,224,2,218,32,12,
+  33,0,147,2,46,85,12,30,1,28,130,84,24,9,146,138,1,162,69,24,1,103,222,1,
+  211,41,12,76,0,212,1,32,238,0,12,245,237,12,3,1,139,1,163,16,28,75,8,86,
+  58,181,26,8,19,0,181,26,12,3,1,136,1,59,17,12,76,0,232,1,194,210,28,30,
+  9,156,253,1,168,41,12,3,1,98,77,17,12,60,0,228,4,59,163,12,78,7,167,1,
+  15,189,58,0,147,0,15,189,1,50,168,10,19,189,1,34,13,10,189,1,126,213,0,0,
+  0,31,1,0,46,78,0,0,6,189,135,4,28,30,1,167,145,3,2,46,8,12,14,248,
+  42,12,78,0,176,4,59,176,4,76,188,2,213,198,20,78,156,249,1,0,178,16,142,6,
+  85,187,34,204,1,196,187,1,50,173,13,196,187,1,28,3,9,151,199,3,117,2,20,87,
+  99,95,80,32,28,78,0,148,166,4,171,178,0,108,206,175,12,30,1,173,5,212,79,8,
+  11,228,1,174,47,12,3,1,108,3,16,8,4,76,162,0,28,60,0,160,196,3,27,169,
+  20,78,136,131,1,53,187,34,111,16,187,1,34,54,208,186,1,50,137,148,1,111,187,1,
+  34,246,1,193,186,1,34,16,88,187,1,0,207,1,205,175,12,3,4,217,2,242,250,28,
+  76,8,108,88,211,224,12,14,0,11,36,243,28,30,1,101,183,1,205,62,12,78,0,214,
+  4,23,178,16,117,53,50,187,4,33,195,6,48,94,37,215,0,0,0,39,1,0,60,78,
+  0,143,0,84,187,149,4,28,30,1,77,253,2,226,50,28,60,0,141,228,7,91,155,12,
+  75,1,243,6,3,30,12,30,13,30,101,54,28,78,0,143,130,4,90,190,34,115,96,190,
+  1,20,60,140,198,4,58,155,34,255,4,2,155,1,16,151,154,5,60,155,20,76,149,173,
+  3,173,192,34,25,67,192,1,28,75,9,150,157,2,17,24,28,60,0,158,184,6,57,155,
+  28,30,9,164,145,6,53,53,28,87,1,166,96,172,37,20,30,105,53,246,50,24,9,134,
+  85,19,66,12,87,19,140,1,172,37,28,75,9,139,72,110,28,28,78,0,143,160,3,234,
+  180,12,30,11,215,3,140,54,12,78,0,234,4,67,179,20,76,165,53,71,192,28,31,9,
+  130,157,2,17,18,12,75,4,164,1,161,25,28,78,0,140,224,2,101,187,28,30,9,148,
+  145,3,120,43,8,1,12,115,71,8,3,138,1,147,43,12,14,0,142,2,146,238,0,10,
+  108,238,170,217,0,0,0,42,1,0,44,78,0,0,70,184,155,4,4,3,251,1,89,252,
+  0,70,37,9,20,76,134,192,1,235,193,34,133,1,10,193,1,50,161,10,156,193,1,4,
+  14,58,132,228,12,87,1,175,1,156,36,28,31,9,136,52,152,28,8,0,108,42,9,20,
+  14,138,140,1,184,220,0,4,186,220,20,43,144,228,1,31,189,28,30,1,99,149,3,255,
+  57,12,33,0,195,2,230,94,4,14,146,5,134,229,28,30,1,91,135,2,196,54,8,14,
+  68,107,60,12,3,0,150,2,160,251,4,30,255,2,250,82,4,31,230,2,132,11,4,43,
+  172,2,124,188,4,53,78,30,193,4,57,226,8,57,142,4,87,255,10,149,36,4,3,126,
+  226,252,20,53,146,162,1,39,212,4,14,152,1,197,219,20,53,138,92,132,210,20,3,164,
+  111,30,253,4,31,41,26,14,34,1,15,14,1,44,219,0,0,0,45,1,0,44,31,0,
+  0,30,14,161,4,4,3,48,26,253,4,31,35,11,14,4,14,66,213,239,4,60,128,6,
+  77,151,28,31,2,141,133,6,130,10,24,8,122,50,136,10,28,43,0,146,250,2,228,181,
+  4,14,217,1,12,220,20,43,163,130,2,216,181,12,87,1,241,2,152,31,20,18,103,163,
+  2,70,86,20,87,88,140,2,57,40,12,3,0,178,1,110,249,20,43,146,128,3,197,178,
+  20,60,138,230,2,58,158,4,31,175,4,243,9,34,19,209,9,1,4,4,76,238,248,4,
+  30,249,2,141,85,4,53,198,4,204,209,4,43,202,1,30,180,4,18,249,5,41,92,12,
+  31,1,162,4,164,23,28,18,0,132,223,2,4,94,8,19,0,4,94,8,4,48,136,93,
+  12,31,0,188,4,144,4,0,22,177,3,0,35,203,17,0,82,172,3,20,53,139,228,2,
+  246,201,182,221,0,0,0,46,1,0,44,4,0,0,157,0,163,4,12,30,15,105,131,43,
+  12,4,0,110,132,0,16,146,14,117,0,8,3,0,186,0,24,0,155,8,110,0,0,5,
+  176,0,8,3,10,134,0,24,0,153,10,150,0,0,88,28,244,20,31,160,5,2,11,20,
+  43,152,208,2,161,186,4,31,251,1,135,8,0,54,20,14,12,4,2,192,1,158,247,12,
+  30,15,91,68,45,12,4,0,124,202,247,8,19,0,202,247,8,0,4,212,247,0,10,225,
+  247,12,30,15,193,1,140,45,12,4,2,214,1,179,247,24,8,115,60,44,238,28,43,0,
+  164,220,2,62,182,4,53,51,114,193,20,43,152,106,59,182,4,4,143,9,53,240,34,3,
+  52,240,1,4,14,150,8,152,229,4,43,152,1,215,186,4,31,213,1,242,14,12,30,1,
+  155,1,87,64,254,223,0,0,0,47,1,0,44,43,0,0,251,176,165,4,44,30,15,203,
+  2,37,45,2,12,14,0,219,1,198,219,28,4,4,114,202,3,8,238,12,30,15,157,1,
+  108,44,8,13,61,172,64,24,12,125,14,121,63,28,53,0,181,196,3,34,216,0,34,24,
+  216,12,30,11,247,1,84,63,12,4,0,168,1,185,255,4,43,240,1,69,186,4,31,149,
+  2,82,25,4,43,176,2,39,186,12,4,4,189,1,174,237,28,31,8,130,41,6,23,28,
+  43,0,145,234,2,67,181,28,30,9,132,191,3,146,77,20,4,105,202,2,215,239,8,0,
+  44,116,238,12,30,1,129,2,89,67,12,53,0,194,3,68,192,4,30,163,2,133,42,20,
+  43,148,136,3,231,188,4,34,203,1,60,16,4,14,150,1,199,219,8,5,6,193,219,24,
+  6,193,8,214,219,8,0,89,72,221,20,60,140,190,3,242,164,8,19,0,242,164,12,43,
+  0,159,1,226,185,73,224,0,0,0,47,1,0,44,18,10,0,243,96,163,4,12,30,1,
+  156,3,0,59,12,31,0,150,1,60,23,28,30,9,134,133,1,14,68,16,110,66,17,60,
+  12,31,0,107,68,26,20,43,143,164,4,233,185,4,14,57,222,226,28,30,1,116,237,2,
+  91,72,12,60,0,232,5,226,158,4,61,141,4,131,21,0,4,140,21,12,14,5,102,25,
+  223,42,0,0,25,223,1,34,2,24,223,1,12,61,1,51,222,21,4,30,50,248,47,12,
+  43,0,140,3,216,188,28,30,1,101,137,3,226,64,12,34,0,226,1,156,12,20,43,136,
+  170,2,56,187,4,61,253,1,78,19,0,28,97,19,28,30,1,145,81,112,60,12,34,3,
+  152,1,105,6,8,0,10,8,4,4,4,138,1,211,254,28,30,9,146,199,1,213,65,28,
+  43,0,132,176,3,240,186,12,30,1,223,2,115,51,12,4,0,174,3,130,243,20,87,156,
+  119,157,37,193,227,0,0,0,49,1,0,44,61,0,0,213,32,167,4,12,30,4,35,182,
+  55,12,18,1,109,215,81,28,61,0,156,238,1,140,26,4,53,132,2,157,195,12,30,1,
+  153,2,70,72,28,60,0,148,242,3,166,170,4,53,133,1,175,195,4,38,142,1,57,186,
+  28,30,1,108,233,2,245,65,16,95,82,228,51,28,43,0,152,170,3,244,180,4,4,211,
+  1,13,246,34,22,4,246,1,12,61,5,65,43,20,28,30,1,122,167,1,71,68,12,61,
+  0,196,1,84,17,4,4,142,1,168,253,20,38,148,212,1,185,194,50,149,124,16,195,1,
+  12,30,13,211,3,38,68,28,38,0,153,232,2,161,194,34,15,143,194,1,4,14,89,169,
+  239,4,61,18,129,9,4,38,174,1,20,201,28,18,9,160,213,3,114,89,28,4,0,162,
+  200,2,111,3,28,61,8,88,1,78,17,28,38,0,141,238,1,84,193,20,61,148,231,1,
+  255,37,0,124,139,3,53,229,0,0,0,52,1,0,60,30,1,97,0,6,67,173,4,28,
+  43,0,135,204,4,30,165,12,61,1,163,2,230,24,8,0,11,92,9,28,30,1,109,177,
+  1,99,73,12,38,0,246,2,243,197,12,4,4,107,117,255,24,8,88,6,212,254,28,43,
+  0,136,148,2,105,178,4,38,213,1,223,203,28,30,1,71,211,1,227,68,0,234,1,95,
+  65,28,61,9,159,230,1,48,18,12,57,0,136,11,12,140,20,43,141,243,7,28,165,34,
+  229,1,124,164,1,20,38,142,128,1,128,195,34,38,150,195,1,20,57,139,204,2,46,149,
+  28,14,8,96,227,2,9,223,12,61,2,113,187,12,8,0,42,160,12,0,16,241,8,4,
+  14,10,10,224,0,18,28,224,0,148,1,224,240,4,43,84,13,181,4,38,13,77,192,4,
+  4,49,117,246,4,65,6,3,207,0,22,106,207,12,4,19,27,117,246,140,231,0,0,0,
+  54,1,0,44,61,0,0,224,17,177,4,8,19,0,224,17,28,30,2,55,65,238,60,12,
+  65,0,174,1,242,219,4,30,87,43,41,4,38,156,2,35,187,0,34,59,187,2,10,217,
+  189,34,1,216,189,1,4,4,153,1,185,246,0,28,218,250,12,14,3,84,113,243,12,43,
+  0,198,3,249,155,16,147,243,1,22,184,16,149,106,168,169,16,149,4,206,169,12,30,1,
+  253,3,178,77,16,122,24,100,76,28,18,12,140,89,6,94,28,65,0,164,230,3,75,206,
+  4,14,65,65,237,4,61,27,145,14,12,18,4,129,2,26,94,4,14,152,3,141,237,28,
+  65,0,158,76,102,206,12,14,3,3,58,239,12,61,0,137,1,132,31,0,74,204,17,28,
+  18,9,158,133,2,185,90,28,43,0,160,172,4,248,176,8,19,0,248,176,28,18,1,118,
+  133,5,139,93,177,232,0,0,0,56,1,0,44,61,4,0,154,42,179,4,28,38,0,132,
+  220,2,96,187,16,137,56,231,187,4,61,139,1,74,4,0,16,94,4,8,3,16,193,4,
+  8,0,4,178,4,12,30,4,161,1,195,70,12,43,0,168,3,245,183,4,65,97,88,214,
+  0,54,171,214,16,148,70,125,206,20,43,143,74,146,185,20,61,152,145,1,47,4,4,65,
+  218,1,242,219,12,14,4,46,131,239,12,61,0,93,74,19,28,18,1,86,249,1,8,89,
+  12,61,4,172,2,38,4,12,38,0,244,1,105,194,34,86,165,194,1,4,65,113,168,210,
+  4,4,139,2,241,1,16,160,148,2,132,232,20,38,143,102,75,194,4,4,3,248,220,20,
+  43,144,146,1,105,182,4,38,64,42,188,4,4,125,70,248,0,35,33,237,20,65,161,90,
+  173,210,0,2,135,210,11,235,0,0,0,57,1,0,60,65,0,146,0,128,210,181,4,12,
+  30,1,185,2,242,77,12,65,0,188,2,129,210,4,61,131,1,58,25,4,65,158,1,26,
+  205,20,43,159,218,1,234,164,4,4,227,1,199,226,0,53,54,253,0,12,224,252,0,46,
+  25,229,16,137,28,103,226,16,155,26,227,226,12,61,4,169,1,227,49,12,65,0,150,1,
+  89,209,4,4,68,27,227,0,19,208,0,4,61,13,237,15,4,43,214,2,20,164,16,137,
+  1,136,164,12,61,1,219,2,93,15,8,0,46,249,17,0,1,2,18,20,43,140,220,1,
+  185,184,4,45,139,2,101,58,4,4,206,1,20,255,20,81,157,168,2,250,163,4,38,121,
+  230,184,4,65,55,138,211,8,2,18,154,211,8,0,0,174,211,8,5,16,215,211,42,0,
+  0,215,211,1,230,235,0,0,0,58,1,0,46,65,0,0,214,211,185,4,4,81,150,1,
+  78,174,34,93,71,174,1,4,61,169,1,223,23,0,8,217,23,20,65,159,240,1,175,214,
+  28,45,1,102,169,2,28,66,12,61,4,114,142,38,12,4,0,1,127,244,12,61,6,60,
+  141,14,28,38,0,146,206,1,236,188,20,65,166,13,115,216,4,4,49,186,0,4,43,238,
+  2,90,158,20,61,144,173,3,153,44,4,4,212,1,78,232,20,81,156,140,2,198,163,4,
+  4,147,1,91,223,20,65,146,23,137,212,4,4,35,255,2,4,45,63,85,58,4,61,130,
+  1,201,36,4,65,140,1,208,218,28,18,1,121,243,1,201,78,12,45,0,98,18,55,0,
+  26,10,55,4,65,204,1,54,214,4,4,16,184,231,4,45,155,1,119,64,20,38,143,156,
+  2,203,190,34,175,1,187,190,1,34,198,1,228,190,1,122,237,0,0,0,62,1,0,60,
+  38,0,153,0,204,190,191,4,28,18,1,102,179,2,115,81,8,19,0,115,81,28,61,0,
+  168,212,1,177,19,0,2,175,19,8,4,52,7,32,12,4,0,29,208,248,4,45,32,5,
+  53,4,61,42,90,27,12,45,5,13,12,53,24,1,89,47,247,70,12,61,0,118,109,23,
+  28,45,1,117,113,73,77,12,4,0,230,1,219,233,0,1,64,222,20,45,149,71,154,57,
+  4,38,200,2,154,177,20,45,151,201,1,176,57,4,4,196,1,145,233,16,146,28,231,220,
+  12,61,5,115,205,41,42,0,1,206,41,1,34,4,203,41,1,4,4,154,2,22,225,0,
+  50,230,233,8,19,49,22,225,8,0,2,36,250,4,65,32,176,215,0,12,210,214,12,4,
+  19,43,36,250,28,18,1,109,227,1,143,82,12,65,0,178,2,249,209,137,238,0,0,0,
+  64,1,0,44,45,0,0,178,51,195,4,0,42,192,51,0,22,127,51,4,4,138,1,53,
+  250,4,65,34,21,208,8,5,122,161,211,12,4,0,8,70,237,4,61,181,1,21,46,0,
+  16,8,46,0,52,151,23,4,45,33,124,51,0,2,97,51,4,61,10,37,46,4,45,3,
+  83,51,4,65,176,1,181,211,4,81,200,1,110,170,20,65,163,105,6,206,4,61,67,247,
+  22,12,18,1,101,59,82,12,45,0,50,86,57,4,61,242,1,217,24,4,4,4,171,220,
+  0,4,172,220,4,61,71,97,41,28,4,5,172,88,109,224,42,0,0,108,224,1,34,0,
+  109,224,1,0,51,230,251,4,65,100,141,205,4,61,81,99,24,0,4,222,23,0,3,21,
+  43,240,239,0,0,0,66,1,0,60,4,9,98,0,94,226,199,4,12,65,0,226,1,225,
+  219,28,45,1,122,243,2,93,74,8,19,0,93,74,12,38,0,156,2,52,202,4,4,29,
+  210,235,4,38,66,58,202,4,4,51,22,236,0,37,2,231,0,166,1,235,235,4,61,77,
+  6,44,8,4,18,15,44,8,0,46,168,16,4,65,94,64,217,4,38,54,201,197,4,4,
+  60,155,237,0,15,69,241,16,167,24,6,224,4,61,45,236,7,0,42,70,8,4,65,88,
+  225,218,16,156,22,244,218,4,61,21,127,49,0,36,231,28,16,161,5,71,48,8,5,8,
+  78,48,42,0,0,78,48,1,34,2,78,48,1,16,160,8,82,48,16,151,0,72,48,34,
+  26,85,48,1,0,10,192,30,102,241,0,0,0,69,1,0,44,38,0,0,13,203,205,4,
+  4,61,87,58,27,0,10,59,27,8,3,17,225,48,0,6,245,48,24,0,186,27,18,49,
+  16,156,84,250,14,20,81,138,136,2,116,161,4,45,185,2,210,54,20,61,120,12,242,48,
+  0,30,216,33,24,2,176,19,250,48,12,38,19,62,13,203,28,61,0,158,49,254,48,0,
+  4,10,49,0,8,227,48,8,3,6,242,48,8,0,24,212,33,0,3,240,48,4,4,124,
+  196,223,4,61,79,124,50,16,160,38,117,48,4,4,88,22,250,4,61,77,140,50,0,76,
+  195,15,0,32,175,15,0,62,239,16,20,4,170,58,0,225,12,61,3,39,19,17,12,4,
+  0,58,174,249,12,18,4,155,1,160,81,12,61,0,226,1,228,16,214,241,0,0,0,69,
+  1,0,60,18,9,147,0,40,87,205,4,12,38,0,162,2,146,203,4,61,133,1,172,43,
+  0,32,233,42,4,81,164,2,99,163,4,4,71,80,222,4,61,113,231,5,20,65,150,113,
+  65,213,4,61,138,1,97,12,0,43,91,48,4,4,98,197,255,0,68,160,227,4,61,65,
+  85,15,0,12,48,5,4,38,88,13,200,4,61,121,219,48,0,130,1,186,15,4,4,40,
+  91,240,4,61,25,212,15,0,50,145,4,0,27,112,15,34,1,117,15,1,0,48,252,29,
+  0,70,47,5,20,4,153,46,69,224,0,0,50,239,4,45,21,58,57,28,18,12,97,17,
+  173,82,12,4,0,252,1,243,227,4,38,24,149,203,4,61,71,111,16,8,2,10,86,16,
+  138,243,0,0,0,70,1,0,44,61,0,0,130,16,207,4,0,12,163,16,0,24,141,16,
+  8,2,4,168,16,8,0,7,115,16,0,6,102,16,4,66,26,206,253,20,4,144,110,177,
+  226,0,15,25,248,12,45,1,137,1,54,74,8,0,84,191,52,4,66,120,142,1,0,38,
+  156,1,0,4,181,1,20,4,170,15,210,242,4,38,154,1,130,191,4,66,123,160,1,0,
+  8,161,1,8,2,4,28,2,12,38,0,108,22,200,4,61,121,233,17,4,4,88,165,246,
+  4,61,51,178,45,20,81,179,236,1,106,165,4,61,195,1,190,28,20,38,143,110,152,199,
+  4,61,37,200,28,20,38,139,106,91,195,34,128,1,32,195,1,4,61,191,1,205,18,0,
+  32,215,18,0,45,209,28,145,244,0,0,0,71,1,0,44,4,0,0,47,248,209,4,4,
+  81,194,1,129,163,20,38,139,109,86,203,34,8,180,203,1,28,18,1,155,215,1,126,86,
+  12,61,0,110,99,42,20,38,144,126,227,202,4,66,63,150,5,12,18,1,97,52,81,28,
+  38,0,129,198,1,151,197,4,4,3,109,240,4,45,111,182,51,4,61,102,25,12,4,66,
+  16,130,254,12,18,1,119,75,85,12,61,0,134,1,130,12,0,14,54,37,16,173,36,174,
+  18,0,15,53,37,4,66,46,81,254,4,61,41,45,37,8,5,4,49,37,58,0,175,1,
+  49,37,1,34,2,49,37,1,0,20,89,20,12,16,1,75,61,77,12,61,0,76,145,41,
+  4,0,34,235,50,4,4,167,1,129,245,4,61,250,1,29,22,4,4,64,201,237,0,0,
+  191,237,57,245,0,0,0,74,1,0,44,0,0,0,158,55,215,4,0,10,149,55,12,4,
+  4,86,7,241,12,61,0,33,186,22,4,0,39,172,55,20,4,168,108,161,237,4,61,11,
+  11,12,4,66,10,152,9,12,4,4,58,246,246,12,61,0,27,79,23,4,66,39,99,10,
+  4,38,136,1,186,199,20,61,144,105,223,42,4,66,44,126,2,8,5,43,154,9,8,0,
+  64,56,3,4,61,8,41,22,4,38,90,237,197,4,61,83,187,22,0,4,184,22,0,10,
+  180,22,16,169,4,121,38,0,36,31,22,0,48,158,23,16,148,26,159,12,4,38,180,1,
+  187,184,12,4,4,121,108,223,12,66,0,158,1,90,4,4,61,153,1,229,42,0,12,138,
+  28,8,5,10,143,28,12,38,0,92,180,194,42,246,0,0,0,74,1,0,44,66,0,0,
+  111,4,215,4,0,24,171,3,20,61,134,0,134,17,4,66,26,160,3,12,4,4,58,164,
+  227,12,66,19,19,90,4,8,0,16,11,5,4,70,116,105,204,4,61,91,130,48,8,4,
+  12,128,48,8,0,58,19,40,4,66,88,86,1,4,61,23,181,32,0,11,11,46,4,4,
+  62,132,247,24,8,130,32,204,233,12,66,2,6,75,1,12,4,0,42,88,221,4,61,1,
+  34,17,20,38,164,76,61,194,34,236,1,189,193,1,4,61,173,2,218,25,4,4,80,67,
+  221,4,66,38,200,10,4,61,12,169,15,4,66,2,203,10,12,4,4,17,22,225,12,66,
+  0,36,195,10,12,61,2,1,118,20,8,0,28,99,19,4,66,62,238,252,4,70,40,105,
+  215,111,247,0,0,0,75,1,0,44,61,0,0,103,18,217,4,16,190,50,199,20,28,18,
+  1,104,117,37,86,12,61,0,124,134,19,0,7,68,44,4,70,82,172,215,20,61,156,73,
+  156,49,0,34,8,18,0,6,204,28,4,66,32,3,253,0,0,254,8,4,61,1,82,15,
+  12,4,4,50,41,222,12,66,0,13,138,253,12,4,2,184,1,112,223,12,61,0,185,1,
+  228,19,4,66,18,138,253,12,61,5,7,241,19,12,4,4,32,227,242,12,61,0,29,106,
+  35,0,58,141,14,0,25,202,12,4,66,12,12,252,20,38,138,56,254,193,4,66,39,31,
+  252,0,0,28,253,0,8,42,252,20,61,162,21,81,19,16,159,0,24,19,4,66,34,102,
+  6,12,18,12,85,123,87,28,61,0,154,78,175,33,238,247,0,0,0,75,1,0,44,61,
+  0,0,175,22,217,4,4,66,12,115,6,4,61,3,35,15,0,9,73,40,4,66,34,223,
+  252,4,38,52,50,201,4,66,39,178,252,4,61,1,252,26,0,10,245,35,0,10,21,27,
+  0,1,248,26,0,10,172,22,20,38,131,74,112,195,4,61,57,23,27,4,66,12,158,252,
+  12,61,4,15,225,17,12,66,0,22,157,252,34,1,155,252,1,0,5,138,9,4,61,1,
+  232,26,8,5,12,232,18,42,0,0,233,18,1,34,0,231,18,1,12,66,3,12,101,6,
+  8,2,6,111,6,8,0,0,131,9,34,6,118,9,1,20,61,153,9,196,18,12,66,2,
+  8,115,10,8,4,30,235,255,8,0,26,175,252,4,61,41,139,22,64,248,0,0,0,79,
+  1,0,44,61,0,0,215,34,225,4,0,30,170,12,16,157,0,45,19,0,160,1,148,26,
+  0,149,1,73,26,4,4,35,126,224,12,61,19,3,215,34,12,66,0,86,13,8,4,4,
+  2,71,249,4,66,7,122,10,12,61,5,5,154,26,42,0,1,153,26,1,34,2,155,26,
+  1,0,40,106,13,0,3,234,19,12,66,19,133,2,115,6,28,38,0,131,204,2,190,195,
+  4,66,45,127,10,4,61,0,106,13,20,4,212,14,99,249,4,61,9,53,12,16,146,6,
+  196,13,0,1,171,26,20,66,195,26,95,0,20,38,163,60,238,195,4,66,57,94,9,12,
+  4,6,8,184,249,58,0,175,0,184,249,1,50,161,2,184,249,1,34,1,183,249,1,4,
+  61,37,36,16,0,26,165,14,159,248,0,0,0,84,1,0,44,61,0,0,32,14,235,4,
+  4,4,117,43,246,12,61,19,118,148,26,8,0,6,170,26,20,38,139,72,231,195,4,4,
+  41,56,245,4,61,9,34,13,0,3,152,26,20,66,165,18,89,0,0,97,145,10,8,19,
+  2,127,10,12,4,0,110,239,243,12,61,3,9,33,16,8,0,26,224,11,8,5,22,133,
+  13,8,0,16,124,14,4,66,5,120,11,4,61,12,50,12,12,66,4,10,72,0,0,0,
+  72,0,12,61,0,4,242,11,8,19,19,124,14,8,0,42,157,11,4,0,31,242,60,4,
+  61,42,172,11,0,13,114,34,0,28,230,11,4,81,112,168,167,4,61,103,241,11,0,9,
+  217,38,16,145,10,127,24,0,20,176,11,86,249,0,0,0,84,1,0,44,61,0,0,234,
+  16,235,4,0,145,1,213,36,4,66,38,255,1,4,61,5,54,16,0,16,176,11,4,38,
+  52,150,195,4,43,96,201,159,4,61,123,164,12,12,16,11,85,14,87,12,70,0,164,1,
+  92,214,4,57,228,2,130,139,12,61,5,227,2,29,16,8,0,22,45,16,4,0,61,23,
+  58,12,61,19,36,234,16,12,66,0,34,13,2,4,61,3,13,17,8,19,0,13,17,12,
+  70,0,86,52,214,4,4,30,34,239,20,61,170,13,220,23,0,5,192,13,0,40,213,20,
+  4,81,92,207,173,12,61,5,83,222,19,12,81,0,108,172,173,20,61,144,71,185,21,28,
+  16,1,94,1,153,87,12,81,0,178,1,65,159,4,4,203,1,229,228,4,63,208,1,202,
+  173,6,70,35,58,200,7,250,0,0,0,85,1,0,62,70,0,170,0,54,200,237,4,4,
+  61,43,53,20,0,9,113,38,4,81,130,1,44,163,28,0,9,108,121,126,60,12,4,0,
+  78,240,248,4,61,7,171,35,4,4,52,166,242,8,4,16,12,250,4,66,3,188,255,0,
+  0,186,255,0,0,186,255,0,0,186,255,12,61,0,3,187,17,16,167,18,157,17,16,153,
+  14,140,33,16,157,24,124,12,0,14,120,12,4,81,84,18,171,20,61,157,83,119,33,0,
+  34,227,31,4,66,28,254,4,4,61,17,26,46,0,30,158,24,4,66,14,6,5,4,61,
+  0,71,16,4,66,134,1,30,0,0,2,140,5,28,0,1,81,39,225,69,12,66,0,72,
+  11,5,4,61,16,115,30,4,63,200,1,17,179,53,251,0,0,0,86,1,0,60,63,0,
+  145,0,122,182,237,4,4,61,57,138,22,4,4,34,10,248,4,66,36,42,254,0,8,40,
+  252,0,0,34,252,0,52,237,6,4,81,96,255,162,4,61,77,122,35,4,66,38,224,251,
+  0,6,205,251,0,2,241,251,20,63,147,86,87,176,4,61,63,221,22,4,66,22,247,6,
+  0,2,213,6,0,12,15,7,4,0,27,2,63,12,18,1,14,149,103,12,4,0,40,62,
+  232,4,66,28,231,251,4,61,9,195,21,0,18,151,33,4,70,36,12,202,34,82,93,202,
+  1,20,66,169,83,17,3,16,146,14,17,3,0,14,108,0,4,4,108,128,234,4,61,34,
+  148,36,4,4,3,84,223,12,61,5,40,114,38,45,252,0,0,0,87,1,0,46,61,0,
+  0,115,38,241,4,4,4,30,187,246,4,61,11,177,22,4,4,24,145,237,0,16,157,238,
+  0,10,139,249,4,61,3,144,38,4,4,64,132,238,4,61,10,151,38,0,50,131,41,20,
+  4,169,20,213,226,4,66,64,82,5,0,8,76,5,4,81,90,51,162,0,14,55,162,4,
+  61,37,78,37,4,4,12,86,228,4,61,32,121,38,4,66,114,188,0,0,44,117,0,4,
+  61,87,216,38,16,138,34,22,37,0,32,80,15,16,158,8,33,14,20,63,138,58,249,194,
+  4,61,19,217,36,4,66,52,155,253,4,61,18,234,38,28,18,2,96,53,52,99,12,70,
+  0,76,5,214,4,66,78,103,5,0,30,194,9,175,253,0,0,0,88,1,0,44,61,0,
+  0,229,41,241,4,0,10,238,41,4,4,192,1,100,232,20,70,139,119,152,212,12,66,2,
+  56,222,5,8,0,24,239,5,4,4,16,173,224,0,1,122,232,4,61,26,16,44,4,4,
+  208,1,248,236,12,18,1,131,1,195,96,12,4,0,22,104,232,20,63,148,58,20,198,50,
+  157,224,1,246,197,1,4,61,227,1,163,38,0,6,148,38,0,2,134,38,16,167,2,156,
+  38,0,8,168,28,0,28,149,28,16,148,4,154,28,8,4,32,28,23,8,0,36,123,44,
+  8,5,2,80,16,8,0,20,235,40,4,4,170,1,173,236,4,61,95,57,40,4,66,10,
+  50,11,0,12,51,11,4,61,8,140,11,4,66,20,46,11,0,12,86,11,247,254,0,0,
+  0,89,1,0,44,66,5,0,138,0,243,4,12,61,0,96,243,30,4,66,8,106,8,4,
+  61,4,180,30,4,66,70,200,0,28,16,1,119,58,82,87,16,92,58,166,80,16,110,90,
+  13,87,12,61,3,39,80,15,8,0,10,120,23,20,70,118,21,166,209,4,61,68,66,15,
+  12,16,1,4,97,85,28,63,0,138,34,33,177,4,66,0,43,5,20,61,149,40,131,29,
+  8,2,8,130,44,8,0,8,14,21,12,16,1,187,255,7,43,72,12,66,0,60,225,8,
+  4,61,30,166,18,12,66,3,1,5,11,12,61,0,12,180,44,0,4,183,44,4,19,95,
+  52,229,16,160,154,2,184,240,4,66,125,47,4,4,61,16,115,18,20,66,172,10,196,4,
+  4,70,42,80,207,4,19,114,245,238,4,61,81,246,22,155,0,0,0,0,89,1,0,44,
+  61,2,0,114,29,243,4,12,66,0,38,163,10,20,61,144,14,131,29,4,66,16,127,10,
+  4,61,24,194,44,4,66,8,101,7,4,19,70,145,232,12,18,11,153,1,132,95,12,81,
+  0,108,189,167,4,66,30,215,9,0,2,103,7,12,19,4,18,148,226,12,66,0,14,109,
+  7,4,19,90,235,236,0,2,234,236,12,66,2,41,221,11,12,0,0,118,96,46,4,66,
+  75,183,250,12,61,4,4,79,39,12,66,0,10,231,11,0,14,252,11,4,0,112,8,47,
+  4,66,105,225,11,0,4,224,11,12,61,3,10,77,39,12,66,0,12,236,11,
+};
+const unsigned long Cat_NGC_Blocks[] = {
+  0,176,359,520,695,877,1053,1228,1425,1627,1823,2008,
+  2193,2375,2578,2767,2935,3098,3273,3461,3657,3850,4046,4227,
+  4410,4599,4781,4962,5149,5344,5523,5710,5896,6074,6259,6427,
+  6596,6778,6966,7141,7335,7522,7689,7869,8051,8234,8406,8594,
+  8789,8994,9204,9402,9585,9770,9973,10175,10377,10595,10820,11043,
+  11257,11474,11685,11908,12120,12335,12553,12767,12990,13220,13446,13672,
+  13877,14087,14295,14506,14721,14916,15125,15336,15534,15733,15952,16138,
+  16324,16517,16720,16904,17095,17281,17468,17663,17847,18034,18233,18417,
+  18617,18807,19001,19197,19394,19587,19774,19974,20173,20371,20563,20758,
+  20954,21149,21338,21515,21693,21868,22067,22253,22453,22636,22809,22981,
+  23160,23333,23507,23683,23850,24030,24199,24372,24549,24730,24901,25071,
+  25251,25423,25606,25794,25973,26145,26321,26493,26673,26854,27049,27222,
+  27399,27572,27749,27924,28103,28282,28457,28634,28813,28987,29157,29333,
+  29503,29683,29867,30044,30227,30404,30587,30764,30945,31119,31299,31486,
+  31666,31845,32028,32213,32415,32623,32802,32989,33184,33368,33572,33755,
+  33928,34103,34284,34466,34653,34830,35013,35198,35383,35564,35766,35960,
+  36161,36344,36539,36740,36928,37105,37315,37509,37714,37911,38129,38344,
+  38559,38764,38987,39197,39407,39607,39817,40017,40236,40462,40664,40885,
+  41107,41311,41534,41756,41974,42203,42428,42638,42866,43069,43274,43468,
+  43685,43899,44118,44323,44524,44718,44908,45111,45307,45481,45656,45834,
+  46008,46183,46370,46548,46729,46910,47082,47264,47435,47622,47797,47965,
+  48133,48308,48495,
+};
+const blk_catalog_t Cat_NGC[1] = {{ Cat_NGC_Data, Cat_NGC_Blocks, NULL }};
@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------
+// Serial ST4 loopback, runs OnStep's master (src/lib/St4SerialMaster.h) against the SHC's slave (St4SerialSlave.cpp)
+// on a PC with simulated pins and a simulated microsecond clock
+
+/*
+Build and run from this directory (-I- keeps the slave's own Config.h, Pinmap.h, etc. out in favor of the stubs):
+  g++ -O2 -w -Istubs -I.. -I../../../src/lib -I- -Istubs st4_loopback.cpp -o st4_loopback && ./st4_loopback
+
+The master clocks the slave by writing DEs, which calls the slave's interrupt handler right away.  Each run
+moves a set of catalog goto commands up to OnStep and their replies down, first with a legacy SHC (its clock
+never passes two seconds so it never asks for fast mode) then with the current one.  Errors are injected by
+flipping the data line (RAw) on some of the master's reads, the payload must still arrive intact.
+*/
+
+#include <stdlib.h>
+#include "Arduino.h"
+#include "Pinmap.h"
+
+bool verbose=true;
+#define DLF(x) { if (verbose) printf("  %s\n",x); }
+#define VLF(x) { if (verbose) printf("  %s\n",x); }
+
+#include "St4SerialMaster.h"
+
+// both ends call their port SerialST4, the slave's is renamed and gets its own clock
+unsigned long slaveMillis();
+#define SerialST4 SlaveST4
+#define millis slaveMillis
+#include "St4SerialSlave.cpp"
+#undef millis
+#undef SerialST4
+
+unsigned long simMicros=0;
+bool legacy=false;
+double flipRate=0;
+int pins[8]={HIGH,HIGH,HIGH,HIGH,HIGH,HIGH,HIGH,HIGH};
+void (*clockIsr)()=NULL;
+
+unsigned long micros() { return simMicros; }
+unsigned long millis() { return simMicros/1000; }
+unsigned long slaveMillis() { return legacy ? 0 : simMicros/1000; }
+void delayMicroseconds(unsigned int us) { simMicros+=us; }
+void pinMode(int pin, int mode) { }
+void attachInterrupt(int irq, void (*isr)(), int mode) { clockIsr=isr; }
+void detachInterrupt(int irq) { clockIsr=NULL; }
+
+void digitalWrite(int pin, int value) {
+  int last=pins[pin]; pins[pin]=value ? HIGH : LOW;
+  if (pin == ST4DEs && last != pins[pin] && clockIsr) { simMicros+=2; clockIsr(); }
+}
+
+int digitalRead(int pin) {
+  int v=pins[pin];
+  if (pin == ST4RAw && flipRate > 0 && rand() < flipRate*RAND_MAX) v=!v;
+  return v;
+}
+
+// sends up and down reps times, true if both arrive intact
+bool run(const char *up, const char *down, int reps, bool *fast) {
+  simMicros+=5000000UL;
+  SerialST4.begin(); SlaveST4.begin(9600);
+
+  // let the link settle (and negotiate fast mode) then drop anything exchanged so far
+  for (int i=0; i<20000; i++) { SerialST4.poll(); simMicros+=100; }
+  while (SlaveST4.available()) SlaveST4.read();
+  while (SerialST4.available()) SerialST4.read();
+
+  static char got[4096], gotS[4096], expect[4096], expectS[4096];
+  int ng=0, ngs=0;
+  expect[0]=0; expectS[0]=0;
+  for (int r=0; r<reps; r++) { strcat(expect,up); strcat(expectS,down); }
+
+  unsigned long t0=simMicros;
+  bool timeout=false;
+  for (int r=0; r<reps && !timeout; r++) {
+    SlaveST4.print(up); SerialST4.print(down);
+    while (ng < (int)((r+1)*strlen(up)) || ngs < (int)((r+1)*strlen(down))) {
+      SerialST4.poll();
+      while (SerialST4.available() && ng < (int)sizeof(got)-1) got[ng++]=SerialST4.read();
+      while (SlaveST4.available() && ngs < (int)sizeof(gotS)-1) gotS[ngs++]=SlaveST4.read();
+      simMicros+=100;
+      if (simMicros-t0 > 120000000UL) { timeout=true; break; }
+    }
+  }
+  got[ng]=0; gotS[ngs]=0;
+  unsigned long dt=simMicros-t0;
+  *fast=SerialST4._fast;
+
+  bool ok=!timeout && strcmp(got,expect) == 0 && strcmp(gotS,expectS) == 0;
+  char flips[20]="none"; if (flipRate > 0) sprintf(flips,"1/%.0f",1.0/flipRate);
+  printf("%s flips %-7s fast=%d  %d+%d bytes in %8.1f ms = %5.0f Bps  %s\n",legacy ? "legacy" : "new   ",
+    flips,(int)*fast,ng,ngs,dt/1000.0,(ng+ngs)*1e6/dt,timeout ? "TIMEOUT" : ok ? "OK" : "MISMATCH");
+
+  SlaveST4.end(); SerialST4.end();
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  const char *up=":Sr12:34:56#:Sd+45*30:00#:MS#", *down="110";
+  // one flip per this many reads, the single parity bit misses two flips in a frame so 1/500 is expected to corrupt
+  const double rates[]={0, 1.0/10000, 1.0/2000, 1.0/500};
+  const bool mustPass[]={true, true, true, false};
+  int failed=0;
+
+  for (int l=1; l >= 0; l--) {
+    legacy=l;
+    for (int i=0; i<4; i++) {
+      bool fast;
+      verbose=(rates[i] == 0); flipRate=rates[i]; srand(1);
+      bool ok=run(up,down,20,&fast);
+      if (mustPass[i] && !ok) failed++;
+      if (rates[i] == 0 && fast == legacy) { printf("  fast mode %s\n",legacy ? "shouldn't be on" : "didn't start"); failed++; }
+    }
+  }
+
+  printf(failed ? "FAILED\n" : "PASSED\n");
+  return failed ? 1 : 0;
+}
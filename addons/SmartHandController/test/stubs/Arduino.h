@@ -0,0 +1,49 @@
+// -----------------------------------------------------------------------------------
+// Just enough of Arduino.h for the ST4 serial master and slave to build on a PC, the loopback supplies the pins and clock
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 3
+#define bitRead(v,b) (((v)>>(b))&1)
+#define bitWrite(v,b,x) ((x)?((v)|=(1UL<<(b))):((v)&=~(1UL<<(b))))
+
+unsigned long micros();
+unsigned long millis();
+void delayMicroseconds(unsigned int us);
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int irq, void (*isr)(), int mode);
+void detachInterrupt(int irq);
+inline void noInterrupts() { }
+inline void interrupts() { }
+
+class Print {
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c)=0;
+    virtual size_t write(const uint8_t *b, size_t n) { for (size_t i=0; i<n; i++) write(b[i]); return n; }
+    size_t print(const char *s) { return write((const uint8_t*)s,strlen(s)); }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available()=0;
+    virtual int read()=0;
+    virtual int peek()=0;
+    virtual void flush()=0;
+    unsigned long _timeout=1000;
+};
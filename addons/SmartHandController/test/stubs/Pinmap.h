@@ -0,0 +1,7 @@
+#pragma once
+
+// the loopback's pins, shared by both ends
+#define ST4RAw 2
+#define ST4DEs 3
+#define ST4DEn 4
+#define ST4RAe 5
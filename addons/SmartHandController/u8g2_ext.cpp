@@ -10,6 +10,11 @@ bool U8G2_EXT::UserInterfaceCatalog(Pad *extPad, const char *title)
   return ext_UserInterfaceCatalog(U8G2_EXT::getU8g2(), extPad, title);
 };
 
+bool U8G2_EXT::UserInterfaceCatalogSearch(Pad *extPad, const char *title, char *text)
+{
+  return ext_UserInterfaceCatalogSearch(U8G2_EXT::getU8g2(), extPad, title, text);
+};
+
 bool U8G2_EXT::UserInterfaceUserCatalog(Pad *extPad, const char *title)
 {
   return ext_UserInterfaceUserCatalog(U8G2_EXT::getU8g2(), extPad, title);
@@ -11,6 +11,7 @@ class U8G2_EXT : public U8G2
 {
 public:
   bool UserInterfaceCatalog(Pad *extPad, const char *title);
+  bool UserInterfaceCatalogSearch(Pad *extPad, const char *title, char *text);
   bool UserInterfaceUserCatalog(Pad *extPad, const char *title);
   uint8_t UserInterfaceMessage(Pad *extPad, const char *title1, const char *title2, const char *title3, const char *buttons);
 #if DISPLAY_WRAP_MENUS == ON
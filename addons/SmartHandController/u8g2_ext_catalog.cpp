@@ -375,6 +375,9 @@ bool ext_UserInterfaceCatalog(u8g2_t *u8g2, Pad* extPad, const char *title)
       if (event == U8X8_MSG_GPIO_MENU_UP)   { cat_mgr.decIndex(); break; } else
       if (event == MSG_MENU_UP_FAST)        { for (int i=0; i<scrollSpeed; i++) cat_mgr.decIndex(); break; }
 
+      // work on the visibility cache while waiting
+      cat_mgr.poll();
+
       // auto-refresh display
       static unsigned long lastRefresh=0;
       if ((thisDisplayMode==DM_HOR_COORDS) && (millis()-lastRefresh>2000)) { lastRefresh=millis(); break; }
@@ -382,6 +385,81 @@ bool ext_UserInterfaceCatalog(u8g2_t *u8g2, Pad* extPad, const char *title)
   }
 }
 
+/*
+title: title line
+text: search text (up to 15 characters,) edited in place. Up/Down changes the last character, Right adds a character and
+      Left removes one.  The best match is looked up and shown as the text changes.
+uses: cat_mgr.search().  On return cat_mgr has the object found selected.
+returns false if user has pressed the home key or removed all characters
+returns true if user has pressed the select key and an object was found
+side effects:
+u8g2_SetFontDirection(u8g2, 0);
+u8g2_SetFontPosBaseline(u8g2);
+*/
+bool ext_UserInterfaceCatalogSearch(u8g2_t *u8g2, Pad* extPad, const char *title, char *text)
+{
+  static const char *charSet=" ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-";
+  int charSetLen=strlen(charSet);
+
+  u8g2_SetFont(u8g2, LF_STANDARD);
+  u8g2_SetFontDirection(u8g2, 0);
+  u8g2_SetFontPosBaseline(u8g2);
+  u8g2_uint_t line_height = u8g2_GetAscent(u8g2) - u8g2_GetDescent(u8g2) + MY_BORDER_SIZE;
+
+  uint8_t event;
+  char line[40];
+  int len=strlen(text);
+  if (len==0) { strcpy(text,"A"); len=1; }
+
+  for (;;) {
+    bool found=cat_mgr.search(text);
+
+    u8g2_FirstPage(u8g2);
+    do {
+      u8g2_uint_t y = u8g2_GetAscent(u8g2);
+      u8g2_DrawUTF8(u8g2, 0, y, title);
+      u8g2_DrawHLine(u8g2, 0, y - u8g2_GetDescent(u8g2) + 1, u8g2_GetDisplayWidth(u8g2));
+      y += line_height + 3;
+
+      // search text, the character being edited is underlined
+      u8g2_uint_t x = u8g2_DrawUTF8(u8g2, 0, y, text);
+      sprintf(line,"%c",text[len-1]);
+      u8g2_uint_t w = u8g2_GetUTF8Width(u8g2, line);
+      u8g2_DrawHLine(u8g2, x-w, y+1, w);
+      y += line_height + 3;
+
+      // best match
+      if (found) {
+        if (cat_mgr.hasPrimaryIdInPrefix()) sprintf(line,"%s",cat_mgr.catalogPrefix()); else sprintf(line,"%s%ld",cat_mgr.catalogPrefix(),cat_mgr.primaryId());
+        u8g2_DrawUTF8(u8g2, 0, y, line);
+        u8g2_DrawUTF8(u8g2, u8g2_GetDisplayWidth(u8g2)-u8g2_GetUTF8Width(u8g2, cat_mgr.catalogTitle()), y, cat_mgr.catalogTitle());
+        y += line_height;
+        u8g2_DrawUTF8(u8g2, 0, y, cat_mgr.objectNameStr());
+      } else u8g2_DrawUTF8(u8g2, 0, y, L_SG_NO_MATCH);
+    } while (u8g2_NextPage(u8g2));
+
+#ifdef U8G2_REF_MAN_PIC
+    return 0;
+#endif
+
+    for (;;) {
+      event = ext_GetMenuEvent(extPad);
+      if (event == U8X8_MSG_GPIO_MENU_SELECT) { if (found) return true; } else
+      if (event == U8X8_MSG_GPIO_MENU_HOME) return false; else
+      if (event == U8X8_MSG_GPIO_MENU_NEXT) { if (len<15) { text[len++]='A'; text[len]=0; } break; } else
+      if (event == U8X8_MSG_GPIO_MENU_PREV) { if (len<=1) return false; text[--len]=0; break; } else
+      if (event == U8X8_MSG_GPIO_MENU_UP || event == MSG_MENU_UP_FAST) {
+        const char *c=strchr(charSet,text[len-1]); int i=c ? c-charSet : 0;
+        i++; if (i>=charSetLen) i=0; text[len-1]=charSet[i]; break;
+      } else
+      if (event == U8X8_MSG_GPIO_MENU_DOWN || event == MSG_MENU_DOWN_FAST) {
+        const char *c=strchr(charSet,text[len-1]); int i=c ? c-charSet : 0;
+        i--; if (i<0) i=charSetLen-1; text[len-1]=charSet[i]; break;
+      }
+    }
+  }
+}
+
 /*
 selection list with string line
 returns line height
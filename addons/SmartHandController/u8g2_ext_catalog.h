@@ -8,4 +8,5 @@
 #include "Locale.h"
 
 bool ext_UserInterfaceCatalog(u8g2_t *u8g2, Pad *extPad, const char *title);
+bool ext_UserInterfaceCatalogSearch(u8g2_t *u8g2, Pad *extPad, const char *title, char *text);
 bool ext_UserInterfaceUserCatalog(u8g2_t *u8g2, Pad *extPad, const char *title);
@@ -65,6 +65,8 @@
 #define AXIS1_ENC_RATE_AUTO           OFF //    OFF, n, (Worm period in seconds.) Adjusts avg encoder pulse rate to account.  Option
                                           //         For skew in the average guide rate over the last worm period.            Option
 #define AXIS1_ENC_BIN_AVG             OFF //    OFF, n, (Number of bins.)  Enables binned rolling average feature.            Option
+#define AXIS1_ENC_KALMAN              OFF //    OFF, n, (Time constant in seconds.) Kalman rate estimate replaces averages.   Option
+#define AXIS1_ENC_CAPTURE             OFF //    OFF, n, (Samples.) Axis1 A/B tick capture for PE and resonance analysis.      Option
 
 // THAT'S IT FOR USER CONFIGURATION!
 // -------------------------------------------------------------------------------
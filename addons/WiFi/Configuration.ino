@@ -102,26 +102,14 @@ void handleConfiguration() {
   
   bool success=processConfigurationGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
 
   // send a standard http response header
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  sendHtml(data);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_collapse1);
-  data += FPSTR(html_main_css_collapse2);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -135,7 +123,6 @@ void handleConfiguration() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgS);
@@ -143,17 +130,15 @@ void handleConfiguration() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
   
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid() || !success) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid() || !success) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
   
   // ajax scripts
   data += FPSTR(html_configScript1);
   
   data+="<div style='width: 35em;'>";
   data += L_BASIC_SET_TITLE "<br /><br />";
-  sendHtml(data);
 
   data += "<button type='button' class='collapsible'>" L_LOCATION_TITLE "</button>";
   data += FPSTR(html_configFormBegin);
@@ -170,7 +155,6 @@ void handleConfiguration() {
   data += temp;
   sprintf_P(temp,html_configLongSec,(char*)&temp1[8]);
   data += temp;
-  sendHtml(data);
 
   // Latitude
   if (!command(":GtH#",temp1)) strcpy(temp1,"+00*00:00"); temp1[9]=0;
@@ -184,7 +168,6 @@ void handleConfiguration() {
   data += temp;
   sprintf_P(temp,html_configLatSec,(char*)&temp1[7]);
   data += temp;
-  sendHtml(data);
 
   // UTC Offset
   if (!command(":GG#",temp1)) strcpy(temp1,"+00");
@@ -201,7 +184,6 @@ void handleConfiguration() {
   data += temp;
   data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
   data += FPSTR(html_configFormEnd);
-  sendHtml(data);
 
   // Overhead and Horizon Limits
   data += "<button type='button' class='collapsible'>" L_LIMITS_TITLE "</button>";
@@ -214,7 +196,6 @@ void handleConfiguration() {
   data += temp;
   data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
   data += FPSTR(html_configFormEnd);
-  sendHtml(data);
 
   // Axis1 RA/Azm
   data += "<br /><button type='button' class='collapsible'>Axis1 RA/Azm</button>";
@@ -223,7 +204,6 @@ void handleConfiguration() {
   if (!command(":%BR#",temp1)) strcpy(temp1,"0"); int backlashAxis1=(int)strtol(&temp1[0],NULL,10);
   sprintf_P(temp,html_configBlAxis1,backlashAxis1);
   data += temp;
-  sendHtml(data);
   // Meridian Limits
   if (mountStatus.mountType() == MT_GEM && (command(":GXE9#",temp1)) && (command(":GXEA#",temp2))) {
     int degPastMerE=(int)strtol(&temp1[0],NULL,10);
@@ -235,10 +215,8 @@ void handleConfiguration() {
     sprintf_P(temp,html_configPastMerW,degPastMerW);
     data += temp;
   } else data += "<br />\r\n";
-  sendHtml(data);
   data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
   data += FPSTR(html_configFormEnd);
-  sendHtml(data);
 
   // Axis2 Dec/Alt
   data += "<button type='button' class='collapsible'>Axis2 Dec/Alt</button>";
@@ -249,7 +227,6 @@ void handleConfiguration() {
   data += temp;
   data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
   data += FPSTR(html_configFormEnd);
-  sendHtml(data);
 
   // Axis3 Rotator
   int i = 0;
@@ -265,7 +242,6 @@ void handleConfiguration() {
     data += temp;
     data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
     data += FPSTR(html_configFormEnd);
-    sendHtml(data);
   }
 
   // Axis4 Focuser1
@@ -287,7 +263,6 @@ void handleConfiguration() {
     if (!command(":Fd#",temp1)) strcpy(temp1,"0"); i=(int)strtol(&temp1[0],NULL,10);
     sprintf_P(temp,html_configDbAxis4,i);
     data += temp;
-    sendHtml(data);
     // TCF Coef
     if (!command(":FC#",temp1)) strcpy(temp1,"0");
     char *conv_end;
@@ -297,7 +272,6 @@ void handleConfiguration() {
     data += temp;
     data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
     data += FPSTR(html_configFormEnd);
-    sendHtml(data);
   }
 
   // Axis5 Focuser2
@@ -317,7 +291,6 @@ void handleConfiguration() {
     if (!command(":fd#",temp1)) strcpy(temp1,"0"); i=(int)strtol(&temp1[0],NULL,10);
     sprintf_P(temp,html_configDbAxis5,i);
     data += temp;
-    sendHtml(data);
     // TCF Coef
     if (!command(":fC#",temp1)) strcpy(temp1,"0");
     char *conv_end;
@@ -327,7 +300,6 @@ void handleConfiguration() {
     data += temp;
     data += "<button type='submit'>" L_UPLOAD "</button>\r\n";
     data += FPSTR(html_configFormEnd);
-    sendHtml(data);
   }
   
   data += "<br />\r\n";
@@ -350,7 +322,6 @@ void handleConfiguration() {
   }
 
 #if DISPLAY_RESET_CONTROLS != OFF
-  sendHtml(data);
   data += "<hr>" L_RESET_TITLE "<br/><br/>";
   data += "<button onpointerdown=\"if (confirm('" L_ARE_YOU_SURE "?')) s('advanced','reset')\" type='button'>" L_RESET "!</button>";
   #ifdef BOOT0_PIN
@@ -368,7 +339,6 @@ void handleConfiguration() {
   strcpy(temp,"</div></div></body></html>");
   data += temp;
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
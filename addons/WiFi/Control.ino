@@ -1,34 +1,8 @@
 // -----------------------------------------------------------------------------------
 // Telescope control related functions 
 
-const char html_controlScript1[] PROGMEM =
-"<script>\n"
-"function s(key,v1) {"
-  "var xhttp = new XMLHttpRequest();"
-  "xhttp.open('GET', 'controlA.txt?'+key+'='+v1+'&x='+new Date().getTime(), true);"
-  "xhttp.send();"
-"}"
-"function g(v1){s('dr',v1);}"
-"function gf(v1){s('dr',v1);autoFastRun();}"
-"function sf(key,v1){s(key,v1);autoFastRun();}\n"
-"</script>\n";
-
-const char html_controlScript2[] PROGMEM =
-"<script>\r\n"
-"function SetDateTime() {"
-"var d1 = new Date();"
-"var jan = new Date(d1.getFullYear(), 0, 1);"
-"var d = new Date(d1.getTime()-(jan.getTimezoneOffset()-d1.getTimezoneOffset())*60*1000);";
-const char html_controlScript3[] =
-"document.getElementById('dd').value = d.getDate();"
-"document.getElementById('dm').value = d.getMonth();"
-"document.getElementById('dy').value = d.getFullYear();";
-const char html_controlScript4[] =
-"document.getElementById('th').value = d.getHours();"
-"document.getElementById('tm').value = d.getMinutes();"
-"document.getElementById('ts').value = d.getSeconds();"
-"}\r\n"
-"</script>\r\n";
+// the button and clock scripts are in assets/control.js
+const char html_controlScript[] PROGMEM = "<script src='/control.js?v=" ASSET_CONTROL_JS_VER "'></script>\n";
 
 const char html_controlQuick1[] PROGMEM =
 "<div style='text-align: center; width: 30em'>"
@@ -167,32 +141,13 @@ void handleControl() {
 
   processControlGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
   
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  sendHtml(data);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_control1);
-  data += FPSTR(html_main_css_control2);
-  data += FPSTR(html_main_css_control3);
-  data += FPSTR(html_main_css_btns1);
-  sendHtml(data);
-  data += FPSTR(html_main_css_btns2);
-  data += FPSTR(html_main_css_btns3);
-  data += FPSTR(html_main_css_collapse1);
-  data += FPSTR(html_main_css_collapse2);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -206,7 +161,6 @@ void handleControl() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -214,22 +168,16 @@ void handleControl() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
-  // ajax scripts
-  data += FPSTR(html_controlScript1);
-  // clock script
-  data += FPSTR(html_controlScript2);
-  data += FPSTR(html_controlScript3);
-  data += FPSTR(html_controlScript4);
+  // ajax and clock scripts
+  data += FPSTR(html_controlScript);
 
   // active ajax page is: controlAjax();
-  data +="<script>var ajaxPage='control.txt';</script>\n";
+  data +="<script>var ajaxPage='control.txt'; var wsPage='control';</script>\n";
   data +=FPSTR(html_ajax_active);
-  sendHtml(data);
 
   // Quick controls ------------------------------------------
   data += FPSTR(html_controlQuick1);
@@ -238,14 +186,12 @@ void handleControl() {
   data += FPSTR(html_controlQuick3);
   data += FPSTR(html_controlQuick4);
   data += FPSTR(html_controlQuick5);
-  sendHtml(data);
 
   // Tracking control ----------------------------------------
   data += FPSTR(html_controlTrack1);
   data += FPSTR(html_controlTrack2);
   data += FPSTR(html_controlTrack3);
   data += FPSTR(html_controlTrack4);
-  sendHtml(data);
 
   // Get the align mode --------------------------------------
   data += FPSTR(html_controlAlign1);
@@ -261,7 +207,6 @@ void handleControl() {
   if (mountStatus.mountType() != MT_ALTAZM) {
     data += FPSTR(html_controlAlign4);
   }
-  sendHtml(data);
   
   // Tracking ------------------------------------------------
   data += FPSTR(html_controlTrack5);
@@ -271,11 +216,9 @@ void handleControl() {
   data += FPSTR(html_controlGuide2);
   data += FPSTR(html_controlGuide3);
   data += FPSTR(html_controlGuide4);
-  sendHtml(data);
   data += FPSTR(html_controlGuide5);
   data += FPSTR(html_controlGuide6);
   data += FPSTR(html_controlGuide7);
-  sendHtml(data);
 
   // Focusing ------------------------------------------------
   if (commandBool(":FA#")) Focuser1=true; else Focuser1=false;
@@ -288,7 +231,6 @@ void handleControl() {
     data += FPSTR(html_controlFocus4);
     data += FPSTR(html_controlFocus5);
     data += FPSTR(html_controlFocus6);
-    sendHtml(data);
   }
 
   // Rotate/De-Rotate ----------------------------------------
@@ -304,16 +246,13 @@ void handleControl() {
     data += FPSTR(html_controlRotate1);
     data += FPSTR(html_controlRotate2);
     data += FPSTR(html_controlRotate3);
-    sendHtml(data);
   }
   if (DeRotate) {
     data += FPSTR(html_controlDeRotate1);
     data += FPSTR(html_controlDeRotate2);
-    sendHtml(data);
   }
   if (Rotate) {
     data += FPSTR(html_controlRotate4);
-    sendHtml(data);
   }
 
   data += FPSTR(html_controlEnd);
@@ -323,7 +262,6 @@ void handleControl() {
   
   data += "</div></body></html>";
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -345,6 +283,15 @@ void controlAjax(EthernetClient *client) {
 #else
 void controlAjax() {
 #endif
+  String data=controlAjaxData();
+#ifdef OETHS
+  client->print(data);
+#else
+  server.send(200, "text/plain",data);
+#endif
+}
+
+String controlAjaxData() {
   String data="";
   char temp[120]="";
 
@@ -419,11 +366,35 @@ void controlAjax() {
     if (command(":rG#",temp)) { temp[9]=temp[5]; temp[10]=temp[6]; temp[11]=0; temp[4]='&'; temp[5]='d'; temp[6]='e'; temp[7]='g'; temp[8]=';'; data += temp; data += "&#39;\n"; } else { data += "?\n"; }
   }
 
-#ifdef OETHS
-  client->print(data);
-#else
-  server.send(200, "text/plain",data);
-#endif
+  return data;
+}
+
+// once a second gather the Control and Status page values for whoever is listening on the WebSocket and push only the lines that changed
+void webSocketPush() {
+  static unsigned long lastPush=0;
+  static String lastData="";
+
+  if ((long)(millis()-lastPush)<1000) return;
+  lastPush=millis();
+  if (!wsSvr.hasClients()) { lastData=""; return; }
+
+  Ser.setTimeout(webTimeout);
+  String data="";
+  if (wsSvr.wants('c')) data += controlAjaxData();
+  if (wsSvr.wants('i')) data += indexAjaxData();
+
+  String changes="";
+  String previous="\n"+lastData;
+  int start=0;
+  while (start<(int)data.length()) {
+    int end=data.indexOf('\n',start); if (end<0) end=data.length()-1;
+    String line=data.substring(start,end+1);
+    if (previous.indexOf("\n"+line)<0) changes += line;
+    start=end+1;
+  }
+  lastData=data;
+
+  wsSvr.push(changes,data);
 }
 
 int get_temp_month;
@@ -0,0 +1,191 @@
+// -----------------------------------------------------------------------------------------------------------------
+// PEC learned from the encoders
+
+// the encoder vs. OnStep angle is the drive train's periodic error no matter how OnStep steps the motor (guiding,
+// rate trim, or PEC playback,) it's binned by OnStep's worm index over whole worm cycles, smoothed with a few
+// harmonics, and written into OnStep's PEC table as the steps per second that cancel it
+#define ENC_PEC_CYCLES    2    // whole worm cycles to learn over
+#define ENC_PEC_HARMONICS 8    // of the worm period kept in the fit
+#define ENC_PEC_SAMPLE_MS 500  // twice per worm segment so every one gets samples
+#define ENC_PEC_UPLOAD    16   // table entries written per poll
+#define ENC_PEC_STALL_MS  5000 // the worm index has to move within a few segments
+#define ENC_PEC_MARGIN_MS 60000L
+
+enum EncPecState {EP_IDLE, EP_LEARNING, EP_UPLOADING, EP_DONE, EP_FAILED};
+enum EncPecFailure {EPF_NONE, EPF_SETUP, EPF_RECORDING, EPF_NO_INDEX, EPF_TRACKING, EPF_TIMEOUT, EPF_UPLOAD};
+
+class EncPec {
+  public:
+    // find the worm period and step size from OnStep and start collecting
+    void start() {
+      char s[22];
+      stop();
+      _failure=EPF_NONE;
+      _pecWas=0;
+      _size=0;
+      if (command(":GXE8#",s)) _size=atol(s);
+      if (command(":GXE4#",s)) _stepsPerArcsec=atof(s)/3600.0; else _stepsPerArcsec=0;
+      if (_size <= 0 || _stepsPerArcsec <= 0 || !command(":$QZ?#",s)) { fail(EPF_SETUP); return; }
+      if (s[0] == 'r' || s[0] == 'R') { fail(EPF_RECORDING); return; }
+      _sumD=(float*)malloc(_size*sizeof(float));
+      _sumT=(float*)malloc(_size*sizeof(float));
+      _count=(uint16_t*)malloc(_size*sizeof(uint16_t));
+      if (!_sumD || !_sumT || !_count) { fail(EPF_SETUP); return; }
+      for (int i=0; i<_size; i++) { _sumD[i]=0; _sumT[i]=0; _count[i]=0; }
+
+      // OnStep only moves the worm index while PEC plays, with no table (or PEC off) it's ignored and :VR# never
+      // changes, so play what's there or (with nothing recorded) a cleared table which corrects nothing
+      _pecWas=s[0];
+      if (_pecWas == 'I') {
+        commandBlind(":$QZ+#");
+        if (command(":$QZ?#",s) && s[0] == 'I') {
+          _pecWas='Z';
+          commandBlind(":$QZZ#");
+          commandBlind(":WR0,0#");
+          commandBlind(":$QZ+#");
+        }
+        if (!command(":$QZ?#",s) || s[0] == 'I') { restorePec(); fail(EPF_SETUP); return; }
+      }
+
+      _stt=0; _std=0; _n=0;
+      _cycles=0; _lastIndex=-1; _startMs=millis(); _nextMs=_startMs; _indexMs=_startMs;
+      _state=EP_LEARNING;
+    }
+
+    void stop() {
+      if (_sumD) { free(_sumD); _sumD=NULL; }
+      if (_sumT) { free(_sumT); _sumT=NULL; }
+      if (_count) { free(_count); _count=NULL; }
+      if (_state == EP_LEARNING || _state == EP_UPLOADING) { restorePec(); _state=EP_IDLE; }
+    }
+
+    bool learning() { return _state == EP_LEARNING || _state == EP_UPLOADING; }
+
+    // en is the encoder Axis1 angle in degrees, read just now, tracking is false if the mount was slewing or not tracking
+    // at the last status update
+    void poll(double en, bool tracking) {
+      if (_state == EP_UPLOADING) { upload(); return; }
+      if (_state != EP_LEARNING || (long)(millis()-_nextMs) < 0) return;
+      _nextMs+=ENC_PEC_SAMPLE_MS;
+
+      // a slew or stopping tracking loses the worm phase
+      if (!tracking) { fail(EPF_TRACKING); return; }
+
+      // a PEC index sense that hasn't seen the worm yet holds the index too, and nothing else should take this long
+      if ((long)(millis()-_indexMs) > ENC_PEC_STALL_MS) { fail(EPF_NO_INDEX); return; }
+      if ((long)(millis()-_startMs) > (ENC_PEC_CYCLES+1)*_size*1000L+ENC_PEC_MARGIN_MS) { fail(EPF_TIMEOUT); return; }
+
+      // :VR# gives the segment playing and its index less one
+      char s[22], *c;
+      if (!command(":VR#",s) || (c=strchr(s,',')) == NULL) return;
+      int index=(atoi(c+1)+1)%_size;
+      if (!command(":GX42#",s) || strlen(s) < 2) return;
+      double os=atof(s);
+
+      // the first cycle is usually partial, so it takes one more wrap than cycles wanted
+      if (index < _lastIndex) _cycles++;
+      if (index != _lastIndex) _indexMs=millis();
+      _lastIndex=index;
+      if (_n == 0) _osStart=os;
+      _osLast=os;
+
+      float t=(millis()-_startMs)/1000.0;
+      float d=(en-os)*3600.0;
+      _sumD[index]+=d; _sumT[index]+=t; _count[index]++;
+      _stt+=(double)t*t; _std+=(double)t*d; _n++;
+
+      if (_cycles > ENC_PEC_CYCLES) { if (fit()) { _uploadIndex=0; _state=EP_UPLOADING; } else fail(EPF_NO_INDEX); }
+    }
+
+    int state() { return _state; }
+    int failure() { return _failure; }
+    int cycles() { return _cycles > 0 ? _cycles-1 : 0; }
+    int uploadIndex() { return _uploadIndex; }
+    int size() { return _size; }
+    float peakToPeak() { return _peakToPeak; }
+
+  private:
+    void fail(int failure) { stop(); _state=EP_FAILED; _failure=failure; }
+
+    // put PEC back the way start() found it if learning doesn't finish
+    void restorePec() {
+      if (_pecWas == 'Z') commandBlind(":$QZZ#"); else
+      if (_pecWas == 'I') commandBlind(":$QZ-#");
+    }
+
+    // remove the drift (a straight line in time) and keep the first few harmonics of what's left, then turn
+    // the change in error across each one second segment into a correction in steps, the drift comes from how
+    // each segment changes from one cycle to the next so the periodic error itself can't bias it
+    bool fit() {
+      double num=_std, den=_stt;
+      for (int i=0; i<_size; i++) {
+        if (_count[i] == 0) return false;
+        num-=(double)_sumT[i]*_sumD[i]/_count[i];
+        den-=(double)_sumT[i]*_sumT[i]/_count[i];
+      }
+      double slope=(den > 0) ? num/den : 0;
+
+      float a[ENC_PEC_HARMONICS], b[ENC_PEC_HARMONICS];
+      for (int k=0; k<ENC_PEC_HARMONICS; k++) { a[k]=0; b[k]=0; }
+      for (int i=0; i<_size; i++) {
+        float e=(_sumD[i]-slope*_sumT[i])/_count[i];
+        float w=6.2831853*(i+0.5)/_size;
+        for (int k=0; k<ENC_PEC_HARMONICS; k++) { a[k]+=e*cos((k+1)*w); b[k]+=e*sin((k+1)*w); }
+      }
+      for (int k=0; k<ENC_PEC_HARMONICS; k++) { a[k]*=2.0/_size; b[k]*=2.0/_size; }
+
+      // tracking runs the axis one way or the other depending on the hemisphere
+      float dir=(_osLast >= _osStart) ? 1.0 : -1.0;
+
+      // _sumD is done with, it holds the steps from here on
+      float lo=1e9, hi=-1e9, last=harmonics(a,b,0), carry=0;
+      for (int i=0; i<_size; i++) {
+        float e=harmonics(a,b,i+1);
+        if (e < lo) lo=e; if (e > hi) hi=e;
+        carry+=-(e-last)*dir*_stepsPerArcsec;
+        int steps=round(carry); carry-=steps;
+        if (steps > 127) steps=127; if (steps < -127) steps=-127;
+        _sumD[i]=steps;
+        last=e;
+      }
+      _peakToPeak=hi-lo;
+      return true;
+    }
+
+    float harmonics(float *a, float *b, float x) {
+      float w=6.2831853*x/_size, e=0;
+      for (int k=0; k<ENC_PEC_HARMONICS; k++) e+=a[k]*cos((k+1)*w)+b[k]*sin((k+1)*w);
+      return e;
+    }
+
+    // OnStep plays each entry a second early to cover guiding latency, so segment i goes in entry i-1
+    void upload() {
+      char s[22], r[22];
+      for (int j=0; j<ENC_PEC_UPLOAD && _uploadIndex<_size; j++, _uploadIndex++) {
+        int entry=(_uploadIndex+_size-1)%_size;
+        sprintf(s,":WR%d,%d#",entry,(int)_sumD[_uploadIndex]);
+        commandBlind(s);
+        // reading it back paces the writes and confirms them
+        sprintf(s,":VR%d#",entry);
+        if (!command(s,r) || atoi(r) != (int)_sumD[_uploadIndex]) { fail(EPF_UPLOAD); return; }
+      }
+      if (_uploadIndex >= _size) { commandBlind(":$QZ+#"); _state=EP_DONE; stop(); }
+    }
+
+    int _state=EP_IDLE;
+    int _failure=EPF_NONE;
+    char _pecWas=0;
+    int _size=0;
+    float _stepsPerArcsec=0;
+    float *_sumD=NULL;
+    float *_sumT=NULL;
+    uint16_t *_count=NULL;
+    double _stt=0, _std=0;
+    long _n=0;
+    int _cycles=0;
+    int _lastIndex=-1;
+    int _uploadIndex=0;
+    double _osStart=0, _osLast=0;
+    unsigned long _startMs=0, _nextMs=0, _indexMs=0;
+    float _peakToPeak=0;
+};
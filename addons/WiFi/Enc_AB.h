@@ -19,30 +19,61 @@
 //         B __|      |______|      |______|   B
 
 #if AXIS1_ENC_RATE_CONTROL == ON && (AXIS1_ENC == AB || AXIS2_ENC == AB)
+  // read the pins straight from the port registers, digitalRead() is too slow for the ISRs at high tick rates
+#if defined(ESP8266)
+  #define EncPinRead(p) GPIP(p)
+#elif defined(ESP32)
+  #include <soc/gpio_struct.h>
+  #define EncPinRead(p) ((p)<32?((GPIO.in>>(p))&1):((GPIO.in1.val>>((p)-32))&1))
+#elif defined(__MK20DX256__)
+  #define EncPinRead(p) digitalReadFast(p)
+#else
+  #define EncPinRead(p) (digitalRead(p) == HIGH)
+#endif
+
+#if AXIS1_ENC == AB && AXIS1_ENC_CAPTURE > 0
+  #define ENC_HAS_CAPTURE
+  // Axis1 tick capture, (clock count, position) for every edge into a ring the ISRs fill and the web download empties,
+  // the ISRs only move the head and the reader only moves the tail so neither needs to lock out the other
+  volatile uint32_t encCaptureT[AXIS1_ENC_CAPTURE];
+  volatile int32_t encCaptureP[AXIS1_ENC_CAPTURE];
+  volatile uint32_t encCaptureHead=0;
+  volatile uint32_t encCaptureTail=0;
+  volatile uint32_t encCaptureOverruns=0;
+  volatile bool encCaptureOn=false;
+
+  void ICACHE_RAM_ATTR __capture1(uint32_t t) {
+    if (!encCaptureOn) return;
+    uint32_t h=encCaptureHead;
+    if (h-encCaptureTail >= AXIS1_ENC_CAPTURE) { encCaptureOverruns++; return; }
+    encCaptureT[h%AXIS1_ENC_CAPTURE]=t;
+    encCaptureP[h%AXIS1_ENC_CAPTURE]=__p1;
+    encCaptureHead=h+1; // publish only once the sample is in place
+  }
+#endif
+
   volatile int16_t __aPin1,__bPin1;
   volatile bool __a_set1=false;
   volatile bool __b_set1=false;
   void ICACHE_RAM_ATTR __a1() {
-#ifdef __MK20DX256__
-    __a_set1 = digitalReadFast(__aPin1) == HIGH;
-#else
-    __a_set1 = digitalRead(__aPin1) == HIGH;
-#endif
+    __a_set1 = EncPinRead(__aPin1);
     if (__a_set1 != __b_set1) __p1--; else __p1++;
 #if AXIS1_ENC_RATE_CONTROL == ON
     T0=GetClockCount; Telapsed=(T0-T1); T1=T0;
+  #ifdef ENC_HAS_CAPTURE
+    __capture1(T0);
+  #endif
     if (Telapsed>clocksPerTickMin) __logRate();
 #endif
   }
   void ICACHE_RAM_ATTR __b1() { 
-#ifdef __MK20DX256__
-    __b_set1 = digitalReadFast(__bPin1) == HIGH;
-#else
-    __b_set1 = digitalRead(__bPin1) == HIGH;
-#endif
+    __b_set1 = EncPinRead(__bPin1);
     if (__a_set1 == __b_set1) __p1--; else __p1++;
 #if AXIS1_ENC_RATE_CONTROL == ON
     T0=GetClockCount; Telapsed=(T0-T1); T1=T0;
+  #ifdef ENC_HAS_CAPTURE
+    __capture1(T0);
+  #endif
     if (Telapsed>clocksPerTickMin) __logRate();
 #endif
   }
@@ -51,11 +82,11 @@
   volatile bool __a_set2=false;
   volatile bool __b_set2=false;
   void ICACHE_RAM_ATTR __a2() {
-    __a_set2 = digitalRead(__aPin2) == HIGH;
+    __a_set2 = EncPinRead(__aPin2);
     if (__a_set2 != __b_set2) __p2--; else __p2++;
   }
   void ICACHE_RAM_ATTR __b2() {
-    __b_set2 = digitalRead(__bPin2) == HIGH;
+    __b_set2 = EncPinRead(__bPin2);
     if (__a_set2 == __b_set2) __p2--; else __p2++;
   }
   
@@ -106,6 +137,9 @@
   
   void ICACHE_RAM_ATTR __logRate() {
     lastLogRate=millis();
+  #if AXIS1_ENC_KALMAN > 0
+    __logTick();
+  #endif
   #if AXIS1_ENC_BIN_AVG > 0
     int i=abs(__p1)%AXIS1_ENC_BIN_AVG;
     uint32_t T0us=T0/ClockCountToMicros;
@@ -69,6 +69,9 @@
   
   void ICACHE_RAM_ATTR __logRate() {
     lastLogRate=millis();
+  #if AXIS1_ENC_KALMAN > 0
+    __logTick();
+  #endif
   #if AXIS1_ENC_BIN_AVG > 0
     int i=abs(__p1)%AXIS1_ENC_BIN_AVG;
     uint32_t T0us=T0/ClockCountToMicros;
@@ -1,6 +1,14 @@
 // -------------------------------------------------------------------------------------------------------
 // Handle encoders, both CW/CCW and Quadrature A/B types are supported
 
+// on the ESP32 the encoders get a task of their own on the core the web server isn't using
+#if ENCODERS == ON && defined(ESP32)
+  #define ENC_TASK
+  #define ENC_TASK_PERIOD_MS 10   // fixed polling rate
+  #define ENC_TASK_CORE      0    // loop() and with it the web server run on core 1
+  #define ENC_TASK_STACK     8192
+#endif
+
 #include "MountStatus.h"
 
 #if ENCODERS == ON
@@ -28,11 +36,6 @@ long Axis2EncDiffAbs =0;
 // encoder position
 volatile int32_t __p1,__p2;
 
-// bring in support for the various encoder types
-#include "Enc_AB.h"
-#include "Enc_CwCcw.h"
-#include "Enc_BiSS_C_BC.h"
-
 // encoder polling rate in seconds, default=2.0
 #define POLLING_RATE 2.0
 
@@ -105,17 +108,120 @@ volatile int32_t __p1,__p2;
   static float axis1RateDelta=0;
 #endif
 
+#if AXIS1_ENC_KALMAN > 0
+  // tick arrival times for the Kalman rate estimate, the ISR only records them and the filter runs in poll()
+  #include "EncKalman.h"
+  #define KF_TICK_BUFFER 16
+  volatile uint32_t kfTickTime[KF_TICK_BUFFER];
+  volatile uint32_t kfTicks=0; // ticks logged so far, also the next write index
+  uint32_t kfTicksRead=0;
+  float Axis1EncKalmanTC=AXIS1_ENC_KALMAN;
+  EncKalman axis1Kalman;
+
+  void ICACHE_RAM_ATTR __logTick() { kfTickTime[kfTicks%KF_TICK_BUFFER]=micros(); kfTicks++; }
+#endif
+
   // guiding
   float guideCorrection=0;
   long guideCorrectionMillis=0;
 
+  // tracking rate trim, a PI loop on the rate error used instead of guiding when OnStep accepts :SX44
+  #define ENC_TRIM_TI  60.0 // integral time in seconds
+  #define ENC_TRIM_MAX 0.01 // +/- x the sidereal rate, added to the tracking rate
+  int encTrimSupport=-1;    // -1 unknown, 0 no, 1 yes
+  float axis1Trim=0.0;
+  float axis1TrimI=0.0;
+
+#endif
+
+// bring in support for the various encoder types, after the rate control globals their ISRs use
+#include "Enc_AB.h"
+#include "Enc_CwCcw.h"
+#include "Enc_BiSS_C_BC.h"
+
+#include "EncPec.h"
+EncPec encPec;
+
+// ----------------------------------------------------------------------------------------------------------------
+// what the web pages show, a copy is published after each poll so they never read the encoder state mid-update
+typedef struct {
+  double osAxis1;
+  double osAxis2;
+  double enAxis1;
+  double enAxis2;
+  bool enAxis1Fault;
+  bool enAxis2Fault;
+#if AXIS1_ENC_RATE_CONTROL == ON
+  float rate;
+  float rateSta;
+  float rateLta;
+  float rateComp;
+  float trim;
+  int trimSupport;
+  long guideMillis;
+  #if AXIS1_ENC_INTPOL_COS == ON
+  float intpolComp;
+  float intpolPhase;
+  #endif
 #endif
+  int pecState;
+  int pecFailure;
+  int pecCycles;
+  int pecUploadIndex;
+  int pecSize;
+  float pecPeakToPeak;
+  // the mount status the last check acted on
+  bool statusValid;
+  bool tracking;
+  bool slewing;
+  bool parked;
+  bool atHome;
+  bool guiding;
+} EncSnapshot;
+
+// the writer bumps the sequence before and after copying so it's odd while busy, a reader retries until it gets
+// the same even sequence on both sides of its copy, the writer never waits on a reader
+class EncSeqlock {
+  public:
+    void write(const EncSnapshot &s) {
+      _seq++; __sync_synchronize();
+      memcpy(&_data,&s,sizeof(EncSnapshot));
+      __sync_synchronize(); _seq++;
+    }
+
+    EncSnapshot read() {
+      EncSnapshot s;
+      uint32_t seq;
+      do {
+        while ((seq=_seq)&1) {}
+        __sync_synchronize();
+        memcpy(&s,&_data,sizeof(EncSnapshot));
+        __sync_synchronize();
+      } while (seq != _seq);
+      return s;
+    }
+
+  private:
+    volatile uint32_t _seq=0;
+    EncSnapshot _data;
+};
+
+// actions the web pages ask for, they're carried out by poll() so only it talks to OnStep about the encoders
+enum EncRequest {ER_SYNC_TO_ONSTEP, ER_SYNC_FROM_ONSTEP, ER_ZERO_FROM_ONSTEP, ER_CLEAR_AVERAGES, ER_PEC_LEARN, ER_PEC_STOP, ER_COUNT};
 
 // ----------------------------------------------------------------------------------------------------------------
 // background process position/rate control for encoders 
 class Encoders {
   public:
     void init() {
+#if AXIS1_ENC_KALMAN > 0
+      axis1Kalman.init(arcSecondsPerTick,Axis1EncKalmanTC,AXIS1_ENC_RATE_AUTO);
+#endif
+      publish();
+#ifdef ENC_TASK
+      serialMutex=xSemaphoreCreateRecursiveMutex();
+      xTaskCreatePinnedToCore(task,"encoders",ENC_TASK_STACK,this,1,NULL,ENC_TASK_CORE);
+#endif
     }
 
     // automatically sync the encoders from OnStep's position when at home or parked
@@ -125,14 +231,14 @@ class Encoders {
       if (Axis2EncDiffFrom != OFF && fabs(_osAxis1-_enAxis1) > (double)(Axis1EncDiffFrom/3600.0)) return;
         
       if (Axis1EncRev == ON)
-        axis1Pos.write(-_osAxis1*(double)Axis1EncTicksPerDeg);
+        writeAxis1(-_osAxis1*(double)Axis1EncTicksPerDeg);
       else
-        axis1Pos.write(_osAxis1*(double)Axis1EncTicksPerDeg);
+        writeAxis1(_osAxis1*(double)Axis1EncTicksPerDeg);
 
       if (Axis2EncRev == ON)
-        axis2Pos.write(-_osAxis2*(double)Axis2EncTicksPerDeg);
+        writeAxis2(-_osAxis2*(double)Axis2EncTicksPerDeg);
       else
-        axis2Pos.write(_osAxis2*(double)Axis2EncTicksPerDeg);
+        writeAxis2(_osAxis2*(double)Axis2EncTicksPerDeg);
 
     }
     
@@ -140,29 +246,78 @@ class Encoders {
 #ifdef ENC_HAS_ABSOLUTE
     void zeroFromOnStep() {
   #ifdef ENC_HAS_ABSOLUTE_AXIS1
-      axis1Pos.write(_osAxis1*(double)Axis1EncTicksPerDeg);
+      writeAxis1(_osAxis1*(double)Axis1EncTicksPerDeg);
   #endif
   #ifdef ENC_HAS_ABSOLUTE_AXIS2
-      axis2Pos.write(_osAxis2*(double)Axis2EncTicksPerDeg);
+      writeAxis2(_osAxis2*(double)Axis2EncTicksPerDeg);
   #endif
     }
 #endif
     
     void syncToOnStep() {
-        char s[22];
+        char cmd[40], s[40], v[20];
         // automatically sync OnStep to the encoders' position
-        Ser.print(":SX40,"); Ser.print(_enAxis1,6); Ser.print("#"); Ser.readBytes(s,1);
-        Ser.print(":SX41,"); Ser.print(_enAxis2,6); Ser.print("#"); Ser.readBytes(s,1);
-        Ser.print(":SX42,1#"); Ser.readBytes(s,1);
+        dtostrf(_enAxis1,1,6,v); sprintf(cmd,":SX40,%s#",v); processCommand(cmd,s,webTimeout);
+        dtostrf(_enAxis2,1,6,v); sprintf(cmd,":SX41,%s#",v); processCommand(cmd,s,webTimeout);
+        processCommand(":SX42,1#",s,webTimeout);
+    }
+
+    // safe to call from the web server at any time
+    void request(EncRequest r) { _request[r]=true; }
+    EncSnapshot snapshot() { return _snapshot.read(); }
+
+#ifdef ENC_TASK
+    // called from loop(), the encoder interrupts run on its core so position writes the task asked for are done here
+    void applyWrites() {
+      if (_axis1WritePending) { _axis1WritePending=false; __sync_synchronize(); axis1Pos.write(_axis1Write); }
+      if (_axis2WritePending) { _axis2WritePending=false; __sync_synchronize(); axis2Pos.write(_axis2Write); }
     }
+#endif
+
+    // called from loop(), or by the task on the ESP32
     void poll() {
+      if (taken(ER_SYNC_TO_ONSTEP)) syncToOnStep();
+      if (taken(ER_SYNC_FROM_ONSTEP)) syncFromOnStep();
+#ifdef ENC_HAS_ABSOLUTE
+      if (taken(ER_ZERO_FROM_ONSTEP)) zeroFromOnStep();
+#endif
+      if (taken(ER_PEC_LEARN)) encPec.start();
+      if (taken(ER_PEC_STOP)) encPec.stop();
+#if AXIS1_ENC_RATE_CONTROL == ON
+      if (taken(ER_CLEAR_AVERAGES)) clearAverages();
+#endif
+      update();
+      publish();
+    }
+
+  private:
+    void update() {
+      // learning PEC samples faster than the checks below
+      if (encPec.learning()) {
+        long pos=axis1Pos.read();
+        if (pos != INT32_MAX) { double a=(double)pos/(double)Axis1EncTicksPerDeg; if (Axis1EncRev == ON) a=-a; encPec.poll(a,_status.tracking() && !_status.slewing()); }
+      }
+
+#if AXIS1_ENC_KALMAN > 0
+      // feed the filter every tick logged since last time, if the ISR got too far ahead only the newest is used
+      while (kfTicksRead != kfTicks) {
+        noInterrupts();
+        uint32_t n=kfTicks;
+        if (n-kfTicksRead > KF_TICK_BUFFER-1) kfTicksRead=n-1;
+        uint32_t t=kfTickTime[kfTicksRead%KF_TICK_BUFFER];
+        interrupts();
+        axis1Kalman.update(t,kfTicksRead);
+        kfTicksRead++;
+      }
+#endif
+
       // check encoders and sync OnStep if diff is too great, checks every 2 seconds
       static unsigned long nextEncCheckMs=millis()+(unsigned long)(POLLING_RATE*1000.0);
       unsigned long temp=millis();
       char *conv_end;
       if ((long)(temp-nextEncCheckMs)>0) {
         nextEncCheckMs=temp+(unsigned long)(POLLING_RATE*1000.0);
-        char s[22];
+        char s[40];
         if (command(":GX42#",s) && strlen(s) > 1) {
           double f=strtod(s,&conv_end);
           if (&s[0] != conv_end && f >= -999.9 && f <= 999.9) _osAxis1=f;
@@ -182,14 +337,14 @@ class Encoders {
         _enAxis2=(double)pos/(double)Axis2EncTicksPerDeg;
         if (Axis2EncRev == ON) _enAxis2=-_enAxis2;
 
-        mountStatus.update();
-        if (encAutoSync && mountStatus.valid() && !_enAxis1Fault && !_enAxis2Fault) {
-          if (mountStatus.atHome() || mountStatus.parked() || mountStatus.aligning() || mountStatus.syncToEncodersOnly()) {
+        _status.update();
+        if (encAutoSync && _status.valid() && !_enAxis1Fault && !_enAxis2Fault) {
+          if (_status.atHome() || _status.parked() || _status.aligning() || _status.syncToEncodersOnly()) {
             syncFromOnStep();
             // re-enable normal operation once we're updated here
-            if (mountStatus.syncToEncodersOnly()) { Ser.print(":SX43,1#"); Ser.readBytes(s,1); }
+            if (_status.syncToEncodersOnly()) processCommand(":SX43,1#",s,webTimeout);
           } else
-            if (!mountStatus.slewing() && !mountStatus.guiding()) {
+            if (!_status.slewing() && !_status.guiding() && !encPec.learning()) {
               if ((fabs(_osAxis1-_enAxis1)>(double)(Axis1EncDiffTo/3600.0)) ||
                   (fabs(_osAxis2-_enAxis2)>(double)(Axis2EncDiffTo/3600.0))) syncToOnStep();
             }
@@ -207,15 +362,21 @@ class Encoders {
         Tsta/=AXIS1_ENC_BIN_AVG; // each period is AXIS1_ENC_BIN_AVG X longer than the step to step frequency
         Tlta/=AXIS1_ENC_BIN_AVG;
 #endif
+#if AXIS1_ENC_KALMAN > 0
+        axis1EncRateSta=(axis1Kalman.rate()/15.041)+axis1EncRateComp;
+        axis1EncRateLta=(axis1Kalman.meanRate()/15.041)+axis1EncRateComp;
+#else
         axis1EncRateSta=(usPerTick/Tsta)+axis1EncRateComp;
         axis1EncRateLta=(usPerTick/Tlta)+axis1EncRateComp;
+#endif
 
         // get the tracking rate OnStep thinks it has once every ten seconds
         static int pass=-1;
         pass++;
         if (pass%5==0) {
-          Ser.print(":GX49#"); s[Ser.readBytesUntil('#',s,20)]=0;
-          if (strlen(s)>1) axis1Rate=atof(s); else axis1Rate=0;
+          if (!command(":GX49#",s)) s[0]=0;
+          // the rate includes our trim, take it back out
+          if (strlen(s)>1) axis1Rate=atof(s)-axis1Trim; else axis1Rate=0;
         }
 
         // reset averages if rate is too fast or too slow
@@ -226,7 +387,7 @@ class Encoders {
         if ((long)(millis()-resetTimeout)<15000L) { clearAverages(); return; }
 
         // encoder rate control disabled
-        if (!encRateControl) return;
+        if (!encRateControl) { if (axis1Trim != 0.0) clearTrim(); return; }
           
 #if AXIS1_ENC_INTPOL_COS == ON
         long a1=axis1Pos.read();
@@ -247,6 +408,20 @@ class Encoders {
         axis1RateDelta+=(axis1Rate-axis1EncRateSta)*POLLING_RATE;
 #endif
 
+        // closed loop tracking, the rate error sets OnStep's rate trim directly so there are no guide pulses
+        if (encTrimSupport == 1) {
+          float e=axis1Rate-axis1EncRateSta;
+          axis1TrimI+=e*POLLING_RATE/ENC_TRIM_TI;
+          if (axis1TrimI>+ENC_TRIM_MAX) axis1TrimI=+ENC_TRIM_MAX;
+          if (axis1TrimI<-ENC_TRIM_MAX) axis1TrimI=-ENC_TRIM_MAX;
+          float t=e*((float)Axis1EncProp/100.0)+axis1TrimI;
+          if (t>+ENC_TRIM_MAX) t=+ENC_TRIM_MAX;
+          if (t<-ENC_TRIM_MAX) t=-ENC_TRIM_MAX;
+          if (setTrim(t)) axis1Trim=t;
+          guideCorrectionMillis=0;
+          return;
+        }
+
         // accumulate tracking rate departures for pulse-guide, rate delta * 2 seconds
         guideCorrection+=(axis1Rate-axis1EncRateSta)*((float)Axis1EncProp/100.0)*POLLING_RATE;
 
@@ -254,12 +429,12 @@ class Encoders {
         if (guideCorrection<-POLLING_RATE) clearAverages(); else
         if (guideCorrection>Axis1EncMinGuide/1000.0) {
           guideCorrectionMillis=round(guideCorrection*1000.0);
-          Ser.print(":Mgw"); Ser.print(guideCorrectionMillis); Ser.print("#");
+          char cmd[20]; sprintf(cmd,":Mgw%ld#",guideCorrectionMillis); processCommand(cmd,s,webTimeout);
           guideCorrection=0;
         } else
         if (guideCorrection<-Axis1EncMinGuide/1000.0) {
           guideCorrectionMillis=round(guideCorrection*1000.0);
-          Ser.print(":Mge"); Ser.print(-guideCorrectionMillis); Ser.print("#");
+          char cmd[20]; sprintf(cmd,":Mge%ld#",-guideCorrectionMillis); processCommand(cmd,s,webTimeout);
           guideCorrection=0;
         } else 
           guideCorrectionMillis=0;
@@ -267,6 +442,7 @@ class Encoders {
       }
     }
 
+  public:
 #if AXIS1_ENC_RATE_CONTROL == ON
     void clearAverages() {
       double d=usPerTick*axis1Rate;
@@ -277,24 +453,114 @@ class Encoders {
       Tlta=d;
       axis1EncRateSta=usPerTick/d;
       axis1EncRateLta=usPerTick/d;
+#if AXIS1_ENC_KALMAN > 0
+      axis1Kalman.reset(axis1Rate*15.041);
+#endif
       guideCorrection=0.0;
       guideCorrectionMillis=0;
+      clearTrim();
 #if AXIS1_ENC_RATE_AUTO > 0
       axis1EncRateComp=0.0;
       axis1RateDelta=0;
       nextWormPeriod=millis()+(unsigned long)(AXIS1_ENC_RATE_AUTO)*997UL;;
 #endif
     }
+
+    // also finds out if OnStep has the trim command, older versions reply 0 and we fall back to guiding
+    void clearTrim() {
+      axis1Trim=0.0;
+      axis1TrimI=0.0;
+      encTrimSupport=setTrim(0.0)?1:0;
+    }
+
+    bool setTrim(float t) {
+      char cmd[40], s[40]="", v[20];
+      dtostrf(t,1,8,v); sprintf(cmd,":SX44,%s#",v);
+      return processCommand(cmd,s,webTimeout) && (s[0] == '1');
+    }
 #endif
   
-    double getAxis1() { return _enAxis1; }
-    double getAxis2() { return _enAxis2; }
-    bool validAxis1() { return !_enAxis1Fault; }
-    bool validAxis2() { return !_enAxis2Fault; }
-    double getOnStepAxis1() { return _osAxis1; }
-    double getOnStepAxis2() { return _osAxis2; }
-
   private:
+    bool taken(EncRequest r) {
+      if (!_request[r]) return false;
+      _request[r]=false;
+      return true;
+    }
+
+    void publish() {
+      EncSnapshot s;
+      s.osAxis1=_osAxis1;
+      s.osAxis2=_osAxis2;
+      s.enAxis1=_enAxis1;
+      s.enAxis2=_enAxis2;
+      s.enAxis1Fault=_enAxis1Fault;
+      s.enAxis2Fault=_enAxis2Fault;
+#if AXIS1_ENC_RATE_CONTROL == ON
+      s.rate=axis1Rate;
+      s.rateSta=axis1EncRateSta;
+      s.rateLta=axis1EncRateLta;
+      s.rateComp=axis1EncRateComp;
+      s.trim=axis1Trim;
+      s.trimSupport=encTrimSupport;
+      s.guideMillis=guideCorrectionMillis;
+  #if AXIS1_ENC_INTPOL_COS == ON
+      s.intpolComp=intpolComp;
+      s.intpolPhase=intpolPhase;
+  #endif
+#endif
+      s.pecState=encPec.state();
+      s.pecFailure=encPec.failure();
+      s.pecCycles=encPec.cycles();
+      s.pecUploadIndex=encPec.uploadIndex();
+      s.pecSize=encPec.size();
+      s.pecPeakToPeak=encPec.peakToPeak();
+      s.statusValid=_status.valid();
+      s.tracking=_status.tracking();
+      s.slewing=_status.slewing();
+      s.parked=_status.parked();
+      s.atHome=_status.atHome();
+      s.guiding=_status.guiding();
+      _snapshot.write(s);
+    }
+
+    void writeAxis1(int32_t v) {
+#ifdef ENC_TASK
+      _axis1Write=v; __sync_synchronize(); _axis1WritePending=true;
+#else
+      axis1Pos.write(v);
+#endif
+    }
+
+    void writeAxis2(int32_t v) {
+#ifdef ENC_TASK
+      _axis2Write=v; __sync_synchronize(); _axis2WritePending=true;
+#else
+      axis2Pos.write(v);
+#endif
+    }
+
+#ifdef ENC_TASK
+    // everything it sends OnStep goes through processCommand(), which holds the serial link for just that command
+    static void task(void *param) {
+      Encoders *e=(Encoders*)param;
+      TickType_t last=xTaskGetTickCount();
+      for (;;) {
+        e->poll();
+        vTaskDelayUntil(&last,pdMS_TO_TICKS(ENC_TASK_PERIOD_MS));
+      }
+    }
+
+    volatile int32_t _axis1Write=0;
+    volatile int32_t _axis2Write=0;
+    volatile bool _axis1WritePending=false;
+    volatile bool _axis2WritePending=false;
+#endif
+
+    // the mount status as seen by the encoders, only poll() updates it so the web pages' mountStatus stays on their core
+    MountStatus _status;
+
+    EncSeqlock _snapshot;
+    volatile bool _request[ER_COUNT]={};
     double _osAxis1=0;
     double _osAxis2=0;
     double _enAxis1=0;
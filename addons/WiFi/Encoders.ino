@@ -167,6 +167,42 @@ const char html_encSweepEn2[] PROGMEM =
 "<button type='button' onpointerdown=\"s('sw','off')\" >" L_OFF "</button>"
 "<br /><br />";
 
+#ifdef ENC_HAS_CAPTURE
+const char html_encCapture1[] PROGMEM =
+"<script>"
+"function capGet(asPerTick) {"
+  "fetch('encCap.csv').then(function(r) { return r.text(); }).then(function(txt) {"
+    "var a=document.createElement('a'); a.href=URL.createObjectURL(new Blob([txt],{type:'text/csv'})); a.download='enccap.csv'; a.click();"
+    // unwrap the 32 bit clock counts into seconds
+    "var l=txt.split('\\n'),cpu=1,t=[],p=[],w=0,last=-1,i;"
+    "for (i=0; i<l.length; i++) {"
+      "if (l[i].charAt(0)=='#') { cpu=parseFloat(l[i].substr(2)); continue; }"
+      "var v=l[i].split(','); if (v.length<2) continue;"
+      "var c=parseFloat(v[0]); if (last>=0 && c<last) w+=4294967296; last=c;"
+      "t.push((c+w)/cpu/1000000.0); p.push(parseFloat(v[1]));"
+    "}"
+    "var n=t.length; if (n<2) return;"
+    // residual from a straight line fit is the periodic error and any resonances, in arc-seconds
+    "var st=0,sp=0,stt=0,stp=0,t0=t[0],p0=p[0];"
+    "for (i=0; i<n; i++) { t[i]-=t0; p[i]-=p0; st+=t[i]; sp+=p[i]; stt+=t[i]*t[i]; stp+=t[i]*p[i]; }"
+    "var m=(n*stp-st*sp)/(n*stt-st*st),b=(sp-m*st)/n,lo=1e9,hi=-1e9;"
+    "for (i=0; i<n; i++) { p[i]=(p[i]-(m*t[i]+b))*asPerTick; if (p[i]<lo) lo=p[i]; if (p[i]>hi) hi=p[i]; }"
+    "document.getElementById('capPP').innerText=(hi-lo).toFixed(2)+'\" p-p, '+n+' / '+t[n-1].toFixed(1)+'s';"
+    "var ctx=document.getElementById('capCanvas').getContext('2d'),sy=280/((hi-lo)||1);"
+    "ctx.clearRect(0,0,600,300); ctx.beginPath(); ctx.strokeStyle='#6666ff';"
+    "for (i=0; i<n; i++) { var x=t[i]/(t[n-1]||1)*600,y=290-(p[i]-lo)*sy; if (i==0) ctx.moveTo(x,y); else ctx.lineTo(x,y); }"
+    "ctx.stroke();"
+  "});"
+"}"
+"</script>\n"
+"<br />" L_ENC_CAPTURE ":<br />"
+"<button type='button' onpointerdown=\"s('cp','on')\" >" L_START "</button>"
+"<button type='button' onpointerdown=\"s('cp','off')\" >" L_STOP "</button>";
+const char html_encCapture2[] PROGMEM =
+"<button type='button' onpointerdown=\"capGet(%ld/1000.0)\" >" L_DOWNLOAD "</button> <span id='capPP'></span><br />"
+"<br /><canvas id='capCanvas' width='600' height='300' style='margin-left: -2px; border:2px solid #999999;'></canvas><br />";
+#endif
+
 const char html_encEnd[] PROGMEM = 
 "</form>";
 
@@ -184,43 +220,26 @@ void handleEncoders() {
   
   processEncodersGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
 
-  String data=FPSTR(html_headB);
+  data += FPSTR(html_headB);
 
   // active ajax page is: encAjax();
   data +="<script>var ajaxPage='enc.txt';</script>\n";
   data +=FPSTR(html_ajax_active);
   data +="<script>auto2Rate=2;</script>";
-  sendHtml(data);
 
   data += html_encScript1;
-  sendHtml(data);
 
 #if AXIS1_ENC_RATE_CONTROL == ON
   data += html_encScript2;
-  sendHtml(data);
 #endif
 
   // send a standard http response header
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  sendHtml(data);
-  data += FPSTR(html_main_css6);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_btns1);
-  sendHtml(data);
-  data += FPSTR(html_main_css_btns2);
-  data += FPSTR(html_main_css_btns3);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   {
@@ -237,7 +256,6 @@ void handleEncoders() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncS);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -245,10 +263,9 @@ void handleEncoders() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data+="<div style='width: 35em;'>";
 
@@ -262,7 +279,6 @@ void handleEncoders() {
   // Autosync
   data += FPSTR(html_encEn1);
   data += FPSTR(html_encEn2);
-  sendHtml(data);
   
   // Encoder sync thresholds
   data += FPSTR(html_encMxAxis0);
@@ -270,7 +286,6 @@ void handleEncoders() {
   data += temp;
   sprintf_P(temp,html_encMxAxis2,Axis2EncDiffTo);
   data += temp;
-  sendHtml(data);
   
 #if AXIS1_ENC_RATE_CONTROL == ON
   // OnStep rate control
@@ -283,7 +298,6 @@ void handleEncoders() {
   data += temp;
   sprintf_P(temp,html_encLtaAxis1,Axis1EncLtaSamples);
   data += temp;
-  sendHtml(data);
 
   // Encoder poportional response
   sprintf_P(temp,html_encPropAxis1,Axis1EncProp);
@@ -308,7 +322,6 @@ void handleEncoders() {
   sprintf_P(temp,html_encIntPolMagAxis1,Axis1EncIntPolMag);
   data += temp;
 #endif
-  sendHtml(data);
 
   // Encoder status display
   sprintf(temp,L_ENC_STAT_RATE_AXIS1 ":<br />");
@@ -334,7 +347,6 @@ void handleEncoders() {
   sprintf(temp,"&nbsp; " L_GUIDE " &nbsp;= <span id='rtF'>?</span><br />");
   data += temp;
 
-  sendHtml(data);
 
   data += "<br /><canvas id='myCanvas' width='600' height='300' style='margin-left: -2px; border:2px solid #999999;'></canvas>";
   data += "&nbsp; " L_CENTER ": OnStep " L_RATE ", " L_BLUE ": STA (" L_RANGE " &#xb1;0.1), " L_GREEN ": LTA (" L_RANGE " &#xb1;0.01)<br />";
@@ -342,7 +354,13 @@ void handleEncoders() {
   data += FPSTR(html_encSweepEn1);
   data += FPSTR(html_encSweepEn2);
 
-  encoders.clearAverages();
+#ifdef ENC_HAS_CAPTURE
+  data += FPSTR(html_encCapture1);
+  sprintf_P(temp,html_encCapture2,(long)round(arcSecondsPerTick*1000.0));
+  data += temp;
+#endif
+
+  encoders.request(ER_CLEAR_AVERAGES);
 #endif
 
   // end of page
@@ -350,7 +368,6 @@ void handleEncoders() {
 
   strcpy(temp,"</div></div></body></html>");
   data += temp;
-  sendHtml(data);
 
   sendHtmlDone(data);
 }
@@ -364,26 +381,30 @@ void encAjax() {
   
 #if AXIS1_ENC_RATE_CONTROL == ON
   char temp[20]="";
-  data += "stO|"; sprintf(temp,"%+1.4f\n",axis1Rate); data += temp;
-  data += "stD|"; sprintf(temp,"%+1.4f\n",axis1Rate-axis1EncRateSta); data += temp;
-  data += "stS|"; sprintf(temp,"%+1.4f\n",axis1EncRateSta); data += temp;
-  data += "stL|"; sprintf(temp,"%+1.4f\n",axis1EncRateLta); data += temp;
+  EncSnapshot s=encoders.snapshot();
+  data += "stO|"; sprintf(temp,"%+1.4f\n",s.rate); data += temp;
+  data += "stD|"; sprintf(temp,"%+1.4f\n",s.rate-s.rateSta); data += temp;
+  data += "stS|"; sprintf(temp,"%+1.4f\n",s.rateSta); data += temp;
+  data += "stL|"; sprintf(temp,"%+1.4f\n",s.rateLta); data += temp;
 #if AXIS1_ENC_INTPOL_COS == ON
-  data += "ipC|"; sprintf(temp,"%+1.4f\n",intpolComp); data += temp;
-  data += "ipP|"; sprintf(temp,"%d\n",(int)intpolPhase); data += temp;
+  data += "ipC|"; sprintf(temp,"%+1.4f\n",s.intpolComp); data += temp;
+  data += "ipP|"; sprintf(temp,"%d\n",(int)s.intpolPhase); data += temp;
 #endif
 #if AXIS1_ENC_RATE_AUTO > 0
-  data += "erA|"; sprintf(temp,"%+1.5f\n",axis1EncRateComp); data += temp;
+  data += "erA|"; sprintf(temp,"%+1.5f\n",s.rateComp); data += temp;
 #endif
 
-if (guideCorrectionMillis==0) {
+if (s.trimSupport == 1) {
+  data += "rtF|"; sprintf(temp,"%+1.5f\n",s.trim); data += temp;
+} else
+if (s.guideMillis==0) {
   data += "rtF|"; sprintf(temp,L_NONE "\n"); data += temp;
 } else
-if (guideCorrectionMillis>0) {
-  data += "rtF|"; sprintf(temp,L_WEST " %ld ms\n",guideCorrectionMillis); data += temp;
+if (s.guideMillis>0) {
+  data += "rtF|"; sprintf(temp,L_WEST " %ld ms\n",s.guideMillis); data += temp;
 } else
-if (guideCorrectionMillis<0) {
-  data += "rtF|"; sprintf(temp,L_EAST " %ld ms\n",-guideCorrectionMillis); data += temp;
+if (s.guideMillis<0) {
+  data += "rtF|"; sprintf(temp,L_EAST " %ld ms\n",-s.guideMillis); data += temp;
 }
 
   data += "orc|"; if (encRateControl) data+=L_ON "\n"; else data+=L_OFF "\n";
@@ -413,16 +434,41 @@ void encAjaxGet() {
 #endif
 }
 
+#ifdef ENC_HAS_CAPTURE
+// bulk download of the tick capture, a "clock count,position" line for each edge, the space is freed as it's sent
+#ifdef OETHS
+void encCaptureAjax(EthernetClient *client) {
+  HtmlWriter data;
+  data.begin(client);
+#else
+void encCaptureAjax() {
+  HtmlWriter data;
+  data.begin("text/plain");
+#endif
+  char temp[40];
+  sprintf(temp,"# %lu clocks/us, %lu overruns\n",(unsigned long)ClockCountToMicros,(unsigned long)encCaptureOverruns);
+  data += temp;
+  uint32_t head=encCaptureHead;
+  while (encCaptureTail != head) {
+    uint32_t i=encCaptureTail%AXIS1_ENC_CAPTURE;
+    sprintf(temp,"%lu,%ld\n",(unsigned long)encCaptureT[i],(long)encCaptureP[i]);
+    data += temp;
+    encCaptureTail++;
+  }
+  sendHtmlDone(data);
+}
+#endif
+
 void processEncodersGet() {
   boolean EEwrite=false;
   String v;
   
   v=server.arg("ms");
   if (v!="") {
-    if (v=="ons") encoders.syncToOnStep();
-    if (v=="enc") encoders.syncFromOnStep();
+    if (v=="ons") encoders.request(ER_SYNC_TO_ONSTEP);
+    if (v=="enc") encoders.request(ER_SYNC_FROM_ONSTEP);
 #ifdef ENC_HAS_ABSOLUTE
-    if (v=="zro") encoders.zeroFromOnStep();
+    if (v=="zro") encoders.request(ER_ZERO_FROM_ONSTEP);
 #endif
   }
 
@@ -544,6 +590,15 @@ void processEncodersGet() {
     if (v=="off") encSweep=false;
   }
 
+#ifdef ENC_HAS_CAPTURE
+  // Tick capture, starting throws away anything not yet downloaded
+  v=server.arg("cp");
+  if (v!="") {
+    if (v=="on") { encCaptureOn=false; encCaptureTail=encCaptureHead; encCaptureOverruns=0; encCaptureOn=true; }
+    if (v=="off") encCaptureOn=false;
+  }
+#endif
+
 #endif // AXIS1_ENC_RATE_CONTROL == ON
 
   nv.commit();
@@ -25,13 +25,13 @@ const char html_settingsBrowserTime[] PROGMEM =
 "' '+pad(now.getUTCHours().toString(),2)+':'+pad(now.getUTCMinutes().toString(),2)+':'+pad(now.getUTCSeconds().toString(),2); "
 "</script><br />\r\n";
 
-const char html_indexDate[] PROGMEM = "&nbsp;&nbsp;<font class='c'>%s</font>";
-const char html_indexTime[] PROGMEM = "&nbsp;<font class='c'>%s</font>&nbsp;" L_UT;
-const char html_indexSidereal[] PROGMEM = "&nbsp;(<font class='c'>%s</font>&nbsp; " L_LST ")<br />";
+const char html_indexDate[] PROGMEM = "&nbsp;&nbsp;<font id='idx_date' class='c'>%s</font>";
+const char html_indexTime[] PROGMEM = "&nbsp;<font id='idx_time' class='c'>%s</font>&nbsp;" L_UT;
+const char html_indexSidereal[] PROGMEM = "&nbsp;(<font id='idx_lst' class='c'>%s</font>&nbsp; " L_LST ")<br />";
 const char html_indexSite[] PROGMEM = "&nbsp;&nbsp;" L_LONG " = <font class='c'>%s</font>, " L_LAT " = <font class='c'>%s</font><br />";
 
-const char html_indexPosition[] PROGMEM = "&nbsp;&nbsp;" L_CURRENT ": " Axis1 "=<font class='c'>%s</font>, " Axis2 "=<font class='c'>%s</font><br />";
-const char html_indexTarget[] PROGMEM = "&nbsp;&nbsp;" L_TARGET ": " Axis1 "=<font class='c'>%s</font>, " Axis2 "=<font class='c'>%s</font><br />";
+const char html_indexPosition[] PROGMEM = "&nbsp;&nbsp;" L_CURRENT ": " Axis1 "=<font id='idx_ra' class='c'>%s</font>, " Axis2 "=<font id='idx_dec' class='c'>%s</font><br />";
+const char html_indexTarget[] PROGMEM = "&nbsp;&nbsp;" L_TARGET ": " Axis1 "=<font id='idx_tra' class='c'>%s</font>, " Axis2 "=<font id='idx_tdec' class='c'>%s</font><br />";
 #if ENCODERS == ON
 const char html_indexEncoder1[] PROGMEM = "&nbsp;&nbsp;OnStep: Ax1=<font class='c'>%s</font>, Ax2=<font class='c'>%s</font><br />";
 const char html_indexEncoder2[] PROGMEM = "&nbsp;&nbsp;" L_ENCODER ": Ax1=<font class='c'>%s</font>, Ax2=<font class='c'>%s</font><br />";
@@ -69,27 +69,14 @@ void handleRoot() {
   char temp1[120]="";
   char temp2[120]="";
 
-  sendHtmlStart();
-
-  String data=FPSTR(html_headB);
-  data += FPSTR(FPSTR(html_headerIdx)); // page refresh
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  data += FPSTR(html_main_css6);
-  sendHtml(data);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_css_control1);
-  data += FPSTR(html_main_css_control2);
-  data += FPSTR(html_main_css_control3);
-  data += FPSTR(html_main_cssE);
+  HtmlWriter data;
+  sendHtmlStart(data);
+
+  data += FPSTR(html_headB);
+  data += FPSTR(FPSTR(html_headerIdx)); // page reload
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -103,7 +90,6 @@ void handleRoot() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
@@ -111,10 +97,9 @@ void handleRoot() {
   data += FPSTR(html_linksWifiN);
 #endif
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data+="<div style='width: 27em;'>";
 
@@ -143,7 +128,6 @@ void handleRoot() {
   if (!command(":GtH#",temp2)) strcpy(temp2,"?"); temp2[9]=0;
   sprintf_P(temp,html_indexSite,temp1,temp2);
   data += temp;
-  sendHtml(data);
 
   // Ambient conditions
 #if DISPLAY_WEATHER == ON
@@ -188,15 +172,16 @@ void handleRoot() {
 
 #if ENCODERS == ON
   // RA,Dec OnStep position
+  EncSnapshot e=encoders.snapshot();
   double f;
-  f=encoders.getOnStepAxis1(); doubleToDms(temp1,&f,true,true);
-  f=encoders.getOnStepAxis2(); doubleToDms(temp2,&f,true,true);
+  f=e.osAxis1; doubleToDms(temp1,&f,true,true);
+  f=e.osAxis2; doubleToDms(temp2,&f,true,true);
   sprintf_P(temp,html_indexEncoder1,temp1,temp2);
   data += temp;
 
   // RA,Dec encoder position
-  if (encoders.validAxis1()) { f=encoders.getAxis1(); doubleToDms(temp1,&f,true,true); } else strcpy(temp1," ** " L_FAULT " ** ");
-  if (encoders.validAxis2()) { f=encoders.getAxis2(); doubleToDms(temp2,&f,true,true); } else strcpy(temp2," ** " L_FAULT " ** ");
+  if (!e.enAxis1Fault) { f=e.enAxis1; doubleToDms(temp1,&f,true,true); } else strcpy(temp1," ** " L_FAULT " ** ");
+  if (!e.enAxis2Fault) { f=e.enAxis2; doubleToDms(temp2,&f,true,true); } else strcpy(temp2," ** " L_FAULT " ** ");
   sprintf_P(temp,html_indexEncoder2,temp1,temp2);
   data += temp;
 #endif
@@ -215,7 +200,6 @@ void handleRoot() {
   if (!mountStatus.valid()) strcpy(temp2,"?");
   sprintf_P(temp,html_indexPier,temp1,temp2);
   data += temp;
-  sendHtml(data);
 
   long lat=LONG_MIN; if (command(":Gt#",temp1)) { temp1[3]=0; if (temp1[0]=='+') temp1[0]='0'; lat=strtol(temp1,NULL,10); }
   if (abs(lat)<=89) {
@@ -247,7 +231,6 @@ void handleRoot() {
       data += temp;
     }
   }
-  sendHtml(data);
 
   data+="<br /><b>" L_OPERATIONS ":</b><br />";
 
@@ -275,7 +258,6 @@ void handleRoot() {
   if (temp2[strlen(temp2)-2]==',') { temp2[strlen(temp2)-2]=0; strcat(temp2,"</font>)<font class=\"c\">"); } else strcpy(temp2,"");
   sprintf_P(temp,html_indexTracking,temp1,temp2);
   data += temp;
-  sendHtml(data);
 
   // Tracking rate
   if ((command(":GT#",temp1)) && (strlen(temp1)>6)) {
@@ -298,7 +280,6 @@ void handleRoot() {
     } else sprintf_P(temp,html_indexMaxSpeed,"?");
     data += temp;
   }
-  sendHtml(data);
 
   data+="<br /><b>" L_STATE ":</b><br />";
 
@@ -381,8 +362,39 @@ void handleRoot() {
   data += temp;
 #endif
   data += "</div><br class=\"clear\" />\r\n";
+
+  // the time and coordinates above are pushed over the WebSocket: see indexAjaxData()
+  data += "<script>var ajaxPage=''; var wsPage='index';"
+          "function wsOpen() { clearTimeout(idxReload); idxReload=setTimeout(function(){location.href='/index.htm';},30000); }</script>\n";
+  data += FPSTR(html_ajax_active);
   data += "</div></body></html>";
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
+
+// the fast changing values on the status page, in the same "id|value" form as the Ajax pages
+String indexAjaxData() {
+  String data="";
+  char temp[40]="";
+
+  if (!command(":GX81#",temp)) strcpy(temp,"?"); stripNum(temp);
+  data += "idx_date|"; data += temp; data += "\n";
+  if (!command(":GX80#",temp)) strcpy(temp,"?");
+  data += "idx_time|"; data += temp; data += "\n";
+  if (!command(":GS#",temp)) strcpy(temp,"?");
+  data += "idx_lst|"; data += temp; data += "\n";
+
+#if DISPLAY_HIGH_PRECISION_COORDS == ON
+  if (!command(":GRa#",temp)) strcpy(temp,"?"); data += "idx_ra|"; data += temp; data += "\n";
+  if (!command(":GDe#",temp)) strcpy(temp,"?"); data += "idx_dec|"; data += temp; data += "\n";
+  if (!command(":Gra#",temp)) strcpy(temp,"?"); data += "idx_tra|"; data += temp; data += "\n";
+  if (!command(":Gde#",temp)) strcpy(temp,"?"); data += "idx_tdec|"; data += temp; data += "\n";
+#else
+  if (!command(":GR#",temp)) strcpy(temp,"?"); data += "idx_ra|"; data += temp; data += "\n";
+  if (!command(":GD#",temp)) strcpy(temp,"?"); data += "idx_dec|"; data += temp; data += "\n";
+  if (!command(":Gr#",temp)) strcpy(temp,"?"); data += "idx_tra|"; data += temp; data += "\n";
+  if (!command(":Gd#",temp)) strcpy(temp,"?"); data += "idx_tdec|"; data += temp; data += "\n";
+#endif
+
+  return data;
+}
@@ -34,8 +34,10 @@ class MountStatus {
 
       if (!command(":GU#",s) || s[0] == 0) { _valid=false; return false; }
 
-      _tracking=false; _slewing=false;
-      if (!strstr(s,"N")) _slewing=true; else _tracking=(!strstr(s,"n"));
+      // worked out first so a reader never sees both false in passing
+      bool tracking=false, slewing=false;
+      if (!strstr(s,"N")) slewing=true; else tracking=(!strstr(s,"n"));
+      _tracking=tracking; _slewing=slewing;
 
       _parked      = strstr(s,"P");
       if (strstr(s,"p")) _parked=false;
@@ -85,7 +87,6 @@ class MountStatus {
         featureUpdate();
         
         // get driver status
-        static int driverStatusTries = 0;
         _validStepperDriverStatus = false;
         _stst1 = false; _olb1 = false; _ola1 = false; _s2ga1 = false; _s2gb1 = false; _ot1 = false; _otpw1 = false;
         _stst2 = false; _olb2 = false; _ola2 = false; _s2ga2 = false; _s2gb2 = false; _ot2 = false; _otpw2 = false;
@@ -186,15 +187,12 @@ class MountStatus {
     float featureValue3() { return _feature[_featureSelected].value3; }
     float featureValue4() { return _feature[_featureSelected].value4; }
     bool featureScan() {
-      // scan features once
-      static bool scan_features = true;
-
       // get feature status
       for (uint8_t i=0; i<8; i++) {
         char *purpose_str=NULL;
         char s[40],s1[40];
 
-        if (scan_features) {
+        if (_scanFeatures) {
           sprintf(s1,":GXY%d#",i+1);
           if (!command(s1,s) || s[0]==0) _valid=false;
           if (!_valid) { for (uint8_t j=0; j<8; j++) _feature[j].purpose=0; _featureFound=false; return false; }
@@ -217,7 +215,7 @@ class MountStatus {
           }
         }
       }
-      scan_features = false;
+      _scanFeatures = false;
       return true;
     }
     bool featureUpdate(bool all = false) {
@@ -287,7 +285,8 @@ class MountStatus {
       return message[0];
     }
   private:
-    // hold state of aux features
+    // hold state of aux features, scanned once
+    bool _scanFeatures = true;
     bool _featureFound = false;
     int _featureSelected=0;
     typedef struct Features {
@@ -332,6 +331,7 @@ class MountStatus {
 
     Errors _lastError=ERR_NONE;
     bool _validStepperDriverStatus = false;
+    int driverStatusTries = 0;
     bool _comms1 = false;
     bool _stst1 = false;
     bool _olb1 = false;
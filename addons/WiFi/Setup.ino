@@ -112,24 +112,14 @@ void handleWifi() {
   
   processWifiGet();
 
-  sendHtmlStart();
+  HtmlWriter data;
+  sendHtmlStart(data);
 
   // send a standard http response header
-  String data=FPSTR(html_headB);
-  data += FPSTR(html_main_cssB);
-  data += FPSTR(html_main_css1);
-  data += FPSTR(html_main_css2);
-  data += FPSTR(html_main_css3);
-  data += FPSTR(html_main_css4);
-  data += FPSTR(html_main_css5);
-  sendHtml(data);
-  data += FPSTR(html_main_css6);
-  data += FPSTR(html_main_css7);
-  data += FPSTR(html_main_css8);
-  data += FPSTR(html_main_cssE);
+  data += FPSTR(html_headB);
+  data += FPSTR(html_main_css);
   data += FPSTR(html_headE);
   data += FPSTR(html_bodyB);
-  sendHtml(data);
 
   // finish the standard http response header
   data += FPSTR(html_onstep_header1); data += "OnStep";
@@ -143,16 +133,14 @@ void handleWifi() {
 #if ENCODERS == ON
   data += FPSTR(html_linksEncN);
 #endif
-  sendHtml(data);
   data += FPSTR(html_linksPecN);
   data += FPSTR(html_linksSetN);
   data += FPSTR(html_linksCfgN);
   data += FPSTR(html_linksWifiS);
   data += FPSTR(html_onstep_header4);
-  sendHtml(data);
 
   // OnStep wasn't found, show warning and info.
-  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtml(data); sendHtmlDone(data); return; }
+  if (!mountStatus.valid()) { data+= FPSTR(html_bad_comms_message); sendHtmlDone(data); return; }
 
   data+="<div>";
 
@@ -181,7 +169,6 @@ void handleWifi() {
     sprintf_P(temp,html_wifiSSID2,stationDhcpEnabled?"checked":"",stationEnabled?"checked":""); data += temp;
     data += FPSTR(html_wifiSSID3A);
     sprintf_P(temp,html_wifiSSID3B,wifi_ap_ssid,"",wifi_ap_ch); data += temp;
-    sendHtml(data);
   
     uint8_t macap[6] = {0,0,0,0,0,0}; WiFi.softAPmacAddress(macap);
     char wifi_ap_mac[80]="";
@@ -198,7 +185,6 @@ void handleWifi() {
   strcpy(temp,"</div></div></body></html>");
   data += temp;
 
-  sendHtml(data);
   sendHtmlDone(data);
 }
 
@@ -0,0 +1,184 @@
+// -----------------------------------------------------------------------------------
+// Minimal WebSocket server, pushes status text to the browsers (RFC 6455, server to client text frames only)
+#pragma once
+
+#ifdef OETHS
+  #define WsServerType EthernetServer
+  #define WsClientType EthernetClient
+  #define WS_CLIENTS 1 // the W5100 only has four sockets
+#else
+  #define WsServerType WiFiServer
+  #define WsClientType WiFiClient
+  #define WS_CLIENTS 4
+#endif
+
+#define WS_HANDSHAKE_TIMEOUT 1000 // in ms, clients that haven't sent their upgrade request by then are dropped
+
+// SHA-1 of a string, needed for the handshake only
+void wsSha1(const char *msg, uint8_t hash[20]) {
+  uint32_t h[5]={0x67452301,0xEFCDAB89,0x98BADCFE,0x10325476,0xC3D2E1F0};
+  unsigned long len=strlen(msg);
+  unsigned long blocks=(len+8)/64+1;
+  for (unsigned long b=0; b<blocks; b++) {
+    uint32_t w[80];
+    for (int i=0; i<16; i++) {
+      w[i]=0;
+      for (int j=0; j<4; j++) {
+        unsigned long k=b*64+i*4+j;
+        uint8_t c=0;
+        if (k<len) c=msg[k]; else if (k==len) c=0x80; else if (k>=blocks*64-4) c=((len*8)>>(8*(blocks*64-1-k)))&0xff;
+        w[i]=(w[i]<<8)|c;
+      }
+    }
+    for (int i=16; i<80; i++) { uint32_t t=w[i-3]^w[i-8]^w[i-14]^w[i-16]; w[i]=(t<<1)|(t>>31); }
+    uint32_t a=h[0],bb=h[1],c=h[2],d=h[3],e=h[4];
+    for (int i=0; i<80; i++) {
+      uint32_t f,k;
+      if (i<20) { f=(bb&c)|((~bb)&d); k=0x5A827999; } else
+      if (i<40) { f=bb^c^d; k=0x6ED9EBA1; } else
+      if (i<60) { f=(bb&c)|(bb&d)|(c&d); k=0x8F1BBCDC; } else { f=bb^c^d; k=0xCA62C1D6; }
+      uint32_t t=((a<<5)|(a>>27))+f+e+k+w[i];
+      e=d; d=c; c=(bb<<30)|(bb>>2); bb=a; a=t;
+    }
+    h[0]+=a; h[1]+=bb; h[2]+=c; h[3]+=d; h[4]+=e;
+  }
+  for (int i=0; i<20; i++) hash[i]=(h[i/4]>>(24-8*(i%4)))&0xff;
+}
+
+void wsBase64(const uint8_t *data, int len, char *out) {
+  const char b64[]="ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  int o=0;
+  for (int i=0; i<len; i+=3) {
+    uint32_t v=(uint32_t)data[i]<<16; if (i+1<len) v|=(uint32_t)data[i+1]<<8; if (i+2<len) v|=data[i+2];
+    out[o++]=b64[(v>>18)&63]; out[o++]=b64[(v>>12)&63];
+    out[o++]=(i+1<len)?b64[(v>>6)&63]:'='; out[o++]=(i+2<len)?b64[v&63]:'=';
+  }
+  out[o]=0;
+}
+
+class WebSocketServer {
+  public:
+    void init(int port);
+    void poll();
+    bool hasClients();
+    bool wants(char page);
+    void push(String &changes, String &all);
+  private:
+    void handshake(int i);
+    void accept(int i);
+    void send(WsClientType &client, String &text);
+
+    WsServerType *server=NULL;
+    WsClientType clients[WS_CLIENTS];
+    bool fresh[WS_CLIENTS];
+    bool open[WS_CLIENTS];           // handshake done
+    char page[WS_CLIENTS];           // first letter of the path the page opened us with, ws://host:81/control etc.
+
+    // upgrade request parsing, a line at a time as it arrives
+    unsigned long since[WS_CLIENTS];
+    char line[WS_CLIENTS][64];
+    uint8_t lineLen[WS_CLIENTS];
+    char key[WS_CLIENTS][41];
+};
+
+void WebSocketServer::init(int port) {
+  server=new WsServerType(port);
+  server->begin();
+}
+
+// accept new clients and drop closed ones, browsers only send us close/ping frames so anything else is discarded
+void WebSocketServer::poll() {
+  if (server==NULL) return;
+
+  for (int i=0; i<WS_CLIENTS; i++) {
+    if (clients[i] && !clients[i].connected()) clients[i].stop();
+    if (clients[i] && !open[i]) { handshake(i); continue; }
+    if (clients[i] && clients[i].available()>0) {
+      uint8_t opcode=clients[i].read()&0x0f;
+      while (clients[i].available()>0) clients[i].read();
+      if (opcode==8) clients[i].stop();
+    }
+  }
+
+  WsClientType client=server->available();
+  if (!client) return;
+#ifdef OETHS
+  // the Ethernet library hands us any socket with data on this port, including ones we already have
+  for (int i=0; i<WS_CLIENTS; i++) if (clients[i]==client) return;
+#endif
+  for (int i=0; i<WS_CLIENTS; i++) {
+    if (!clients[i]) {
+      clients[i]=client; open[i]=false; page[i]=0;
+      since[i]=millis(); lineLen[i]=0; key[i][0]=0;
+      handshake(i);
+      return;
+    }
+  }
+  client.stop();
+}
+
+bool WebSocketServer::hasClients() {
+  for (int i=0; i<WS_CLIENTS; i++) if (clients[i] && open[i]) return true;
+  return false;
+}
+
+bool WebSocketServer::wants(char p) {
+  for (int i=0; i<WS_CLIENTS; i++) if (clients[i] && open[i] && page[i]==p) return true;
+  return false;
+}
+
+// new clients get everything, the others just what changed
+void WebSocketServer::push(String &changes, String &all) {
+  for (int i=0; i<WS_CLIENTS; i++) {
+    if (!clients[i] || !open[i]) continue;
+    if (fresh[i]) { send(clients[i],all); fresh[i]=false; } else if (changes.length()>0) send(clients[i],changes);
+  }
+}
+
+// takes whatever has arrived of the upgrade request without waiting for the rest, so a slow or idle client can't stall
+// the web server, the blank line after the headers completes it
+void WebSocketServer::handshake(int i) {
+  while (clients[i].available()>0) {
+    char c=clients[i].read();
+    if (c=='\r') continue;
+    if (c!='\n') { if (lineLen[i]<sizeof(line[i])-1) line[i][lineLen[i]++]=c; continue; }
+    line[i][lineLen[i]]=0;
+    if (lineLen[i]==0) { accept(i); return; }
+    if (strncmp(line[i],"GET /",5)==0) page[i]=line[i][5];
+    if (strncmp(line[i],"Sec-WebSocket-Key:",18)==0) {
+      const char *k=&line[i][18]; while (*k==' ') k++;
+      strncpy(key[i],k,40); key[i][40]=0;
+      int l=strlen(key[i]); while ((l>0) && (key[i][l-1]==' ')) key[i][--l]=0;
+    }
+    lineLen[i]=0;
+  }
+  if ((long)(millis()-since[i]) > WS_HANDSHAKE_TIMEOUT) clients[i].stop();
+}
+
+void WebSocketServer::accept(int i) {
+  if (key[i][0]==0) { clients[i].stop(); return; }
+
+  char k[80];
+  uint8_t hash[20];
+  char reply[32];
+  strcpy(k,key[i]);
+  strcat(k,"258EAFA5-E914-47DA-95CA-C5AB0DC85B11");
+  wsSha1(k,hash);
+  wsBase64(hash,20,reply);
+
+  clients[i].print("HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: ");
+  clients[i].print(reply);
+  clients[i].print("\r\n\r\n");
+  open[i]=true;
+  fresh[i]=true;
+}
+
+void WebSocketServer::send(WsClientType &client, String &text) {
+  size_t len=text.length();
+  uint8_t header[4];
+  int n=2;
+  header[0]=0x81; // final frame, text
+  if (len<126) header[1]=len; else { header[1]=126; header[2]=(len>>8)&0xff; header[3]=len&0xff; n=4; }
+  client.write(header,n);
+  client.write((const uint8_t*)text.c_str(),len);
+}
@@ -71,6 +71,7 @@
   #define ENCODERS ON
 #endif
 #include "Locale.h"
+#include "Assets.h"
 #include "Globals.h"
 
 // The settings below are for initialization only, afterward they are stored and recalled from EEPROM and must
@@ -86,17 +87,9 @@ int cmdTimeout=TIMEOUT_CMD;
 Encoders encoders;
 #endif
 
-#ifndef LEGACY_TRANSMIT_ON
-  // macros to help with sending webpage data, chunked
-  #define sendHtmlStart() server.setContentLength(CONTENT_LENGTH_UNKNOWN); server.sendHeader("Cache-Control","no-cache"); server.send(200, "text/html", String());
-  #define sendHtml(x) server.sendContent(x); x=""
-  #define sendHtmlDone(x) server.sendContent("");
-#else
-  // macros to help with sending webpage data, normal method
-  #define sendHtmlStart()
-  #define sendHtml(x)
-  #define sendHtmlDone(x) server.send(200, "text/html", x)
-#endif
+// macros to help with sending webpage data, chunked unless LEGACY_TRANSMIT_ON is defined
+#define sendHtmlStart(x) x.begin()
+#define sendHtmlDone(x) x.done()
 
 #define Default_Password "password"
 char masterPassword[40]=Default_Password;
@@ -128,12 +121,23 @@ IPAddress wifi_ap_sn = IPAddress(255,255,255,0);
 
 #if STANDARD_COMMAND_CHANNEL == ON
   WiFiServer cmdSvr(9999);
-  WiFiClient cmdSvrClient;
 #endif
 
 #if PERSISTENT_COMMAND_CHANNEL == ON
   WiFiServer persistentCmdSvr(9998);
-  WiFiClient persistentCmdSvrClient;
+#endif
+
+#if STANDARD_COMMAND_CHANNEL == ON || PERSISTENT_COMMAND_CHANNEL == ON
+  // clients on either port share these slots, each has its own command buffer and they take turns on the serial link to OnStep
+  #define CMD_SVR_CLIENTS 4
+  typedef struct {
+    WiFiClient client;
+    char cmdBuffer[40];
+    int cmdBufferPos;
+    unsigned long clientTime;
+    bool persistent;
+  } CmdSvrClient;
+  CmdSvrClient cmdSvrClients[CMD_SVR_CLIENTS];
 #endif
 
 void handleNotFound(){
@@ -151,8 +155,26 @@ void handleNotFound(){
   server.send(404, "text/plain", message);
 }
 
+// the pre-compressed static files, the browser keeps them cached and checks back with the ETag at most once a day
+void handleAsset() {
+  for (int i=0; i<WEB_ASSET_COUNT; i++) {
+    if (server.uri()==webAssets[i].uri) {
+      server.sendHeader("ETag",webAssets[i].etag);
+      server.sendHeader("Cache-Control","max-age=86400");
+      if (server.header("If-None-Match")==webAssets[i].etag) { server.send(304); return; }
+      server.sendHeader("Content-Encoding","gzip");
+      server.send_P(200,webAssets[i].contentType,(PGM_P)webAssets[i].data,webAssets[i].len);
+      return;
+    }
+  }
+  handleNotFound();
+}
+
 #include "Accessories.h"
 #include "MountStatus.h"
+#include "HtmlWriter.h"
+#include "WebSocket.h"
+WebSocketServer wsSvr;
 
 void setup(void){
   WiFi.disconnect();
@@ -364,6 +386,9 @@ TryAgain:
   server.on("/enc.htm", handleEncoders);
   server.on("/encA.txt", encAjaxGet);
   server.on("/enc.txt", encAjax);
+#ifdef ENC_HAS_CAPTURE
+  server.on("/encCap.csv", encCaptureAjax);
+#endif
 #endif
   server.on("/library.htm", handleLibrary);
   server.on("/libraryA.txt", libraryAjaxGet);
@@ -377,6 +402,9 @@ TryAgain:
   server.on("/pec.htm", handlePec);
   server.on("/pec.txt", pecAjax);
   server.on("/wifi.htm", handleWifi);
+  for (int i=0; i<WEB_ASSET_COUNT; i++) server.on(webAssets[i].uri, handleAsset);
+  const char* cacheHeaders[]={"If-None-Match"};
+  server.collectHeaders(cacheHeaders,1);
   
   server.onNotFound(handleNotFound);
 
@@ -395,6 +423,9 @@ TryAgain:
   VLF("WEM: Starting port 80 web svr");
   server.begin();
 
+  VLF("WEM: Starting port 81 websocket svr");
+  wsSvr.init(WEBSOCKET_PORT);
+
   // allow time for the background servers to come up
   delay(2000);
 
@@ -412,85 +443,82 @@ TryAgain:
 void loop(void) {
   server.handleClient();
 #if ENCODERS == ON
+  #ifdef ENC_TASK
+  encoders.applyWrites();
+  #else
   encoders.poll();
+  #endif
 #endif
 
-#if STANDARD_COMMAND_CHANNEL == ON
+  // push status changes to the web pages
+  wsSvr.poll();
+  webSocketPush();
+
+#if STANDARD_COMMAND_CHANNEL == ON || PERSISTENT_COMMAND_CHANNEL == ON
   // -------------------------------------------------------------------------------------------------------------------------------
-  // Standard IP connections on port 9999
-
-  // disconnect client
-  static unsigned long clientTime = 0;
-  if (cmdSvrClient && (!cmdSvrClient.connected())) cmdSvrClient.stop();
-  if (cmdSvrClient && ((long)(clientTime-millis())<0)) cmdSvrClient.stop();
-
-  // new client
-  if (!cmdSvrClient && (cmdSvr.hasClient())) {
-    // find free/disconnected spot
-    cmdSvrClient = cmdSvr.available();
-    clientTime=millis()+2000UL;
-  }
+  // Standard IP connections on port 9999 and persistent IP connections on port 9998
 
-  // check clients for data, if found get the command, pass to OnStep and pickup the response, then return the response to client
-  while (cmdSvrClient && cmdSvrClient.connected() && (cmdSvrClient.available()>0)) {
-    static char cmdBuffer[40]="";
-    static int cmdBufferPos=0;
+  // disconnect clients, standard clients get 2 seconds and persistent clients 2 minutes after their last command
+  for (int i=0; i<CMD_SVR_CLIENTS; i++) {
+    CmdSvrClient *c=&cmdSvrClients[i];
+    if (c->client && (!c->client.connected())) c->client.stop();
+    if (c->client && ((long)(c->clientTime-millis())<0)) c->client.stop();
+  }
 
-    // get the data
-    byte b=cmdSvrClient.read();
-    cmdBuffer[cmdBufferPos]=b; cmdBufferPos++; if (cmdBufferPos>39) cmdBufferPos=39; cmdBuffer[cmdBufferPos]=0;
+  // new clients
+#if STANDARD_COMMAND_CHANNEL == ON
+  if (cmdSvr.hasClient()) acceptCmdSvrClient(cmdSvr,false);
+#endif
+#if PERSISTENT_COMMAND_CHANNEL == ON
+  if (persistentCmdSvr.hasClient()) acceptCmdSvrClient(persistentCmdSvr,true);
+#endif
 
-    // send cmd and pickup the response
-    if (b == '#' || (strlen(cmdBuffer) == 1 && b == (char)6)) {
-      char result[40]="";
-      processCommand(cmdBuffer,result,cmdTimeout);               // send cmd to OnStep, pickup response
-      if (strlen(result) > 0) { if (cmdSvrClient && cmdSvrClient.connected()) { cmdSvrClient.print(result); delay(2); } } // client response
-      cmdBuffer[0]=0; cmdBufferPos=0;
-    } else idle();
-  }
+  // one command from each client per pass, starting with a different client each time so nobody gets starved
+  static int nextClient=0;
+  for (int i=0; i<CMD_SVR_CLIENTS; i++) serviceCmdSvrClient(&cmdSvrClients[(nextClient+i)%CMD_SVR_CLIENTS]);
+  nextClient=(nextClient+1)%CMD_SVR_CLIENTS;
   // -------------------------------------------------------------------------------------------------------------------------------
 #endif
 
-#if PERSISTENT_COMMAND_CHANNEL == ON
-  // -------------------------------------------------------------------------------------------------------------------------------
-  // Persistent IP connections on port 9998
-
-  // disconnect client
-  static unsigned long persistentClientTime = 0;
-  if (persistentCmdSvrClient && (!persistentCmdSvrClient.connected())) persistentCmdSvrClient.stop();
-  if (persistentCmdSvrClient && ((long)(persistentClientTime-millis())<0)) persistentCmdSvrClient.stop();
-
-  // new client
-  if (!persistentCmdSvrClient && (persistentCmdSvr.hasClient())) {
-    // find free/disconnected spot
-    persistentCmdSvrClient = persistentCmdSvr.available();
-    persistentClientTime=millis()+120000UL;
-  }
+}
 
-  // check clients for data, if found get the command, pass to OnStep and pickup the response, then return the response to client
-  while (persistentCmdSvrClient && persistentCmdSvrClient.connected() && (persistentCmdSvrClient.available()>0)) {
-    static char cmdBuffer[40]="";
-    static int cmdBufferPos=0;
+#if STANDARD_COMMAND_CHANNEL == ON || PERSISTENT_COMMAND_CHANNEL == ON
+// put a new client in a free slot, if there isn't one it waits on the server until there is
+void acceptCmdSvrClient(WiFiServer &svr, bool persistent) {
+  for (int i=0; i<CMD_SVR_CLIENTS; i++) {
+    CmdSvrClient *c=&cmdSvrClients[i];
+    if (!c->client) {
+      c->client=svr.available();
+      c->client.setNoDelay(true);
+      c->cmdBuffer[0]=0; c->cmdBufferPos=0;
+      c->persistent=persistent;
+      if (persistent) c->clientTime=millis()+120000UL; else c->clientTime=millis()+2000UL;
+      return;
+    }
+  }
+}
 
+// check a client for data, if a command is complete pass it to OnStep and return the response to the client
+void serviceCmdSvrClient(CmdSvrClient *c) {
+  while (c->client && c->client.connected() && (c->client.available()>0)) {
     // still active? push back disconnect by 2 minutes
-    persistentClientTime=millis()+120000UL;
+    if (c->persistent) c->clientTime=millis()+120000UL;
 
     // get the data
-    byte b=persistentCmdSvrClient.read();
-    cmdBuffer[cmdBufferPos]=b; cmdBufferPos++; if (cmdBufferPos>39) cmdBufferPos=39; cmdBuffer[cmdBufferPos]=0;
+    byte b=c->client.read();
+    c->cmdBuffer[c->cmdBufferPos]=b; c->cmdBufferPos++; if (c->cmdBufferPos>39) c->cmdBufferPos=39; c->cmdBuffer[c->cmdBufferPos]=0;
 
     // send cmd and pickup the response
-    if (b == '#' || (strlen(cmdBuffer) == 1 && b == (char)6)) {
+    if (b == '#' || (strlen(c->cmdBuffer) == 1 && b == (char)6)) {
       char result[40]="";
-      processCommand(cmdBuffer,result,cmdTimeout);               // send cmd to OnStep, pickup response
-      if (strlen(result) > 0) { if (persistentCmdSvrClient && persistentCmdSvrClient.connected()) { persistentCmdSvrClient.print(result); delay(2); } } // client response
-      cmdBuffer[0]=0; cmdBufferPos=0;
-    } else idle();
+      processCommand(c->cmdBuffer,result,cmdTimeout);                                         // send cmd to OnStep, pickup response
+      if (strlen(result) > 0) { if (c->client && c->client.connected()) { c->client.print(result); delay(2); } } // client response
+      c->cmdBuffer[0]=0; c->cmdBufferPos=0;
+      return;
+    }
   }
-  // -------------------------------------------------------------------------------------------------------------------------------
-#endif
-
 }
+#endif
 
 const char* HighSpeedCommsStr(long baud) {
   if (baud==115200) { return ":SB0#"; }
@@ -503,7 +531,11 @@ const char* HighSpeedCommsStr(long baud) {
 void idle() {
   server.handleClient(); 
 #if ENCODERS == ON
+  #ifdef ENC_TASK
+  encoders.applyWrites();
+  #else
   encoders.poll();
+  #endif
 #endif
 }
 
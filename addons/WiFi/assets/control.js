@@ -0,0 +1,20 @@
+function s(key,v1) {
+  var xhttp = new XMLHttpRequest();
+  xhttp.open('GET', 'controlA.txt?'+key+'='+v1+'&x='+new Date().getTime(), true);
+  xhttp.send();
+}
+function g(v1){s('dr',v1);}
+function gf(v1){s('dr',v1);autoFastRun();}
+function sf(key,v1){s(key,v1);autoFastRun();}
+
+function SetDateTime() {
+  var d1 = new Date();
+  var jan = new Date(d1.getFullYear(), 0, 1);
+  var d = new Date(d1.getTime()-(jan.getTimezoneOffset()-d1.getTimezoneOffset())*60*1000);
+  document.getElementById('dd').value = d.getDate();
+  document.getElementById('dm').value = d.getMonth();
+  document.getElementById('dy').value = d.getFullYear();
+  document.getElementById('th').value = d.getHours();
+  document.getElementById('tm').value = d.getMinutes();
+  document.getElementById('ts').value = d.getSeconds();
+}
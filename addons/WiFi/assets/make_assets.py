@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+# Builds ../Assets.h from the static web assets in this directory, run it again after editing any of them
+import gzip, os, zlib
+
+ASSETS = [
+  ("main.css",   "/main.css",   "text/css"),
+  ("control.js", "/control.js", "application/javascript"),
+]
+
+here = os.path.dirname(os.path.abspath(__file__))
+out = []
+out.append("// -----------------------------------------------------------------------------------")
+out.append("// Static web assets, gzip compressed")
+out.append("// Generated by assets/make_assets.py from the files in assets/, edit those and run it rather than changing this file")
+out.append("#pragma once")
+out.append("")
+out.append("typedef struct {")
+out.append("  const char *uri;")
+out.append("  const char *contentType;")
+out.append("  const uint8_t *data;")
+out.append("  unsigned int len;")
+out.append("  const char *etag;")
+out.append("} WebAsset;")
+
+table = []
+for fn, uri, ctype in ASSETS:
+  raw = open(os.path.join(here, fn), "rb").read()
+  gz = gzip.compress(raw, 9, mtime=0)
+  name = fn.replace(".", "_")
+  ver = "%08x" % zlib.crc32(raw)
+  out.append("")
+  out.append("// %s, %d bytes compressed from %d" % (fn, len(gz), len(raw)))
+  out.append("#define ASSET_%s_VER \"%s\"" % (name.upper(), ver))
+  out.append("const uint8_t asset_%s[] PROGMEM = {" % name)
+  for i in range(0, len(gz), 16):
+    out.append("  " + "".join("0x%02x," % b for b in gz[i:i+16]))
+  out.append("};")
+  table.append("  { \"%s\", \"%s\", asset_%s, sizeof(asset_%s), \"\\\"%s\\\"\" }," % (uri, ctype, name, name, ver))
+
+out.append("")
+out.append("// the pages link these with ?v=<version> so the browser can cache them until the firmware changes")
+out.append("#define WEB_ASSET_COUNT %d" % len(ASSETS))
+out.append("const WebAsset webAssets[WEB_ASSET_COUNT] = {")
+out += table
+out.append("};")
+
+open(os.path.join(here, "..", "Assets.h"), "w", newline="\n").write("\n".join(out) + "\n")
@@ -25,6 +25,11 @@
 #endif
 #define CACHE_SIZE ((E2END+1)/8)
 
+// Bytes written per page write transaction, must divide the EEPROM page size and fit in the Wire buffer (with 2 address bytes)
+#if !defined(EEPROM_PAGE_WRITE)
+  #define EEPROM_PAGE_WRITE 16
+#endif
+
 #define MSB(i) (i >> 8)
 #define LSB(i) (i & 0xFF)
 
@@ -62,25 +67,29 @@ class nvs {
         if (dirtyW || dirtyR) break;
       }
 
-      // write data as required
+      // write data as required, a run of dirty bytes in the same page goes out in one write cycle
       if (dirtyW) {
-        j=cache[i];        // get data from cache
-        ee_write(i,j);     // store in EEPROM
+        int n=1;
+        while (n < EEPROM_PAGE_WRITE && (i+n)%EEPROM_PAGE_WRITE != 0 && bitRead(cacheWriteState[(i+n)/8],(i+n)%8)) n++;
+        ee_writePage(i,&cache[i],n); // store in EEPROM
         #ifdef NV_VALIDATE
-          uint8_t k;
-          ee_read(i,&k);
-          if (j!=k) {
-            //Serial.print("Write addr "); Serial.print(i); Serial.print(" value "); Serial.print(j); Serial.println(" FAILED");
-            //Serial.println("Restarting Wire");
-            HAL_Wire.end();
-            HAL_Wire.begin();
-            HAL_Wire.setClock(HAL_WIRE_CLOCK);
-            ee_write(i,j);
-            //ee_read(i,&k);
-            //if (j!=k) Serial.println("Second attempt FAILED"); else Serial.println("Second attempt SUCCESS");
+          for (int m=i; m < i+n; m++) {
+            uint8_t k;
+            ee_read(m,&k);
+            if (cache[m]!=k) {
+              //Serial.print("Write addr "); Serial.print(m); Serial.print(" value "); Serial.print(cache[m]); Serial.println(" FAILED");
+              //Serial.println("Restarting Wire");
+              HAL_Wire.end();
+              HAL_Wire.begin();
+              HAL_Wire.setClock(HAL_WIRE_CLOCK);
+              ee_write(m,cache[m]);
+              //ee_read(m,&k);
+              //if (cache[m]!=k) Serial.println("Second attempt FAILED"); else Serial.println("Second attempt SUCCESS");
+            }
           }
         #endif
-        bitWrite(cacheWriteState[i/8],i%8,0); // clean
+        for (int m=i; m < i+n; m++) bitWrite(cacheWriteState[m/8],m%8,0); // clean
+        i+=n-1;
       } else {
         // read data as required
         if (dirtyR) {
@@ -239,6 +248,17 @@ private:
     nextOpMs=millis()+EEPROM_WRITE_WAIT;
   }
 
+  void ee_writePage(int offset, byte *data, int count) {
+    while (!ee_ready()) {}
+    
+    HAL_Wire.beginTransmission(_eeprom_addr);
+    HAL_Wire.write(MSB(offset));
+    HAL_Wire.write(LSB(offset));
+    for (int k=0; k < count; k++) HAL_Wire.write(data[k]);
+    HAL_Wire.endTransmission();
+    nextOpMs=millis()+EEPROM_WRITE_WAIT;
+  }
+
   void ee_read(int offset, byte *data) {
     while (!ee_ready()) {}
     
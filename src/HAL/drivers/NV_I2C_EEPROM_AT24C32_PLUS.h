@@ -27,6 +27,11 @@
 #define CACHE_SIZE ((E2END2+1)/8)
 #define E2END 8191
 
+// Bytes written per page write transaction, must divide the EEPROM page size and fit in the Wire buffer (with 2 address bytes)
+#if !defined(EEPROM_PAGE_WRITE)
+  #define EEPROM_PAGE_WRITE 16
+#endif
+
 #define MSB(i) (i >> 8)
 #define LSB(i) (i & 0xFF)
 
@@ -64,11 +69,13 @@ class nvs {
         if (dirtyW || dirtyR) break;
       }
 
-      // write data as required
+      // write data as required, a run of dirty bytes in the same page goes out in one write cycle
       if (dirtyW) {
-        j=cache[i];        // get data from cache
-        ee_write(i,j);     // store in EEPROM
-        bitWrite(cacheWriteState[i/8],i%8,0); // clean
+        int n=1;
+        while (n < EEPROM_PAGE_WRITE && (i+n)%EEPROM_PAGE_WRITE != 0 && bitRead(cacheWriteState[(i+n)/8],(i+n)%8)) n++;
+        ee_writePage(i,&cache[i],n); // store in EEPROM
+        for (int m=i; m < i+n; m++) bitWrite(cacheWriteState[m/8],m%8,0); // clean
+        i+=n-1;
       } else {
         // read data as required
         if (dirtyR) {
@@ -236,6 +243,17 @@ private:
     nextOpMs=millis()+EEPROM_WRITE_WAIT;
   }
 
+  void ee_writePage(int offset, byte *data, int count) {
+    while (!ee_ready()) {}
+    
+    HAL_Wire.beginTransmission(_eeprom_addr);
+    HAL_Wire.write(MSB(offset));
+    HAL_Wire.write(LSB(offset));
+    for (int k=0; k < count; k++) HAL_Wire.write(data[k]);
+    HAL_Wire.endTransmission();
+    nextOpMs=millis()+EEPROM_WRITE_WAIT;
+  }
+
   void ee_read(int offset, byte *data, byte count) {
     while (!ee_ready()) {}
 
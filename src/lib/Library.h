@@ -20,6 +20,47 @@ typedef union {
 } libRec_t;
 #pragma pack()
 
+// the nearest objects found by a search, in order of distance
+#define LIB_NEAREST_MAX 8
+class libNearest
+{
+  public:
+    void reset(int n) { if (n < 1) n=1; if (n > LIB_NEAREST_MAX) n=LIB_NEAREST_MAX; max=n; count=0; next=0; }
+    inline bool full() { return count >= max; }
+    inline float worst() { return dist[count-1]; }
+    void add(long p, float d) {
+      if (full() && d >= worst()) return;
+      int i=count; if (count < max) count++; else i--;
+      while (i > 0 && dist[i-1] > d) { pos[i]=pos[i-1]; dist[i]=dist[i-1]; i--; }
+      pos[i]=p; dist[i]=d;
+    }
+
+    long pos[LIB_NEAREST_MAX];
+    float dist[LIB_NEAREST_MAX];
+    int count=0;
+    int max=1;
+    int next=0;
+};
+
+// angular distance in degrees, haversine form since most distances of interest are small
+double libAngDist(double RA1, double Dec1, double RA2, double Dec2) {
+  double a=sin((Dec2-Dec1)/(2.0*Rad)); a*=a;
+  double b=sin((RA2-RA1)/(2.0*Rad)); b*=b;
+  a=a+cos(Dec1/Rad)*cos(Dec2/Rad)*b; if (a > 1.0) a=1.0;
+  return 2.0*asin(sqrt(a))*Rad;
+}
+
+#if LIBRARY_COMPACT == ON
+  #include "LibraryCompact.h"
+#else
+
+// RAM index, one byte per record: low 4 bits are the catalog # (15 = free), bit 4 is set for the catalog name ($) record
+// and the high 3 bits are the declination band (22.5 degrees each, starting at -90)
+const long lib_index_size = (E2END-399)/rec_size;
+#define LIB_INDEX_FREE 15
+#define LIB_INDEX_NAME 16
+#define LIB_BANDS      8
+
 class Library
 {
   public:
@@ -36,6 +77,10 @@ class Library
     void writeVars(char* name, int code, double RA, double Dec);
     void readVars(char* name, int* code, double* RA, double* Dec);
 
+    // raw record transfer, for bulk upload/download
+    bool readRawRec(libRec_t* data);
+    bool writeRawRec(libRec_t data);
+
     bool firstRec();
     bool nameRec();
     bool firstFreeRec();
@@ -53,11 +98,29 @@ class Library
     long recFreeAll();      // number records available for this library
     long recPos;            // currently selected record#
     long recMax;            // last record#
+
+    int findNearest(double RA, double Dec, int n); // find the n nearest objects of this catalog, returns the number found
+    bool nextNearest(float* dist);                  // move to the next of those objects, if it exists
     
   private:
     libRec_t readRec(long address);
     void writeRec(long address, libRec_t data);
     void clearRec(long address);
+
+    // keep the RAM index in sync with NV
+    void indexRec(long address, libRec_t data);
+    void unindexRec(long address);
+    inline int indexCat(long address) { return recIndex[address] & 15; }
+    inline bool indexIsObject(long address) { return indexCat(address) == catalog && !(recIndex[address] & LIB_INDEX_NAME); }
+    inline int indexBand(long address) { return recIndex[address]>>5; }
+
+    byte recIndex[lib_index_size];
+    long catCount[15];      // object records (excluding the name record) for each catalog
+    long namePos[15];       // record# of the first name record for each catalog, -1 if none
+    long countAll;          // records in use (index or otherwise)
+    long freeHint;          // no free records exist below this record#
+
+    libNearest near;
     inline double degRange(double d) { while (d >= 360.0) d-=360.0; while (d < 0.0)  d+=360.0; return d; }
 
     int catalog;
@@ -65,10 +128,13 @@ class Library
     long byteMin;
     long byteMax;
 };
+#endif
 
 Library Lib;
 char const * objectStr[] = {"UNK", "OC", "GC", "PN", "DN", "SG", "EG", "IG", "KNT", "SNR", "GAL", "CN", "STR", "PLA", "CMT", "AST"};
 
+#if LIBRARY_COMPACT != ON
+
 Library::Library()
 {
   catalog=0;
@@ -81,6 +147,13 @@ Library::Library()
   if (byteCount > 262143) byteCount=262143; // maximum 256KB
 
   recMax=byteCount/rec_size; // maximum number of records
+  if (recMax > lib_index_size) recMax=lib_index_size;
+
+  // the index is empty until init() scans NV
+  for (long l=0; l < lib_index_size; l++) recIndex[l]=LIB_INDEX_FREE;
+  for (int c=0; c < 15; c++) { catCount[c]=0; namePos[c]=-1; }
+  countAll=0;
+  freeHint=0;
 }
 
 Library::~Library()
@@ -91,9 +164,56 @@ void Library::init() {
   // This is now in the Init() function, because on boards
   // with an I2C EEPROM nv.init() has to be called before
   // anything else
+
+  // build the RAM index, this is the only full scan of the NV records
+  libRec_t work;
+  for (int c=0; c < 15; c++) { catCount[c]=0; namePos[c]=-1; }
+  countAll=0;
+  freeHint=0;
+  for (long l=0; l < recMax; l++) {
+    work=readRec(l);
+    recIndex[l]=LIB_INDEX_FREE;
+    indexRec(l,work);
+  }
+
   firstRec();
 }
 
+void Library::indexRec(long address, libRec_t data)
+{
+  unindexRec(address);
+
+  int cat=(int)data.libRec.code>>4;
+  if (cat == 15) return;
+
+  recIndex[address]=cat | ((data.libRec.Dec>>13)<<5);
+  if (data.libRec.name[0] == '$') {
+    recIndex[address]|=LIB_INDEX_NAME;
+    if (namePos[cat] < 0 || address < namePos[cat]) namePos[cat]=address;
+  } else catCount[cat]++;
+  countAll++;
+}
+
+void Library::unindexRec(long address)
+{
+  int cat=indexCat(address);
+  if (cat == 15) { if (address < freeHint) freeHint=address; return; }
+
+  bool isName=recIndex[address] & LIB_INDEX_NAME;
+  if (!isName) catCount[cat]--;
+  countAll--;
+  recIndex[address]=LIB_INDEX_FREE;
+  if (address < freeHint) freeHint=address;
+
+  // look for another name record if this was the one in use
+  if (isName && namePos[cat] == address) {
+    namePos[cat]=-1;
+    for (long l=address+1; l < recMax; l++) {
+      if (indexCat(l) == cat && (recIndex[l] & LIB_INDEX_NAME)) { namePos[cat]=l; break; }
+    }
+  }
+}
+
 bool Library::setCatalog(int num)
 {
   if (num < 0 || num > 14) return false;
@@ -124,6 +244,7 @@ void Library::writeVars(char* name, int code, double RA, double Dec)
 void Library::readVars(char* name, int* code, double* RA, double* Dec)
 {
   libRec_t work;
+  if (recPos < 0 || recPos >= recMax) { name[0]=0; *code=0; *RA=0.0; *Dec=0.0; return; }
   work=readRec(recPos);
 
   int cat = work.libRec.code>>4;
@@ -144,6 +265,24 @@ void Library::readVars(char* name, int* code, double* RA, double* Dec)
   *Dec=((*Dec/65536.0)*180.0)-90.0;
 }
 
+// read the current record as-is, with advance to next record
+bool Library::readRawRec(libRec_t* data)
+{
+  if (recPos < 0 || recPos >= recMax || !indexIsObject(recPos)) return false;
+  *data=readRec(recPos);
+  if (!nextRec()) recPos=recMax; // past the last record
+  return true;
+}
+
+// write the record as-is (except for the catalog #) to the first unused record
+bool Library::writeRawRec(libRec_t data)
+{
+  if (!firstFreeRec()) return false;
+  data.libRec.code=(data.libRec.code & 15) | (catalog<<4);
+  writeRec(recPos,data);
+  return true;
+}
+
 libRec_t Library::readRec(long address)
 {
   libRec_t work;
@@ -157,6 +296,7 @@ void Library::writeRec(long address, libRec_t data)
   if (address >= 0 && address < recMax) {
     long l=address*rec_size+byteMin;
     for (int m=0; m < 16; m++) nv.write(l+m,data.libRecBytes[m]);
+    indexRec(address,data);
   }
 }
 
@@ -166,18 +306,15 @@ void Library::clearRec(long address)
     long l=address*rec_size+byteMin;
     int code=15<<4;
     nv.write(l+11,(byte)code); // catalog code 15 = deleted
+    unindexRec(address);
   }
 }
 
 bool Library::firstRec()
 {
-  libRec_t work;
-
   // see if first record is for the currentLib
   recPos=0;
-  work=readRec(recPos);
-  int cat=(int)work.libRec.code>>4;
-  if (work.libRec.name[0] != '$' && cat == catalog) return true;
+  if (recMax > 0 && indexIsObject(recPos)) return true;
 
   // otherwise find the first one, if it exists
   return nextRec();
@@ -186,61 +323,29 @@ bool Library::firstRec()
 // move to the catalog name rec
 bool Library::nameRec()
 {
-  libRec_t work;
-
-  int cat;
-  recPos=-1;
-  
-  do
-  {
-    recPos++; if (recPos >= recMax) break;
-    work=readRec(recPos);
-
-    cat=(int)work.libRec.code>>4;
-
-    if (work.libRec.name[0] == '$' && cat == catalog) break;
-  } while (recPos < recMax);
-  if (recPos >= recMax) { recPos=recMax-1; return false; }
-
+  if (namePos[catalog] < 0) { recPos=recMax-1; return false; }
+  recPos=namePos[catalog];
   return true;
 }
 
 // move to first unused record for this catalog
 bool Library::firstFreeRec()
 {
-  libRec_t work;
-
-  int cat;
-  recPos=-1;
-  
-  do
-  {
-    recPos++; if (recPos >= recMax) break;
-    work=readRec(recPos);
-
-    cat=(int)work.libRec.code>>4;
-  
-    if (cat == 15) break; // unused?
-  } while (recPos < recMax);
-  if (recPos >= recMax) { recPos=recMax-1; return false; }
-
-  return true;
+  for (recPos=freeHint; recPos < recMax; recPos++) {
+    if (indexCat(recPos) == 15) { freeHint=recPos; return true; }
+  }
+  freeHint=recMax;
+  recPos=recMax-1;
+  return false;
 }
 
 // read the previous record, if it exists
 bool Library::prevRec()
 {
-  libRec_t work;
-
-  int cat;
-  
   do
   {
     recPos--; if (recPos < 0) break;
-    work=readRec(recPos);
-
-    cat=(int)work.libRec.code>>4;
-    if (work.libRec.name[0] != '$' && cat == catalog) break;
+    if (indexIsObject(recPos)) break;
   } while (recPos >= 0);
   if (recPos < 0) { recPos=0; return false; }
 
@@ -250,17 +355,10 @@ bool Library::prevRec()
 // read the next record, if it exists
 bool Library::nextRec()
 {
-  libRec_t work;
-
-  int cat;
- 
   do
   {
     recPos++; if (recPos >= recMax) break;
-    work=readRec(recPos);
-
-    cat=(int)work.libRec.code>>4;
-    if (work.libRec.name[0] != '$' && cat == catalog) break;
+    if (indexIsObject(recPos)) break;
   } while (recPos < recMax);
   if (recPos >= recMax) { recPos=recMax-1; return false; }
 
@@ -270,17 +368,13 @@ bool Library::nextRec()
 // read the specified record (of this catalog), if it exists
 bool Library::gotoRec(long num)
 {
-  libRec_t work;
-
-  int cat;
   long r=0;
   long c=0;
   
+  if (num > catCount[catalog]) return false;
   for (long l=0; l < recMax; l++) {
-    work=readRec(l); r=l;
-
-    cat=(int)work.libRec.code>>4;
-    if (work.libRec.name[0] != '$' && cat == catalog) c++;
+    r=l;
+    if (indexIsObject(l)) c++;
     if (c == num) break;
   }
   if (c == num) { recPos=r; return true; } else return false;
@@ -289,37 +383,13 @@ bool Library::gotoRec(long num)
 // count all catalog records
 long Library::recCount()
 {
-  libRec_t work;
-
-  int cat;
-  long c=0;
-  
-  for (long l=0; l < recMax; l++) {
-    work=readRec(l);
-
-    cat=(int)work.libRec.code>>4;
-    if (work.libRec.name[0] != '$' && cat == catalog) c++;
-  }
-  
-  return c;
+  return catCount[catalog];
 }
 
 // count all library records (index or otherwise)
 long Library::recCountAll()
 {
-  libRec_t work;
-
-  int cat;
-  long c=0;
-  
-  for (long l=0; l < recMax; l++) {
-    work=readRec(l);
-
-    cat=(int)work.libRec.code>>4;
-    if (cat >= 0 && cat <= 14) c++;
-  }
-  
-  return c;
+  return countAll;
 }
 
 // library records available
@@ -328,31 +398,61 @@ long Library::recFreeAll()
   return recMax-recCountAll();
 }
 
-// mark this catalog record as empty
-void Library::clearCurrentRec()
+// search the declination band with the target first then work outward, skipping bands that can't hold a nearer object
+int Library::findNearest(double RA, double Dec, int n)
 {
   libRec_t work;
+  double r,d;
+
+  near.reset(n);
+  int center=(Dec+90.0)/(180.0/LIB_BANDS); if (center < 0) center=0; if (center > LIB_BANDS-1) center=LIB_BANDS-1;
+  for (int step=0; step < LIB_BANDS; step++) {
+    bool searched=false;
+    for (int side=-1; side <= 1; side+=2) {
+      if (step == 0 && side == 1) continue;
+      int band=center+side*step;
+      if (band < 0 || band > LIB_BANDS-1) continue;
+
+      // closest this band can be to the target
+      double bound=0.0;
+      if (side < 0) bound=Dec-((band+1)*(180.0/LIB_BANDS)-90.0); else bound=(band*(180.0/LIB_BANDS)-90.0)-Dec;
+      if (step > 0 && near.full() && bound > near.worst()) continue;
+
+      searched=true;
+      for (long l=0; l < recMax; l++) {
+        if (!indexIsObject(l) || indexBand(l) != band) continue;
+        work=readRec(l);
+        r=((double)work.libRec.RA/65536.0)*360.0;
+        d=(((double)work.libRec.Dec/65536.0)*180.0)-90.0;
+        near.add(l,libAngDist(RA,Dec,r,d));
+      }
+    }
+    if (step > 0 && !searched) break;
+  }
 
-  int cat;
+  return near.count;
+}
 
-  work=readRec(recPos);
+bool Library::nextNearest(float* dist)
+{
+  if (near.next >= near.count) return false;
+  recPos=near.pos[near.next];
+  *dist=near.dist[near.next];
+  near.next++;
+  return true;
+}
 
-  cat=(int)work.libRec.code>>4;
-  if (cat == catalog) clearRec(recPos);
+// mark this catalog record as empty
+void Library::clearCurrentRec()
+{
+  if (recPos >= 0 && recPos < recMax && indexCat(recPos) == catalog) clearRec(recPos);
 }
 
 // mark all catalog records as empty
 void Library::clearLib()
 {
-  libRec_t work;
-
-  int cat;
-
   for (long l=0; l < recMax; l++) {
-    work=readRec(l);
-
-    cat=(int)work.libRec.code>>4;
-    if (cat == catalog) clearRec(l);
+    if (indexCat(l) == catalog) clearRec(l);
   }
 }
 
@@ -361,3 +461,4 @@ void Library::clearAll()
 {
   for (long l=0;l < recMax;l++) clearRec(l);
 }
+#endif
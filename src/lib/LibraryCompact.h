@@ -0,0 +1,570 @@
+// -----------------------------------------------------------------------------------
+// Object libraries, compact variable length record format (LIBRARY_COMPACT ON)
+
+// NV is divided into blocks of LIB_BLOCK_SIZE bytes, each holds a run of records followed by LIB_END (unless full.)
+// Records don't span blocks and names are front-coded against the previous record in the same block:
+//   header: 1 (high 4 bits are the # of leading name chars shared with the previous record, low are the # that follow)
+//   code:   1 (low 4 bits are object class, high are catalog #, catalog 15 = deleted)
+//   RA:     3 (0..360 degrees scaled to 24 bits)
+//   Dec:    3 (-90..+90 degrees scaled to 24 bits)
+//   name:   0..11 chars
+// recPos is (block# * LIB_BLOCK_RECS) + record# within the block.
+// Switching between this and the standard 16 byte record format requires clearing the library (:L!#)
+
+#pragma once
+
+#define LIB_BLOCK_SIZE 128
+#define LIB_BLOCK_RECS 16  // LIB_BLOCK_SIZE/LIB_REC_MIN, the most records a block can hold
+#define LIB_REC_MIN    8   // header, code, RA, and Dec
+#define LIB_REC_AVG    10  // typical record size, for estimating the free records
+#define LIB_END        0xFF
+
+const long lib_blocks = (E2END-399)/LIB_BLOCK_SIZE;
+
+class Library
+{
+  public:
+    Library();
+    ~Library();
+
+    void init();
+
+    bool setCatalog(int num);
+
+    void writeVars(char* name, int code, double RA, double Dec);
+    void readVars(char* name, int* code, double* RA, double* Dec);
+
+    // raw record transfer, for bulk upload/download
+    bool readRawRec(libRec_t* data);
+    bool writeRawRec(libRec_t data);
+
+    bool firstRec();
+    bool nameRec();
+    bool firstFreeRec();
+    bool prevRec();
+    bool nextRec();
+    bool gotoRec(long num);
+
+    void clearCurrentRec(); // clears this record
+    void clearLib();        // clears this library
+    void clearAll();        // clears all libraries
+
+    long recCount();        // actual number of records for this catalog
+    long recCountAll();     // actual number of records for this library
+    long recFreeAll();      // number records available for this library (estimated)
+    long recPos;            // currently selected record#
+    long recMax;            // last record#
+
+    int findNearest(double RA, double Dec, int n); // find the n nearest objects of this catalog, returns the number found
+    bool nextNearest(float* dist);                  // move to the next of those objects, if it exists
+
+  private:
+    typedef struct {
+      char name[12];
+      byte code;
+      uint32_t RA;
+      uint32_t Dec;
+    } libObj_t;
+
+    void loadBlock(int b);
+    void storeBlock(int b, int len);
+    int decodeNext(int offset, libObj_t* obj);
+    int encodeRec(byte* dest, libObj_t* obj, const char* prevName);
+    bool getRec(long pos, libObj_t* obj);
+    bool appendRec(libObj_t* obj);
+    void rebuildBlock(int b, int dropSlot, int dropCat);
+    void indexBlock(int b, int sign);
+    inline bool isObject(libObj_t* obj) { return (obj->code>>4) == catalog && obj->name[0] != '$'; }
+    inline byte decDegs(libObj_t* obj) { return ((uint32_t)obj->Dec*180UL)>>24; }
+    inline double degRange(double d) { while (d >= 360.0) d-=360.0; while (d < 0.0)  d+=360.0; return d; }
+
+    byte blk[LIB_BLOCK_SIZE];       // the cached block
+    int blkNum;                     // block# in the cache, -1 if none
+    int endBlock;                   // last block records were added to, appending starts here
+
+    // RAM index
+    byte blockUsed[lib_blocks];     // bytes in use
+    byte blockRecs[lib_blocks];     // records (including deleted ones)
+    uint16_t blockCats[lib_blocks]; // bit n is set if catalog n has records here
+    byte blockDecMin[lib_blocks];   // declination range of the objects here, in degrees 0..180 (from -90)
+    byte blockDecMax[lib_blocks];
+    long catCount[15];              // object records (excluding the name record) for each catalog
+    long countAll;                  // records in use (index or otherwise)
+
+    int catalog;
+
+    long byteMin;
+    long byteMax;
+    long blocks;
+
+    libNearest near;
+};
+
+Library::Library()
+{
+  catalog=0;
+  blkNum=-1;
+  endBlock=0;
+
+  byteMin=200+pecBufferSize;
+  byteMax=GSB;
+
+  long byteCount=(byteMax-byteMin)+1;
+  if (byteCount < 0) byteCount=0;
+  if (byteCount > 262143) byteCount=262143; // maximum 256KB
+
+  blocks=byteCount/LIB_BLOCK_SIZE;
+  if (blocks > lib_blocks) blocks=lib_blocks;
+  recMax=blocks*LIB_BLOCK_RECS;
+
+  // the index is empty until init() scans NV
+  for (long b=0; b < lib_blocks; b++) { blockUsed[b]=0; blockRecs[b]=0; blockCats[b]=0; blockDecMin[b]=255; blockDecMax[b]=0; }
+  for (int c=0; c < 15; c++) catCount[c]=0;
+  countAll=0;
+}
+
+Library::~Library()
+{
+}
+
+void Library::init() {
+  // build the RAM index, a block that doesn't decode keeps the records it has up to the bad one and is
+  // left as is otherwise, it's marked full so nothing gets written over it until the library is cleared
+  bool bad=false;
+  for (int c=0; c < 15; c++) catCount[c]=0;
+  countAll=0;
+  endBlock=0;
+  for (int b=0; b < blocks; b++) {
+    indexBlock(b,1);
+    if (blockUsed[b] < LIB_BLOCK_SIZE && blk[blockUsed[b]] != LIB_END) { blockUsed[b]=LIB_BLOCK_SIZE; bad=true; }
+    if (blockRecs[b] > 0) endBlock=b;
+  }
+  if (bad) DLF("WRN, Lib.init(): library has blocks that don't decode, clear it (:L!#) to reuse them");
+
+  firstRec();
+}
+
+bool Library::setCatalog(int num)
+{
+  if (num < 0 || num > 14) return false;
+
+  catalog=num;
+  return firstRec();
+}
+
+void Library::writeVars(char* name, int code, double RA, double Dec)
+{
+  libObj_t obj;
+  int l;
+  for (l=0; l < 11 && name[l] != 0; l++) obj.name[l]=name[l]; obj.name[l]=0;
+  obj.code=(code | (catalog<<4));
+
+  // convert into ulong, RA=0..360
+  RA=degRange(RA)/360.0;
+  // convert into ulong, Dec=0..180
+  if (Dec > 90.0) Dec=90.0; if (Dec < -90.0) Dec=-90.0; Dec=Dec+90.0; Dec=Dec/180.0;
+  obj.RA=((uint32_t)round(RA*16777216.0)) & 0xFFFFFF;
+  obj.Dec=round(Dec*16777216.0); if (obj.Dec > 0xFFFFFF) obj.Dec=0xFFFFFF;
+
+  appendRec(&obj);
+}
+
+void Library::readVars(char* name, int* code, double* RA, double* Dec)
+{
+  libObj_t obj;
+
+  // empty? or not found
+  if (!getRec(recPos,&obj) || (obj.code>>4) != catalog) { name[0]=0; *code=0; *RA=0.0; *Dec=0.0; return; }
+
+  strcpy(name,obj.name);
+  *code=obj.code & 15;
+
+  // convert from ulong
+  *RA=(double)obj.RA;
+  *RA=(*RA/16777216.0)*360.0;
+  *Dec=(double)obj.Dec;
+  *Dec=((*Dec/16777216.0)*180.0)-90.0;
+}
+
+// read the current record in the standard 16 byte format, with advance to next record
+bool Library::readRawRec(libRec_t* data)
+{
+  libObj_t obj;
+  if (!getRec(recPos,&obj) || !isObject(&obj)) return false;
+
+  for (int l=0; l < 11; l++) data->libRec.name[l]=obj.name[l];
+  data->libRec.code=obj.code;
+  data->libRec.RA=((obj.RA+128)>>8) & 0xFFFF;
+  uint32_t d=(obj.Dec+128)>>8; if (d > 0xFFFF) d=0xFFFF;
+  data->libRec.Dec=d;
+
+  if (!nextRec()) recPos=recMax; // past the last record
+  return true;
+}
+
+// write a record in the standard 16 byte format (except for the catalog #)
+bool Library::writeRawRec(libRec_t data)
+{
+  libObj_t obj;
+  int l;
+  for (l=0; l < 11 && data.libRec.name[l] != 0; l++) obj.name[l]=data.libRec.name[l]; obj.name[l]=0;
+  obj.code=(data.libRec.code & 15) | (catalog<<4);
+  obj.RA=(uint32_t)data.libRec.RA<<8;
+  obj.Dec=(uint32_t)data.libRec.Dec<<8;
+  return appendRec(&obj);
+}
+
+void Library::loadBlock(int b)
+{
+  if (b == blkNum) return;
+  nv.readBytes(byteMin+(long)b*LIB_BLOCK_SIZE,blk,LIB_BLOCK_SIZE);
+  blkNum=b;
+}
+
+// write the first len bytes of the cached block (and the end marker) to NV
+void Library::storeBlock(int b, int len)
+{
+  if (len < LIB_BLOCK_SIZE) { blk[len]=LIB_END; len++; }
+  long l=byteMin+(long)b*LIB_BLOCK_SIZE;
+  for (int m=0; m < len; m++) nv.update(l+m,blk[m]);
+  blkNum=b;
+}
+
+// decode the cached block record at offset, obj holds the previous record on entry
+// returns the offset of the following record or -1 if there are no more
+int Library::decodeNext(int offset, libObj_t* obj)
+{
+  if (offset < 0 || offset+LIB_REC_MIN > LIB_BLOCK_SIZE || blk[offset] == LIB_END) return -1;
+  int p=blk[offset]>>4;
+  int n=blk[offset] & 15;
+  if (p+n > 11 || p > (int)strlen(obj->name) || offset+LIB_REC_MIN+n > LIB_BLOCK_SIZE) return -1;
+
+  obj->code=blk[offset+1];
+  obj->RA=(uint32_t)blk[offset+2] | ((uint32_t)blk[offset+3]<<8) | ((uint32_t)blk[offset+4]<<16);
+  obj->Dec=(uint32_t)blk[offset+5] | ((uint32_t)blk[offset+6]<<8) | ((uint32_t)blk[offset+7]<<16);
+  for (int l=0; l < n; l++) obj->name[p+l]=blk[offset+LIB_REC_MIN+l];
+  obj->name[p+n]=0;
+
+  return offset+LIB_REC_MIN+n;
+}
+
+// encode obj into dest (if not NULL) front-coded against prevName, returns the size in bytes
+int Library::encodeRec(byte* dest, libObj_t* obj, const char* prevName)
+{
+  int p=0;
+  while (p < 11 && obj->name[p] != 0 && obj->name[p] == prevName[p]) p++;
+  int n=strlen(obj->name)-p;
+
+  if (dest != NULL) {
+    dest[0]=(p<<4) | n;
+    dest[1]=obj->code;
+    dest[2]=obj->RA & 0xFF; dest[3]=(obj->RA>>8) & 0xFF; dest[4]=(obj->RA>>16) & 0xFF;
+    dest[5]=obj->Dec & 0xFF; dest[6]=(obj->Dec>>8) & 0xFF; dest[7]=(obj->Dec>>16) & 0xFF;
+    for (int l=0; l < n; l++) dest[LIB_REC_MIN+l]=obj->name[p+l];
+  }
+
+  return LIB_REC_MIN+n;
+}
+
+// get the record at pos, if it exists
+bool Library::getRec(long pos, libObj_t* obj)
+{
+  if (pos < 0 || pos >= recMax) return false;
+  int b=pos/LIB_BLOCK_RECS;
+  int s=pos%LIB_BLOCK_RECS;
+  if (s >= blockRecs[b]) return false;
+
+  loadBlock(b);
+  int offset=0;
+  obj->name[0]=0;
+  for (int l=0; l <= s; l++) offset=decodeNext(offset,obj);
+  return offset >= 0;
+}
+
+// add obj to the first block with room for it, starting where the last record went so a bulk upload
+// doesn't rescan the blocks it already filled, gaps earlier on are only used once the end is reached
+bool Library::appendRec(libObj_t* obj)
+{
+  int len=strlen(obj->name);
+  for (int i=0; i < blocks; i++) {
+    int b=(endBlock+i)%blocks;
+    int room=LIB_BLOCK_SIZE-blockUsed[b];
+    if (blockRecs[b] >= LIB_BLOCK_RECS || room < LIB_REC_MIN) continue;
+
+    // find the last record, this block's records are front-coded against it
+    libObj_t last;
+    last.name[0]=0;
+    if (room < LIB_REC_MIN+len || blockRecs[b] > 0) {
+      loadBlock(b);
+      int offset=0;
+      for (int l=0; l < blockRecs[b]; l++) offset=decodeNext(offset,&last);
+    }
+    if (encodeRec(NULL,obj,last.name) > room) continue;
+
+    loadBlock(b);
+    int size=encodeRec(&blk[blockUsed[b]],obj,last.name);
+    storeBlock(b,blockUsed[b]+size);
+
+    int cat=obj->code>>4;
+    recPos=(long)b*LIB_BLOCK_RECS+blockRecs[b];
+    blockUsed[b]+=size;
+    blockRecs[b]++;
+    endBlock=b;
+    if (cat != 15) {
+      blockCats[b]|=1<<cat;
+      if (obj->name[0] != '$') catCount[cat]++;
+      countAll++;
+    }
+    byte d=decDegs(obj);
+    if (d < blockDecMin[b]) blockDecMin[b]=d;
+    if (d+1 > blockDecMax[b]) blockDecMax[b]=d+1;
+    return true;
+  }
+  return false;
+}
+
+// rewrite a block without record dropSlot and without records for catalog dropCat (-1 for none)
+// if front-coding the remaining records against new neighbors won't fit they are marked deleted instead
+void Library::rebuildBlock(int b, int dropSlot, int dropCat)
+{
+  byte out[LIB_BLOCK_SIZE];
+  int len=0;
+
+  indexBlock(b,-1);
+  for (int attempt=0; attempt < 2; attempt++) {
+    libObj_t obj;
+    char last[12]="";
+    bool fits=true;
+    int offset=0;
+    obj.name[0]=0;
+    len=0;
+
+    for (int s=0; s < blockRecs[b]; s++) {
+      offset=decodeNext(offset,&obj); if (offset < 0) break;
+      int cat=obj.code>>4;
+      if (s == dropSlot || cat == dropCat || cat == 15) {
+        if (attempt == 0) continue;
+        obj.code|=0xF0;
+      }
+      int size=encodeRec(NULL,&obj,last);
+      if (len+size > LIB_BLOCK_SIZE) { fits=false; break; }
+      encodeRec(&out[len],&obj,last);
+      len+=size;
+      strcpy(last,obj.name);
+    }
+    if (fits) break;
+  }
+
+  memcpy(blk,out,len);
+  storeBlock(b,len);
+  indexBlock(b,1);
+}
+
+// add (sign=1) or remove (sign=-1) a block's records from the RAM index
+void Library::indexBlock(int b, int sign)
+{
+  libObj_t obj;
+  int offset=0, next;
+  int recs=0;
+  uint16_t cats=0;
+  byte decMin=255, decMax=0;
+
+  loadBlock(b);
+  obj.name[0]=0;
+  while (recs < LIB_BLOCK_RECS && (next=decodeNext(offset,&obj)) >= 0) {
+    int cat=obj.code>>4;
+    if (cat != 15) {
+      cats|=1<<cat;
+      if (obj.name[0] != '$') catCount[cat]+=sign;
+      countAll+=sign;
+      byte d=decDegs(&obj);
+      if (d < decMin) decMin=d;
+      if (d+1 > decMax) decMax=d+1;
+    }
+    offset=next;
+    recs++;
+  }
+
+  if (sign > 0) { blockUsed[b]=offset; blockRecs[b]=recs; blockCats[b]=cats; blockDecMin[b]=decMin; blockDecMax[b]=decMax; }
+}
+
+bool Library::firstRec()
+{
+  recPos=-1;
+  return nextRec();
+}
+
+// move to the catalog name rec
+bool Library::nameRec()
+{
+  libObj_t obj;
+  for (long pos=0; pos < recMax; pos++) {
+    int b=pos/LIB_BLOCK_RECS;
+    if (!(blockCats[b] & (1<<catalog))) { pos=(long)b*LIB_BLOCK_RECS+LIB_BLOCK_RECS-1; continue; }
+    if (getRec(pos,&obj) && (obj.code>>4) == catalog && obj.name[0] == '$') { recPos=pos; return true; }
+  }
+  recPos=recMax-1;
+  return false;
+}
+
+// move to first unused record, the writeVars() that follows will find room for any name
+bool Library::firstFreeRec()
+{
+  for (int b=0; b < blocks; b++) {
+    if (blockRecs[b] < LIB_BLOCK_RECS && LIB_BLOCK_SIZE-blockUsed[b] >= LIB_REC_MIN+11) { recPos=(long)b*LIB_BLOCK_RECS+blockRecs[b]; return true; }
+  }
+  recPos=recMax-1;
+  return false;
+}
+
+// read the previous record, if it exists
+bool Library::prevRec()
+{
+  libObj_t obj;
+  long pos=recPos;
+  while (true) {
+    pos--; if (pos < 0) break;
+    int b=pos/LIB_BLOCK_RECS;
+    int s=pos%LIB_BLOCK_RECS;
+    if (!(blockCats[b] & (1<<catalog))) { pos=(long)b*LIB_BLOCK_RECS; continue; }
+    if (s >= blockRecs[b]) { pos=(long)b*LIB_BLOCK_RECS+blockRecs[b]; continue; }
+    if (getRec(pos,&obj) && isObject(&obj)) { recPos=pos; return true; }
+  }
+  recPos=0;
+  return false;
+}
+
+// read the next record, if it exists
+bool Library::nextRec()
+{
+  libObj_t obj;
+  long pos=recPos;
+  while (true) {
+    pos++; if (pos >= recMax) break;
+    int b=pos/LIB_BLOCK_RECS;
+    int s=pos%LIB_BLOCK_RECS;
+    if (!(blockCats[b] & (1<<catalog)) || s >= blockRecs[b]) { pos=(long)b*LIB_BLOCK_RECS+LIB_BLOCK_RECS-1; continue; }
+    if (getRec(pos,&obj) && isObject(&obj)) { recPos=pos; return true; }
+  }
+  recPos=recMax-1;
+  return false;
+}
+
+// read the specified record (of this catalog), if it exists
+bool Library::gotoRec(long num)
+{
+  if (num > catCount[catalog]) return false;
+  if (num < 1) { recPos=0; return true; }
+
+  libObj_t obj;
+  long c=0;
+  for (long pos=0; pos < recMax; pos++) {
+    int b=pos/LIB_BLOCK_RECS;
+    int s=pos%LIB_BLOCK_RECS;
+    if (!(blockCats[b] & (1<<catalog)) || s >= blockRecs[b]) { pos=(long)b*LIB_BLOCK_RECS+LIB_BLOCK_RECS-1; continue; }
+    if (getRec(pos,&obj) && isObject(&obj)) c++;
+    if (c == num) { recPos=pos; return true; }
+  }
+  return false;
+}
+
+// count all catalog records
+long Library::recCount()
+{
+  return catCount[catalog];
+}
+
+// count all library records (index or otherwise)
+long Library::recCountAll()
+{
+  return countAll;
+}
+
+// library records available, estimated from the free space
+long Library::recFreeAll()
+{
+  long c=0;
+  for (int b=0; b < blocks; b++) {
+    int r=(LIB_BLOCK_SIZE-blockUsed[b])/LIB_REC_AVG;
+    if (r > LIB_BLOCK_RECS-blockRecs[b]) r=LIB_BLOCK_RECS-blockRecs[b];
+    c+=r;
+  }
+  return c;
+}
+
+// search blocks in passes of increasing distance between the target and their declination range,
+// stopping once no block left can hold a nearer object
+int Library::findNearest(double RA, double Dec, int n)
+{
+  const float passLimit[]={0.0, 2.0, 5.0, 10.0, 20.0, 45.0, 90.0, 180.0};
+  libObj_t obj;
+  double d=Dec+90.0;
+  float lower=-1.0;
+
+  near.reset(n);
+  for (int i=0; i < 8; i++) {
+    if (near.full() && near.worst() <= lower) break;
+    for (int b=0; b < blocks; b++) {
+      if (!(blockCats[b] & (1<<catalog))) continue;
+
+      // closest this block can be to the target
+      float bound=0.0;
+      if (d < blockDecMin[b]) bound=blockDecMin[b]-d; else if (d > blockDecMax[b]) bound=d-blockDecMax[b];
+      if (bound <= lower || bound > passLimit[i]) continue;
+      if (near.full() && bound > near.worst()) continue;
+
+      loadBlock(b);
+      int offset=0;
+      obj.name[0]=0;
+      for (int s=0; s < blockRecs[b]; s++) {
+        offset=decodeNext(offset,&obj); if (offset < 0) break;
+        if (!isObject(&obj)) continue;
+        double r=((double)obj.RA/16777216.0)*360.0;
+        double e=(((double)obj.Dec/16777216.0)*180.0)-90.0;
+        near.add((long)b*LIB_BLOCK_RECS+s,libAngDist(RA,Dec,r,e));
+      }
+    }
+    lower=passLimit[i];
+  }
+
+  return near.count;
+}
+
+bool Library::nextNearest(float* dist)
+{
+  if (near.next >= near.count) return false;
+  recPos=near.pos[near.next];
+  *dist=near.dist[near.next];
+  near.next++;
+  return true;
+}
+
+// remove this catalog record, the record that follows moves into its place
+void Library::clearCurrentRec()
+{
+  libObj_t obj;
+  if (!getRec(recPos,&obj) || (obj.code>>4) != catalog) return;
+  rebuildBlock(recPos/LIB_BLOCK_RECS,recPos%LIB_BLOCK_RECS,-1);
+  recPos--;
+}
+
+// remove all catalog records
+void Library::clearLib()
+{
+  for (int b=0; b < blocks; b++) {
+    if (blockCats[b] & (1<<catalog)) rebuildBlock(b,-1,catalog);
+  }
+}
+
+// remove all records
+void Library::clearAll()
+{
+  for (int b=0; b < blocks; b++) {
+    nv.write(byteMin+(long)b*LIB_BLOCK_SIZE,LIB_END);
+    blockUsed[b]=0; blockRecs[b]=0; blockCats[b]=0; blockDecMin[b]=255; blockDecMax[b]=0;
+  }
+  for (int c=0; c < 15; c++) catCount[c]=0;
+  countAll=0;
+  blkNum=-1;
+  endBlock=0;
+}
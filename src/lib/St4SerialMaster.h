@@ -20,8 +20,17 @@ Data is exchanged on clock edges similar to SPI so is timing insensitive (runs w
 One data byte is exchanged (in both directions w/basic error detection and recovery.)  A value 0x00 byte 
 means "no data" and is ignored on both sides.  Mega2560 hardware runs at (fastest) 10mS/byte (100 Bps) and 
 all others (Teensy3.x, etc.) at 2mS/byte (500 Bps.)
+
+Fast mode: an SHC that can keep up with a faster clock sends the ccFast control byte now and then.  When
+OnStep (not Mega2560) sees it the clock runs twice as fast and up to ST4_BURST byte pairs are exchanged
+back to back while there's data moving, each with the usual parity/check/frame bits.  Both sides drop
+back to normal mode on repeated errors and the SHC simply asks again.
 */
 
+#define ccFast 22
+#define ST4_BURST 4
+#define ST4_FAST_ERRORS 8
+
 #include "Stream.h"
 
 class Mst4 : public Stream
@@ -32,19 +41,29 @@ class Mst4 : public Stream
     
     void end();
 
-    // recvs one char and transmits one char to/from buffers; recvd chars < 32 are returned directly and bypass the buffer
+    // recvs one char and transmits one char to/from buffers (up to ST4_BURST of each in fast mode); recvd chars < 32 are returned directly and bypass the buffer
     inline char poll() {
-      char c=0;
-      if (trans(&c,_xmit_buffer[_xmit_head])) {
+      for (int n=0; n < ST4_BURST; n++) {
+        char c=0;
+        char out=_xmit_buffer[_xmit_head];
+        if (!trans(&c,out,n > 0)) return (char)0;
         // data going out was good?
         if (!_send_error) {
-          if (_xmit_buffer[_xmit_head] != (char)0) _xmit_head++;
+          if (out != (char)0) _xmit_head++;
         }
         // data coming in was good?
-        if (!_recv_error) {
-          if (c >= (char)32) { _recv_buffer[_recv_tail]=c; _recv_tail++; _recv_buffer[_recv_tail]=(char)0; return (char)0; } else return c;
-        } else return (char)0;
-      } else return (char)0;
+        if (_recv_error) return (char)0;
+        if (c == (char)ccFast) {
+          #ifndef HAL_SLOW_PROCESSOR
+            if (!_fast) { _fast=true; VLF("MSG: SerialST4 fast mode activated"); }
+          #endif
+          return (char)0;
+        }
+        if (c < (char)32) { if (c != (char)0) return c; } else { _recv_buffer[_recv_tail]=c; _recv_tail++; _recv_buffer[_recv_tail]=(char)0; }
+        // keep going only in fast mode and while data is moving
+        if (!_fast || _send_error || ((out == (char)0) && (c == (char)0))) return (char)0;
+      }
+      return (char)0;
     }
     
     virtual size_t write(uint8_t);
@@ -68,20 +87,24 @@ class Mst4 : public Stream
     volatile bool _frame_error      = false;
     volatile bool _send_error       = false;
     volatile bool _recv_error       = false;
+    volatile bool _fast             = false;
 
   private:
-    inline bool trans(char *data_in, uint8_t data_out)
+    // exchange a pair of data bytes, continued is true for the 2nd and later bytes of a fast mode burst
+    inline bool trans(char *data_in, uint8_t data_out, bool continued)
     {
       static unsigned long lastMicros=0;
 
       // SHC_CLOCK HIGH for more than 1500 us means that a pair of data bytes is done being exchanged
+      // after a good frame in fast mode the SHC is already waiting for the next start bit so a short gap is enough
       #ifdef HAL_SLOW_PROCESSOR
         #define XMIT_TIME 20
         if ((long)(micros()-lastMicros) < 10000L) return false;
       #else
         #define XMIT_TIME 40
-        if ((long)(micros()-lastMicros) < 2000L) return false;
+        if (!continued && (long)(micros()-lastMicros) < _gap) return false;
       #endif
+      const int xmitTime = _fast ? XMIT_TIME/2 : XMIT_TIME;
 
       uint8_t s_parity=0;
       uint8_t r_parity=0;
@@ -94,49 +117,50 @@ class Mst4 : public Stream
       // start bit
       digitalWrite(ST4DEs,LOW);                        // clock
       digitalWrite(ST4DEn,LOW);                        // send start bit
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
       digitalWrite(ST4DEs,HIGH);                       // clock
       if (digitalRead(ST4RAw) != LOW) _frame_error=true; // recv start bit
-      delayMicroseconds(XMIT_TIME);
-      if (_frame_error) { lastMicros=micros(); return false; }
+      delayMicroseconds(xmitTime);
+      if (_frame_error) { lastMicros=micros(); fastError(); return false; }
 
       for (int i=7; i >= 0; i--)
       {
         uint8_t state=bitRead(data_out,i); s_parity+=state;
         digitalWrite(ST4DEs,LOW);                      // clock
         digitalWrite(ST4DEn,state);                    // send data bit
-        delayMicroseconds(XMIT_TIME);
+        delayMicroseconds(xmitTime);
         digitalWrite(ST4DEs,HIGH);                     // clock
         state=digitalRead(ST4RAw); r_parity+=state;    // recv data bit
         bitWrite(*data_in,i,state);                    
-        delayMicroseconds(XMIT_TIME);
+        delayMicroseconds(xmitTime);
       }
       
       // parity bit
       digitalWrite(ST4DEs,LOW);                        // clock
       digitalWrite(ST4DEn,s_parity&1);                 // send parity bit
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
       digitalWrite(ST4DEs,HIGH);                       // clock
       if ((r_parity&1) != digitalRead(ST4RAw)) _recv_error=true; // recv parity bit
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
 
       // parity ck bit
       digitalWrite(ST4DEs,LOW);                        // clock
       digitalWrite(ST4DEn,_recv_error);                // send local parity check
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
       digitalWrite(ST4DEs,HIGH);                       // clock
       if (digitalRead(ST4RAw) == HIGH) _send_error=true; // recv remote parity, ok?
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
 
       // stop bit
       digitalWrite(ST4DEs,LOW);                        // clock
       digitalWrite(ST4DEn,LOW);                        // send
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
       digitalWrite(ST4DEs,HIGH);                       // clock
       if (digitalRead(ST4RAw) != LOW) _frame_error=true; // recv stop bit
-      delayMicroseconds(XMIT_TIME);
+      delayMicroseconds(xmitTime);
 
       lastMicros=micros();
+      if (_frame_error || _send_error || _recv_error) fastError(); else { _fast_errors=0; if (_fast) _gap=500L; }
 
       if (_frame_error) DLF("WRN, SerialST4.trans(): frame error");
       if (_send_error) DLF("WRN, SerialST4.trans(): send parity error");
@@ -145,10 +169,19 @@ class Mst4 : public Stream
       if (_frame_error) return false; else return true;
     }
 
+    // the SHC needs the clock idle for > 1500 us to resync after an error, too many in a row and fast mode is dropped
+    inline void fastError() {
+      _gap=2000L;
+      if (_fast) { _fast_errors++; if (_fast_errors >= ST4_FAST_ERRORS) { _fast=false; _fast_errors=0; VLF("MSG: SerialST4 fast mode deactivated"); } }
+    }
+
     byte _recv_head = 0;
+    long _gap = 2000L;
+    int _fast_errors = 0;
 };
 
 void Mst4::begin() {
+  _fast=false; _fast_errors=0; _gap=2000L;
   _xmit_head=0; _xmit_tail=0; _xmit_buffer[0]=0;
   _recv_head=0; _recv_tail=0; _recv_buffer[0]=0;
 }
@@ -158,6 +191,7 @@ void Mst4::begin(long baud) {
 }
 
 void Mst4::end() {
+  _fast=false;
   _xmit_head=0; _xmit_tail=0; _xmit_buffer[0]=0;
   _recv_head=0; _recv_tail=0; _recv_buffer[0]=0;
 }